@@ -32,6 +32,14 @@ constexpr char USER_ID[] =             "XXXXXXXX";
 // Sample access token corresponding to a free user account, to be replaced by yours.
 constexpr char USER_ACCESS_TOKEN[] =	"XXXXXXXXXXXXXXXXXXXXXXXXXXX";
 
+// Optional OAuth refresh token and token endpoint : when set, the access token is refreshed before it expires.
+constexpr char USER_REFRESH_TOKEN[] =	"";
+constexpr char OAUTH_TOKEN_URL[] =		"https://connect.deezer.com/oauth/access_token.php";
+constexpr char APP_SECRET[] =			"";
+
+// Expiry of USER_ACCESS_TOKEN (unix time), 0 if unknown or if it never expires.
+constexpr long long USER_ACCESS_TOKEN_EXPIRES = 0;
+
 // Set the user cache path, This path must already exist.
 constexpr char USER_CACHE_PATH[] =		"/var/tmp/XXXXXXXXXXXXXXXXXX";
 
@@ -0,0 +1,64 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * Glyphs pre-rasterized at build time (make_glyphs.py) as 4 bits coverage masks, two pixels per byte.
+ */
+struct bitmap_font
+{
+    struct glyph
+    {
+        uint16_t codepoint;
+        uint8_t width;
+        uint8_t height;
+        int8_t left;        ///< from the pen position
+        int8_t top;         ///< from the baseline, negative upwards
+        uint8_t advance;
+        uint32_t offset;    ///< first byte of the mask in alpha
+    };
+
+    int size;
+    int ascent;
+    int descent;
+    const glyph* glyphs;    ///< sorted by codepoint
+    size_t glyph_count;
+    const uint8_t* alpha;
+
+    // nullptr for codepoints outside of the rasterized set
+    const glyph* find( uint32_t codepoint ) const;
+    int text_width( const std::string& utf8 ) const;
+
+    // decodes the codepoint at index, moving index past it (U+FFFD for invalid sequences)
+    static uint32_t next_codepoint( const std::string& utf8, size_t& index );
+};
+
+extern const bitmap_font font_small;
+extern const bitmap_font font_large;
@@ -0,0 +1,2548 @@
+// generated by make_glyphs.py from OpenSans-Regular.ttf, do not edit
+
+#include "bitmap_font.h"
+
+namespace {
+
+const uint8_t font_small_alpha[] = {
+    160,14,144,13,128,13,128,12,112,11,96,11,96,10,80,9,64,9,0,1,176,14,144,13,224,23,95,208,6,78,176,5,
+    61,160,3,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,15,144,
+    6,0,64,13,192,4,0,96,10,224,2,0,144,8,226,0,240,255,255,255,239,0,224,2,136,0,0,211,0,76,0,249,
+    255,255,255,95,0,121,48,13,0,0,76,80,11,0,0,46,128,8,0,16,14,160,6,0,0,0,30,0,0,112,253,206,
+    7,128,77,62,69,0,140,224,1,0,144,45,30,0,0,177,255,22,0,0,48,238,78,0,0,224,145,14,0,0,30,244,
+    1,72,226,197,10,144,237,207,23,0,0,224,1,0,0,0,30,0,0,64,237,6,0,225,2,0,77,226,2,144,8,0,
+    225,0,90,32,30,0,32,14,144,7,122,0,0,225,0,106,227,1,0,0,76,226,178,87,221,5,48,237,71,29,62,227,
+    1,0,0,107,211,0,76,0,0,212,64,12,176,5,0,192,5,211,0,76,0,80,12,0,62,226,1,0,77,0,64,221,
+    5,0,178,238,8,0,0,0,172,66,94,0,0,0,79,0,139,0,0,0,141,32,94,0,0,0,244,232,9,0,0,0,
+    210,159,0,0,0,48,158,248,4,128,12,192,10,128,79,208,7,241,4,0,248,233,1,240,6,0,176,143,0,144,110,67,
+    249,235,4,16,216,239,58,144,62,224,7,208,6,176,5,160,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,229,1,209,6,96,14,0,155,0,240,5,48,47,0,244,1,80,15,0,244,1,48,47,0,241,5,0,156,0,96,
+    14,0,225,6,0,229,1,227,2,0,170,0,48,47,0,208,7,0,185,0,96,14,0,245,0,64,31,0,245,0,96,14,
+    0,185,0,208,8,48,47,0,186,0,227,2,0,0,80,31,0,0,0,243,0,0,162,54,61,167,32,185,253,172,25,0,
+    209,171,0,0,160,28,126,0,16,90,112,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,21,0,0,0,240,2,0,0,0,47,0,0,0,240,2,0,243,255,255,255,5,17,
+    241,19,1,0,0,47,0,0,0,240,2,0,0,0,22,0,0,0,0,0,0,192,11,224,7,242,1,166,0,245,255,24,
+    51,19,0,0,0,0,0,0,0,0,0,1,160,14,144,13,0,0,139,0,32,63,0,112,12,0,192,7,0,243,2,0,
+    184,0,0,109,0,64,31,0,144,10,0,224,5,0,229,1,0,154,0,0,0,197,223,6,0,244,39,230,5,176,9,0,
+    199,0,95,0,48,47,242,3,0,241,52,47,0,0,95,243,2,0,240,37,63,0,16,79,224,5,0,243,2,154,0,112,
+    13,48,127,82,110,0,64,252,109,0,0,64,158,0,0,128,205,9,0,64,27,154,0,0,0,160,9,0,0,0,154,0,
+    0,0,160,9,0,0,0,154,0,0,0,160,9,0,0,0,154,0,0,0,160,9,0,0,0,154,0,0,0,160,9,0,
+    32,233,206,5,0,156,36,246,5,16,0,0,170,0,0,0,144,11,0,0,0,140,0,0,0,245,2,0,0,227,7,0,
+    0,210,9,0,0,210,9,0,0,209,9,0,0,193,60,51,51,49,255,255,255,79,48,234,223,7,16,140,36,229,7,0,
+    0,0,200,0,0,0,160,11,0,0,114,78,0,128,255,93,0,0,33,115,126,0,0,0,80,31,0,0,0,243,3,0,
+    0,96,31,147,36,99,158,32,217,239,108,0,0,0,144,47,0,0,64,253,2,0,16,109,47,0,0,169,242,2,0,228,
+    33,47,0,209,5,242,2,160,10,32,47,80,30,0,242,2,250,255,255,255,44,51,51,244,37,0,0,32,47,0,0,0,
+    242,2,64,255,255,111,0,213,51,51,1,112,11,0,0,0,168,0,0,0,144,9,0,0,0,234,238,125,1,16,36,99,
+    190,0,0,0,80,47,0,0,0,242,3,0,0,80,31,144,53,99,142,0,216,238,92,0,0,80,236,111,0,128,110,34,
+    2,64,79,0,0,0,186,0,0,0,208,7,0,0,0,111,234,174,2,241,109,33,218,16,111,0,16,79,224,5,0,224,
+    5,154,0,32,63,32,142,66,188,0,48,251,157,1,244,255,255,255,21,51,51,99,63,0,0,0,185,0,0,0,225,5,
+    0,0,112,13,0,0,0,125,0,0,0,229,1,0,0,192,9,0,0,48,63,0,0,0,186,0,0,0,242,5,0,0,
+    128,13,0,0,0,215,223,24,0,231,20,212,9,176,8,0,214,0,170,0,128,12,48,158,114,62,0,48,255,63,0,48,
+    158,164,78,0,141,0,112,30,242,2,0,240,20,79,0,32,63,160,76,49,188,0,129,253,157,1,0,215,206,5,0,231,
+    37,230,5,224,5,0,214,32,47,0,16,47,241,4,0,242,4,202,19,196,79,16,233,190,244,3,0,0,64,31,0,0,
+    0,216,0,0,0,225,7,16,34,213,11,0,244,207,7,0,160,13,160,14,0,1,0,0,0,0,0,0,0,1,160,14,
+    144,13,160,13,160,14,0,1,0,0,0,0,0,0,0,0,176,11,224,7,242,1,166,0,0,0,0,146,5,0,16,232,
+    25,0,129,158,2,16,232,24,0,0,226,75,0,0,0,96,220,22,0,0,0,180,142,1,0,0,48,89,0,0,0,0,
+    0,0,0,0,0,241,255,255,255,3,17,17,17,1,16,17,17,17,16,255,255,255,63,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,163,2,0,0,16,232,41,0,0,0,129,158,2,0,0,16,231,25,0,0,48,234,3,
+    0,197,125,1,113,206,5,0,48,74,0,0,0,0,0,0,0,0,0,0,0,0,180,238,76,96,72,131,46,0,0,208,
+    6,0,0,109,0,0,246,2,0,245,5,0,227,5,0,144,8,0,0,75,0,0,16,0,0,16,158,0,0,209,8,0,
+    0,0,164,237,190,5,0,0,144,109,2,81,173,0,0,169,1,0,0,177,7,64,29,64,252,174,32,14,144,7,226,5,
+    213,0,76,208,3,153,0,213,0,106,240,1,107,0,198,0,106,240,1,107,0,184,0,61,224,3,199,33,220,81,13,160,
+    8,161,222,115,206,2,48,62,0,0,0,0,0,0,230,55,17,115,3,0,0,48,217,239,157,2,0,0,0,202,0,0,
+    0,0,241,62,0,0,0,96,172,9,0,0,0,124,229,0,0,0,243,2,94,0,0,128,11,144,10,0,0,110,0,244,
+    1,0,245,255,255,127,0,160,58,51,147,12,16,79,0,0,243,3,215,0,0,0,140,192,8,0,0,112,14,96,255,255,
+    157,1,96,46,50,230,11,96,14,0,96,31,96,14,0,80,15,96,14,16,195,8,96,255,255,143,0,96,46,34,197,11,
+    96,14,0,32,95,96,14,0,0,127,96,14,0,48,95,96,46,50,213,29,96,255,255,157,1,0,48,218,239,75,0,246,
+    90,83,57,32,143,0,0,0,144,13,0,0,0,208,9,0,0,0,240,7,0,0,0,240,6,0,0,0,208,8,0,0,
+    0,160,13,0,0,0,64,127,0,0,0,0,248,74,67,23,0,80,235,239,27,96,255,255,141,1,0,96,46,50,198,62,
+    0,96,14,0,0,219,0,96,14,0,0,242,5,96,14,0,0,208,8,96,14,0,0,176,10,96,14,0,0,176,10,96,
+    14,0,0,208,8,96,14,0,0,243,4,96,14,0,16,204,0,96,46,50,215,45,0,96,255,239,124,1,0,96,255,255,
+    239,0,230,51,51,3,96,14,0,0,0,230,0,0,0,96,14,0,0,0,246,255,255,10,96,62,51,35,0,230,0,0,
+    0,96,14,0,0,0,230,0,0,0,96,62,51,51,0,246,255,255,14,96,255,255,239,96,62,51,51,96,14,0,0,96,
+    14,0,0,96,14,0,0,96,14,0,0,96,255,255,175,96,62,51,35,96,14,0,0,96,14,0,0,96,14,0,0,96,
+    14,0,0,0,32,216,238,157,1,0,228,91,67,166,0,32,158,0,0,0,0,128,13,0,0,0,0,208,8,0,0,0,
+    0,224,6,0,0,0,0,240,6,0,246,255,7,208,8,0,49,211,7,160,13,0,0,208,7,48,127,0,0,208,7,0,
+    247,90,51,229,7,0,64,234,239,173,3,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,
+    0,241,4,96,14,0,0,241,4,96,255,255,255,255,4,96,62,51,51,244,4,96,14,0,0,241,4,96,14,0,0,241,
+    4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,96,14,96,14,96,14,96,14,96,14,96,
+    14,96,14,96,14,96,14,96,14,96,14,0,128,12,0,128,12,0,128,12,0,128,12,0,128,12,0,128,12,0,128,12,
+    0,128,12,0,128,12,0,128,12,0,128,12,0,128,12,0,144,11,65,229,6,227,142,0,96,14,0,80,79,96,14,0,
+    244,5,96,14,32,126,0,96,14,209,9,0,96,30,172,0,0,96,174,79,0,0,96,191,218,1,0,96,14,209,10,0,
+    96,14,64,111,0,96,14,0,232,2,96,14,0,192,11,96,14,0,32,126,96,14,0,0,96,14,0,0,96,14,0,0,
+    96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,62,51,51,
+    96,255,255,239,96,191,0,0,0,244,13,96,253,2,0,0,218,13,96,219,7,0,16,158,13,96,124,13,0,96,108,13,
+    96,44,63,0,176,119,13,96,12,155,0,242,114,13,96,12,230,0,183,112,13,96,12,225,5,93,112,13,96,12,160,58,
+    30,112,13,96,12,64,175,9,112,13,96,12,0,254,4,112,13,96,12,0,216,0,112,13,96,111,0,0,176,8,96,239,
+    1,0,176,8,96,219,9,0,176,8,96,75,79,0,176,8,96,12,218,0,176,8,96,12,226,7,176,8,96,12,96,47,
+    176,8,96,12,0,188,176,8,96,12,0,243,181,8,96,12,0,144,190,8,96,12,0,16,253,8,96,12,0,0,245,8,
+    0,80,235,223,24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,
+    0,0,0,126,240,6,0,0,0,126,208,8,0,0,16,95,160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,
+    220,1,0,80,235,223,24,0,96,255,239,75,0,96,46,67,250,4,96,14,0,192,10,96,14,0,144,12,96,14,0,192,
+    10,96,14,33,249,3,96,255,255,76,0,96,46,18,0,0,96,14,0,0,0,96,14,0,0,0,96,14,0,0,0,96,
+    14,0,0,0,0,80,235,223,24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,
+    16,95,240,6,0,0,0,126,240,6,0,0,0,110,208,8,0,0,16,95,160,12,0,0,80,31,64,95,0,0,193,10,
+    0,248,72,83,220,1,0,80,235,255,25,0,0,0,0,209,11,0,0,0,0,48,159,0,0,0,0,0,247,6,96,255,
+    239,92,0,96,62,67,249,4,96,14,0,192,10,96,14,0,144,12,96,14,0,176,10,96,14,16,247,3,96,255,255,61,
+    0,96,46,130,30,0,96,14,16,142,0,96,14,0,246,2,96,14,0,192,11,96,14,0,64,95,0,215,239,91,0,233,
+    54,132,5,224,7,0,0,0,126,0,0,0,160,61,0,0,0,161,191,5,0,0,48,249,44,0,0,0,210,11,0,0,
+    0,246,0,0,0,112,14,146,53,115,126,16,218,239,92,0,253,255,255,255,43,51,246,52,35,0,64,31,0,0,0,244,
+    1,0,0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,0,64,31,
+    0,0,0,244,1,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,
+    0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,
+    217,0,0,234,55,148,79,0,0,112,253,190,4,0,156,0,0,16,95,231,0,0,96,30,242,4,0,176,10,192,9,0,
+    241,5,112,14,0,230,0,32,79,0,172,0,0,156,32,79,0,0,231,112,14,0,0,242,179,9,0,0,176,248,4,0,
+    0,96,238,0,0,0,16,159,0,0,186,0,0,248,3,0,224,103,14,0,192,127,0,48,63,242,3,16,159,12,0,230,
+    0,125,0,229,243,1,160,11,160,11,144,10,94,0,126,0,230,0,110,160,10,242,3,32,63,243,2,229,96,14,0,208,
+    119,12,16,79,169,0,0,170,138,0,192,215,6,0,96,221,4,0,183,63,0,0,242,14,0,48,239,0,0,0,189,0,
+    0,224,10,0,230,2,0,192,9,176,10,0,230,1,32,79,16,94,0,0,216,144,11,0,0,209,234,2,0,0,80,143,
+    0,0,0,144,206,0,0,0,243,227,7,0,0,140,96,46,0,96,29,0,172,0,225,5,0,243,4,186,0,0,144,13,
+    187,0,0,176,59,63,0,48,63,176,11,0,171,0,243,3,244,2,0,186,176,9,0,48,127,47,0,0,160,159,0,0,
+    0,243,3,0,0,48,47,0,0,0,243,2,0,0,48,47,0,0,0,243,2,0,243,255,255,255,5,51,51,163,46,0,
+    0,32,127,0,0,0,203,0,0,0,245,3,0,0,225,9,0,0,144,29,0,0,64,95,0,0,0,189,0,0,0,231,
+    2,0,0,242,57,51,51,82,255,255,255,143,176,255,13,171,17,176,9,0,155,0,176,9,0,155,0,176,9,0,155,0,
+    176,9,0,155,0,176,9,0,155,0,176,9,0,171,18,176,255,13,170,0,0,228,1,0,224,5,0,144,11,0,48,31,
+    0,0,109,0,0,200,0,0,242,2,0,192,7,0,112,13,0,32,63,0,0,139,249,255,16,97,15,0,245,0,80,15,
+    0,245,0,80,15,0,245,0,80,15,0,245,0,80,15,0,245,0,80,15,0,245,16,98,15,249,255,0,0,112,12,0,
+    0,0,237,4,0,0,196,182,0,0,176,6,62,0,32,30,112,10,0,152,0,225,2,225,3,0,153,96,12,0,32,30,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,255,255,63,0,0,0,0,0,
+    0,176,13,0,0,0,226,6,0,0,0,211,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,217,222,7,0,
+    145,36,246,5,0,0,0,140,0,0,0,160,9,32,201,238,159,16,173,3,176,9,243,2,0,157,16,143,50,250,9,80,
+    253,125,151,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,122,253,76,0,144,174,35,
+    248,2,144,14,0,192,9,144,11,0,128,12,144,10,0,112,13,144,11,0,128,12,144,14,0,192,9,144,190,35,248,2,
+    144,118,253,76,0,0,196,239,11,64,143,67,6,192,10,0,0,240,5,0,0,241,4,0,0,240,5,0,0,192,10,0,
+    0,80,143,51,6,0,197,239,10,0,0,0,208,7,0,0,0,208,7,0,0,0,208,7,0,0,0,208,7,0,214,223,
+    197,7,80,127,66,236,7,192,10,0,243,7,240,5,0,224,7,241,4,0,208,7,240,5,0,224,7,192,9,0,242,7,
+    80,127,66,236,7,0,214,223,165,7,0,196,223,7,0,244,39,229,6,176,10,0,216,0,111,0,80,31,241,255,255,255,
+    2,111,17,17,1,192,9,0,0,0,244,56,83,7,0,180,254,125,0,0,195,222,0,208,41,3,32,47,0,0,243,1,
+    0,231,239,62,16,244,18,0,64,31,0,0,244,1,0,64,31,0,0,244,1,0,64,31,0,0,244,1,0,64,31,0,
+    0,16,217,255,239,5,201,1,231,1,224,5,0,79,0,95,0,240,4,160,27,112,29,0,209,239,59,0,64,29,0,0,
+    0,183,1,0,0,48,255,255,109,48,93,51,115,47,153,0,0,241,116,61,16,163,13,128,253,223,25,0,144,10,0,0,
+    0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,106,237,92,0,144,190,35,248,3,144,30,0,208,6,144,
+    11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,80,6,128,
+    9,0,0,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,0,101,0,128,9,0,0,0,144,10,0,
+    169,0,144,10,0,169,0,144,10,0,169,0,144,10,0,169,0,144,10,0,169,0,160,10,34,125,192,190,1,144,10,0,
+    0,0,169,0,0,0,144,10,0,0,0,169,0,0,0,144,10,16,141,0,169,16,156,0,144,10,186,0,0,169,200,1,
+    0,144,253,30,0,0,217,212,11,0,144,10,244,7,0,169,0,247,3,144,10,0,219,1,144,10,144,10,144,10,144,10,
+    144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,153,254,76,197,223,7,0,249,58,195,239,37,246,
+    4,144,30,0,244,6,0,140,0,185,0,48,63,0,176,9,144,10,0,243,2,0,155,0,169,0,48,47,0,176,9,144,
+    10,0,243,2,0,155,0,169,0,48,47,0,176,9,144,10,0,243,2,0,155,0,144,104,253,92,0,144,190,36,248,3,
+    144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,
+    0,192,8,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,160,
+    10,176,10,0,225,6,48,143,50,219,1,0,180,238,42,0,144,119,253,76,0,144,174,51,249,2,144,30,0,192,9,144,
+    11,0,128,12,144,10,0,112,13,144,11,0,128,12,144,14,0,208,9,144,190,51,249,2,144,121,253,76,0,144,10,0,
+    0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,0,214,207,165,7,64,127,66,236,7,192,10,0,243,7,
+    224,5,0,224,7,241,4,0,208,7,240,5,0,224,7,192,9,0,242,7,80,127,66,236,7,0,214,207,213,7,0,0,
+    0,208,7,0,0,0,208,7,0,0,0,208,7,0,0,0,208,7,144,71,253,3,185,93,20,144,63,0,0,201,0,0,
+    144,10,0,0,169,0,0,144,10,0,0,169,0,0,144,10,0,0,48,235,206,5,224,40,98,4,241,3,0,0,176,109,
+    1,0,0,214,142,0,0,0,212,9,0,0,96,13,162,36,195,9,161,253,157,1,32,11,0,112,12,0,249,255,79,128,
+    12,0,128,12,0,128,12,0,128,12,0,128,12,0,112,12,0,80,79,18,0,233,78,176,9,0,208,7,176,9,0,208,
+    7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,
+    215,207,165,7,140,0,0,216,112,14,0,208,7,242,4,64,47,0,155,0,185,0,96,14,224,6,0,225,68,31,0,0,
+    154,169,0,0,64,222,5,0,0,224,14,0,0,170,0,144,47,0,243,98,14,0,238,6,112,13,242,2,227,168,0,154,
+    0,110,128,75,14,224,5,160,10,108,224,52,47,0,214,242,2,154,214,0,32,143,12,96,173,9,0,208,126,0,241,94,
+    0,0,249,3,0,252,1,0,243,4,0,141,0,216,1,216,1,0,156,243,3,0,48,223,8,0,0,176,47,0,0,80,
+    206,10,0,16,126,226,5,0,202,0,230,2,229,2,0,187,0,156,0,0,216,96,14,0,208,8,241,5,48,47,0,170,
+    0,200,0,64,31,208,6,0,208,54,31,0,0,184,184,0,0,32,223,5,0,0,176,30,0,0,0,170,0,0,0,242,
+    4,0,32,178,11,0,0,236,27,0,0,0,241,255,255,11,0,32,126,0,0,202,0,0,229,2,0,225,7,0,160,12,
+    0,80,46,0,16,126,0,0,245,255,255,13,0,96,125,0,244,39,0,200,0,0,185,0,0,185,0,0,169,0,65,110,
+    0,248,8,0,65,110,0,0,170,0,0,185,0,0,185,0,0,200,0,0,244,39,0,96,125,0,32,15,0,0,0,242,
+    0,0,0,32,15,0,0,0,242,0,0,0,32,15,0,0,0,242,0,0,0,32,15,0,0,0,242,0,0,0,32,15,
+    0,0,0,242,0,0,0,32,15,0,0,0,242,0,0,0,32,15,0,0,0,242,0,0,0,32,15,0,0,0,242,0,
+    0,0,32,15,0,0,214,7,0,97,95,0,0,155,0,0,170,0,0,170,0,0,169,0,0,229,21,0,112,159,0,229,
+    21,0,169,0,0,170,0,0,170,0,0,155,0,97,95,0,214,7,0,145,238,73,114,52,40,148,237,27,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,12,160,14,0,1,80,8,80,9,96,10,112,
+    10,112,11,128,12,144,12,144,13,160,14,0,0,166,0,0,16,232,223,6,0,219,53,53,0,243,3,0,0,96,14,0,
+    0,0,215,0,0,0,96,14,0,0,0,243,3,0,0,0,220,53,85,0,16,233,223,6,0,0,150,0,0,0,96,9,
+    0,0,112,237,157,0,96,78,66,7,0,140,0,0,0,224,6,0,0,0,110,0,0,0,224,6,0,0,247,255,255,11,
+    0,224,6,0,0,0,110,0,0,0,241,4,0,0,161,60,51,51,130,255,255,255,143,48,0,0,48,0,187,236,172,12,
+    32,94,48,93,0,135,0,96,9,112,8,0,166,0,226,21,212,5,160,203,223,202,0,3,0,0,4,0,0,0,0,0,
+    0,0,0,0,215,0,0,176,25,110,0,64,47,96,30,0,140,0,208,7,228,1,0,229,193,7,0,0,188,13,0,128,
+    255,255,175,0,0,241,3,0,0,16,63,0,0,248,255,255,10,0,16,63,0,0,0,241,3,0,0,32,15,0,0,0,
+    242,0,0,0,32,15,0,0,0,242,0,0,0,32,15,0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,242,0,0,0,32,15,0,0,0,242,0,0,0,32,15,0,0,0,242,
+    0,0,0,32,15,0,0,16,234,223,9,160,42,49,5,192,8,0,0,80,175,4,0,48,189,206,2,192,6,161,13,208,
+    5,16,47,112,110,64,14,0,214,254,5,0,0,213,12,0,0,48,47,112,19,146,13,160,254,174,2,0,166,112,10,0,
+    96,10,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,200,204,58,0,0,64,109,0,48,123,0,32,44,
+    145,238,8,90,0,74,144,43,49,16,12,192,16,63,0,0,128,37,10,243,0,0,0,117,162,48,15,0,0,80,7,12,
+    241,2,0,0,88,160,4,170,17,2,193,0,194,18,234,126,160,6,0,196,5,0,179,7,0,0,129,204,172,3,0,176,
+    220,6,16,32,13,161,187,13,150,48,13,210,156,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,195,33,28,32,94,209,6,210,22,140,0,210,23,140,0,32,94,209,7,0,195,33,28,0,0,0,0,243,
+    255,255,255,5,17,17,17,92,0,0,0,176,5,0,0,0,91,0,0,0,0,0,0,0,0,0,245,255,24,51,19,0,
+    0,0,0,0,0,0,0,0,16,200,204,58,0,0,64,109,0,48,123,0,32,44,248,223,4,90,0,74,128,10,215,16,
+    12,192,0,168,32,15,128,37,10,128,10,200,0,117,162,0,248,239,2,80,7,12,128,26,78,0,88,160,4,168,112,12,
+    193,0,194,130,10,209,166,6,0,196,5,0,179,7,0,0,129,204,172,3,0,241,255,255,255,31,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,235,26,0,91,112,9,208,0,193,
+    0,91,112,9,32,236,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,21,0,0,0,240,2,0,0,0,47,0,0,0,240,2,0,243,255,255,255,5,17,241,19,1,0,0,47,0,0,
+    0,240,2,0,0,0,22,0,48,255,255,255,95,16,17,17,17,0,178,221,4,66,80,12,0,64,11,0,193,4,16,92,
+    0,193,4,0,249,238,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,221,5,34,80,13,0,112,10,144,
+    237,5,0,48,31,3,48,14,216,205,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,1,0,0,
+    243,4,0,0,176,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,10,0,192,8,144,10,0,192,8,144,
+    10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,208,8,144,12,0,242,8,144,127,66,252,8,144,203,223,
+    151,8,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,0,216,255,221,11,144,255,255,35,11,
+    224,255,255,35,11,241,255,255,35,11,241,255,255,35,11,224,255,255,35,11,144,255,255,35,11,16,217,238,35,11,0,0,
+    176,35,11,0,0,176,35,11,0,0,176,35,11,0,0,176,35,11,0,0,176,35,11,0,0,176,35,11,0,0,176,35,
+    11,144,13,160,14,0,1,0,0,0,0,0,0,0,0,160,3,144,44,0,91,201,26,64,205,0,178,198,0,0,196,0,
+    0,196,0,0,196,0,0,196,0,0,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,204,8,180,0,
+    75,119,0,120,180,0,75,128,204,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,194,
+    18,44,0,112,29,214,2,0,200,113,29,0,201,129,29,112,29,214,2,194,18,44,0,0,0,0,0,64,189,0,0,212,
+    0,179,182,0,0,77,0,0,180,0,112,10,0,0,180,0,225,2,0,0,180,0,137,0,0,0,180,48,29,192,10,0,
+    180,192,5,200,10,0,0,182,80,122,10,0,16,61,194,113,10,0,128,8,232,238,159,0,210,1,0,112,10,0,107,0,
+    0,112,10,96,142,0,0,92,0,150,136,0,96,11,0,0,136,0,209,3,0,0,136,0,136,0,0,0,136,32,29,0,
+    0,0,136,176,86,220,27,0,136,197,64,1,107,0,16,61,0,0,90,0,128,9,0,80,12,0,226,1,0,196,1,0,
+    122,0,80,28,0,64,13,0,240,238,174,197,221,4,0,128,9,48,2,198,0,32,30,0,0,129,9,0,107,0,0,218,
+    78,0,197,0,0,0,48,14,208,3,0,48,0,228,112,10,243,4,216,205,36,30,193,77,0,0,0,122,160,212,4,0,
+    0,212,112,7,77,0,0,192,4,237,254,78,0,96,10,0,0,77,0,16,46,0,0,208,4,0,160,12,0,0,219,0,
+    0,0,1,0,0,150,0,0,160,7,0,112,46,0,112,62,0,48,79,0,0,184,0,0,128,11,0,0,243,55,132,4,
+    197,223,58,0,243,6,0,0,0,0,216,0,0,0,0,0,122,0,0,0,0,0,0,0,0,0,0,202,0,0,0,0,
+    241,62,0,0,0,96,172,9,0,0,0,124,229,0,0,0,243,2,94,0,0,128,11,144,10,0,0,110,0,244,1,0,
+    245,255,255,127,0,160,58,51,147,12,16,79,0,0,243,3,215,0,0,0,140,192,8,0,0,112,14,0,0,160,30,0,
+    0,0,32,79,0,0,0,0,123,0,0,0,0,0,0,0,0,0,0,202,0,0,0,0,241,62,0,0,0,96,172,9,
+    0,0,0,124,229,0,0,0,243,2,94,0,0,128,11,144,10,0,0,110,0,244,1,0,245,255,255,127,0,160,58,51,
+    147,12,16,79,0,0,243,3,215,0,0,0,140,192,8,0,0,112,14,0,16,222,1,0,0,0,169,154,0,0,0,182,
+    17,107,0,0,0,0,0,0,0,0,0,202,0,0,0,0,241,62,0,0,0,96,172,9,0,0,0,124,229,0,0,0,
+    243,2,94,0,0,128,11,144,10,0,0,110,0,244,1,0,245,255,255,127,0,160,58,51,147,12,16,79,0,0,243,3,
+    215,0,0,0,140,192,8,0,0,112,14,0,228,92,195,0,0,192,83,236,4,0,0,0,0,0,0,0,0,160,12,0,
+    0,0,16,239,3,0,0,0,198,154,0,0,0,192,87,14,0,0,48,47,224,5,0,0,184,0,169,0,0,224,6,64,
+    31,0,80,255,255,255,7,0,170,51,51,201,0,241,4,0,48,63,112,13,0,0,192,8,140,0,0,0,231,0,0,209,
+    18,45,0,0,16,45,209,2,0,0,0,0,0,0,0,0,160,12,0,0,0,16,239,3,0,0,0,198,154,0,0,0,
+    192,87,14,0,0,48,47,224,5,0,0,184,0,169,0,0,224,6,64,31,0,80,255,255,255,7,0,170,51,51,201,0,
+    241,4,0,48,63,112,13,0,0,192,8,140,0,0,0,231,0,0,64,204,5,0,0,0,73,178,0,0,0,64,255,5,
+    0,0,0,241,62,0,0,0,96,172,9,0,0,0,124,229,0,0,0,243,2,94,0,0,128,11,144,10,0,0,110,0,
+    244,1,0,245,255,255,127,0,160,58,51,147,12,16,79,0,0,243,3,215,0,0,0,140,192,8,0,0,112,14,0,0,
+    0,252,255,255,255,0,0,0,244,212,57,51,3,0,0,176,10,125,0,0,0,0,32,63,208,7,0,0,0,0,201,0,
+    125,0,0,0,0,241,5,208,255,255,11,0,128,13,0,157,51,35,0,16,254,255,255,7,0,0,0,230,51,51,125,0,
+    0,0,208,8,0,208,7,0,0,80,31,0,0,157,51,51,0,156,0,0,208,255,255,15,0,48,218,239,75,0,246,90,
+    83,57,32,143,0,0,0,144,13,0,0,0,208,9,0,0,0,240,7,0,0,0,240,6,0,0,0,208,8,0,0,0,
+    160,13,0,0,0,64,127,0,0,0,0,248,74,67,23,0,80,235,239,27,0,0,160,3,0,0,0,144,44,0,0,0,
+    0,91,0,0,0,201,27,0,0,244,5,0,0,0,201,0,0,0,0,107,0,0,0,0,0,0,96,255,255,239,0,230,
+    51,51,3,96,14,0,0,0,230,0,0,0,96,14,0,0,0,246,255,255,10,96,62,51,35,0,230,0,0,0,96,14,
+    0,0,0,230,0,0,0,96,62,51,51,0,246,255,255,14,0,0,243,6,0,0,160,11,0,0,64,29,0,0,0,0,
+    0,0,96,255,255,239,0,230,51,51,3,96,14,0,0,0,230,0,0,0,96,14,0,0,0,246,255,255,10,96,62,51,
+    35,0,230,0,0,0,96,14,0,0,0,230,0,0,0,96,62,51,51,0,246,255,255,14,0,64,159,0,0,16,125,77,
+    0,0,123,48,45,0,0,0,0,0,96,255,255,239,0,230,51,51,3,96,14,0,0,0,230,0,0,0,96,14,0,0,
+    0,246,255,255,10,96,62,51,35,0,230,0,0,0,96,14,0,0,0,230,0,0,0,96,62,51,51,0,246,255,255,14,
+    0,196,80,12,0,64,12,180,0,0,0,0,0,0,246,255,255,14,96,62,51,51,0,230,0,0,0,96,14,0,0,0,
+    230,0,0,0,96,255,255,175,0,230,51,51,2,96,14,0,0,0,230,0,0,0,96,14,0,0,0,230,51,51,3,96,
+    255,255,239,0,219,0,226,5,64,13,0,0,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,
+    96,14,96,14,0,245,4,208,8,96,11,0,0,0,96,14,0,230,0,96,14,0,230,0,96,14,0,230,0,96,14,0,
+    230,0,96,14,0,230,0,96,14,0,230,0,0,252,2,112,140,12,211,1,137,0,0,0,0,230,0,0,230,0,0,230,
+    0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,92,192,180,4,
+    76,0,0,0,230,0,96,14,0,230,0,96,14,0,230,0,96,14,0,230,0,96,14,0,230,0,96,14,0,230,0,96,
+    14,0,96,255,239,140,1,0,96,46,50,214,45,0,96,14,0,16,188,0,96,14,0,0,244,3,96,14,0,0,240,7,
+    249,255,223,0,208,8,130,62,35,0,208,8,96,14,0,0,241,6,96,14,0,0,245,2,96,14,0,32,173,0,96,46,
+    67,231,28,0,96,255,239,124,1,0,0,48,221,38,13,0,0,160,69,235,6,0,0,0,0,0,0,0,96,111,0,0,
+    176,8,96,239,1,0,176,8,96,219,9,0,176,8,96,75,79,0,176,8,96,12,218,0,176,8,96,12,226,7,176,8,
+    96,12,96,47,176,8,96,12,0,188,176,8,96,12,0,243,181,8,96,12,0,144,190,8,96,12,0,16,253,8,96,12,
+    0,0,245,8,0,0,219,0,0,0,0,0,226,5,0,0,0,0,64,13,0,0,0,0,0,0,0,0,0,80,235,223,
+    24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,0,0,0,126,
+    240,6,0,0,0,126,208,8,0,0,16,95,160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,220,1,0,80,
+    235,223,24,0,0,0,0,233,1,0,0,0,32,95,0,0,0,0,160,7,0,0,0,0,0,0,0,0,0,80,235,223,
+    24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,0,0,0,126,
+    240,6,0,0,0,126,208,8,0,0,16,95,160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,220,1,0,80,
+    235,223,24,0,0,0,192,46,0,0,0,0,183,185,0,0,0,64,28,160,8,0,0,0,0,0,0,0,0,80,235,223,
+    24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,0,0,0,126,
+    240,6,0,0,0,126,208,8,0,0,16,95,160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,220,1,0,80,
+    235,223,24,0,0,32,221,38,13,0,0,144,69,235,6,0,0,0,0,0,0,0,0,80,235,223,24,0,0,248,73,99,
+    220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,0,0,0,126,240,6,0,0,0,126,
+    208,8,0,0,16,95,160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,220,1,0,80,235,223,24,0,0,0,
+    91,192,5,0,0,0,91,176,4,0,0,0,0,0,0,0,0,80,235,223,24,0,0,248,73,99,220,1,64,95,0,0,
+    193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,0,0,0,126,240,6,0,0,0,126,208,8,0,0,16,95,
+    160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,220,1,0,80,235,223,24,0,0,0,0,0,0,89,0,64,
+    11,64,94,64,94,0,64,142,94,0,0,112,159,0,0,64,142,94,0,64,110,64,94,0,105,0,64,11,0,0,0,0,
+    0,0,0,0,0,0,80,235,222,152,7,0,248,73,99,253,3,64,95,0,32,238,10,160,12,0,192,105,47,208,8,0,
+    215,17,95,240,6,48,62,0,127,240,7,208,8,0,126,208,8,200,0,16,95,160,77,46,0,80,47,64,239,6,0,193,
+    10,0,252,73,83,220,1,48,92,235,223,24,0,0,48,127,0,0,0,0,0,215,1,0,0,0,0,160,7,0,0,0,
+    0,0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,
+    0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,
+    0,0,234,55,148,79,0,0,112,253,190,4,0,0,0,16,142,0,0,0,0,128,12,0,0,0,0,210,2,0,0,0,
+    0,0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,
+    0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,
+    0,0,234,55,148,79,0,0,112,253,190,4,0,0,0,244,10,0,0,0,16,125,93,0,0,0,160,7,211,2,0,0,
+    0,0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,
+    0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,
+    0,0,234,55,148,79,0,0,112,253,190,4,0,0,64,13,196,0,0,0,48,12,196,0,0,0,0,0,0,0,0,128,
+    12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,
+    0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,0,0,234,55,148,79,
+    0,0,112,253,190,4,0,0,0,244,5,0,0,192,9,0,0,80,11,0,0,0,0,0,0,187,0,0,176,59,63,0,
+    48,63,176,11,0,171,0,243,3,244,2,0,186,176,9,0,48,127,47,0,0,160,159,0,0,0,243,3,0,0,48,47,
+    0,0,0,243,2,0,0,48,47,0,0,0,243,2,0,96,14,0,0,0,96,14,0,0,0,96,255,239,92,0,96,46,
+    67,249,6,96,14,0,160,13,96,14,0,112,14,96,14,0,160,12,96,14,32,247,5,96,255,255,92,0,96,46,18,0,
+    0,96,14,0,0,0,96,14,0,0,0,0,197,238,59,0,64,111,50,234,0,128,11,0,243,2,144,10,0,217,0,144,
+    10,144,62,0,144,10,243,2,0,144,10,243,4,0,144,10,128,127,0,144,10,0,229,8,144,10,0,80,31,144,10,0,
+    16,63,144,10,74,130,14,144,10,233,206,3,0,233,1,0,0,16,125,0,0,0,32,45,0,0,0,0,0,0,16,217,
+    222,7,0,145,36,246,5,0,0,0,140,0,0,0,160,9,32,201,238,159,16,173,3,176,9,243,2,0,157,16,143,50,
+    250,9,80,253,125,151,0,0,0,245,4,0,0,192,8,0,0,96,11,0,0,0,0,0,0,16,217,222,7,0,145,36,
+    246,5,0,0,0,140,0,0,0,160,9,32,201,238,159,16,173,3,176,9,243,2,0,157,16,143,50,250,9,80,253,125,
+    151,0,0,128,95,0,0,48,110,46,0,16,77,96,12,0,0,0,0,0,16,217,222,7,0,145,36,246,5,0,0,0,
+    140,0,0,0,160,9,32,201,238,159,16,173,3,176,9,243,2,0,157,16,143,50,250,9,80,253,125,151,0,0,235,40,
+    58,0,149,147,174,0,0,0,0,0,0,145,237,125,0,16,73,98,95,0,0,0,192,8,0,0,0,154,0,146,236,254,
+    9,209,58,0,155,48,47,0,208,9,241,40,163,159,0,213,223,119,9,0,122,160,6,0,144,6,106,0,0,0,0,0,
+    0,145,237,125,0,16,73,98,95,0,0,0,192,8,0,0,0,154,0,146,236,254,9,209,58,0,155,48,47,0,208,9,
+    241,40,163,159,0,213,223,119,9,0,160,188,0,0,32,11,58,0,0,160,188,1,0,0,0,0,0,16,217,222,7,0,
+    145,36,246,5,0,0,0,140,0,0,0,160,9,32,201,238,159,16,173,3,176,9,243,2,0,157,16,143,50,250,9,80,
+    253,125,151,0,0,0,0,0,0,0,0,48,218,207,51,252,93,0,48,55,146,221,39,246,3,0,0,16,207,0,176,10,
+    0,0,0,142,0,128,12,32,217,238,255,255,255,14,208,42,0,142,17,17,1,243,2,32,191,0,0,0,241,40,196,249,
+    56,83,5,80,253,109,64,235,206,4,0,196,239,11,64,143,67,6,192,10,0,0,240,5,0,0,241,4,0,0,240,5,
+    0,0,192,10,0,0,80,143,51,6,0,197,239,10,0,32,11,0,0,64,124,0,0,0,211,0,0,194,108,0,0,245,
+    4,0,0,0,201,0,0,0,0,91,0,0,0,0,0,0,0,196,223,7,0,244,39,229,6,176,10,0,216,0,111,0,
+    80,31,241,255,255,255,2,111,17,17,1,192,9,0,0,0,244,56,83,7,0,180,254,125,0,0,0,242,8,0,0,144,
+    12,0,0,32,45,0,0,0,0,0,0,0,196,223,7,0,244,39,229,6,176,10,0,216,0,111,0,80,31,241,255,255,
+    255,2,111,17,17,1,192,9,0,0,0,244,56,83,7,0,180,254,125,0,0,80,159,0,0,16,109,78,0,0,107,48,
+    45,0,0,0,0,0,0,196,223,7,0,244,39,229,6,176,10,0,216,0,111,0,80,31,241,255,255,255,2,111,17,17,
+    1,192,9,0,0,0,244,56,83,7,0,180,254,125,0,0,181,96,11,0,80,11,165,0,0,0,0,0,0,64,252,125,
+    0,64,127,82,110,0,171,0,128,13,240,6,0,245,17,255,255,255,47,240,22,17,17,0,156,0,0,0,64,143,51,117,
+    0,64,235,223,7,226,8,0,230,1,0,152,0,0,0,0,169,0,144,10,0,169,0,144,10,0,169,0,144,10,0,169,
+    0,144,10,0,169,0,0,247,3,209,7,128,10,0,0,0,144,10,0,169,0,144,10,0,169,0,144,10,0,169,0,144,
+    10,0,169,0,144,10,0,16,237,1,144,170,9,181,17,107,0,0,0,0,169,0,0,169,0,0,169,0,0,169,0,0,
+    169,0,0,169,0,0,169,0,0,169,0,0,169,0,209,18,45,209,18,29,0,0,0,0,169,0,0,169,0,0,169,0,
+    0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,176,6,134,0,0,80,238,60,0,0,145,222,11,
+    0,0,163,17,126,0,0,0,0,229,1,0,214,223,232,5,96,110,50,250,9,208,8,0,192,10,241,4,0,144,11,241,
+    4,0,160,10,208,8,0,208,6,80,127,50,218,1,0,197,239,42,0,0,227,109,195,0,0,75,197,94,0,0,0,0,
+    0,0,144,104,253,92,0,144,190,36,248,3,144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,
+    144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,0,226,8,0,0,0,96,30,0,0,0,0,152,0,0,0,0,
+    0,0,0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,160,
+    10,176,10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,0,225,9,0,0,0,216,1,0,0,32,45,0,0,0,
+    0,0,0,0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,
+    160,10,176,10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,32,191,0,0,0,192,200,7,0,0,152,32,61,0,
+    0,0,0,0,0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,
+    0,160,10,176,10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,230,75,165,0,0,61,214,61,0,0,0,0,0,
+    0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,160,10,176,
+    10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,211,64,13,0,0,195,48,12,0,0,0,0,0,0,0,196,239,
+    26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,160,10,176,10,0,225,6,
+    48,143,50,219,1,0,180,238,42,0,0,32,78,0,0,0,194,3,0,0,0,0,0,48,255,255,255,95,16,17,17,17,
+    0,0,194,3,0,0,32,78,0,0,0,0,0,0,0,0,0,0,0,0,196,239,201,3,64,143,51,238,0,192,10,96,
+    237,6,240,5,226,164,9,241,4,140,144,11,224,133,12,160,10,176,236,2,225,6,64,175,50,219,1,112,202,238,42,0,
+    0,243,6,0,0,0,112,13,0,0,0,0,122,0,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,9,
+    0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,165,
+    7,0,0,192,12,0,0,0,228,2,0,0,0,93,0,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,
+    9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,
+    165,7,0,32,207,0,0,0,176,200,7,0,0,168,16,76,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,
+    176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,
+    207,165,7,0,211,49,13,0,0,210,48,13,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,9,0,208,
+    7,176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,165,7,0,
+    0,232,2,0,0,225,5,0,0,144,8,0,0,0,0,0,0,156,0,0,216,96,14,0,208,8,241,5,48,47,0,170,
+    0,200,0,64,31,208,6,0,208,54,31,0,0,184,184,0,0,32,223,5,0,0,176,30,0,0,0,170,0,0,0,242,
+    4,0,32,178,11,0,0,236,27,0,0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,
+    144,122,253,76,0,144,174,51,248,2,144,30,0,192,9,144,11,0,128,12,144,10,0,112,13,144,11,0,128,12,144,14,
+    0,192,9,144,190,35,248,2,144,122,253,76,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,
+    0,16,45,210,2,0,209,18,29,0,0,0,0,0,192,9,0,128,13,230,0,0,141,16,95,0,243,2,160,10,128,12,
+    0,244,1,109,0,0,109,243,1,0,128,139,11,0,0,242,93,0,0,0,235,1,0,0,160,10,0,0,32,79,0,0,
+    34,187,0,0,192,190,1,0,0,0,16,17,1,0,0,32,255,255,8,0,0,0,0,0,0,0,0,160,12,0,0,0,
+    16,239,3,0,0,0,198,154,0,0,0,192,87,14,0,0,48,47,224,5,0,0,184,0,169,0,0,224,6,64,31,0,
+    80,255,255,255,7,0,170,51,51,201,0,241,4,0,48,63,112,13,0,0,192,8,140,0,0,0,231,0,0,17,17,1,
+    0,176,255,239,0,0,0,0,0,0,145,237,125,0,16,73,98,95,0,0,0,192,8,0,0,0,154,0,146,236,254,9,
+    209,58,0,155,48,47,0,208,9,241,40,163,159,0,213,223,119,9,0,180,34,89,0,0,0,232,158,0,0,0,0,0,
+    0,0,0,0,160,12,0,0,0,16,239,3,0,0,0,198,154,0,0,0,192,87,14,0,0,48,47,224,5,0,0,184,
+    0,169,0,0,224,6,64,31,0,80,255,255,255,7,0,170,51,51,201,0,241,4,0,48,63,112,13,0,0,192,8,140,
+    0,0,0,231,0,0,76,65,11,0,48,252,60,0,0,0,0,0,0,145,237,125,0,16,73,98,95,0,0,0,192,8,
+    0,0,0,154,0,146,236,254,9,209,58,0,155,48,47,0,208,9,241,40,163,159,0,213,223,119,9,0,0,202,0,0,
+    0,0,241,62,0,0,0,96,172,9,0,0,0,124,229,0,0,0,243,2,94,0,0,128,11,144,10,0,0,110,0,244,
+    1,0,245,255,255,127,0,160,58,51,147,12,16,79,0,0,243,3,215,0,0,0,140,192,8,0,0,160,15,0,0,0,
+    32,28,0,0,0,0,182,0,0,0,0,32,221,2,16,217,222,7,0,145,36,246,5,0,0,0,140,0,0,0,160,9,
+    32,201,238,159,16,173,3,176,9,243,2,0,157,16,143,50,250,9,80,253,125,203,0,0,0,195,0,0,0,128,9,0,
+    0,0,228,13,0,0,0,233,1,0,0,32,79,0,0,0,160,7,0,0,0,0,0,0,0,48,218,239,75,0,246,90,
+    83,57,32,143,0,0,0,144,13,0,0,0,208,9,0,0,0,240,7,0,0,0,240,6,0,0,0,208,8,0,0,0,
+    160,13,0,0,0,64,127,0,0,0,0,248,74,67,23,0,80,235,239,27,0,0,242,7,0,0,186,0,0,48,29,0,
+    0,0,0,0,0,196,239,11,64,143,67,6,192,10,0,0,240,5,0,0,241,4,0,0,240,5,0,0,192,10,0,0,
+    80,143,51,6,0,197,239,10,0,0,208,30,0,0,0,184,169,0,0,80,28,176,7,0,0,0,0,0,0,48,218,239,
+    75,0,246,90,83,57,32,143,0,0,0,144,13,0,0,0,208,9,0,0,0,240,7,0,0,0,240,6,0,0,0,208,
+    8,0,0,0,160,13,0,0,0,64,127,0,0,0,0,248,74,67,23,0,80,235,239,27,0,144,95,0,0,228,214,1,
+    16,61,96,11,0,0,0,0,0,196,239,11,64,143,67,6,192,10,0,0,240,5,0,0,241,4,0,0,240,5,0,0,
+    192,10,0,0,80,143,51,6,0,197,239,10,0,0,80,12,0,0,0,80,12,0,0,0,0,0,0,0,48,218,239,75,
+    0,246,90,83,57,32,143,0,0,0,144,13,0,0,0,208,9,0,0,0,240,7,0,0,0,240,6,0,0,0,208,8,
+    0,0,0,160,13,0,0,0,64,127,0,0,0,0,248,74,67,23,0,80,235,239,27,0,16,77,0,0,0,77,0,0,
+    0,0,0,0,196,239,11,64,143,67,6,192,10,0,0,240,5,0,0,241,4,0,0,240,5,0,0,192,10,0,0,80,
+    143,51,6,0,197,239,10,0,48,45,128,9,0,0,214,199,1,0,0,176,63,0,0,0,0,0,0,0,48,218,239,75,
+    0,246,90,83,57,32,143,0,0,0,144,13,0,0,0,208,9,0,0,0,240,7,0,0,0,240,6,0,0,0,208,8,
+    0,0,0,160,13,0,0,0,64,127,0,0,0,0,248,74,67,23,0,80,235,239,27,0,108,48,29,0,226,230,4,0,
+    80,143,0,0,0,0,0,0,196,239,11,64,143,67,6,192,10,0,0,240,5,0,0,241,4,0,0,240,5,0,0,192,
+    10,0,0,80,143,51,6,0,197,239,10,0,209,4,198,0,0,0,64,110,46,0,0,0,0,248,5,0,0,0,0,0,
+    0,0,0,96,255,255,141,1,0,96,46,50,198,62,0,96,14,0,0,219,0,96,14,0,0,242,5,96,14,0,0,208,
+    8,96,14,0,0,176,10,96,14,0,0,176,10,96,14,0,0,208,8,96,14,0,0,243,4,96,14,0,16,204,0,96,
+    46,50,215,45,0,96,255,239,124,1,0,0,0,0,208,103,14,0,0,0,208,135,9,0,0,0,208,183,2,0,0,0,
+    208,7,0,0,214,223,197,7,0,80,127,66,236,7,0,192,10,0,243,7,0,240,5,0,224,7,0,241,4,0,208,7,
+    0,240,5,0,224,7,0,192,9,0,242,7,0,80,127,66,236,7,0,0,214,223,165,7,0,96,255,239,140,1,0,96,
+    46,50,214,45,0,96,14,0,16,188,0,96,14,0,0,244,3,96,14,0,0,240,7,249,255,223,0,208,8,130,62,35,
+    0,208,8,96,14,0,0,241,6,96,14,0,0,245,2,96,14,0,32,173,0,96,46,67,231,28,0,96,255,239,124,1,
+    0,0,0,0,208,7,0,0,0,208,7,0,80,255,255,175,0,0,0,208,7,0,214,223,197,7,80,127,66,236,7,192,
+    10,0,243,7,240,5,0,224,7,241,4,0,208,7,240,5,0,224,7,192,9,0,242,7,80,127,66,236,7,0,214,223,
+    165,7,0,16,17,1,0,128,255,255,3,0,0,0,0,0,246,255,255,14,96,62,51,51,0,230,0,0,0,96,14,0,
+    0,0,230,0,0,0,96,255,255,175,0,230,51,51,2,96,14,0,0,0,230,0,0,0,96,14,0,0,0,230,51,51,
+    3,96,255,255,239,0,0,17,17,1,0,128,255,255,2,0,0,0,0,0,64,252,125,0,64,127,82,110,0,171,0,128,
+    13,240,6,0,245,17,255,255,255,47,240,22,17,17,0,156,0,0,0,64,143,51,117,0,64,235,223,7,0,135,33,44,
+    0,16,234,109,0,0,0,0,0,0,246,255,255,14,96,62,51,51,0,230,0,0,0,96,14,0,0,0,230,0,0,0,
+    96,255,255,175,0,230,51,51,2,96,14,0,0,0,230,0,0,0,96,14,0,0,0,230,51,51,3,96,255,255,239,0,
+    0,105,49,13,0,32,252,77,0,0,0,0,0,0,64,252,125,0,64,127,82,110,0,171,0,128,13,240,6,0,245,17,
+    255,255,255,47,240,22,17,17,0,156,0,0,0,64,143,51,117,0,64,235,223,7,0,0,122,0,0,0,160,7,0,0,
+    0,0,0,0,246,255,255,14,96,62,51,51,0,230,0,0,0,96,14,0,0,0,230,0,0,0,96,255,255,175,0,230,
+    51,51,2,96,14,0,0,0,230,0,0,0,96,14,0,0,0,230,51,51,3,96,255,255,239,0,0,0,77,0,0,0,
+    208,4,0,0,0,0,0,0,64,252,125,0,64,127,82,110,0,171,0,128,13,240,6,0,245,17,255,255,255,47,240,22,
+    17,17,0,156,0,0,0,64,143,51,117,0,64,235,223,7,96,255,255,239,0,230,51,51,3,96,14,0,0,0,230,0,
+    0,0,96,14,0,0,0,246,255,255,10,96,62,51,35,0,230,0,0,0,96,14,0,0,0,230,0,0,0,96,62,51,
+    51,0,246,255,255,15,0,0,96,9,0,0,0,107,0,0,0,96,174,0,0,196,223,7,0,244,39,229,6,176,10,0,
+    216,0,111,0,80,31,241,255,255,255,2,111,17,17,1,192,9,0,0,0,244,56,83,7,0,180,254,127,0,0,0,120,
+    0,0,0,208,4,0,0,0,232,9,0,152,16,76,0,0,140,124,0,0,32,207,0,0,0,0,0,0,96,255,255,239,
+    0,230,51,51,3,96,14,0,0,0,230,0,0,0,96,14,0,0,0,246,255,255,10,96,62,51,35,0,230,0,0,0,
+    96,14,0,0,0,230,0,0,0,96,62,51,51,0,246,255,255,14,0,123,48,45,0,16,109,77,0,0,64,159,0,0,
+    0,0,0,0,0,196,223,7,0,244,39,229,6,176,10,0,216,0,111,0,80,31,241,255,255,255,2,111,17,17,1,192,
+    9,0,0,0,244,56,83,7,0,180,254,125,0,0,0,96,127,0,0,0,0,226,230,3,0,0,0,92,64,29,0,0,
+    0,0,0,0,0,0,32,216,238,157,1,0,228,91,67,166,0,32,158,0,0,0,0,128,13,0,0,0,0,208,8,0,
+    0,0,0,224,6,0,0,0,0,240,6,0,246,255,7,208,8,0,49,211,7,160,13,0,0,208,7,48,127,0,0,208,
+    7,0,247,90,51,229,7,0,64,234,239,173,3,0,160,79,0,0,80,125,29,0,32,45,112,10,0,0,0,0,0,16,
+    217,255,239,5,201,1,231,1,224,5,0,79,0,95,0,240,4,160,27,112,29,0,209,239,59,0,64,29,0,0,0,183,
+    1,0,0,48,255,255,109,48,93,51,115,47,153,0,0,241,116,61,16,163,13,128,253,223,25,0,0,0,105,49,29,0,
+    0,0,178,222,5,0,0,0,0,0,0,0,0,32,216,238,157,1,0,228,91,67,166,0,32,158,0,0,0,0,128,13,
+    0,0,0,0,208,8,0,0,0,0,224,6,0,0,0,0,240,6,0,246,255,7,208,8,0,49,211,7,160,13,0,0,
+    208,7,48,127,0,0,208,7,0,247,90,51,229,7,0,64,234,239,173,3,0,61,97,9,0,80,237,27,0,0,0,0,
+    0,0,145,253,255,94,144,28,112,30,0,94,0,240,4,240,5,0,79,0,186,1,215,1,16,253,190,3,0,212,1,0,
+    0,112,27,0,0,0,243,255,223,6,211,53,51,247,146,9,0,16,79,215,3,49,218,0,216,255,157,1,0,0,0,108,
+    0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,32,216,238,157,1,0,228,91,67,166,0,32,158,0,0,0,0,
+    128,13,0,0,0,0,208,8,0,0,0,0,224,6,0,0,0,0,240,6,0,246,255,7,208,8,0,49,211,7,160,13,
+    0,0,208,7,48,127,0,0,208,7,0,247,90,51,229,7,0,64,234,239,173,3,0,80,13,0,0,0,196,0,0,0,
+    0,0,0,0,145,253,255,94,144,28,112,30,0,94,0,240,4,240,5,0,79,0,186,1,215,1,16,253,190,3,0,212,
+    1,0,0,112,27,0,0,0,243,255,223,6,211,53,51,247,146,9,0,16,79,215,3,49,218,0,216,255,157,1,0,32,
+    216,238,157,1,0,228,91,67,166,0,32,158,0,0,0,0,128,13,0,0,0,0,208,8,0,0,0,0,224,6,0,0,
+    0,0,240,6,0,246,255,7,208,8,0,49,211,7,160,13,0,0,208,7,48,127,0,0,208,7,0,247,90,51,229,7,
+    0,64,234,239,173,3,0,0,0,0,0,0,0,0,48,31,0,0,0,0,96,11,0,0,0,0,160,3,0,0,0,0,
+    103,0,0,0,225,2,0,0,80,14,0,0,0,0,0,0,16,217,255,239,5,201,1,231,1,224,5,0,79,0,95,0,
+    240,4,160,27,112,29,0,209,239,59,0,64,29,0,0,0,183,1,0,0,48,255,255,109,48,93,51,115,47,153,0,0,
+    241,116,61,16,163,13,128,253,223,25,0,0,0,226,12,0,0,0,0,155,140,0,0,0,112,10,193,4,0,0,0,0,
+    0,0,0,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,
+    4,96,255,255,255,255,4,96,62,51,51,244,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,4,96,
+    14,0,0,241,4,96,14,0,0,241,4,0,16,222,0,0,0,160,185,9,0,0,182,16,92,0,0,0,0,0,0,144,
+    10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,10,0,0,0,144,106,237,92,0,144,190,35,248,3,144,30,0,
+    208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,
+    96,14,0,0,241,4,96,14,0,0,241,4,255,255,255,255,255,207,114,46,34,34,243,21,96,14,0,0,241,4,96,255,
+    255,255,255,4,96,62,51,51,244,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,241,4,96,14,0,0,
+    241,4,96,14,0,0,241,4,144,10,0,0,0,144,10,0,0,0,253,255,255,3,0,144,10,0,0,0,144,154,254,92,
+    0,144,191,36,248,2,144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,
+    10,0,192,8,144,10,0,192,8,210,125,194,129,70,235,7,0,0,0,0,96,14,0,0,230,0,0,96,14,0,0,230,
+    0,0,96,14,0,0,230,0,0,96,14,0,0,230,0,0,96,14,0,0,230,0,0,96,14,0,0,230,0,0,228,92,
+    195,75,197,94,0,0,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,
+    169,0,16,17,17,241,255,159,0,0,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,
+    0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,16,17,1,244,255,111,0,0,0,0,169,0,0,169,0,0,169,
+    0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,193,18,135,96,238,26,0,0,0,0,230,0,0,
+    230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,0,230,0,
+    164,33,74,144,238,8,0,0,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,
+    0,0,169,0,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,144,15,209,2,212,0,
+    193,78,80,6,128,9,0,0,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,224,13,195,0,152,0,228,13,
+    80,12,80,12,0,0,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,96,14,144,10,
+    144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,96,14,16,79,0,230,0,241,4,96,14,16,79,0,230,0,
+    241,4,96,14,16,79,0,230,0,241,4,96,14,16,79,0,230,0,241,4,96,14,16,79,0,230,0,241,4,96,14,16,
+    79,0,230,0,241,4,0,0,32,63,0,0,51,218,0,0,176,206,3,0,80,6,80,7,128,9,128,10,0,0,0,0,
+    144,10,144,11,144,10,144,11,144,10,144,11,144,10,144,11,144,10,144,11,144,10,144,11,144,10,144,11,144,10,144,11,
+    144,10,144,11,0,0,144,11,0,0,144,10,0,32,210,8,0,176,191,1,0,192,46,0,112,140,11,64,28,160,8,0,
+    0,0,0,128,12,0,0,200,0,0,128,12,0,0,200,0,0,128,12,0,0,200,0,0,128,12,0,0,200,0,0,128,
+    12,0,0,200,0,0,128,12,0,0,200,0,0,144,11,16,84,110,0,227,142,0,0,16,222,0,160,185,9,182,16,92,
+    0,0,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,0,0,169,
+    0,0,170,0,34,125,0,236,27,0,96,14,0,80,79,96,14,0,244,5,96,14,32,126,0,96,14,209,9,0,96,30,
+    172,0,0,96,174,79,0,0,96,191,218,1,0,96,14,209,10,0,96,14,64,111,0,96,14,0,232,2,96,14,0,192,
+    11,96,14,0,32,126,0,0,0,0,0,0,0,215,0,0,0,0,122,0,0,0,0,29,0,0,144,10,0,0,0,169,
+    0,0,0,144,10,0,0,0,169,0,0,0,144,10,16,141,0,169,16,156,0,144,10,186,0,0,169,200,1,0,144,253,
+    30,0,0,217,212,11,0,144,10,244,7,0,169,0,247,3,144,10,0,219,1,0,0,0,0,0,48,47,0,0,0,182,
+    0,0,0,160,4,0,0,144,12,32,158,0,201,0,188,0,144,11,217,1,0,185,230,3,0,144,237,46,0,0,233,179,
+    12,0,144,12,226,7,0,201,0,246,3,144,12,0,218,0,0,208,10,0,0,230,1,0,16,61,0,0,0,0,0,0,
+    96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,
+    96,14,0,0,96,14,0,0,96,62,51,51,96,255,255,239,0,247,2,225,6,128,9,0,0,0,144,10,0,169,0,144,
+    10,0,169,0,144,10,0,169,0,144,10,0,169,0,144,10,0,169,0,144,10,0,169,0,144,10,0,96,14,0,0,96,
+    14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,
+    14,0,0,96,62,51,51,96,255,255,239,0,0,0,0,0,32,47,0,0,80,12,0,0,144,4,0,144,10,144,10,144,
+    10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,144,10,0,0,176,9,224,3,179,0,96,14,64,
+    31,96,14,96,11,96,14,144,4,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,
+    0,96,14,0,0,96,62,51,51,96,255,255,239,144,42,63,144,74,12,144,122,5,144,10,0,144,10,0,144,10,0,144,
+    10,0,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,96,14,0,0,96,14,0,0,96,14,0,0,
+    96,14,0,0,96,14,0,0,96,14,128,10,96,14,128,9,96,14,0,0,96,14,0,0,96,14,0,0,96,62,51,51,
+    96,255,255,239,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,144,42,61,144,26,45,144,
+    10,0,144,10,0,144,10,0,144,10,0,96,14,0,0,96,14,0,0,96,14,0,0,96,14,0,0,96,30,120,0,96,
+    222,43,0,178,95,0,0,199,14,0,0,96,14,0,0,96,14,0,0,96,62,51,51,96,255,255,239,0,169,0,0,169,
+    0,0,169,0,0,169,0,0,169,0,0,185,27,0,250,26,112,191,0,160,172,0,0,169,0,0,169,0,0,169,0,0,
+    169,0,0,0,0,218,1,0,0,0,48,79,0,0,0,0,176,6,0,0,0,0,0,0,0,0,96,111,0,0,176,8,
+    96,239,1,0,176,8,96,219,9,0,176,8,96,75,79,0,176,8,96,12,218,0,176,8,96,12,226,7,176,8,96,12,
+    96,47,176,8,96,12,0,188,176,8,96,12,0,243,181,8,96,12,0,144,190,8,96,12,0,16,253,8,96,12,0,0,
+    245,8,0,0,176,13,0,0,0,244,3,0,0,0,92,0,0,0,0,0,0,0,144,104,253,92,0,144,190,36,248,3,
+    144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,
+    0,192,8,96,111,0,0,176,8,96,239,1,0,176,8,96,219,9,0,176,8,96,75,79,0,176,8,96,12,218,0,176,
+    8,96,12,226,7,176,8,96,12,96,47,176,8,96,12,0,188,176,8,96,12,0,243,181,8,96,12,0,144,190,8,96,
+    12,0,16,253,8,96,12,0,0,245,8,0,0,0,0,0,0,0,0,224,6,0,0,0,0,226,1,0,0,0,0,134,
+    0,0,0,144,104,253,92,0,144,190,36,248,3,144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,
+    8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,0,0,0,0,0,0,0,125,0,0,0,16,31,0,0,0,
+    80,9,0,0,0,96,27,176,6,0,0,0,169,170,0,0,0,0,209,30,0,0,0,0,0,0,0,0,96,111,0,0,
+    176,8,96,239,1,0,176,8,96,219,9,0,176,8,96,75,79,0,176,8,96,12,218,0,176,8,96,12,226,7,176,8,
+    96,12,96,47,176,8,96,12,0,188,176,8,96,12,0,243,181,8,96,12,0,144,190,8,96,12,0,16,253,8,96,12,
+    0,0,245,8,0,182,16,92,0,0,160,169,9,0,0,16,222,0,0,0,0,0,0,0,144,104,253,92,0,144,190,36,
+    248,3,144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,144,10,0,192,8,
+    144,10,0,192,8,244,3,0,0,0,112,14,0,0,0,0,138,0,0,0,0,208,130,89,253,109,0,0,232,75,114,63,
+    0,128,31,0,192,7,0,200,0,0,155,0,128,11,0,176,9,0,184,0,0,155,0,128,11,0,176,9,0,184,0,0,
+    155,0,128,11,0,176,9,96,111,0,0,176,8,96,239,1,0,176,8,96,219,10,0,176,8,96,75,79,0,176,8,96,
+    12,217,1,176,8,96,12,209,8,176,8,96,12,64,63,176,8,96,12,0,202,176,8,96,12,0,225,183,8,96,12,0,
+    80,206,8,96,12,0,0,250,8,96,12,0,0,226,7,0,0,0,0,208,6,0,0,0,51,248,2,0,0,0,248,93,
+    0,144,120,253,92,0,144,190,36,248,3,144,30,0,208,6,144,11,0,192,8,144,10,0,192,8,144,10,0,192,8,144,
+    10,0,192,8,144,10,0,192,8,144,10,0,192,8,0,0,0,192,8,0,0,0,192,8,0,0,32,227,5,0,0,176,
+    174,0,0,0,17,17,1,0,0,16,255,255,9,0,0,0,0,0,0,0,0,80,235,223,24,0,0,248,73,99,220,1,
+    64,95,0,0,193,10,160,12,0,0,80,47,208,8,0,0,16,95,240,6,0,0,0,126,240,6,0,0,0,126,208,8,
+    0,0,16,95,160,12,0,0,80,47,64,95,0,0,193,10,0,248,72,83,220,1,0,80,235,223,24,0,0,16,17,1,
+    0,0,248,255,63,0,0,0,0,0,0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,
+    4,0,144,11,240,5,0,160,10,176,10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,16,44,113,8,0,0,0,
+    230,174,1,0,0,0,0,0,0,0,0,80,235,223,24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,
+    80,47,208,8,0,0,16,95,240,6,0,0,0,126,240,6,0,0,0,126,208,8,0,0,16,95,160,12,0,0,80,47,
+    64,95,0,0,193,10,0,248,72,83,220,1,0,80,235,223,24,0,0,135,33,44,0,0,177,222,6,0,0,0,0,0,
+    0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,160,10,176,
+    10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,0,208,41,111,0,0,0,213,129,11,0,0,0,60,210,1,0,
+    0,0,0,0,0,0,0,80,235,223,24,0,0,248,73,99,220,1,64,95,0,0,193,10,160,12,0,0,80,47,208,8,
+    0,0,16,95,240,6,0,0,0,126,240,6,0,0,0,126,208,8,0,0,16,95,160,12,0,0,80,47,64,95,0,0,
+    193,10,0,248,72,83,220,1,0,80,235,223,24,0,0,80,47,216,1,0,192,24,78,0,0,181,128,7,0,0,0,0,
+    0,0,0,196,239,26,0,64,143,67,219,1,192,10,0,225,6,240,5,0,160,10,241,4,0,144,11,240,5,0,160,10,
+    176,10,0,225,6,48,143,50,219,1,0,180,238,42,0,0,80,235,255,255,255,207,0,128,159,52,247,53,51,2,64,95,
+    0,32,63,0,0,0,202,0,0,242,3,0,0,208,8,0,32,63,0,0,0,111,0,0,242,255,255,8,240,6,0,32,
+    95,51,19,0,141,0,0,242,3,0,0,160,12,0,32,63,0,0,0,244,5,0,242,3,0,0,0,248,72,99,95,51,
+    35,0,0,181,254,255,255,255,12,0,197,223,7,161,238,8,0,245,39,196,200,42,228,8,192,9,0,243,13,0,230,16,
+    95,0,0,174,0,48,47,241,4,0,192,255,255,255,4,95,0,0,173,17,17,1,192,9,0,242,13,0,0,0,244,39,
+    196,219,74,67,7,0,196,239,25,162,254,141,0,0,0,176,13,0,0,0,244,3,0,0,0,92,0,0,0,0,0,0,
+    0,96,255,239,92,0,96,62,67,249,4,96,14,0,192,10,96,14,0,144,12,96,14,0,176,10,96,14,16,247,3,96,
+    255,255,61,0,96,46,130,30,0,96,14,16,142,0,96,14,0,246,2,96,14,0,192,11,96,14,0,64,95,0,16,174,
+    0,0,215,1,0,209,3,0,0,0,0,144,71,253,3,185,93,20,144,63,0,0,201,0,0,144,10,0,0,169,0,0,
+    144,10,0,0,169,0,0,144,10,0,0,96,255,239,92,0,96,62,67,249,4,96,14,0,192,10,96,14,0,144,12,96,
+    14,0,176,10,96,14,16,247,3,96,255,255,61,0,96,46,130,30,0,96,14,16,142,0,96,14,0,246,2,96,14,0,
+    192,11,96,14,0,64,95,0,0,0,0,0,0,0,184,0,0,0,0,107,0,0,0,16,13,0,0,144,71,253,3,185,
+    93,20,144,63,0,0,201,0,0,144,10,0,0,169,0,0,144,10,0,0,169,0,0,144,10,0,0,0,0,0,160,10,
+    0,0,77,0,0,178,0,0,0,0,167,16,92,0,0,160,185,8,0,0,16,222,0,0,0,0,0,0,0,96,255,239,
+    92,0,96,62,67,249,4,96,14,0,192,10,96,14,0,144,12,96,14,0,176,10,96,14,16,247,3,96,255,255,61,0,
+    96,46,130,30,0,96,14,16,142,0,96,14,0,246,2,96,14,0,192,11,96,14,0,64,95,176,6,211,2,225,230,4,
+    0,245,9,0,0,0,0,144,71,253,3,185,93,20,144,63,0,0,201,0,0,144,10,0,0,169,0,0,144,10,0,0,
+    169,0,0,144,10,0,0,0,0,225,8,0,0,128,12,0,0,32,45,0,0,0,0,0,0,0,215,239,91,0,233,54,
+    132,5,224,7,0,0,0,126,0,0,0,160,61,0,0,0,161,191,5,0,0,48,249,44,0,0,0,210,11,0,0,0,
+    246,0,0,0,112,14,146,53,115,126,16,218,239,92,0,0,0,189,0,0,80,46,0,0,208,4,0,0,0,0,0,48,
+    235,206,5,224,40,98,4,241,3,0,0,176,109,1,0,0,214,142,0,0,0,212,9,0,0,96,13,162,36,195,9,161,
+    253,157,1,0,96,127,0,0,32,110,62,0,0,92,64,29,0,0,0,0,0,0,215,239,91,0,233,54,132,5,224,7,
+    0,0,0,126,0,0,0,160,61,0,0,0,161,191,5,0,0,48,249,44,0,0,0,210,11,0,0,0,246,0,0,0,
+    112,14,146,53,115,126,16,218,239,92,0,0,226,12,0,0,155,140,0,112,10,193,4,0,0,0,0,48,235,206,5,224,
+    40,98,4,241,3,0,0,176,109,1,0,0,214,142,0,0,0,212,9,0,0,96,13,162,36,195,9,161,253,157,1,0,
+    215,239,91,0,233,54,132,5,224,7,0,0,0,126,0,0,0,160,61,0,0,0,161,191,5,0,0,48,249,44,0,0,
+    0,210,11,0,0,0,246,0,0,0,112,14,146,53,115,126,16,218,239,92,0,0,80,8,0,0,0,198,5,0,0,0,
+    166,0,0,80,204,3,0,48,235,206,5,224,40,98,4,241,3,0,0,176,109,1,0,0,214,142,0,0,0,212,9,0,
+    0,96,13,162,36,195,9,161,253,157,1,0,193,0,0,0,179,9,0,0,16,15,0,0,220,7,0,16,92,80,28,0,
+    48,110,46,0,0,112,127,0,0,0,0,0,0,0,215,239,91,0,233,54,132,5,224,7,0,0,0,126,0,0,0,160,
+    61,0,0,0,161,191,5,0,0,48,249,44,0,0,0,210,11,0,0,0,246,0,0,0,112,14,146,53,115,126,16,218,
+    239,92,0,112,10,193,5,0,155,139,0,0,226,12,0,0,0,0,0,48,235,206,5,224,40,98,4,241,3,0,0,176,
+    109,1,0,0,214,142,0,0,0,212,9,0,0,96,13,162,36,195,9,161,253,157,1,253,255,255,255,43,51,246,52,35,
+    0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,0,64,31,0,0,
+    0,244,1,0,0,64,31,0,0,0,244,1,0,0,32,11,0,0,0,196,7,0,0,0,211,0,0,48,204,5,0,32,
+    11,0,112,12,0,249,255,79,128,12,0,128,12,0,128,12,0,128,12,0,128,12,0,112,12,0,80,79,18,0,233,78,
+    0,178,0,0,196,7,0,48,13,32,204,6,16,77,80,12,0,48,110,46,0,0,128,111,0,0,0,0,0,0,253,255,
+    255,255,43,51,246,52,35,0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,
+    1,0,0,64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,0,0,155,0,0,77,32,27,12,112,12,0,
+    249,255,79,128,12,0,128,12,0,128,12,0,128,12,0,128,12,0,112,12,0,80,79,18,0,233,78,253,255,255,255,43,
+    51,246,52,35,0,64,31,0,0,0,244,1,0,0,64,31,0,0,250,255,255,8,16,82,63,18,0,0,244,1,0,0,
+    64,31,0,0,0,244,1,0,0,64,31,0,0,0,244,1,0,32,11,0,112,12,0,249,255,79,128,12,0,128,12,0,
+    249,255,47,128,12,0,128,12,0,112,12,0,64,95,18,0,233,78,0,96,190,84,10,0,0,208,99,221,3,0,0,0,
+    0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,
+    242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,0,
+    0,234,55,148,79,0,0,112,253,190,4,0,0,229,76,164,0,0,60,214,61,0,0,0,0,0,0,176,9,0,208,7,
+    176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,
+    66,236,7,0,215,207,165,7,0,0,17,17,0,0,0,128,255,255,3,0,0,0,0,0,0,0,128,12,0,0,242,3,
+    128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,
+    0,0,242,3,128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,0,0,234,55,148,79,0,0,112,253,190,
+    4,0,0,16,17,1,0,0,247,255,79,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,
+    176,9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,165,7,0,112,
+    24,194,1,0,0,16,235,109,0,0,0,0,0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,
+    242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,
+    112,13,0,0,244,2,48,79,0,0,217,0,0,234,55,148,79,0,0,112,253,190,4,0,0,135,33,44,0,0,161,238,
+    6,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,
+    176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,165,7,0,0,199,60,0,0,0,0,29,133,0,0,
+    0,0,199,60,0,0,0,0,0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,
+    0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,0,
+    244,2,48,79,0,0,217,0,0,234,55,148,79,0,0,112,253,190,4,0,0,96,204,3,0,0,192,65,9,0,0,96,
+    204,3,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,
+    7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,165,7,0,0,244,115,30,0,0,0,139,225,5,
+    0,0,64,11,135,0,0,0,0,0,0,0,0,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,
+    12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,112,13,0,
+    0,244,2,48,79,0,0,217,0,0,234,55,148,79,0,0,112,253,190,4,0,0,48,79,230,1,0,160,9,109,0,0,
+    195,113,9,0,0,0,0,0,0,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,9,0,
+    208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,165,7,128,12,0,0,242,3,128,12,0,0,
+    242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,128,12,0,0,242,3,
+    128,12,0,0,242,3,112,13,0,0,244,2,48,79,0,0,217,0,0,234,55,148,79,0,0,112,253,191,4,0,0,0,
+    210,1,0,0,0,0,182,0,0,0,0,0,210,45,0,0,176,9,0,208,7,176,9,0,208,7,176,9,0,208,7,176,
+    9,0,208,7,176,9,0,208,7,176,9,0,224,7,144,11,0,243,7,80,111,66,236,7,0,215,207,245,8,0,0,0,
+    150,0,0,0,0,107,0,0,0,0,230,10,0,0,0,249,5,0,0,0,0,0,228,214,1,0,0,0,0,209,3,182,
+    0,0,0,0,0,0,0,0,0,0,186,0,0,248,3,0,224,103,14,0,192,127,0,48,63,242,3,16,159,12,0,230,
+    0,125,0,229,243,1,160,11,160,11,144,10,94,0,126,0,230,0,110,160,10,242,3,32,63,243,2,229,96,14,0,208,
+    119,12,16,79,169,0,0,170,138,0,192,215,6,0,96,221,4,0,183,63,0,0,242,14,0,48,239,0,0,0,189,0,
+    0,224,10,0,0,0,176,63,0,0,0,0,96,141,28,0,0,0,48,45,128,9,0,0,0,0,0,0,0,0,170,0,
+    144,47,0,243,98,14,0,238,6,112,13,242,2,227,168,0,154,0,110,128,75,14,224,5,160,10,108,224,52,47,0,214,
+    242,2,154,214,0,32,143,12,96,173,9,0,208,126,0,241,94,0,0,249,3,0,252,1,0,0,112,111,0,0,48,110,
+    46,0,16,76,80,12,0,0,0,0,0,187,0,0,176,59,63,0,48,63,176,11,0,171,0,243,3,244,2,0,186,176,
+    9,0,48,127,47,0,0,160,159,0,0,0,243,3,0,0,48,47,0,0,0,243,2,0,0,48,47,0,0,0,243,2,
+    0,0,208,30,0,0,128,155,10,0,80,28,176,7,0,0,0,0,0,156,0,0,216,96,14,0,208,8,241,5,48,47,
+    0,170,0,200,0,64,31,208,6,0,208,54,31,0,0,184,184,0,0,32,223,5,0,0,176,30,0,0,0,170,0,0,
+    0,242,4,0,32,178,11,0,0,236,27,0,0,0,0,136,144,8,0,128,8,120,0,0,0,0,0,176,11,0,0,187,
+    243,3,0,243,3,187,0,176,10,48,63,64,47,0,160,11,155,0,0,243,247,2,0,0,250,9,0,0,48,63,0,0,
+    0,243,2,0,0,48,47,0,0,0,243,2,0,0,48,47,0,0,0,0,243,7,0,0,160,11,0,0,64,29,0,0,
+    0,0,0,0,243,255,255,255,5,51,51,163,46,0,0,32,127,0,0,0,203,0,0,0,245,3,0,0,225,9,0,0,
+    144,29,0,0,64,95,0,0,0,189,0,0,0,231,2,0,0,242,57,51,51,82,255,255,255,143,0,0,189,0,0,230,
+    2,0,209,4,0,0,0,0,241,255,255,11,0,32,126,0,0,202,0,0,229,2,0,225,7,0,160,12,0,80,46,0,
+    16,126,0,0,245,255,255,13,0,16,61,0,0,0,209,2,0,0,0,0,0,48,255,255,255,95,48,51,51,234,2,0,
+    0,242,7,0,0,176,12,0,0,80,63,0,0,16,158,0,0,0,217,1,0,0,244,5,0,0,208,11,0,0,112,46,
+    0,0,32,159,51,51,35,245,255,255,255,8,0,192,6,0,0,92,0,0,0,0,16,255,255,191,0,0,226,7,0,160,
+    12,0,80,46,0,16,126,0,0,202,0,0,229,2,0,225,7,0,80,255,255,223,0,92,64,29,0,32,110,62,0,0,
+    96,127,0,0,0,0,0,0,243,255,255,255,5,51,51,163,46,0,0,32,127,0,0,0,203,0,0,0,245,3,0,0,
+    225,9,0,0,144,29,0,0,64,95,0,0,0,189,0,0,0,231,2,0,0,242,57,51,51,82,255,255,255,143,144,8,
+    210,3,209,215,6,0,243,11,0,0,0,0,241,255,255,11,0,32,126,0,0,202,0,0,229,2,0,225,7,0,160,12,
+    0,80,46,0,16,126,0,0,245,255,255,13,0,215,143,64,79,35,128,11,0,144,10,0,144,10,0,144,10,0,144,10,
+    0,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,144,10,0,245,255,255,95,49,51,51,19,0,0,0,0,0,
+    0,0,0,0,0,0,0,245,255,255,255,255,255,255,95,49,51,51,51,51,51,51,19,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,22,62,246,161,13,0,0,0,0,0,0,0,0,0,0,0,
+    0,241,70,47,183,160,5,0,0,0,0,0,0,0,0,0,0,0,0,144,6,75,225,35,31,246,129,13,218,192,10,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,241,54,79,244,98,30,183,144,9,
+    90,192,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+    1,0,234,0,248,2,246,4,144,13,112,30,80,62,0,0,48,234,206,7,0,226,75,99,9,0,187,0,0,0,16,79,
+    0,0,0,248,255,255,31,0,80,15,0,0,0,80,15,0,0,0,248,255,255,9,0,16,95,0,0,0,0,187,0,0,
+    0,0,226,91,83,6,0,48,234,223,7,
+};
+
+const bitmap_font::glyph font_small_glyphs[] = {
+    { 0x0020, 4, 0, 0, 0, 4, 0 },
+    { 0x0021, 4, 12, 0, -12, 4, 0 },
+    { 0x0022, 6, 12, 0, -12, 6, 24 },
+    { 0x0023, 10, 12, 0, -12, 10, 60 },
+    { 0x0024, 9, 13, 0, -12, 9, 120 },
+    { 0x0025, 13, 12, 0, -12, 13, 179 },
+    { 0x0026, 12, 12, 0, -12, 12, 257 },
+    { 0x0027, 4, 12, 0, -12, 4, 329 },
+    { 0x0028, 5, 15, 0, -12, 5, 353 },
+    { 0x0029, 5, 15, 0, -12, 5, 391 },
+    { 0x002a, 9, 13, 0, -13, 9, 429 },
+    { 0x002b, 9, 10, 0, -10, 9, 488 },
+    { 0x002c, 4, 4, 0, -2, 4, 533 },
+    { 0x002d, 5, 5, 0, -5, 5, 541 },
+    { 0x002e, 4, 3, 0, -3, 4, 554 },
+    { 0x002f, 6, 12, 0, -12, 6, 560 },
+    { 0x0030, 9, 12, 0, -12, 9, 596 },
+    { 0x0031, 9, 12, 0, -12, 9, 650 },
+    { 0x0032, 9, 12, 0, -12, 9, 704 },
+    { 0x0033, 9, 12, 0, -12, 9, 758 },
+    { 0x0034, 9, 12, 0, -12, 9, 812 },
+    { 0x0035, 9, 12, 0, -12, 9, 866 },
+    { 0x0036, 9, 12, 0, -12, 9, 920 },
+    { 0x0037, 9, 12, 0, -12, 9, 974 },
+    { 0x0038, 9, 12, 0, -12, 9, 1028 },
+    { 0x0039, 9, 12, 0, -12, 9, 1082 },
+    { 0x003a, 4, 9, 0, -9, 4, 1136 },
+    { 0x003b, 4, 11, 0, -9, 4, 1154 },
+    { 0x003c, 9, 10, 0, -10, 9, 1176 },
+    { 0x003d, 9, 8, 0, -8, 9, 1221 },
+    { 0x003e, 9, 10, 0, -10, 9, 1257 },
+    { 0x003f, 7, 12, 0, -12, 7, 1302 },
+    { 0x0040, 14, 13, 0, -12, 14, 1344 },
+    { 0x0041, 11, 12, 0, -12, 10, 1435 },
+    { 0x0042, 10, 12, 0, -12, 10, 1501 },
+    { 0x0043, 10, 12, 0, -12, 10, 1561 },
+    { 0x0044, 12, 12, 0, -12, 12, 1621 },
+    { 0x0045, 9, 12, 0, -12, 9, 1693 },
+    { 0x0046, 8, 12, 0, -12, 8, 1747 },
+    { 0x0047, 12, 12, 0, -12, 12, 1795 },
+    { 0x0048, 12, 12, 0, -12, 12, 1867 },
+    { 0x0049, 4, 12, 0, -12, 4, 1939 },
+    { 0x004a, 6, 15, -2, -12, 4, 1963 },
+    { 0x004b, 10, 12, 0, -12, 10, 2008 },
+    { 0x004c, 8, 12, 0, -12, 8, 2068 },
+    { 0x004d, 14, 12, 0, -12, 14, 2116 },
+    { 0x004e, 12, 12, 0, -12, 12, 2200 },
+    { 0x004f, 12, 12, 0, -12, 12, 2272 },
+    { 0x0050, 10, 12, 0, -12, 10, 2344 },
+    { 0x0051, 12, 15, 0, -12, 12, 2404 },
+    { 0x0052, 10, 12, 0, -12, 10, 2494 },
+    { 0x0053, 9, 12, 0, -12, 9, 2554 },
+    { 0x0054, 9, 12, 0, -12, 9, 2608 },
+    { 0x0055, 12, 12, 0, -12, 12, 2662 },
+    { 0x0056, 10, 12, 0, -12, 10, 2734 },
+    { 0x0057, 15, 12, 0, -12, 15, 2794 },
+    { 0x0058, 10, 12, 0, -12, 9, 2884 },
+    { 0x0059, 9, 12, 0, -12, 9, 2944 },
+    { 0x005a, 9, 12, 0, -12, 9, 2998 },
+    { 0x005b, 5, 15, 0, -12, 5, 3052 },
+    { 0x005c, 6, 12, 0, -12, 6, 3090 },
+    { 0x005d, 5, 15, 0, -12, 5, 3126 },
+    { 0x005e, 9, 12, 0, -12, 9, 3164 },
+    { 0x005f, 9, 3, -1, 0, 7, 3218 },
+    { 0x0060, 9, 13, 0, -13, 9, 3232 },
+    { 0x0061, 9, 9, 0, -9, 9, 3291 },
+    { 0x0062, 10, 13, 0, -13, 10, 3332 },
+    { 0x0063, 8, 9, 0, -9, 8, 3397 },
+    { 0x0064, 10, 13, 0, -13, 10, 3433 },
+    { 0x0065, 9, 9, 0, -9, 9, 3498 },
+    { 0x0066, 7, 13, 0, -13, 5, 3539 },
+    { 0x0067, 9, 13, 0, -9, 9, 3585 },
+    { 0x0068, 10, 13, 0, -13, 10, 3644 },
+    { 0x0069, 4, 12, 0, -12, 4, 3709 },
+    { 0x006a, 5, 16, -1, -12, 4, 3733 },
+    { 0x006b, 9, 13, 0, -13, 8, 3773 },
+    { 0x006c, 4, 13, 0, -13, 4, 3832 },
+    { 0x006d, 15, 9, 0, -9, 15, 3858 },
+    { 0x006e, 10, 9, 0, -9, 10, 3926 },
+    { 0x006f, 10, 9, 0, -9, 10, 3971 },
+    { 0x0070, 10, 13, 0, -9, 10, 4016 },
+    { 0x0071, 10, 13, 0, -9, 10, 4081 },
+    { 0x0072, 7, 9, 0, -9, 7, 4146 },
+    { 0x0073, 8, 9, 0, -9, 8, 4178 },
+    { 0x0074, 6, 11, 0, -11, 6, 4214 },
+    { 0x0075, 10, 9, 0, -9, 10, 4247 },
+    { 0x0076, 9, 9, 0, -9, 8, 4292 },
+    { 0x0077, 13, 9, 0, -9, 12, 4333 },
+    { 0x0078, 9, 9, 0, -9, 8, 4392 },
+    { 0x0079, 9, 13, 0, -9, 8, 4433 },
+    { 0x007a, 7, 9, 0, -9, 7, 4492 },
+    { 0x007b, 6, 15, 0, -12, 6, 4524 },
+    { 0x007c, 9, 17, 0, -13, 9, 4569 },
+    { 0x007d, 6, 15, 0, -12, 6, 4646 },
+    { 0x007e, 9, 7, 0, -7, 9, 4691 },
+    { 0x00a0, 4, 0, 0, 0, 4, 4723 },
+    { 0x00a1, 4, 12, 0, -9, 4, 4723 },
+    { 0x00a2, 9, 12, 0, -12, 9, 4747 },
+    { 0x00a3, 9, 12, 0, -12, 9, 4801 },
+    { 0x00a4, 9, 10, 0, -10, 9, 4855 },
+    { 0x00a5, 9, 12, 0, -12, 9, 4900 },
+    { 0x00a6, 9, 17, 0, -13, 9, 4954 },
+    { 0x00a7, 8, 13, 0, -13, 8, 5031 },
+    { 0x00a8, 9, 12, 0, -12, 9, 5083 },
+    { 0x00a9, 13, 12, 0, -12, 13, 5137 },
+    { 0x00aa, 6, 12, 0, -12, 6, 5215 },
+    { 0x00ab, 8, 7, 0, -7, 8, 5251 },
+    { 0x00ac, 9, 6, 0, -6, 9, 5279 },
+    { 0x00ad, 5, 5, 0, -5, 5, 5306 },
+    { 0x00ae, 13, 12, 0, -12, 13, 5319 },
+    { 0x00af, 10, 13, -1, -13, 8, 5397 },
+    { 0x00b0, 7, 12, 0, -12, 7, 5462 },
+    { 0x00b1, 9, 11, 0, -10, 9, 5504 },
+    { 0x00b2, 6, 12, 0, -12, 6, 5554 },
+    { 0x00b3, 6, 12, 0, -12, 6, 5590 },
+    { 0x00b4, 9, 13, 0, -13, 9, 5626 },
+    { 0x00b5, 10, 13, 0, -9, 10, 5685 },
+    { 0x00b6, 10, 15, 0, -13, 10, 5750 },
+    { 0x00b7, 4, 7, 0, -7, 4, 5825 },
+    { 0x00b8, 4, 4, 0, 0, 4, 5839 },
+    { 0x00b9, 6, 12, 0, -12, 6, 5847 },
+    { 0x00ba, 6, 12, 0, -12, 6, 5883 },
+    { 0x00bb, 8, 7, 0, -7, 8, 5919 },
+    { 0x00bc, 12, 12, 0, -12, 12, 5947 },
+    { 0x00bd, 12, 12, 0, -12, 12, 6019 },
+    { 0x00be, 13, 12, 0, -12, 12, 6091 },
+    { 0x00bf, 7, 12, 0, -9, 7, 6169 },
+    { 0x00c0, 11, 16, 0, -16, 10, 6211 },
+    { 0x00c1, 11, 16, 0, -16, 10, 6299 },
+    { 0x00c2, 11, 16, 0, -16, 10, 6387 },
+    { 0x00c3, 11, 15, 0, -15, 10, 6475 },
+    { 0x00c4, 11, 15, 0, -15, 10, 6558 },
+    { 0x00c5, 11, 14, 0, -14, 10, 6641 },
+    { 0x00c6, 15, 12, -1, -12, 14, 6718 },
+    { 0x00c7, 10, 16, 0, -12, 10, 6808 },
+    { 0x00c8, 9, 16, 0, -16, 9, 6888 },
+    { 0x00c9, 9, 16, 0, -16, 9, 6960 },
+    { 0x00ca, 9, 16, 0, -16, 9, 7032 },
+    { 0x00cb, 9, 15, 0, -15, 9, 7104 },
+    { 0x00cc, 4, 16, 0, -16, 4, 7172 },
+    { 0x00cd, 5, 16, 0, -16, 4, 7204 },
+    { 0x00ce, 6, 16, -1, -16, 4, 7244 },
+    { 0x00cf, 5, 15, 0, -15, 4, 7292 },
+    { 0x00d0, 12, 12, 0, -12, 12, 7330 },
+    { 0x00d1, 12, 15, 0, -15, 12, 7402 },
+    { 0x00d2, 12, 16, 0, -16, 12, 7492 },
+    { 0x00d3, 12, 16, 0, -16, 12, 7588 },
+    { 0x00d4, 12, 16, 0, -16, 12, 7684 },
+    { 0x00d5, 12, 15, 0, -15, 12, 7780 },
+    { 0x00d6, 12, 15, 0, -15, 12, 7870 },
+    { 0x00d7, 9, 10, 0, -10, 9, 7960 },
+    { 0x00d8, 12, 12, 0, -12, 12, 8005 },
+    { 0x00d9, 12, 16, 0, -16, 12, 8077 },
+    { 0x00da, 12, 16, 0, -16, 12, 8173 },
+    { 0x00db, 12, 16, 0, -16, 12, 8269 },
+    { 0x00dc, 12, 15, 0, -15, 12, 8365 },
+    { 0x00dd, 9, 16, 0, -16, 9, 8455 },
+    { 0x00de, 10, 12, 0, -12, 10, 8527 },
+    { 0x00df, 10, 13, 0, -13, 10, 8587 },
+    { 0x00e0, 9, 13, 0, -13, 9, 8652 },
+    { 0x00e1, 9, 13, 0, -13, 9, 8711 },
+    { 0x00e2, 9, 13, 0, -13, 9, 8770 },
+    { 0x00e3, 9, 12, 0, -12, 9, 8829 },
+    { 0x00e4, 9, 12, 0, -12, 9, 8883 },
+    { 0x00e5, 9, 13, 0, -13, 9, 8937 },
+    { 0x00e6, 14, 10, 0, -10, 14, 8996 },
+    { 0x00e7, 8, 13, 0, -9, 8, 9066 },
+    { 0x00e8, 9, 13, 0, -13, 9, 9118 },
+    { 0x00e9, 9, 13, 0, -13, 9, 9177 },
+    { 0x00ea, 9, 13, 0, -13, 9, 9236 },
+    { 0x00eb, 9, 12, 0, -12, 9, 9295 },
+    { 0x00ec, 5, 13, -1, -13, 4, 9349 },
+    { 0x00ed, 5, 13, 0, -13, 4, 9382 },
+    { 0x00ee, 6, 13, -1, -13, 4, 9415 },
+    { 0x00ef, 6, 12, -1, -12, 4, 9454 },
+    { 0x00f0, 10, 13, 0, -13, 10, 9490 },
+    { 0x00f1, 10, 12, 0, -12, 10, 9555 },
+    { 0x00f2, 10, 13, 0, -13, 10, 9615 },
+    { 0x00f3, 10, 13, 0, -13, 10, 9680 },
+    { 0x00f4, 10, 13, 0, -13, 10, 9745 },
+    { 0x00f5, 10, 12, 0, -12, 10, 9810 },
+    { 0x00f6, 10, 12, 0, -12, 10, 9870 },
+    { 0x00f7, 9, 9, 0, -9, 9, 9930 },
+    { 0x00f8, 10, 9, 0, -9, 10, 9971 },
+    { 0x00f9, 10, 13, 0, -13, 10, 10016 },
+    { 0x00fa, 10, 13, 0, -13, 10, 10081 },
+    { 0x00fb, 10, 13, 0, -13, 10, 10146 },
+    { 0x00fc, 10, 12, 0, -12, 10, 10211 },
+    { 0x00fd, 9, 17, 0, -13, 8, 10271 },
+    { 0x00fe, 10, 17, 0, -13, 10, 10348 },
+    { 0x00ff, 9, 16, 0, -12, 8, 10433 },
+    { 0x0100, 11, 15, 0, -15, 10, 10505 },
+    { 0x0101, 9, 12, 0, -12, 9, 10588 },
+    { 0x0102, 11, 15, 0, -15, 10, 10642 },
+    { 0x0103, 9, 12, 0, -12, 9, 10725 },
+    { 0x0104, 11, 15, 0, -12, 10, 10779 },
+    { 0x0105, 9, 12, 0, -9, 9, 10862 },
+    { 0x0106, 10, 16, 0, -16, 10, 10916 },
+    { 0x0107, 8, 13, 0, -13, 8, 10996 },
+    { 0x0108, 10, 16, 0, -16, 10, 11048 },
+    { 0x0109, 8, 13, 0, -13, 8, 11128 },
+    { 0x010a, 10, 15, 0, -15, 10, 11180 },
+    { 0x010b, 8, 12, 0, -12, 8, 11255 },
+    { 0x010c, 10, 16, 0, -16, 10, 11303 },
+    { 0x010d, 8, 13, 0, -13, 8, 11383 },
+    { 0x010e, 12, 16, 0, -16, 12, 11435 },
+    { 0x010f, 12, 13, 0, -13, 10, 11531 },
+    { 0x0110, 12, 12, 0, -12, 12, 11609 },
+    { 0x0111, 10, 13, 0, -13, 10, 11681 },
+    { 0x0112, 9, 15, 0, -15, 9, 11746 },
+    { 0x0113, 9, 12, 0, -12, 9, 11814 },
+    { 0x0114, 9, 15, 0, -15, 9, 11868 },
+    { 0x0115, 9, 12, 0, -12, 9, 11936 },
+    { 0x0116, 9, 15, 0, -15, 9, 11990 },
+    { 0x0117, 9, 12, 0, -12, 9, 12058 },
+    { 0x0118, 9, 15, 0, -12, 9, 12112 },
+    { 0x0119, 9, 12, 0, -9, 9, 12180 },
+    { 0x011a, 9, 16, 0, -16, 9, 12234 },
+    { 0x011b, 9, 13, 0, -13, 9, 12306 },
+    { 0x011c, 12, 16, 0, -16, 12, 12365 },
+    { 0x011d, 9, 17, 0, -13, 9, 12461 },
+    { 0x011e, 12, 15, 0, -15, 12, 12538 },
+    { 0x011f, 9, 16, 0, -12, 9, 12628 },
+    { 0x0120, 12, 15, 0, -15, 12, 12700 },
+    { 0x0121, 9, 16, 0, -12, 9, 12790 },
+    { 0x0122, 12, 16, 0, -12, 12, 12862 },
+    { 0x0123, 9, 17, 0, -13, 9, 12958 },
+    { 0x0124, 12, 16, 0, -16, 12, 13035 },
+    { 0x0125, 10, 17, 0, -17, 10, 13131 },
+    { 0x0126, 12, 12, 0, -12, 12, 13216 },
+    { 0x0127, 10, 13, 0, -13, 10, 13288 },
+    { 0x0128, 7, 15, -1, -15, 4, 13353 },
+    { 0x0129, 6, 12, -1, -12, 4, 13406 },
+    { 0x012a, 6, 15, -1, -15, 4, 13442 },
+    { 0x012b, 6, 12, -1, -12, 4, 13487 },
+    { 0x012c, 6, 15, -1, -15, 4, 13523 },
+    { 0x012d, 6, 12, -1, -12, 4, 13568 },
+    { 0x012e, 4, 15, 0, -12, 4, 13604 },
+    { 0x012f, 4, 15, 0, -12, 4, 13634 },
+    { 0x0130, 4, 15, 0, -15, 4, 13664 },
+    { 0x0131, 4, 9, 0, -9, 4, 13694 },
+    { 0x0132, 9, 15, 0, -12, 9, 13712 },
+    { 0x0133, 8, 16, 0, -12, 8, 13780 },
+    { 0x0134, 7, 19, -2, -16, 4, 13844 },
+    { 0x0135, 6, 17, -1, -13, 4, 13911 },
+    { 0x0136, 10, 16, 0, -12, 10, 13962 },
+    { 0x0137, 9, 17, 0, -13, 8, 14042 },
+    { 0x0138, 9, 9, 0, -9, 8, 14119 },
+    { 0x0139, 8, 16, 0, -16, 8, 14160 },
+    { 0x013a, 5, 17, 0, -17, 4, 14224 },
+    { 0x013b, 8, 16, 0, -12, 8, 14267 },
+    { 0x013c, 4, 17, 0, -13, 4, 14331 },
+    { 0x013d, 8, 12, 0, -12, 8, 14365 },
+    { 0x013e, 6, 13, 0, -13, 4, 14413 },
+    { 0x013f, 8, 12, 0, -12, 8, 14452 },
+    { 0x0140, 6, 13, 0, -13, 5, 14500 },
+    { 0x0141, 8, 12, 0, -12, 8, 14539 },
+    { 0x0142, 6, 13, -1, -13, 4, 14587 },
+    { 0x0143, 12, 16, 0, -16, 12, 14626 },
+    { 0x0144, 10, 13, 0, -13, 10, 14722 },
+    { 0x0145, 12, 16, 0, -12, 12, 14787 },
+    { 0x0146, 10, 13, 0, -9, 10, 14883 },
+    { 0x0147, 12, 16, 0, -16, 12, 14948 },
+    { 0x0148, 10, 13, 0, -13, 10, 15044 },
+    { 0x0149, 11, 12, 0, -12, 11, 15109 },
+    { 0x014a, 12, 15, 0, -12, 12, 15175 },
+    { 0x014b, 10, 13, 0, -9, 10, 15265 },
+    { 0x014c, 12, 15, 0, -15, 12, 15330 },
+    { 0x014d, 10, 12, 0, -12, 10, 15420 },
+    { 0x014e, 12, 15, 0, -15, 12, 15480 },
+    { 0x014f, 10, 12, 0, -12, 10, 15570 },
+    { 0x0150, 12, 16, 0, -16, 12, 15630 },
+    { 0x0151, 10, 13, 0, -13, 10, 15726 },
+    { 0x0152, 15, 12, 0, -12, 15, 15791 },
+    { 0x0153, 15, 9, 0, -9, 15, 15881 },
+    { 0x0154, 10, 16, 0, -16, 10, 15949 },
+    { 0x0155, 7, 13, 0, -13, 7, 16029 },
+    { 0x0156, 10, 16, 0, -12, 10, 16075 },
+    { 0x0157, 7, 13, 0, -9, 7, 16155 },
+    { 0x0158, 10, 16, 0, -16, 10, 16201 },
+    { 0x0159, 7, 13, 0, -13, 7, 16281 },
+    { 0x015a, 9, 16, 0, -16, 9, 16327 },
+    { 0x015b, 8, 13, 0, -13, 8, 16399 },
+    { 0x015c, 9, 16, 0, -16, 9, 16451 },
+    { 0x015d, 8, 13, 0, -13, 8, 16523 },
+    { 0x015e, 9, 16, 0, -12, 9, 16575 },
+    { 0x015f, 8, 13, 0, -9, 8, 16647 },
+    { 0x0160, 9, 16, 0, -16, 9, 16699 },
+    { 0x0161, 8, 13, 0, -13, 8, 16771 },
+    { 0x0162, 9, 16, 0, -12, 9, 16823 },
+    { 0x0163, 6, 15, 0, -11, 6, 16895 },
+    { 0x0164, 9, 16, 0, -16, 9, 16940 },
+    { 0x0165, 6, 13, 0, -13, 6, 17012 },
+    { 0x0166, 9, 12, 0, -12, 9, 17051 },
+    { 0x0167, 6, 11, 0, -11, 6, 17105 },
+    { 0x0168, 12, 15, 0, -15, 12, 17138 },
+    { 0x0169, 10, 12, 0, -12, 10, 17228 },
+    { 0x016a, 12, 15, 0, -15, 12, 17288 },
+    { 0x016b, 10, 12, 0, -12, 10, 17378 },
+    { 0x016c, 12, 15, 0, -15, 12, 17438 },
+    { 0x016d, 10, 12, 0, -12, 10, 17528 },
+    { 0x016e, 12, 16, 0, -16, 12, 17588 },
+    { 0x016f, 10, 13, 0, -13, 10, 17684 },
+    { 0x0170, 12, 16, 0, -16, 12, 17749 },
+    { 0x0171, 10, 13, 0, -13, 10, 17845 },
+    { 0x0172, 12, 15, 0, -12, 12, 17910 },
+    { 0x0173, 10, 12, 0, -9, 10, 18000 },
+    { 0x0174, 15, 16, 0, -16, 15, 18060 },
+    { 0x0175, 13, 13, 0, -13, 12, 18180 },
+    { 0x0176, 9, 16, 0, -16, 9, 18265 },
+    { 0x0177, 9, 17, 0, -13, 8, 18337 },
+    { 0x0178, 9, 15, 0, -15, 9, 18414 },
+    { 0x0179, 9, 16, 0, -16, 9, 18482 },
+    { 0x017a, 7, 13, 0, -13, 7, 18554 },
+    { 0x017b, 9, 15, 0, -15, 9, 18600 },
+    { 0x017c, 7, 12, 0, -12, 7, 18668 },
+    { 0x017d, 9, 16, 0, -16, 9, 18710 },
+    { 0x017e, 7, 13, 0, -13, 7, 18782 },
+    { 0x017f, 6, 13, 0, -13, 5, 18828 },
+    { 0x2013, 8, 5, 0, -5, 8, 18867 },
+    { 0x2014, 16, 5, 0, -5, 16, 18887 },
+    { 0x2018, 3, 12, 0, -12, 3, 18927 },
+    { 0x2019, 3, 12, 0, -12, 3, 18945 },
+    { 0x201c, 6, 12, 0, -12, 6, 18963 },
+    { 0x201d, 6, 12, 0, -12, 6, 18999 },
+    { 0x2026, 13, 3, 0, -3, 13, 19035 },
+    { 0x20ac, 10, 12, 0, -12, 9, 19055 },
+};
+
+const uint8_t font_large_alpha[] = {
+    0,255,6,0,254,5,0,253,4,0,252,4,0,252,3,0,251,2,0,250,1,0,249,1,0,249,0,0,232,0,0,231,
+    0,0,214,0,0,0,0,0,33,0,16,254,5,48,255,9,0,236,4,96,175,16,255,0,80,159,0,239,0,64,143,0,
+    222,0,32,127,0,204,0,16,111,0,171,0,0,95,0,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,32,143,0,224,10,0,0,0,80,95,0,241,7,0,0,0,128,47,0,244,4,0,
+    0,0,160,14,0,247,1,0,0,0,208,11,0,218,0,0,112,255,255,255,255,255,255,13,64,119,250,121,151,191,119,6,
+    0,0,247,2,80,79,0,0,0,0,218,0,128,31,0,0,0,0,174,0,192,12,0,0,246,255,255,255,255,255,255,1,
+    131,168,159,136,249,139,136,0,0,112,47,0,245,4,0,0,0,160,14,0,248,1,0,0,0,208,11,0,234,0,0,0,
+    0,240,9,0,189,0,0,0,0,243,6,16,143,0,0,0,0,0,0,158,0,0,0,0,0,0,158,0,0,0,0,48,
+    217,255,206,56,0,0,246,191,222,218,143,0,16,255,3,158,0,19,0,48,207,0,158,0,0,0,16,239,2,158,0,0,
+    0,0,249,126,158,0,0,0,0,145,255,223,22,0,0,0,0,130,255,239,8,0,0,0,0,190,232,159,0,0,0,0,
+    158,32,255,1,0,0,0,158,0,254,2,64,4,0,158,112,207,0,112,239,172,239,254,61,0,32,200,237,239,106,0,0,
+    0,0,0,158,0,0,0,0,0,0,158,0,0,0,0,0,0,158,0,0,0,0,195,223,7,0,0,128,63,0,0,16,
+    222,183,111,0,0,226,10,0,0,112,63,0,220,0,0,249,2,0,0,160,14,0,248,1,48,143,0,0,0,176,13,0,
+    247,3,176,30,0,0,0,176,13,0,247,3,244,6,0,0,0,160,14,0,248,1,221,0,0,0,0,96,79,0,221,96,
+    95,161,238,25,0,16,222,183,111,225,11,250,136,191,0,0,195,223,7,248,35,143,0,248,3,0,0,0,32,159,80,79,
+    0,243,6,0,0,0,160,46,96,63,0,242,8,0,0,0,243,8,96,63,0,242,8,0,0,0,235,1,80,79,0,243,
+    6,0,0,80,111,0,32,143,0,248,3,0,0,208,12,0,0,250,136,191,0,0,0,247,4,0,0,145,238,26,0,0,
+    0,179,237,124,0,0,0,0,0,80,255,171,254,10,0,0,0,0,208,79,0,225,63,0,0,0,0,240,14,0,160,95,
+    0,0,0,0,224,14,0,176,63,0,0,0,0,160,127,0,245,13,0,0,0,0,32,255,116,239,3,0,0,0,0,0,
+    245,255,61,0,0,0,0,0,32,250,255,4,0,0,0,0,0,228,175,247,95,0,0,251,3,16,254,5,80,255,6,32,
+    223,0,112,159,0,0,228,127,128,127,0,160,111,0,0,48,254,250,29,0,144,143,0,0,0,226,255,4,0,64,255,5,
+    0,48,249,255,27,0,0,249,239,204,254,191,195,207,1,0,80,235,239,157,4,16,251,28,96,175,0,245,9,64,143,0,
+    242,7,16,111,0,240,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,236,2,0,248,7,0,242,13,0,144,127,0,16,254,1,0,245,11,0,128,127,0,0,252,4,0,208,
+    47,0,0,254,1,0,240,15,0,0,254,1,0,208,47,0,0,252,4,0,144,127,0,0,245,11,0,16,239,1,0,144,
+    127,0,0,243,13,0,0,248,7,0,0,237,2,225,29,0,0,245,10,0,0,252,4,0,80,175,0,0,224,47,0,0,
+    250,6,0,96,175,0,0,243,13,0,16,255,0,0,240,31,0,0,254,2,0,224,31,0,16,255,0,0,242,14,0,96,
+    175,0,0,249,7,0,224,47,0,80,191,0,0,251,4,0,245,10,0,225,29,0,0,0,0,128,175,0,0,0,0,0,
+    246,8,0,0,0,0,80,127,0,0,0,69,0,243,5,48,6,192,239,122,143,233,255,0,185,220,255,239,188,26,0,0,
+    209,238,2,0,0,0,160,79,207,0,0,0,96,191,144,159,0,0,32,254,5,242,95,0,0,96,11,0,121,1,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,
+    0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,192,255,255,255,255,255,7,112,153,153,
+    223,153,153,5,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,
+    0,0,0,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,255,3,64,239,0,112,159,0,176,63,
+    0,224,12,0,242,6,0,240,255,255,11,192,204,204,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,33,0,16,254,5,48,255,9,0,236,4,0,0,0,249,6,0,0,224,30,0,0,80,159,0,0,0,250,
+    4,0,0,241,13,0,0,112,127,0,0,0,252,2,0,0,243,11,0,0,144,95,0,0,0,238,1,0,0,245,9,0,
+    0,176,79,0,0,16,223,0,0,0,247,7,0,0,192,47,0,0,48,191,0,0,0,249,5,0,0,0,0,16,216,238,
+    75,0,0,0,193,239,203,255,7,0,0,249,26,0,210,79,0,16,239,1,0,64,191,0,96,159,0,0,0,254,1,144,
+    111,0,0,0,250,4,176,79,0,0,0,249,6,176,63,0,0,0,248,7,192,63,0,0,0,247,8,176,63,0,0,0,
+    248,7,160,79,0,0,0,248,6,128,111,0,0,0,250,4,80,159,0,0,0,254,1,16,238,1,0,64,207,0,0,248,
+    10,0,210,95,0,0,176,239,187,255,9,0,0,0,199,238,91,0,0,0,0,32,252,6,0,0,0,0,228,255,6,0,
+    0,0,96,239,250,6,0,0,0,248,45,247,6,0,0,0,179,1,248,6,0,0,0,0,0,248,6,0,0,0,0,0,
+    248,6,0,0,0,0,0,248,6,0,0,0,0,0,248,6,0,0,0,0,0,248,6,0,0,0,0,0,248,6,0,0,
+    0,0,0,248,6,0,0,0,0,0,248,6,0,0,0,0,0,248,6,0,0,0,0,0,248,6,0,0,0,0,0,248,
+    6,0,0,0,0,0,248,6,0,0,0,80,234,239,91,0,0,32,252,207,203,255,9,0,48,159,1,0,228,79,0,0,
+    1,0,0,128,159,0,0,0,0,0,80,175,0,0,0,0,0,96,143,0,0,0,0,0,160,79,0,0,0,0,0,244,
+    12,0,0,0,0,16,237,3,0,0,0,0,193,95,0,0,0,0,16,252,6,0,0,0,0,193,111,0,0,0,0,16,
+    252,5,0,0,0,0,209,95,0,0,0,0,32,237,4,0,0,0,0,176,239,204,204,204,204,5,192,255,255,255,255,255,
+    7,0,113,235,239,124,0,0,80,254,206,202,255,28,0,64,109,1,0,210,143,0,0,0,0,0,80,191,0,0,0,0,
+    0,64,175,0,0,0,0,0,160,111,0,0,0,0,82,251,10,0,0,64,255,255,76,0,0,0,48,170,219,239,8,0,
+    0,0,0,0,195,143,0,0,0,0,0,16,254,1,0,0,0,0,0,251,4,0,0,0,0,0,252,4,0,0,0,0,
+    32,255,1,128,4,0,0,194,159,0,208,239,171,202,255,27,0,48,201,253,222,90,0,0,0,0,0,0,251,11,0,0,
+    0,0,112,255,11,0,0,0,0,243,249,11,0,0,0,16,221,243,11,0,0,0,160,79,242,11,0,0,0,246,8,242,
+    11,0,0,32,190,0,242,11,0,0,192,46,0,242,11,0,0,249,5,0,242,11,0,80,143,0,0,242,11,0,226,12,
+    0,0,242,11,0,247,255,255,255,255,255,79,198,204,204,204,252,206,60,0,0,0,0,242,11,0,0,0,0,0,242,11,
+    0,0,0,0,0,242,11,0,0,0,0,0,242,11,0,0,246,255,255,255,47,0,0,248,205,204,204,44,0,0,249,3,
+    0,0,0,0,0,250,2,0,0,0,0,0,251,1,0,0,0,0,0,252,0,0,0,0,0,0,237,0,0,0,0,0,
+    0,239,236,239,124,1,0,0,234,172,202,255,45,0,0,0,0,0,178,207,0,0,0,0,0,16,254,3,0,0,0,0,
+    0,250,5,0,0,0,0,0,251,4,0,0,0,0,16,254,1,64,21,0,0,195,143,0,112,255,188,219,255,10,0,16,
+    199,254,223,74,0,0,0,0,64,217,254,62,0,0,0,250,207,170,59,0,0,160,191,2,0,0,0,0,245,10,0,0,
+    0,0,0,252,2,0,0,0,0,32,191,0,0,0,0,0,80,143,146,253,174,3,0,112,143,222,153,252,79,0,128,255,
+    8,0,80,239,1,144,191,0,0,0,251,5,144,111,0,0,0,247,7,112,111,0,0,0,246,8,64,175,0,0,0,248,
+    6,0,238,2,0,0,253,3,0,247,44,0,128,191,0,0,160,255,171,253,45,0,0,0,181,254,141,1,0,208,255,255,
+    255,255,255,8,176,204,204,204,204,254,7,0,0,0,0,0,253,1,0,0,0,0,80,159,0,0,0,0,0,192,47,0,
+    0,0,0,0,244,11,0,0,0,0,0,251,4,0,0,0,0,48,207,0,0,0,0,0,160,95,0,0,0,0,0,242,
+    13,0,0,0,0,0,249,7,0,0,0,0,32,239,1,0,0,0,0,128,143,0,0,0,0,0,225,47,0,0,0,0,
+    0,247,9,0,0,0,0,16,254,3,0,0,0,0,96,191,0,0,0,0,0,48,218,239,140,1,0,0,245,207,169,253,
+    46,0,0,254,5,0,144,175,0,48,207,0,0,16,239,0,32,207,0,0,32,207,0,0,252,5,0,160,111,0,0,226,
+    175,67,252,8,0,0,16,251,255,78,0,0,0,80,254,252,207,3,0,0,248,60,32,249,95,0,64,207,1,0,80,239,
+    1,160,95,0,0,0,250,5,176,63,0,0,0,247,7,160,95,0,0,0,250,5,80,239,3,0,96,239,1,0,249,191,
+    169,253,78,0,0,64,218,255,141,2,0,0,32,217,223,58,0,0,0,227,223,203,255,6,0,16,253,6,0,228,63,0,
+    96,175,0,0,64,191,0,160,95,0,0,0,252,1,176,63,0,0,0,249,4,176,79,0,0,0,249,6,128,143,0,0,
+    0,253,6,48,239,3,0,161,255,6,0,248,191,169,206,250,5,0,80,235,207,7,251,2,0,0,0,0,0,238,0,0,
+    0,0,0,80,159,0,0,0,0,0,209,63,0,0,0,0,48,252,8,0,0,182,169,253,143,0,0,0,230,239,140,2,
+    0,0,0,236,4,48,255,9,16,254,5,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,
+    16,254,5,48,255,9,0,236,4,16,236,3,64,255,8,16,254,4,0,17,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,32,255,3,64,239,0,112,159,0,176,63,0,224,12,0,242,6,0,0,0,0,0,0,113,6,
+    0,0,0,0,113,254,7,0,0,0,113,254,75,0,0,0,112,254,75,0,0,0,96,253,59,0,0,0,80,253,58,0,
+    0,0,0,192,207,4,0,0,0,0,16,232,207,6,0,0,0,0,16,214,239,40,0,0,0,0,0,181,255,74,0,0,
+    0,0,0,163,255,7,0,0,0,0,0,130,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,144,255,255,255,255,255,4,96,153,153,153,153,153,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,96,153,153,153,153,153,3,144,255,255,255,255,255,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,5,0,0,0,0,0,176,207,5,
+    0,0,0,0,0,214,207,5,0,0,0,0,0,214,207,4,0,0,0,0,0,214,207,4,0,0,0,0,0,197,191,3,
+    0,0,0,0,80,254,7,0,0,0,113,254,108,0,0,0,163,255,75,0,0,0,197,255,57,0,0,0,176,239,40,0,
+    0,0,0,160,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,
+    218,239,124,1,248,223,204,255,12,130,2,0,194,111,0,0,0,80,159,0,0,0,64,159,0,0,0,144,95,0,0,0,
+    246,12,0,0,128,207,1,0,0,249,10,0,0,64,175,0,0,0,128,31,0,0,0,144,14,0,0,0,0,0,0,0,
+    0,16,2,0,0,0,225,111,0,0,0,242,159,0,0,0,192,78,0,0,0,0,0,64,201,254,206,57,0,0,0,0,
+    0,64,252,190,137,185,255,26,0,0,0,0,246,93,0,0,0,129,223,1,0,0,80,191,1,0,0,0,0,244,11,0,
+    0,226,28,0,0,0,0,0,112,95,0,0,249,3,0,180,254,206,8,16,190,0,0,174,0,112,223,121,233,13,0,250,
+    0,64,111,0,243,28,0,224,12,0,248,2,112,63,0,248,5,0,240,11,0,247,2,128,31,0,251,2,0,241,10,0,
+    248,1,128,31,0,250,2,0,244,9,0,220,0,112,47,0,247,6,0,250,11,48,127,0,80,95,0,225,159,183,126,159,
+    232,29,0,32,159,0,48,235,190,3,232,174,1,0,0,251,2,0,0,0,0,0,0,0,0,0,243,28,0,0,0,0,
+    0,0,0,0,0,96,223,5,0,0,0,52,0,0,0,0,0,212,239,155,169,235,127,0,0,0,0,0,0,165,237,239,
+    156,21,0,0,0,0,0,0,246,10,0,0,0,0,0,0,252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,144,
+    79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,207,
+    0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,204,
+    204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,0,
+    0,0,0,247,9,252,3,0,0,0,0,241,30,0,250,255,255,222,90,0,0,0,250,188,187,236,255,10,0,0,250,5,
+    0,0,229,95,0,0,250,5,0,0,128,159,0,0,250,5,0,0,112,159,0,0,250,5,0,0,176,95,0,0,250,5,
+    0,49,249,10,0,0,250,255,255,255,92,0,0,0,250,172,170,219,207,5,0,0,250,5,0,0,211,111,0,0,250,5,
+    0,0,48,239,0,0,250,5,0,0,0,254,2,0,250,5,0,0,0,254,3,0,250,5,0,0,64,255,1,0,250,5,
+    0,0,211,159,0,0,250,188,187,219,255,28,0,0,250,255,255,239,107,0,0,0,0,16,183,254,206,90,1,0,80,254,
+    223,220,255,63,0,112,255,41,0,0,117,0,48,255,5,0,0,0,0,0,251,9,0,0,0,0,0,241,47,0,0,0,
+    0,0,80,207,0,0,0,0,0,0,247,10,0,0,0,0,0,128,159,0,0,0,0,0,0,247,10,0,0,0,0,0,
+    96,207,0,0,0,0,0,0,242,31,0,0,0,0,0,0,253,8,0,0,0,0,0,96,255,4,0,0,0,0,0,160,
+    255,24,0,0,66,0,0,144,255,223,220,254,12,0,0,48,201,254,222,90,0,0,250,255,255,222,73,0,0,0,0,250,
+    188,187,252,255,44,0,0,0,250,5,0,0,197,239,2,0,0,250,5,0,0,0,251,12,0,0,250,5,0,0,0,225,
+    95,0,0,250,5,0,0,0,128,175,0,0,250,5,0,0,0,64,223,0,0,250,5,0,0,0,32,255,0,0,250,5,
+    0,0,0,16,255,0,0,250,5,0,0,0,32,239,0,0,250,5,0,0,0,80,223,0,0,250,5,0,0,0,144,159,
+    0,0,250,5,0,0,0,226,79,0,0,250,5,0,0,16,252,11,0,0,250,5,0,16,230,223,1,0,0,250,188,187,
+    253,255,26,0,0,0,250,255,255,206,56,0,0,0,0,250,255,255,255,239,0,160,223,204,204,204,10,0,250,5,0,0,
+    0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,255,255,255,
+    255,7,0,250,205,204,204,92,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,
+    0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,223,204,204,204,11,0,250,255,255,255,239,0,0,250,255,
+    255,255,239,0,250,205,204,204,172,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,
+    0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,255,255,255,127,0,250,205,204,204,92,0,250,5,0,0,0,0,
+    250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,
+    0,0,0,0,0,0,165,237,223,156,4,0,0,48,253,239,205,254,255,3,0,80,255,58,0,0,97,9,0,32,254,7,
+    0,0,0,0,0,0,251,9,0,0,0,0,0,0,241,47,0,0,0,0,0,0,80,207,0,0,0,0,0,0,0,247,
+    10,0,0,0,0,0,0,128,159,0,0,32,255,255,191,0,247,10,0,0,193,204,253,11,80,207,0,0,0,0,64,191,
+    0,242,31,0,0,0,0,244,11,0,252,8,0,0,0,64,191,0,64,255,4,0,0,0,244,11,0,128,255,41,0,0,
+    80,191,0,0,112,255,239,204,236,255,11,0,0,32,200,254,239,172,38,0,0,250,5,0,0,0,144,95,0,0,250,5,
+    0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,
+    0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,255,255,255,255,255,95,0,0,250,205,204,
+    204,204,236,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,
+    0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,
+    0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,
+    95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,
+    5,0,160,95,0,0,250,5,0,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,
+    3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,252,
+    3,0,0,252,3,0,0,252,3,0,0,252,3,0,0,254,2,0,112,223,0,205,253,95,0,251,190,4,0,0,250,5,
+    0,0,80,223,2,160,95,0,0,64,239,2,0,250,5,0,48,238,3,0,160,95,0,48,238,4,0,0,250,5,32,254,
+    4,0,0,160,95,16,253,5,0,0,0,250,21,252,6,0,0,0,160,111,251,12,0,0,0,0,250,254,254,6,0,0,
+    0,160,255,69,255,3,0,0,0,250,6,128,223,1,0,0,160,95,0,176,175,0,0,0,250,5,0,226,111,0,0,160,
+    95,0,0,244,46,0,0,250,5,0,0,248,29,0,160,95,0,0,0,251,9,0,250,5,0,0,16,254,5,0,250,5,
+    0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,
+    0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,
+    250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,205,204,204,188,0,250,255,
+    255,255,239,0,250,143,0,0,0,0,0,253,95,0,0,250,239,0,0,0,0,64,255,95,0,0,250,251,5,0,0,0,
+    160,191,95,0,0,250,246,11,0,0,0,225,156,95,0,0,250,211,47,0,0,0,246,166,95,0,0,250,131,127,0,0,
+    0,236,161,95,0,0,250,35,223,0,0,48,175,160,95,0,0,250,3,251,4,0,144,79,160,95,0,0,250,3,245,10,
+    0,225,13,160,95,0,0,250,3,224,31,0,245,7,160,95,0,0,250,3,144,111,0,251,1,160,95,0,0,250,3,48,
+    207,32,175,0,160,95,0,0,250,3,0,252,131,79,0,160,95,0,0,250,3,0,246,233,13,0,160,95,0,0,250,3,
+    0,241,255,8,0,160,95,0,0,250,3,0,160,255,2,0,160,95,0,0,250,3,0,64,191,0,0,160,95,0,0,250,
+    29,0,0,0,32,191,0,0,250,159,0,0,0,32,191,0,0,250,254,4,0,0,32,191,0,0,250,247,29,0,0,32,
+    191,0,0,250,178,159,0,0,32,191,0,0,250,34,254,3,0,32,191,0,0,250,3,246,13,0,32,191,0,0,250,3,
+    176,143,0,32,191,0,0,250,3,32,254,3,32,191,0,0,250,3,0,247,12,32,191,0,0,250,3,0,192,143,32,191,
+    0,0,250,3,0,32,255,35,191,0,0,250,3,0,0,247,28,191,0,0,250,3,0,0,192,127,191,0,0,250,3,0,
+    0,48,255,191,0,0,250,3,0,0,0,248,191,0,0,250,3,0,0,0,208,191,0,0,0,48,201,254,190,23,0,0,
+    0,0,144,255,223,220,255,94,0,0,0,160,239,22,0,32,248,95,0,0,96,239,3,0,0,0,246,30,0,0,253,6,
+    0,0,0,0,250,8,0,242,30,0,0,0,0,64,223,0,96,191,0,0,0,0,0,241,31,0,247,10,0,0,0,0,
+    0,254,2,128,159,0,0,0,0,0,208,63,0,247,10,0,0,0,0,0,254,2,96,191,0,0,0,0,0,241,31,0,
+    242,30,0,0,0,0,64,223,0,0,252,6,0,0,0,0,250,8,0,96,239,2,0,0,0,245,30,0,0,160,239,22,
+    0,16,248,95,0,0,0,144,255,207,220,255,94,0,0,0,0,48,201,254,190,23,0,0,0,0,250,255,239,173,5,0,
+    0,250,188,203,254,191,1,0,250,5,0,64,254,9,0,250,5,0,0,244,14,0,250,5,0,0,224,47,0,250,5,0,
+    0,208,63,0,250,5,0,0,241,31,0,250,5,0,0,247,11,0,250,5,16,164,239,3,0,250,255,255,255,61,0,0,
+    250,188,171,72,0,0,0,250,5,0,0,0,0,0,250,5,0,0,0,0,0,250,5,0,0,0,0,0,250,5,0,0,
+    0,0,0,250,5,0,0,0,0,0,250,5,0,0,0,0,0,0,48,201,254,190,23,0,0,0,0,144,255,223,220,255,
+    94,0,0,0,160,239,22,0,32,248,95,0,0,96,239,3,0,0,0,246,30,0,0,253,6,0,0,0,0,250,8,0,
+    242,30,0,0,0,0,64,223,0,96,191,0,0,0,0,0,241,31,0,247,10,0,0,0,0,0,254,2,128,159,0,0,
+    0,0,0,208,63,0,247,10,0,0,0,0,0,254,3,96,191,0,0,0,0,0,241,31,0,242,30,0,0,0,0,64,
+    223,0,0,252,6,0,0,0,0,250,8,0,96,239,2,0,0,0,245,30,0,0,160,239,22,0,16,248,95,0,0,0,
+    144,255,207,220,255,94,0,0,0,0,48,201,254,255,25,0,0,0,0,0,0,0,128,223,2,0,0,0,0,0,0,0,
+    176,223,1,0,0,0,0,0,0,0,209,207,1,0,0,0,0,0,0,0,226,191,0,0,0,250,255,255,190,23,0,0,
+    160,223,187,220,255,45,0,0,250,5,0,32,252,11,0,160,95,0,0,32,255,1,0,250,5,0,0,224,63,0,160,95,
+    0,0,0,254,2,0,250,5,0,0,245,13,0,160,95,0,32,230,79,0,0,250,255,255,255,76,0,0,160,207,187,251,
+    30,0,0,0,250,5,0,250,9,0,0,160,95,0,32,254,3,0,0,250,5,0,112,191,0,0,160,95,0,0,209,95,
+    0,0,250,5,0,0,245,29,0,160,95,0,0,0,252,8,0,250,5,0,0,48,255,2,0,48,217,239,189,22,0,96,
+    255,206,237,255,6,32,255,6,0,48,24,0,247,10,0,0,0,0,128,143,0,0,0,0,0,245,12,0,0,0,0,16,
+    254,42,0,0,0,0,48,253,175,5,0,0,0,16,232,255,109,0,0,0,0,80,251,207,1,0,0,0,0,211,159,0,
+    0,0,0,0,243,14,0,0,0,0,0,255,0,0,0,0,0,243,13,112,21,0,0,212,127,0,251,239,204,254,175,0,
+    64,218,254,223,74,0,0,252,255,255,255,255,255,31,201,204,220,239,204,204,28,0,0,80,159,0,0,0,0,0,80,159,
+    0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,
+    0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,
+    0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,252,
+    3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,
+    0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,
+    251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,
+    0,0,251,4,0,249,6,0,0,0,224,47,0,80,223,0,0,0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,
+    255,205,236,239,5,0,0,0,96,235,239,140,2,0,0,252,4,0,0,0,16,255,114,175,0,0,0,0,246,11,242,30,
+    0,0,0,176,111,0,251,5,0,0,32,239,1,96,191,0,0,0,247,10,0,225,31,0,0,192,79,0,0,250,7,0,
+    48,239,0,0,64,207,0,0,248,8,0,0,224,47,0,208,63,0,0,0,249,8,64,207,0,0,0,48,223,0,249,7,
+    0,0,0,208,63,224,47,0,0,0,0,247,72,191,0,0,0,0,32,207,248,6,0,0,0,0,176,223,30,0,0,0,
+    0,0,246,175,0,0,0,0,0,16,255,4,0,0,0,248,8,0,0,48,255,3,0,0,80,191,244,12,0,0,112,255,
+    8,0,0,144,127,241,31,0,0,192,238,13,0,0,208,63,176,95,0,0,241,188,47,0,0,242,14,112,159,0,0,246,
+    120,127,0,0,246,10,48,223,0,0,250,36,191,0,0,250,6,0,254,1,0,238,0,253,1,0,253,2,0,250,5,64,
+    175,0,248,6,32,223,0,0,246,9,144,95,0,244,10,96,159,0,0,242,13,208,31,0,224,30,160,95,0,0,208,47,
+    242,11,0,160,95,224,31,0,0,144,95,246,7,0,80,159,242,12,0,0,80,159,250,3,0,16,223,246,8,0,0,16,
+    207,221,0,0,0,251,250,4,0,0,0,236,159,0,0,0,246,238,0,0,0,0,248,79,0,0,0,242,191,0,0,0,
+    0,244,14,0,0,0,192,127,0,0,243,30,0,0,0,226,30,128,175,0,0,0,251,5,0,253,4,0,96,175,0,0,
+    243,13,0,225,46,0,0,144,143,0,250,6,0,0,16,253,67,191,0,0,0,0,244,220,46,0,0,0,0,144,255,6,
+    0,0,0,0,112,255,5,0,0,0,0,226,253,30,0,0,0,0,251,132,159,0,0,0,96,175,0,253,4,0,0,225,
+    30,0,244,13,0,0,250,6,0,160,143,0,80,191,0,0,16,254,3,209,47,0,0,0,246,12,249,8,0,0,0,192,
+    127,251,7,0,0,0,225,63,243,30,0,0,0,248,9,160,143,0,0,16,238,2,32,239,1,0,144,143,0,0,248,9,
+    0,242,30,0,0,225,47,0,250,6,0,0,112,175,48,223,0,0,0,16,253,179,95,0,0,0,0,246,253,11,0,0,
+    0,0,192,255,3,0,0,0,0,80,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,
+    0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,176,255,255,255,255,255,7,144,
+    204,204,204,204,255,6,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,
+    0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,
+    251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,
+    0,224,223,204,204,204,204,9,240,255,255,255,255,255,11,16,255,255,79,16,255,170,58,16,239,0,0,16,239,0,0,16,
+    239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,
+    239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,239,0,0,16,255,170,58,16,
+    255,255,79,248,5,0,0,48,191,0,0,0,192,47,0,0,0,246,7,0,0,16,223,0,0,0,160,79,0,0,0,245,
+    9,0,0,0,238,1,0,0,128,111,0,0,0,243,11,0,0,0,252,2,0,0,96,143,0,0,0,241,13,0,0,0,
+    250,4,0,0,80,175,0,0,0,224,30,0,0,0,248,6,246,255,239,0,164,170,239,0,0,0,239,0,0,0,239,0,
+    0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,
+    0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,0,0,239,0,164,170,239,0,
+    246,255,239,0,0,0,144,30,0,0,0,0,16,254,9,0,0,0,0,248,250,2,0,0,0,225,26,158,0,0,0,96,
+    63,128,47,0,0,0,205,0,242,9,0,0,245,5,0,249,2,0,192,13,0,32,159,0,64,127,0,0,144,47,0,235,
+    1,0,0,242,10,243,9,0,0,0,249,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,241,
+    255,255,255,255,207,128,136,136,136,136,104,0,0,243,63,0,0,0,0,0,112,207,0,0,0,0,0,0,249,6,0,0,
+    0,0,0,144,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,218,239,124,0,0,64,255,172,235,175,0,0,96,1,
+    0,226,47,0,0,0,0,0,249,5,0,0,0,0,128,111,0,0,131,219,238,255,6,0,250,190,120,182,111,0,247,28,
+    0,0,248,6,192,79,0,0,160,111,0,253,3,0,16,254,6,176,143,0,32,251,111,0,244,207,186,238,248,6,0,179,
+    254,157,33,111,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,0,
+    0,0,0,0,254,0,0,0,0,0,0,224,15,198,238,124,0,0,0,238,249,172,235,191,0,0,224,239,3,0,193,127,
+    0,0,254,7,0,0,242,14,0,224,63,0,0,0,253,3,0,254,1,0,0,160,95,0,224,15,0,0,0,250,5,0,
+    254,1,0,0,176,95,0,224,63,0,0,0,253,3,0,254,8,0,0,243,13,0,224,239,4,0,193,127,0,0,206,250,
+    172,235,191,0,0,224,9,198,238,108,0,0,0,0,182,254,189,4,16,252,207,219,95,0,250,43,0,32,0,242,30,0,
+    0,0,96,159,0,0,0,0,249,6,0,0,0,160,111,0,0,0,0,249,6,0,0,0,112,159,0,0,0,0,243,30,
+    0,0,0,0,251,27,0,32,2,16,252,190,219,127,0,16,199,254,173,3,0,0,0,0,0,244,10,0,0,0,0,0,
+    64,175,0,0,0,0,0,0,244,10,0,0,0,0,0,64,175,0,0,0,0,0,0,244,10,0,0,129,253,174,67,175,
+    0,0,210,239,170,253,248,10,0,176,175,0,0,248,175,0,48,239,1,0,0,252,10,0,247,9,0,0,112,175,0,144,
+    111,0,0,0,245,10,0,250,6,0,0,80,175,0,144,111,0,0,0,245,10,0,247,9,0,0,112,175,0,48,223,0,
+    0,0,251,10,0,192,159,0,0,247,175,0,0,226,223,170,253,247,10,0,0,146,253,174,3,175,0,0,0,199,238,124,
+    0,0,16,251,190,235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,143,0,0,0,254,2,249,255,255,255,
+    255,63,160,191,153,153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,242,47,0,0,0,0,0,249,61,0,
+    0,67,0,16,251,207,203,254,10,0,0,181,254,222,56,0,0,0,215,239,27,0,144,239,186,11,0,242,30,0,0,0,
+    244,10,0,0,0,245,9,0,0,164,254,239,206,0,150,251,156,121,0,0,245,9,0,0,0,245,9,0,0,0,245,9,
+    0,0,0,245,9,0,0,0,245,9,0,0,0,245,9,0,0,0,245,9,0,0,0,245,9,0,0,0,245,9,0,0,
+    0,245,9,0,0,0,245,9,0,0,0,96,236,255,255,255,9,160,223,120,250,175,37,48,223,1,0,245,11,0,247,7,
+    0,0,254,0,112,127,0,0,224,15,0,244,12,0,64,191,0,0,250,124,150,238,3,0,0,250,254,157,2,0,0,244,
+    7,0,0,0,0,176,14,0,0,0,0,0,252,4,0,0,0,0,80,255,255,239,124,1,32,234,189,187,236,207,16,237,
+    3,0,0,193,79,246,7,0,0,0,248,134,111,0,0,0,160,79,245,12,0,0,96,223,0,251,158,136,217,223,3,0,
+    182,254,223,107,1,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,
+    0,0,0,0,0,254,0,0,0,0,0,0,224,15,181,254,141,1,0,0,254,248,172,235,223,1,0,224,239,4,0,193,
+    127,0,0,254,7,0,0,245,10,0,224,63,0,0,48,207,0,0,254,1,0,0,242,12,0,224,15,0,0,32,207,0,
+    0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,
+    0,0,0,242,12,0,224,15,0,0,32,207,0,0,118,0,16,255,2,0,220,1,0,0,0,0,0,0,0,254,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,
+    0,254,0,0,0,118,0,0,16,255,2,0,0,220,1,0,0,0,0,0,0,0,0,0,0,254,0,0,0,254,0,0,
+    0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,
+    0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,239,0,0,48,207,0,180,234,111,0,227,
+    223,7,0,0,254,0,0,0,0,0,224,15,0,0,0,0,0,254,0,0,0,0,0,224,15,0,0,0,0,0,254,0,
+    0,0,0,0,224,15,0,0,251,8,0,254,0,0,250,9,0,224,15,0,249,9,0,0,254,0,248,10,0,0,224,15,
+    246,11,0,0,0,238,244,30,0,0,0,224,238,255,7,0,0,0,254,76,255,4,0,0,224,15,96,223,1,0,0,254,
+    0,160,191,0,0,224,15,0,209,127,0,0,254,0,0,243,79,0,224,15,0,0,246,29,0,254,0,0,254,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,190,80,236,190,5,80,235,207,7,0,0,222,248,172,252,95,248,
+    172,252,143,0,0,254,62,0,112,239,95,0,64,255,1,0,254,7,0,0,254,9,0,0,251,4,0,254,3,0,0,252,
+    5,0,0,249,5,0,254,1,0,0,251,3,0,0,248,6,0,254,0,0,0,251,3,0,0,248,6,0,254,0,0,0,
+    251,3,0,0,248,6,0,254,0,0,0,251,3,0,0,248,6,0,254,0,0,0,251,3,0,0,248,6,0,254,0,0,
+    0,251,3,0,0,248,6,0,254,0,0,0,251,3,0,0,248,6,0,254,0,0,0,251,3,0,0,248,6,0,190,80,
+    235,223,25,0,0,224,141,223,186,254,29,0,0,254,94,0,16,252,7,0,224,143,0,0,80,175,0,0,254,3,0,0,
+    243,12,0,224,31,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,
+    0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,0,
+    0,182,254,157,2,0,0,16,252,190,218,255,5,0,0,250,26,0,80,239,2,0,242,30,0,0,112,159,0,112,159,0,
+    0,0,242,14,0,249,6,0,0,0,254,1,160,111,0,0,0,208,47,0,248,6,0,0,0,254,1,96,159,0,0,0,
+    242,14,0,241,30,0,0,112,159,0,0,249,27,0,64,238,2,0,16,251,190,202,255,5,0,0,0,182,254,157,2,0,
+    0,0,190,80,236,206,7,0,0,224,157,207,186,255,11,0,0,254,78,0,32,253,7,0,224,127,0,0,64,239,0,0,
+    254,3,0,0,208,63,0,224,31,0,0,0,251,5,0,254,0,0,0,160,95,0,224,31,0,0,0,251,5,0,254,3,
+    0,0,224,63,0,224,143,0,0,80,223,0,0,254,78,0,32,253,7,0,224,174,207,186,255,11,0,0,238,96,236,206,
+    6,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,
+    0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,0,16,216,239,58,224,10,0,32,253,174,218,111,175,0,0,
+    251,10,0,128,255,10,0,243,30,0,0,192,175,0,112,159,0,0,0,248,10,0,249,6,0,0,80,175,0,160,111,0,
+    0,0,245,10,0,249,6,0,0,80,175,0,112,159,0,0,0,247,10,0,243,13,0,0,176,175,0,0,252,9,0,112,
+    255,10,0,32,253,173,218,143,175,0,0,16,217,239,58,244,10,0,0,0,0,0,64,175,0,0,0,0,0,0,244,10,
+    0,0,0,0,0,64,175,0,0,0,0,0,0,244,10,0,0,0,0,0,64,175,0,0,0,0,0,0,244,10,0,0,
+    190,48,234,94,0,206,227,207,77,0,238,173,1,0,0,254,12,0,0,0,254,4,0,0,0,254,1,0,0,0,254,0,
+    0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,
+    0,130,236,222,90,0,226,207,186,253,12,144,111,0,0,50,0,251,2,0,0,0,112,207,2,0,0,0,160,255,91,0,
+    0,0,64,251,239,7,0,0,0,130,254,10,0,0,0,32,253,3,0,0,0,144,95,0,0,0,16,253,2,202,170,185,
+    254,8,80,235,255,190,5,0,0,242,2,0,0,246,2,0,0,251,2,0,229,255,255,223,133,254,137,120,0,252,2,0,
+    0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,251,3,0,0,249,9,0,
+    0,243,207,186,0,64,236,206,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,
+    13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,
+    0,80,175,0,16,239,0,0,0,247,10,0,240,31,0,0,192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,
+    175,0,0,48,234,239,58,240,10,0,252,4,0,0,64,223,112,159,0,0,0,249,7,241,30,0,0,224,47,0,250,5,
+    0,80,191,0,80,191,0,0,250,5,0,224,31,0,241,14,0,0,249,6,96,159,0,0,48,207,0,251,3,0,0,192,
+    47,242,13,0,0,0,247,119,127,0,0,0,16,191,251,2,0,0,0,160,255,11,0,0,0,0,245,95,0,0,0,249,
+    7,0,0,253,9,0,0,251,84,175,0,0,242,223,0,0,240,14,241,14,0,112,191,63,0,64,191,0,252,3,0,236,
+    245,7,0,248,7,128,127,0,242,26,207,0,192,63,0,244,10,96,111,192,47,16,239,0,0,238,0,251,2,247,6,244,
+    9,0,176,63,241,12,32,191,128,95,0,0,247,87,127,0,208,31,252,1,0,48,175,250,2,0,248,245,12,0,0,224,
+    221,12,0,48,207,143,0,0,0,250,127,0,0,224,255,4,0,0,96,255,3,0,0,249,14,0,0,209,79,0,0,160,
+    143,0,244,29,0,80,207,0,0,248,9,16,238,2,0,0,252,4,250,6,0,0,48,223,247,10,0,0,0,112,255,30,
+    0,0,0,0,241,159,0,0,0,0,160,239,63,0,0,0,96,191,243,29,0,0,32,238,2,248,9,0,0,252,6,0,
+    252,5,0,247,10,0,32,239,2,243,30,0,0,112,191,0,252,5,0,0,48,223,96,175,0,0,0,248,8,225,31,0,
+    0,208,47,0,249,7,0,64,207,0,48,207,0,0,249,6,0,192,63,0,224,31,0,0,246,9,64,175,0,0,16,239,
+    0,250,5,0,0,160,79,225,14,0,0,0,244,89,159,0,0,0,0,237,250,3,0,0,0,112,255,12,0,0,0,0,
+    241,127,0,0,0,0,0,254,2,0,0,0,0,244,11,0,0,0,0,176,95,0,0,0,0,96,207,0,0,0,144,202,
+    239,3,0,0,0,234,174,3,0,0,0,0,144,255,255,255,255,2,133,136,136,249,31,0,0,0,176,127,0,0,0,96,
+    191,0,0,0,32,238,2,0,0,0,252,5,0,0,0,247,10,0,0,0,243,29,0,0,0,192,79,0,0,0,128,159,
+    0,0,0,64,223,0,0,0,0,253,138,136,136,40,240,255,255,255,255,4,0,0,96,235,4,0,144,255,59,0,48,239,
+    2,0,0,246,10,0,0,96,143,0,0,0,246,8,0,0,96,143,0,0,0,247,8,0,0,160,111,0,16,166,191,0,
+    0,244,143,0,0,16,182,191,0,0,0,160,111,0,0,0,247,8,0,0,96,143,0,0,0,246,8,0,0,96,143,0,
+    0,0,246,10,0,0,48,239,2,0,0,144,255,59,0,0,96,236,4,0,0,48,127,0,0,0,0,0,243,7,0,0,
+    0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,
+    0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,
+    0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,
+    0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,
+    0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,226,108,0,0,32,251,175,0,0,0,226,63,0,0,0,249,7,
+    0,0,128,127,0,0,0,248,7,0,0,128,127,0,0,0,247,7,0,0,80,191,0,0,0,160,191,38,0,0,112,255,
+    6,0,176,191,38,0,80,191,0,0,0,247,8,0,0,128,127,0,0,0,248,7,0,0,128,127,0,0,0,249,7,0,
+    0,210,79,0,32,235,175,0,0,226,108,0,0,0,32,234,206,40,0,64,6,176,191,234,255,172,252,7,128,2,0,148,
+    253,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,4,48,255,9,16,254,5,0,33,0,
+    0,0,0,0,199,0,0,216,0,0,232,0,0,249,0,0,250,0,0,251,1,0,251,2,0,252,2,0,253,3,0,254,
+    4,0,254,5,0,255,5,0,0,0,242,7,0,0,0,0,0,242,7,0,0,0,0,129,252,223,58,0,0,32,254,207,
+    236,79,0,0,208,175,1,0,3,0,0,245,13,0,0,0,0,0,248,7,0,0,0,0,0,251,5,0,0,0,0,0,
+    251,4,0,0,0,0,0,251,4,0,0,0,0,0,249,7,0,0,0,0,0,245,12,0,0,0,0,0,209,159,1,0,
+    34,0,0,48,254,206,220,111,0,0,0,130,253,223,41,0,0,0,0,242,6,0,0,0,0,0,242,6,0,0,0,0,
+    112,236,206,73,0,0,16,252,190,219,239,1,0,112,191,1,0,66,0,0,192,79,0,0,0,0,0,208,47,0,0,0,
+    0,0,208,47,0,0,0,0,0,208,47,0,0,0,0,0,208,47,0,0,0,0,243,255,255,255,255,1,0,113,231,143,
+    119,119,0,0,0,208,47,0,0,0,0,0,208,47,0,0,0,0,0,224,31,0,0,0,0,0,242,13,0,0,0,0,
+    0,251,4,0,0,0,0,227,239,204,204,204,204,10,244,255,255,255,255,255,12,0,23,0,0,0,82,0,64,191,197,238,
+    90,238,1,0,246,207,152,253,62,0,0,244,8,0,177,30,0,0,218,0,0,32,111,0,0,188,0,0,0,143,0,0,
+    218,0,0,32,111,0,0,245,8,0,177,30,0,0,246,207,152,253,46,0,64,191,198,238,106,238,1,0,23,0,0,0,
+    83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,11,0,0,0,225,30,192,63,
+    0,0,0,248,8,80,191,0,0,16,238,1,0,251,4,0,128,111,0,0,243,12,0,226,13,0,0,160,79,0,249,5,
+    0,0,48,207,32,207,0,0,0,0,249,165,79,0,0,0,0,242,253,11,0,0,0,252,255,255,255,143,0,0,118,135,
+    239,119,71,0,0,0,32,207,0,0,0,0,252,255,255,255,143,0,0,118,135,239,119,71,0,0,0,32,207,0,0,0,
+    0,0,32,207,0,0,0,0,0,32,207,0,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,
+    0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,
+    0,0,0,0,48,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,
+    7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,127,0,0,0,0,0,243,7,0,0,0,0,48,
+    127,0,0,0,0,0,243,7,0,0,0,113,236,239,140,2,0,252,157,169,253,4,48,191,0,0,48,0,48,207,0,0,
+    0,0,0,252,76,0,0,0,0,193,255,142,2,0,0,248,122,252,110,0,32,175,0,64,253,5,80,111,0,0,243,10,
+    64,191,0,0,240,10,0,251,92,0,247,6,0,128,254,190,159,0,0,0,97,252,159,0,0,0,0,64,253,6,0,0,
+    0,0,244,10,48,2,0,0,247,9,128,207,137,201,239,2,48,217,254,206,24,0,0,48,142,0,218,1,0,0,48,142,
+    0,218,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,253,223,73,0,0,0,0,0,194,175,70,100,250,43,0,
+    0,0,64,190,2,0,0,32,235,3,0,0,226,8,32,217,223,41,144,46,0,0,171,0,226,175,168,29,0,187,0,64,
+    47,0,251,5,0,0,0,242,3,144,11,16,207,0,0,0,0,176,8,176,7,64,143,0,0,0,0,128,11,192,6,80,
+    127,0,0,0,0,112,12,176,7,64,127,0,0,0,0,128,11,144,11,32,175,0,0,0,0,176,8,64,47,0,252,4,
+    0,0,0,242,3,0,188,0,227,175,152,12,0,187,0,0,226,8,32,234,223,8,144,46,0,0,64,190,1,0,0,32,
+    235,4,0,0,0,194,175,70,100,250,44,0,0,0,0,0,165,253,223,74,0,0,0,80,235,206,5,0,132,52,249,2,
+    0,0,16,79,0,146,237,255,5,208,76,34,95,32,95,0,244,5,241,58,213,95,0,213,206,228,5,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,167,1,176,7,0,64,207,0,249,7,0,226,46,112,175,0,16,253,3,244,12,0,176,111,32,238,
+    2,0,176,111,32,238,2,0,16,253,3,244,28,0,0,226,46,112,175,0,0,64,207,0,249,7,0,0,167,1,176,7,
+    0,0,0,0,0,0,192,255,255,255,255,255,7,112,153,153,153,153,250,7,0,0,0,0,0,242,7,0,0,0,0,0,
+    242,7,0,0,0,0,0,242,7,0,0,0,0,0,242,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,240,255,255,11,192,204,204,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,164,253,223,73,0,0,0,0,0,194,175,70,100,250,43,0,0,0,64,190,2,0,0,32,235,3,0,0,
+    226,8,244,255,206,4,144,46,0,0,171,0,244,123,233,47,0,187,0,64,47,0,244,7,80,127,0,242,3,144,11,0,
+    244,7,64,143,0,176,8,176,7,0,244,7,194,79,0,128,11,192,6,0,244,255,239,6,0,112,12,176,7,0,244,123,
+    237,1,0,128,11,144,11,0,244,7,246,8,0,176,8,64,47,0,244,7,208,46,0,242,3,0,188,0,244,7,80,159,
+    0,187,0,0,226,8,244,7,0,252,147,46,0,0,64,190,1,0,0,32,235,4,0,0,0,194,175,70,100,250,44,0,
+    0,0,0,0,165,253,223,74,0,0,0,241,255,255,255,255,255,31,113,119,119,119,119,119,23,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,238,59,0,0,236,103,236,
+    2,80,47,0,208,9,112,13,0,144,12,80,63,0,208,9,0,236,103,236,2,0,145,237,59,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,
+    0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,192,255,255,255,255,255,7,112,153,153,
+    223,153,153,5,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,0,0,0,175,0,0,0,
+    0,0,0,105,0,0,0,0,0,0,0,0,0,0,192,255,255,255,255,255,7,112,153,153,153,153,153,5,64,235,190,3,
+    225,107,214,30,32,0,80,79,0,0,96,47,0,0,209,10,0,16,203,1,0,193,28,0,32,173,1,0,210,109,102,70,
+    246,255,255,175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    96,252,190,4,244,89,214,46,16,0,80,79,0,0,178,47,16,255,239,4,0,68,198,45,0,0,16,143,0,0,32,159,
+    169,87,214,63,180,254,173,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,246,30,0,0,0,0,16,254,4,0,0,0,0,144,111,0,0,0,0,0,243,7,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,
+    224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,
+    0,0,48,207,0,0,254,1,0,0,245,12,0,224,63,0,0,160,207,0,0,254,27,0,96,255,12,0,224,255,174,218,
+    159,207,0,0,238,197,239,91,208,12,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,
+    0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,0,64,234,255,255,255,47,0,
+    0,245,255,255,127,99,47,0,16,254,255,255,79,48,47,0,80,255,255,255,79,48,47,0,128,255,255,255,79,48,47,0,
+    160,255,255,255,79,48,47,0,160,255,255,255,79,48,47,0,144,255,255,255,79,48,47,0,96,255,255,255,79,48,47,0,
+    16,255,255,255,79,48,47,0,0,247,255,255,79,48,47,0,0,80,235,222,79,48,47,0,0,0,0,16,79,48,47,0,
+    0,0,0,16,79,48,47,0,0,0,0,16,79,48,47,0,0,0,0,16,79,48,47,0,0,0,0,16,79,48,47,0,
+    0,0,0,16,79,48,47,0,0,0,0,16,79,48,47,0,0,0,0,16,79,48,47,0,0,0,0,16,79,48,47,0,
+    0,236,4,48,255,9,16,254,5,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,93,
+    0,96,207,3,0,194,14,0,128,31,67,213,12,248,157,2,0,178,175,0,96,206,174,0,160,7,173,0,0,0,174,0,
+    0,0,174,0,0,0,174,0,0,0,174,0,0,0,174,0,0,0,174,0,0,0,174,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,223,8,0,232,70,230,8,224,7,0,
+    247,32,79,0,64,47,242,4,0,244,2,126,0,112,14,112,110,100,126,0,112,253,125,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,128,10,32,91,0,0,128,143,16,253,3,0,0,251,6,226,46,0,0,209,79,64,207,1,0,32,238,2,247,10,0,
+    48,238,2,247,10,0,209,79,64,207,1,0,251,6,226,46,0,128,143,16,253,3,0,112,10,32,91,0,0,0,0,0,
+    0,0,0,0,178,159,0,0,0,192,13,0,0,230,236,9,0,0,96,79,0,0,160,7,158,0,0,16,174,0,0,0,
+    0,224,9,0,0,234,1,0,0,0,0,158,0,0,244,6,0,0,0,0,224,9,0,208,12,0,0,0,0,0,158,0,
+    128,63,0,0,0,0,0,224,9,32,143,0,226,15,0,0,0,158,0,219,1,176,255,0,0,0,224,9,246,4,128,189,
+    15,0,0,0,0,225,10,80,63,250,0,0,0,0,144,46,32,110,176,15,0,0,0,64,111,0,156,0,251,0,0,0,
+    0,205,0,246,255,255,255,7,0,0,247,3,32,102,102,252,54,0,0,242,8,0,0,0,176,15,0,0,176,29,0,0,
+    0,0,251,0,0,0,212,79,0,0,0,233,2,0,16,250,251,4,0,0,243,7,0,0,194,68,79,0,0,192,12,0,
+    0,0,0,244,4,0,112,63,0,0,0,0,64,79,0,32,158,0,0,0,0,0,244,4,0,234,1,0,0,0,0,64,
+    79,0,245,5,0,0,0,0,0,244,4,209,11,180,238,43,0,0,64,79,128,47,242,106,214,13,0,0,244,52,127,0,
+    2,0,246,2,0,0,0,220,0,0,0,112,31,0,0,0,246,4,0,0,16,157,0,0,0,225,9,0,0,16,188,0,
+    0,0,160,30,0,0,32,189,1,0,0,64,111,0,0,32,173,0,0,0,16,189,0,0,48,222,102,102,3,0,248,2,
+    0,0,248,255,255,159,0,112,253,190,3,0,0,0,235,1,80,158,101,237,1,0,0,245,5,0,16,0,112,63,0,0,
+    209,11,0,0,0,48,236,1,0,144,47,0,0,32,255,239,3,0,48,127,0,0,0,64,100,205,1,0,220,0,0,0,
+    0,0,32,127,0,247,4,0,0,0,0,0,243,8,226,9,32,238,0,170,86,215,63,160,30,0,252,14,80,235,223,58,
+    80,111,0,201,236,0,0,0,0,16,189,0,230,178,14,0,0,0,0,248,2,227,5,236,0,0,0,0,243,8,209,8,
+    192,14,0,0,0,192,13,112,255,255,255,111,0,0,96,79,0,99,102,214,110,2,0,16,174,0,0,0,0,236,0,0,
+    0,234,1,0,0,0,192,14,0,0,0,209,45,0,0,0,245,127,0,0,0,226,79,0,0,0,16,1,0,0,0,0,
+    0,0,0,0,160,14,0,0,0,192,12,0,0,0,246,8,0,0,96,223,1,0,0,248,28,0,0,128,175,0,0,0,
+    242,13,0,0,0,245,8,0,0,0,245,9,0,0,0,242,62,0,16,69,128,255,188,252,207,0,181,254,190,39,0,16,
+    253,7,0,0,0,0,0,0,243,30,0,0,0,0,0,0,80,175,0,0,0,0,0,0,0,245,5,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,10,0,0,0,0,0,0,252,31,0,0,0,0,0,
+    48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,8,245,9,0,0,0,0,
+    252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,0,0,252,3,0,0,246,
+    255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,0,0,80,207,0,225,30,
+    0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,0,0,0,253,9,0,0,0,0,
+    0,96,207,1,0,0,0,0,0,225,29,0,0,0,0,0,0,218,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,246,10,0,0,0,0,0,0,252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,
+    144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,
+    207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,
+    204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,
+    0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,0,0,252,11,0,0,0,0,0,128,223,127,0,0,0,0,0,
+    246,9,250,5,0,0,0,64,143,0,128,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,246,10,0,0,0,0,0,0,252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,
+    225,13,250,4,0,0,0,0,246,8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,
+    111,0,48,207,0,0,0,225,30,0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,
+    0,0,0,176,111,0,144,127,0,0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,
+    0,0,0,0,241,30,0,0,233,108,0,183,0,0,0,96,175,253,173,110,0,0,0,176,7,96,236,9,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,10,0,0,0,0,0,0,252,31,0,0,0,0,0,
+    48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,8,245,9,0,0,0,0,
+    252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,0,0,252,3,0,0,246,
+    255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,0,0,80,207,0,225,30,
+    0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,0,232,3,210,9,0,0,0,0,
+    232,3,210,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,10,0,0,0,0,0,
+    0,252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,
+    246,8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,
+    30,0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,
+    0,0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,0,
+    48,236,76,0,0,0,0,0,192,42,232,0,0,0,0,0,240,3,242,2,0,0,0,0,192,57,232,0,0,0,0,0,
+    48,236,76,0,0,0,0,0,0,246,10,0,0,0,0,0,0,252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,
+    144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,
+    207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,
+    204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,
+    0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,0,0,0,242,255,255,255,255,255,8,0,0,0,0,249,205,239,
+    204,204,204,6,0,0,0,16,238,65,191,0,0,0,0,0,0,0,128,143,64,191,0,0,0,0,0,0,0,225,31,64,
+    191,0,0,0,0,0,0,0,247,9,64,191,0,0,0,0,0,0,16,254,2,64,191,0,0,0,0,0,0,112,175,0,
+    64,255,255,255,255,1,0,0,224,63,0,64,239,204,204,204,1,0,0,246,11,0,64,191,0,0,0,0,0,0,253,255,
+    255,255,191,0,0,0,0,0,96,239,204,204,220,191,0,0,0,0,0,208,95,0,0,64,191,0,0,0,0,0,245,12,
+    0,0,64,191,0,0,0,0,0,252,5,0,0,64,191,0,0,0,0,80,207,0,0,0,64,239,204,204,204,6,192,79,
+    0,0,0,64,255,255,255,255,8,0,0,16,183,254,206,90,1,0,80,254,223,220,255,63,0,112,255,41,0,0,117,0,
+    48,255,5,0,0,0,0,0,251,9,0,0,0,0,0,241,47,0,0,0,0,0,80,207,0,0,0,0,0,0,247,10,
+    0,0,0,0,0,128,159,0,0,0,0,0,0,247,10,0,0,0,0,0,96,207,0,0,0,0,0,0,242,31,0,0,
+    0,0,0,0,253,8,0,0,0,0,0,96,255,4,0,0,0,0,0,160,255,24,0,0,66,0,0,144,255,223,220,254,
+    12,0,0,48,201,254,222,90,0,0,0,0,208,5,0,0,0,0,0,96,207,4,0,0,0,0,0,32,236,0,0,0,
+    0,0,0,112,31,0,0,0,0,48,84,205,0,0,0,0,0,247,174,2,0,0,0,32,254,6,0,0,0,0,80,223,
+    0,0,0,0,0,112,143,0,0,0,0,0,112,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,
+    255,255,239,0,160,223,204,204,204,10,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,
+    0,0,0,0,0,250,5,0,0,0,0,160,255,255,255,255,7,0,250,205,204,204,92,0,160,95,0,0,0,0,0,250,
+    5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,
+    223,204,204,204,11,0,250,255,255,255,239,0,0,0,0,160,191,0,0,0,0,64,223,2,0,0,0,0,236,3,0,0,
+    0,0,231,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,255,255,239,0,160,223,204,204,204,10,
+    0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,
+    0,160,255,255,255,255,7,0,250,205,204,204,92,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,
+    0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,223,204,204,204,11,0,250,255,255,255,
+    239,0,0,0,64,255,4,0,0,0,32,238,238,2,0,0,16,236,51,206,1,0,0,218,3,48,189,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,250,255,255,255,239,0,160,223,204,204,204,10,0,250,5,0,0,0,0,160,95,0,
+    0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,255,255,255,255,7,0,250,205,
+    204,204,92,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,
+    0,0,0,0,0,250,5,0,0,0,0,160,223,204,204,204,11,0,250,255,255,255,239,0,0,16,189,0,231,4,0,0,
+    209,11,112,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,255,255,239,0,160,223,204,204,204,10,0,
+    250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,
+    160,255,255,255,255,7,0,250,205,204,204,92,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,
+    0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,223,204,204,204,11,0,250,255,255,255,239,
+    0,251,10,0,32,254,3,0,48,206,0,0,48,126,0,0,0,0,0,0,0,0,0,250,5,0,160,95,0,0,250,5,
+    0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,
+    0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,0,0,253,7,0,247,11,0,226,28,0,176,28,0,
+    0,0,0,0,0,0,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,
+    160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,
+    250,5,0,0,226,143,0,0,176,223,79,0,144,111,193,62,112,94,0,177,30,0,0,0,0,0,0,0,0,0,0,160,
+    95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,
+    5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,
+    0,0,0,250,5,0,0,160,95,0,0,219,1,228,167,29,64,110,0,0,0,0,0,0,0,0,250,5,0,160,95,0,
+    0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,
+    160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,0,250,255,255,206,56,0,0,0,160,207,
+    187,203,255,175,1,0,0,250,5,0,16,214,207,1,0,160,95,0,0,0,193,159,0,0,250,5,0,0,0,243,47,0,
+    160,95,0,0,0,0,251,7,0,250,5,0,0,0,112,175,112,255,255,255,207,0,0,245,12,197,254,205,204,9,0,64,
+    207,0,160,95,0,0,0,0,245,11,0,250,5,0,0,0,128,175,0,160,95,0,0,0,0,252,6,0,250,5,0,0,
+    0,244,30,0,160,95,0,0,0,226,143,0,0,250,5,0,32,231,191,0,0,160,207,187,220,255,143,0,0,0,250,255,
+    239,189,39,0,0,0,0,0,32,236,59,0,108,0,0,0,0,176,173,254,188,47,0,0,0,0,241,2,129,222,5,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,29,0,0,0,32,191,0,0,250,159,0,
+    0,0,32,191,0,0,250,254,4,0,0,32,191,0,0,250,247,29,0,0,32,191,0,0,250,178,159,0,0,32,191,0,
+    0,250,34,254,3,0,32,191,0,0,250,3,246,13,0,32,191,0,0,250,3,176,143,0,32,191,0,0,250,3,32,254,
+    3,32,191,0,0,250,3,0,247,12,32,191,0,0,250,3,0,192,143,32,191,0,0,250,3,0,32,255,35,191,0,0,
+    250,3,0,0,247,28,191,0,0,250,3,0,0,192,127,191,0,0,250,3,0,0,48,255,191,0,0,250,3,0,0,0,
+    248,191,0,0,250,3,0,0,0,208,191,0,0,0,0,252,10,0,0,0,0,0,0,0,32,254,3,0,0,0,0,0,
+    0,0,48,206,0,0,0,0,0,0,0,0,64,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,48,201,254,190,23,0,0,0,0,144,255,223,220,255,94,0,0,0,160,239,22,0,32,248,95,
+    0,0,96,239,3,0,0,0,246,30,0,0,253,6,0,0,0,0,250,8,0,242,30,0,0,0,0,64,223,0,96,191,
+    0,0,0,0,0,241,31,0,247,10,0,0,0,0,0,254,2,128,159,0,0,0,0,0,208,63,0,247,10,0,0,0,
+    0,0,254,2,96,191,0,0,0,0,0,241,31,0,242,30,0,0,0,0,64,223,0,0,252,6,0,0,0,0,250,8,
+    0,96,239,2,0,0,0,245,30,0,0,160,239,22,0,16,248,95,0,0,0,144,255,207,220,255,94,0,0,0,0,48,
+    201,254,190,23,0,0,0,0,0,0,0,64,255,2,0,0,0,0,0,0,0,252,6,0,0,0,0,0,0,0,247,8,
+    0,0,0,0,0,0,0,242,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,48,201,254,190,23,0,0,0,0,144,255,223,220,255,94,0,0,0,160,239,22,0,32,248,95,0,0,96,239,3,
+    0,0,0,246,30,0,0,253,6,0,0,0,0,250,8,0,242,30,0,0,0,0,64,223,0,96,191,0,0,0,0,0,
+    241,31,0,247,10,0,0,0,0,0,254,2,128,159,0,0,0,0,0,208,63,0,247,10,0,0,0,0,0,254,2,96,
+    191,0,0,0,0,0,241,31,0,242,30,0,0,0,0,64,223,0,0,252,6,0,0,0,0,250,8,0,96,239,2,0,
+    0,0,245,30,0,0,160,239,22,0,16,248,95,0,0,0,144,255,207,220,255,94,0,0,0,0,48,201,254,190,23,0,
+    0,0,0,0,0,32,255,7,0,0,0,0,0,0,16,252,254,3,0,0,0,0,0,0,250,37,237,2,0,0,0,0,
+    0,232,4,16,220,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,201,254,
+    190,23,0,0,0,0,144,255,223,220,255,94,0,0,0,160,239,22,0,32,248,95,0,0,96,239,3,0,0,0,246,30,
+    0,0,253,6,0,0,0,0,250,8,0,242,30,0,0,0,0,64,223,0,96,191,0,0,0,0,0,241,31,0,247,10,
+    0,0,0,0,0,254,2,128,159,0,0,0,0,0,208,63,0,247,10,0,0,0,0,0,254,2,96,191,0,0,0,0,
+    0,241,31,0,242,30,0,0,0,0,64,223,0,0,252,6,0,0,0,0,250,8,0,96,239,2,0,0,0,245,30,0,
+    0,160,239,22,0,16,248,95,0,0,0,144,255,207,220,255,94,0,0,0,0,48,201,254,190,23,0,0,0,0,0,16,
+    235,75,0,139,0,0,0,0,0,218,234,207,251,3,0,0,0,0,224,4,113,237,6,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,236,239,123,1,0,0,0,0,249,255,205,253,239,5,0,0,
+    0,250,110,1,0,130,255,5,0,0,246,62,0,0,0,96,239,1,0,208,111,0,0,0,0,160,143,0,32,239,1,0,
+    0,0,0,244,13,0,246,11,0,0,0,0,16,255,1,112,175,0,0,0,0,0,224,47,0,248,9,0,0,0,0,0,
+    253,3,112,175,0,0,0,0,0,224,47,0,246,11,0,0,0,0,16,255,1,32,239,1,0,0,0,0,244,13,0,192,
+    111,0,0,0,0,160,143,0,0,246,46,0,0,0,80,239,1,0,0,250,110,1,0,129,255,5,0,0,0,249,255,204,
+    253,239,5,0,0,0,0,147,236,239,123,1,0,0,0,0,0,218,2,227,7,0,0,0,0,0,160,45,48,126,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,201,254,190,23,0,0,0,0,144,
+    255,223,220,255,94,0,0,0,160,239,22,0,32,248,95,0,0,96,239,3,0,0,0,246,30,0,0,253,6,0,0,0,
+    0,250,8,0,242,30,0,0,0,0,64,223,0,96,191,0,0,0,0,0,241,31,0,247,10,0,0,0,0,0,254,2,
+    128,159,0,0,0,0,0,208,63,0,247,10,0,0,0,0,0,254,2,96,191,0,0,0,0,0,241,31,0,242,30,0,
+    0,0,0,64,223,0,0,252,6,0,0,0,0,250,8,0,96,239,2,0,0,0,245,30,0,0,160,239,22,0,16,248,
+    95,0,0,0,144,255,207,220,255,94,0,0,0,0,48,201,254,190,23,0,0,0,0,40,0,0,0,85,0,48,223,2,
+    0,80,223,0,0,245,45,0,245,45,0,0,80,223,82,223,2,0,0,0,245,254,45,0,0,0,0,128,255,4,0,0,
+    0,0,245,254,45,0,0,0,80,223,82,223,2,0,0,245,45,0,245,45,0,48,223,2,0,80,223,0,0,39,0,0,
+    0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,201,254,190,39,170,
+    1,0,0,144,255,223,236,255,255,8,0,0,160,239,22,0,32,251,79,0,0,96,239,3,0,0,226,254,30,0,0,253,
+    6,0,0,192,79,251,8,0,242,30,0,0,144,143,80,207,0,96,191,0,0,80,191,0,241,31,0,247,10,0,32,238,
+    2,0,254,2,128,159,0,0,252,4,0,208,63,0,247,10,0,248,8,0,0,254,2,96,191,0,244,12,0,0,241,31,
+    0,242,30,225,46,0,0,64,223,0,0,253,182,95,0,0,0,250,8,0,96,255,159,0,0,0,245,30,0,0,176,255,
+    23,0,16,248,95,0,0,32,254,255,223,220,255,94,0,0,0,212,52,217,254,190,23,0,0,0,0,0,96,239,1,0,
+    0,0,0,0,0,160,159,0,0,0,0,0,0,0,176,63,0,0,0,0,0,0,0,177,13,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,
+    3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,
+    0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,
+    251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,0,0,251,4,0,249,6,0,0,0,224,47,0,80,223,0,0,
+    0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,255,205,236,239,5,0,0,0,96,235,239,140,2,0,0,0,0,
+    0,0,225,127,0,0,0,0,0,0,128,175,0,0,0,0,0,0,48,207,1,0,0,0,0,0,0,204,1,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,
+    251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,
+    0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,
+    0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,0,0,251,4,0,249,6,0,0,0,224,47,0,
+    80,223,0,0,0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,255,205,236,239,5,0,0,0,96,235,239,140,2,
+    0,0,0,0,0,176,207,0,0,0,0,0,0,112,223,143,0,0,0,0,0,80,175,144,111,0,0,0,0,48,159,0,
+    128,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,176,79,0,192,63,
+    0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,
+    192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,
+    79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,0,0,251,4,0,249,6,0,0,
+    0,224,47,0,80,223,0,0,0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,255,205,236,239,5,0,0,0,96,
+    235,239,140,2,0,0,0,0,96,94,16,189,0,0,0,0,0,230,5,209,11,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,
+    79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,
+    0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,
+    0,0,0,176,79,0,176,63,0,0,0,0,251,4,0,249,6,0,0,0,224,47,0,80,223,0,0,0,96,207,0,0,
+    192,191,2,0,112,255,4,0,0,194,255,205,236,239,5,0,0,0,96,235,239,140,2,0,0,0,0,0,192,159,0,0,
+    0,0,0,246,28,0,0,0,0,16,222,2,0,0,0,0,160,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,251,7,0,0,0,225,63,243,30,0,0,0,248,9,160,143,0,0,16,238,2,32,239,1,0,144,143,0,0,
+    248,9,0,242,30,0,0,225,47,0,250,6,0,0,112,175,48,223,0,0,0,16,253,179,95,0,0,0,0,246,253,11,
+    0,0,0,0,192,255,3,0,0,0,0,80,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,
+    64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,250,5,0,0,0,
+    0,0,160,95,0,0,0,0,0,0,250,5,0,0,0,0,0,160,255,255,223,107,1,0,0,250,188,187,253,223,2,0,
+    160,95,0,0,195,207,0,0,250,5,0,0,225,63,0,160,95,0,0,0,251,6,0,250,5,0,0,160,111,0,160,95,
+    0,0,0,253,4,0,250,5,0,0,245,14,0,160,95,0,49,248,95,0,0,250,255,255,255,94,0,0,160,207,187,138,
+    5,0,0,0,250,5,0,0,0,0,0,160,95,0,0,0,0,0,0,250,5,0,0,0,0,0,0,16,200,254,190,5,
+    0,0,32,254,190,202,255,9,0,0,249,26,0,48,254,2,0,208,47,0,0,176,79,0,0,254,0,0,16,238,1,0,
+    224,15,0,32,253,6,0,0,254,0,48,238,5,0,0,224,15,0,252,4,0,0,0,254,0,208,31,0,0,0,224,15,
+    0,249,44,0,0,0,254,0,0,250,110,0,0,224,15,0,0,230,159,0,0,254,0,0,0,210,95,0,224,15,0,0,
+    0,244,11,0,254,0,0,0,32,207,0,224,15,0,0,0,247,10,0,254,0,190,154,252,62,0,224,15,128,236,223,42,
+    0,0,128,223,0,0,0,0,0,192,111,0,0,0,0,0,209,46,0,0,0,0,0,210,11,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,64,218,239,124,0,0,64,255,172,235,175,0,0,96,1,0,226,47,0,0,0,0,0,
+    249,5,0,0,0,0,128,111,0,0,131,219,238,255,6,0,250,190,120,182,111,0,247,28,0,0,248,6,192,79,0,0,
+    160,111,0,253,3,0,16,254,6,176,143,0,32,251,111,0,244,207,186,238,248,6,0,179,254,157,33,111,0,0,0,0,
+    208,143,0,0,0,0,112,191,0,0,0,0,32,206,1,0,0,0,0,219,1,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,64,218,239,124,0,0,64,255,172,235,175,0,0,96,1,0,226,47,0,0,0,0,0,249,5,0,0,
+    0,0,128,111,0,0,131,219,238,255,6,0,250,190,120,182,111,0,247,28,0,0,248,6,192,79,0,0,160,111,0,253,
+    3,0,16,254,6,176,143,0,32,251,111,0,244,207,186,238,248,6,0,179,254,157,33,111,0,0,0,160,223,0,0,0,
+    0,96,223,159,0,0,0,64,191,129,127,0,0,32,158,0,112,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,64,218,239,124,0,0,64,255,172,235,175,0,0,96,1,0,226,47,0,0,0,0,0,249,5,0,0,0,0,128,111,
+    0,0,131,219,238,255,6,0,250,190,120,182,111,0,247,28,0,0,248,6,192,79,0,0,160,111,0,253,3,0,16,254,
+    6,176,143,0,32,251,111,0,244,207,186,238,248,6,0,179,254,157,33,111,0,0,112,222,23,80,14,0,64,175,252,174,
+    158,0,0,169,0,180,190,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,253,206,7,0,0,244,207,186,
+    254,10,0,0,22,0,32,254,2,0,0,0,0,144,95,0,0,0,0,0,248,6,0,48,184,237,254,111,0,160,239,139,
+    103,251,6,112,207,1,0,128,111,0,252,4,0,0,250,6,208,63,0,0,225,111,0,251,8,0,178,255,6,64,255,172,
+    235,142,111,0,48,235,223,25,242,6,0,128,62,32,157,0,0,0,232,3,210,9,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,64,218,239,124,0,0,64,255,172,235,175,0,0,96,1,0,226,47,0,0,0,0,0,249,5,0,0,
+    0,0,128,111,0,0,131,219,238,255,6,0,250,190,120,182,111,0,247,28,0,0,248,6,192,79,0,0,160,111,0,253,
+    3,0,16,254,6,176,143,0,32,251,111,0,244,207,186,238,248,6,0,179,254,157,33,111,0,0,0,161,222,6,0,0,
+    0,144,60,246,3,0,0,0,124,0,109,0,0,0,144,60,246,3,0,0,0,161,222,6,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,164,253,206,7,0,0,244,207,186,254,10,0,0,22,0,32,254,2,0,0,0,0,144,95,
+    0,0,0,0,0,248,6,0,48,184,237,254,111,0,160,239,139,103,251,6,112,207,1,0,128,111,0,252,4,0,0,250,
+    6,208,63,0,0,225,111,0,251,8,0,178,255,6,64,255,172,235,142,111,0,48,235,223,25,242,6,0,0,0,0,0,
+    0,0,0,0,0,0,16,183,254,174,3,162,254,157,1,0,0,250,190,202,255,229,191,218,223,1,0,48,5,0,112,255,
+    79,0,144,175,0,0,0,0,0,240,143,0,0,225,31,0,0,0,0,0,253,4,0,0,252,4,0,64,201,237,255,239,
+    238,238,254,95,0,160,239,138,103,254,154,153,153,153,3,112,207,1,0,224,63,0,0,0,0,0,252,4,0,16,255,6,
+    0,0,0,0,208,63,0,0,245,191,0,0,0,0,0,250,8,0,227,204,143,0,0,82,0,48,255,172,252,45,210,239,
+    187,253,12,0,48,235,222,24,0,129,237,223,73,0,0,0,182,254,189,4,16,252,207,219,95,0,250,43,0,32,0,242,
+    30,0,0,0,96,159,0,0,0,0,249,6,0,0,0,160,111,0,0,0,0,249,6,0,0,0,112,159,0,0,0,0,
+    243,30,0,0,0,0,251,27,0,32,2,16,252,190,219,127,0,16,199,254,173,3,0,0,226,3,0,0,0,128,191,2,
+    0,0,0,48,190,0,0,0,0,160,13,0,0,48,100,158,0,0,0,250,141,1,0,0,32,254,5,0,0,0,0,80,
+    223,0,0,0,0,0,112,143,0,0,0,0,0,112,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    199,238,124,0,0,16,251,190,235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,143,0,0,0,254,2,249,
+    255,255,255,255,63,160,191,153,153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,242,47,0,0,0,0,0,
+    249,61,0,0,67,0,16,251,207,203,254,10,0,0,181,254,222,56,0,0,0,0,112,223,1,0,0,0,16,254,3,0,
+    0,0,0,250,5,0,0,0,0,245,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,238,124,0,
+    0,16,251,190,235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,143,0,0,0,254,2,249,255,255,255,255,
+    63,160,191,153,153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,242,47,0,0,0,0,0,249,61,0,0,
+    67,0,16,251,207,203,254,10,0,0,181,254,222,56,0,0,0,80,255,4,0,0,0,32,238,222,1,0,0,16,237,67,
+    206,1,0,0,219,2,48,189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,238,124,0,0,16,251,190,
+    235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,143,0,0,0,254,2,249,255,255,255,255,63,160,191,153,
+    153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,242,47,0,0,0,0,0,249,61,0,0,67,0,16,251,
+    207,203,254,10,0,0,181,254,222,56,0,0,32,173,0,232,3,0,0,210,10,128,62,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,199,238,124,0,0,16,251,190,235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,
+    143,0,0,0,254,2,249,255,255,255,255,63,160,191,153,153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,
+    242,47,0,0,0,0,0,249,61,0,0,67,0,16,251,207,203,254,10,0,0,181,254,222,56,0,244,63,0,0,248,11,
+    0,0,250,5,0,0,234,1,0,0,0,0,0,0,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,
+    0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,16,254,
+    6,0,249,10,0,243,11,0,208,27,0,0,0,0,0,0,0,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,
+    0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,
+    0,244,95,0,32,238,238,2,193,78,227,28,218,3,32,189,0,0,0,0,0,0,0,0,0,224,15,0,0,224,15,0,
+    0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,
+    0,224,15,0,0,224,15,0,0,224,15,0,210,10,128,62,210,10,128,62,0,0,0,0,0,0,0,0,0,224,15,0,
+    0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,
+    0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,0,194,5,16,73,0,0,0,229,191,231,127,0,0,0,
+    16,253,207,2,0,0,0,179,223,239,3,0,0,16,238,6,245,29,0,0,0,19,0,128,143,0,0,0,0,0,0,253,
+    2,0,16,216,238,141,247,7,0,227,239,171,252,254,12,0,253,8,0,48,253,15,80,191,0,0,0,243,31,144,127,0,
+    0,0,208,47,160,95,0,0,0,208,31,144,111,0,0,0,224,14,80,191,0,0,0,244,10,0,252,24,0,48,253,3,
+    0,210,239,171,252,111,0,0,16,199,254,173,3,0,0,0,232,125,1,213,0,0,0,244,202,239,234,8,0,0,144,9,
+    80,236,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,11,181,254,157,1,0,0,222,248,173,235,
+    223,1,0,224,239,5,0,193,127,0,0,254,8,0,0,245,10,0,224,63,0,0,48,207,0,0,254,1,0,0,242,12,
+    0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,
+    15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,0,251,11,0,0,0,0,0,16,253,
+    4,0,0,0,0,0,48,222,0,0,0,0,0,0,48,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,182,254,157,2,0,0,16,252,190,218,255,5,0,0,250,26,0,80,239,2,0,242,30,0,0,112,159,0,
+    112,159,0,0,0,242,14,0,249,6,0,0,0,254,1,160,111,0,0,0,208,47,0,248,6,0,0,0,254,1,96,159,
+    0,0,0,242,14,0,241,30,0,0,112,159,0,0,249,27,0,64,238,2,0,16,251,190,202,255,5,0,0,0,182,254,
+    157,2,0,0,0,0,0,96,239,1,0,0,0,0,16,254,4,0,0,0,0,0,249,6,0,0,0,0,0,243,7,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,182,254,157,2,0,0,16,252,190,218,255,5,0,
+    0,250,26,0,80,239,2,0,242,30,0,0,112,159,0,112,159,0,0,0,242,14,0,249,6,0,0,0,254,1,160,111,
+    0,0,0,208,47,0,248,6,0,0,0,254,1,96,159,0,0,0,242,14,0,241,30,0,0,112,159,0,0,249,27,0,
+    64,238,2,0,16,251,190,202,255,5,0,0,0,182,254,157,2,0,0,0,0,32,254,8,0,0,0,0,0,252,253,4,
+    0,0,0,0,249,22,236,3,0,0,0,231,5,16,219,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,182,254,157,2,0,0,16,252,190,218,255,5,0,0,250,26,0,80,239,2,0,242,30,0,0,112,159,0,112,159,
+    0,0,0,242,14,0,249,6,0,0,0,254,1,160,111,0,0,0,208,47,0,248,6,0,0,0,254,1,96,159,0,0,
+    0,242,14,0,241,30,0,0,112,159,0,0,249,27,0,64,238,2,0,16,251,190,202,255,5,0,0,0,182,254,157,2,
+    0,0,0,16,235,75,0,138,0,0,0,234,234,207,250,3,0,0,224,4,113,237,7,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,96,235,223,41,0,0,0,193,239,171,253,95,0,0,160,175,1,0,245,46,0,32,239,
+    1,0,0,247,9,0,247,9,0,0,32,239,0,144,111,0,0,0,224,31,0,250,6,0,0,0,253,2,128,111,0,0,
+    0,224,31,0,246,9,0,0,32,239,0,16,239,1,0,0,247,9,0,144,191,1,0,228,46,0,0,177,239,171,252,95,
+    0,0,0,96,235,223,41,0,0,0,0,204,0,230,5,0,0,0,192,12,96,94,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,182,254,157,2,0,0,16,252,190,218,255,5,0,0,250,26,0,80,239,2,0,242,30,
+    0,0,112,159,0,112,159,0,0,0,242,14,0,249,6,0,0,0,254,1,160,111,0,0,0,208,47,0,248,6,0,0,
+    0,254,1,96,159,0,0,0,242,14,0,241,30,0,0,112,159,0,0,249,27,0,64,238,2,0,16,251,190,202,255,5,
+    0,0,0,182,254,157,2,0,0,0,0,48,206,0,0,0,0,0,112,255,2,0,0,0,0,32,155,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,192,255,255,255,255,255,7,112,153,153,153,153,153,5,0,0,0,0,0,0,
+    0,0,0,32,156,0,0,0,0,0,112,255,2,0,0,0,0,48,206,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,3,0,0,96,235,222,120,143,0,0,193,239,171,253,223,
+    1,0,160,175,1,0,252,46,0,32,239,1,0,247,253,9,0,247,9,0,244,44,239,0,144,111,0,209,46,224,31,0,
+    250,6,176,95,0,253,2,144,127,112,143,0,224,31,0,246,57,207,0,32,239,0,32,239,237,2,0,247,9,0,144,255,
+    6,0,228,46,0,0,246,239,171,252,95,0,0,225,109,235,223,41,0,0,0,88,0,0,0,0,0,0,0,0,253,8,
+    0,0,0,0,0,48,238,2,0,0,0,0,0,80,175,0,0,0,0,0,0,80,95,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,
+    241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,
+    0,0,80,175,0,16,239,0,0,0,247,10,0,240,31,0,0,192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,
+    127,175,0,0,48,234,239,58,240,10,0,0,0,0,32,255,5,0,0,0,0,0,250,9,0,0,0,0,0,244,11,0,
+    0,0,0,0,208,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,223,0,0,0,244,10,0,
+    241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,
+    0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,80,175,0,16,239,0,0,0,247,10,0,240,31,0,0,
+    192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,175,0,0,48,234,239,58,240,10,0,0,0,16,254,9,0,
+    0,0,0,0,251,253,5,0,0,0,0,249,23,236,3,0,0,0,246,6,16,234,2,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,
+    0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,
+    80,175,0,16,239,0,0,0,247,10,0,240,31,0,0,192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,175,
+    0,0,48,234,239,58,240,10,0,0,0,219,1,229,6,0,0,0,176,29,80,110,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,
+    0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,
+    80,175,0,16,239,0,0,0,247,10,0,240,31,0,0,192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,175,
+    0,0,48,234,239,58,240,10,0,0,0,0,243,79,0,0,0,0,176,127,0,0,0,0,80,159,0,0,0,0,16,174,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,5,0,0,48,223,96,175,0,0,0,248,8,225,31,0,
+    0,208,47,0,249,7,0,64,207,0,48,207,0,0,249,6,0,192,63,0,224,31,0,0,246,9,64,175,0,0,16,239,
+    0,250,5,0,0,160,79,225,14,0,0,0,244,89,159,0,0,0,0,237,250,3,0,0,0,112,255,12,0,0,0,0,
+    241,127,0,0,0,0,0,254,2,0,0,0,0,244,11,0,0,0,0,176,95,0,0,0,0,96,207,0,0,0,144,202,
+    239,3,0,0,0,234,174,3,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,
+    0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,197,238,108,0,0,0,254,249,172,235,191,0,
+    0,224,239,4,0,193,127,0,0,254,7,0,0,243,14,0,224,47,0,0,0,253,3,0,254,1,0,0,160,95,0,224,
+    15,0,0,0,250,5,0,254,1,0,0,176,95,0,224,63,0,0,0,253,2,0,254,8,0,0,243,13,0,224,239,4,
+    0,193,127,0,0,238,250,172,235,191,0,0,224,15,198,238,108,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,
+    0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,
+    0,210,10,128,62,0,0,32,173,0,232,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,5,0,0,48,223,
+    96,175,0,0,0,248,8,225,31,0,0,208,47,0,249,7,0,64,207,0,48,207,0,0,249,6,0,192,63,0,224,31,
+    0,0,246,9,64,175,0,0,16,239,0,250,5,0,0,160,79,225,14,0,0,0,244,89,159,0,0,0,0,237,250,3,
+    0,0,0,112,255,12,0,0,0,0,241,127,0,0,0,0,0,254,2,0,0,0,0,244,11,0,0,0,0,176,95,0,
+    0,0,0,96,207,0,0,0,144,202,239,3,0,0,0,234,174,3,0,0,0,0,0,0,151,153,153,57,0,0,0,0,
+    251,255,255,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,10,0,0,0,0,0,
+    0,252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,
+    246,8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,
+    30,0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,
+    0,0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,80,
+    153,153,153,4,0,0,249,255,255,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,218,239,124,0,0,64,
+    255,172,235,175,0,0,96,1,0,226,47,0,0,0,0,0,249,5,0,0,0,0,128,111,0,0,131,219,238,255,6,0,
+    250,190,120,182,111,0,247,28,0,0,248,6,192,79,0,0,160,111,0,253,3,0,16,254,6,176,143,0,32,251,111,0,
+    244,207,186,238,248,6,0,179,254,157,33,111,0,0,0,94,0,64,31,0,0,0,0,249,154,235,10,0,0,0,0,128,
+    253,141,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,10,0,0,0,0,0,0,
+    252,31,0,0,0,0,0,48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,
+    8,245,9,0,0,0,0,252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,
+    0,0,252,3,0,0,246,255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,
+    0,0,80,207,0,225,30,0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,0,0,0,0,241,30,0,192,8,
+    0,242,4,0,0,246,155,234,12,0,0,0,214,222,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,
+    253,206,7,0,0,244,207,186,254,10,0,0,22,0,32,254,2,0,0,0,0,144,95,0,0,0,0,0,248,6,0,48,
+    184,237,254,111,0,160,239,139,103,251,6,112,207,1,0,128,111,0,252,4,0,0,250,6,208,63,0,0,225,111,0,251,
+    8,0,178,255,6,64,255,172,235,142,111,0,48,235,223,25,242,6,0,0,0,246,10,0,0,0,0,0,0,252,31,0,
+    0,0,0,0,48,207,127,0,0,0,0,0,144,79,223,0,0,0,0,0,225,13,250,4,0,0,0,0,246,8,245,9,
+    0,0,0,0,252,2,224,30,0,0,0,48,207,0,144,111,0,0,0,144,111,0,48,207,0,0,0,225,30,0,0,252,
+    3,0,0,246,255,255,255,255,9,0,0,252,204,204,204,252,30,0,48,223,0,0,0,176,111,0,144,127,0,0,0,80,
+    207,0,225,30,0,0,0,0,253,3,246,9,0,0,0,0,247,9,252,3,0,0,0,0,242,31,0,0,0,0,0,0,
+    217,1,0,0,0,0,0,80,63,0,0,0,0,0,0,160,15,0,0,0,0,0,0,144,143,22,0,0,0,0,0,32,
+    235,45,0,64,218,239,124,0,0,64,255,172,235,175,0,0,96,1,0,226,47,0,0,0,0,0,249,5,0,0,0,0,
+    128,111,0,0,131,219,238,255,6,0,250,190,120,182,111,0,247,28,0,0,248,6,192,79,0,0,160,111,0,253,3,0,
+    16,254,6,176,143,0,32,251,111,0,244,207,186,238,248,6,0,179,254,157,49,127,0,0,0,0,16,172,0,0,0,0,
+    0,232,1,0,0,0,0,208,12,0,0,0,0,0,252,102,0,0,0,0,48,252,13,0,0,0,0,80,239,2,0,0,
+    0,0,0,253,5,0,0,0,0,0,247,7,0,0,0,0,0,242,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,16,183,254,206,90,1,0,80,254,223,220,255,63,0,112,255,41,0,0,117,0,48,255,5,0,0,
+    0,0,0,251,9,0,0,0,0,0,241,47,0,0,0,0,0,80,207,0,0,0,0,0,0,247,10,0,0,0,0,0,
+    128,159,0,0,0,0,0,0,247,10,0,0,0,0,0,96,207,0,0,0,0,0,0,242,31,0,0,0,0,0,0,253,
+    8,0,0,0,0,0,96,255,4,0,0,0,0,0,160,255,24,0,0,66,0,0,144,255,223,220,254,12,0,0,48,201,
+    254,222,90,0,0,0,0,144,207,0,0,0,48,239,2,0,0,0,236,3,0,0,0,230,4,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,182,254,189,4,16,252,207,219,95,0,250,43,0,32,0,242,30,0,0,0,96,159,0,0,0,
+    0,249,6,0,0,0,160,111,0,0,0,0,249,6,0,0,0,112,159,0,0,0,0,243,30,0,0,0,0,251,27,0,
+    32,2,16,252,190,219,127,0,16,199,254,173,3,0,0,0,48,255,6,0,0,0,0,16,253,238,2,0,0,0,0,251,
+    52,222,1,0,0,0,233,3,32,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,183,254,206,
+    90,1,0,80,254,223,220,255,63,0,112,255,41,0,0,117,0,48,255,5,0,0,0,0,0,251,9,0,0,0,0,0,
+    241,47,0,0,0,0,0,80,207,0,0,0,0,0,0,247,10,0,0,0,0,0,128,159,0,0,0,0,0,0,247,10,
+    0,0,0,0,0,96,207,0,0,0,0,0,0,242,31,0,0,0,0,0,0,253,8,0,0,0,0,0,96,255,4,0,
+    0,0,0,0,160,255,24,0,0,66,0,0,144,255,223,220,254,12,0,0,48,201,254,222,90,0,0,0,176,207,0,0,
+    0,112,223,159,0,0,80,175,144,111,0,48,158,0,112,95,0,0,0,0,0,0,0,0,0,0,0,0,0,182,254,189,
+    4,16,252,207,219,95,0,250,43,0,32,0,242,30,0,0,0,96,159,0,0,0,0,249,6,0,0,0,160,111,0,0,
+    0,0,249,6,0,0,0,112,159,0,0,0,0,243,30,0,0,0,0,251,27,0,32,2,16,252,190,219,127,0,16,199,
+    254,173,3,0,0,0,0,231,3,0,0,0,0,0,176,127,0,0,0,0,0,0,231,3,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,113,235,239,172,21,0,0,229,255,205,253,255,3,0,247,159,2,0,80,7,0,
+    243,95,0,0,0,0,0,176,159,0,0,0,0,0,16,255,2,0,0,0,0,0,245,12,0,0,0,0,0,112,175,0,
+    0,0,0,0,0,248,9,0,0,0,0,0,112,175,0,0,0,0,0,0,246,12,0,0,0,0,0,32,255,1,0,0,
+    0,0,0,208,143,0,0,0,0,0,0,246,79,0,0,0,0,0,0,250,143,1,0,32,4,0,0,249,255,205,237,207,
+    0,0,0,147,236,239,173,5,0,0,0,204,0,0,0,0,242,47,0,0,0,0,204,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,96,235,223,75,0,193,255,188,253,5,160,191,2,0,2,32,239,1,0,0,0,246,9,0,0,0,144,
+    111,0,0,0,0,250,6,0,0,0,144,111,0,0,0,0,247,9,0,0,0,48,239,1,0,0,0,176,191,1,0,34,
+    0,193,239,187,253,7,0,113,236,223,58,0,0,96,111,0,161,46,0,0,0,128,127,177,79,0,0,0,0,176,223,95,
+    0,0,0,0,0,209,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,183,254,206,90,1,
+    0,80,254,223,220,255,63,0,112,255,41,0,0,117,0,48,255,5,0,0,0,0,0,251,9,0,0,0,0,0,241,47,
+    0,0,0,0,0,80,207,0,0,0,0,0,0,247,10,0,0,0,0,0,128,159,0,0,0,0,0,0,247,10,0,0,
+    0,0,0,96,207,0,0,0,0,0,0,242,31,0,0,0,0,0,0,253,8,0,0,0,0,0,96,255,4,0,0,0,
+    0,0,160,255,24,0,0,66,0,0,144,255,223,220,254,12,0,0,48,201,254,222,90,0,0,192,44,0,227,10,0,209,
+    46,228,11,0,0,227,238,29,0,0,0,246,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,182,254,189,4,16,
+    252,207,219,95,0,250,43,0,32,0,242,30,0,0,0,96,159,0,0,0,0,249,6,0,0,0,160,111,0,0,0,0,
+    249,6,0,0,0,112,159,0,0,0,0,243,30,0,0,0,0,251,27,0,32,2,16,252,190,219,127,0,16,199,254,173,
+    3,0,0,233,3,32,204,0,0,0,0,0,176,79,210,29,0,0,0,0,0,16,237,238,2,0,0,0,0,0,0,243,
+    111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,255,222,73,0,0,0,
+    0,250,188,187,252,255,44,0,0,0,250,5,0,0,197,239,2,0,0,250,5,0,0,0,251,12,0,0,250,5,0,0,
+    0,225,95,0,0,250,5,0,0,0,128,175,0,0,250,5,0,0,0,64,223,0,0,250,5,0,0,0,32,255,0,0,
+    250,5,0,0,0,16,255,0,0,250,5,0,0,0,32,239,0,0,250,5,0,0,0,80,223,0,0,250,5,0,0,0,
+    144,159,0,0,250,5,0,0,0,226,79,0,0,250,5,0,0,16,252,11,0,0,250,5,0,16,230,223,1,0,0,250,
+    188,187,253,255,26,0,0,0,250,255,255,206,56,0,0,0,0,0,0,0,0,244,10,248,6,0,0,0,0,64,175,176,
+    31,0,0,0,0,0,244,10,158,0,0,0,0,0,64,175,243,2,0,0,0,0,0,244,10,0,0,0,129,253,174,67,
+    175,0,0,0,210,239,170,253,248,10,0,0,176,175,0,0,248,175,0,0,48,239,1,0,0,252,10,0,0,247,9,0,
+    0,112,175,0,0,144,111,0,0,0,245,10,0,0,250,6,0,0,80,175,0,0,144,111,0,0,0,245,10,0,0,247,
+    9,0,0,112,175,0,0,48,223,0,0,0,251,10,0,0,192,159,0,0,247,175,0,0,0,226,223,170,253,247,10,0,
+    0,0,146,253,174,3,175,0,0,0,250,255,255,206,56,0,0,0,160,207,187,203,255,175,1,0,0,250,5,0,16,214,
+    207,1,0,160,95,0,0,0,193,159,0,0,250,5,0,0,0,243,47,0,160,95,0,0,0,0,251,7,0,250,5,0,
+    0,0,112,175,112,255,255,255,207,0,0,245,12,197,254,205,204,9,0,64,207,0,160,95,0,0,0,0,245,11,0,250,
+    5,0,0,0,128,175,0,160,95,0,0,0,0,252,6,0,250,5,0,0,0,244,30,0,160,95,0,0,0,226,143,0,
+    0,250,5,0,32,231,191,0,0,160,207,187,220,255,143,0,0,0,250,255,239,189,39,0,0,0,0,0,0,0,0,244,
+    10,0,0,0,0,0,64,175,0,0,0,128,255,255,255,255,7,0,0,132,136,168,207,72,0,0,0,0,0,244,10,0,
+    0,129,253,174,67,175,0,0,210,239,170,253,248,10,0,176,175,0,0,248,175,0,48,239,1,0,0,252,10,0,247,9,
+    0,0,112,175,0,144,111,0,0,0,245,10,0,250,6,0,0,80,175,0,144,111,0,0,0,245,10,0,247,9,0,0,
+    112,175,0,48,223,0,0,0,251,10,0,192,159,0,0,247,175,0,0,226,223,170,253,247,10,0,0,146,253,174,3,175,
+    0,0,32,153,153,153,7,0,0,244,255,255,207,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,255,255,
+    239,0,160,223,204,204,204,10,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,
+    0,0,0,250,5,0,0,0,0,160,255,255,255,255,7,0,250,205,204,204,92,0,160,95,0,0,0,0,0,250,5,0,
+    0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,223,204,
+    204,204,11,0,250,255,255,255,239,0,0,48,153,153,153,6,0,0,245,255,255,175,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,199,238,124,0,0,16,251,190,235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,143,
+    0,0,0,254,2,249,255,255,255,255,63,160,191,153,153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,242,
+    47,0,0,0,0,0,249,61,0,0,67,0,16,251,207,203,254,10,0,0,181,254,222,56,0,0,64,31,0,128,11,0,
+    0,208,174,201,95,0,0,0,162,238,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,255,255,255,255,14,
+    0,250,205,204,204,172,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,
+    0,160,95,0,0,0,0,0,250,255,255,255,127,0,160,223,204,204,204,5,0,250,5,0,0,0,0,160,95,0,0,0,
+    0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,205,204,204,
+    188,0,160,255,255,255,255,14,0,128,12,0,192,8,0,0,243,156,218,46,0,0,0,180,238,59,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,112,236,206,7,0,0,177,239,187,254,11,0,144,159,0,16,251,8,32,223,0,0,
+    32,239,0,246,8,0,0,224,47,144,255,255,255,255,255,3,250,155,153,153,153,41,144,127,0,0,0,0,0,247,10,0,
+    0,0,0,32,255,2,0,0,0,0,144,223,3,0,48,4,0,177,255,188,236,175,0,0,80,235,239,141,3,0,0,0,
+    231,3,0,0,0,0,192,127,0,0,0,0,0,231,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,255,
+    255,255,255,14,0,250,205,204,204,172,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,
+    5,0,0,0,0,160,95,0,0,0,0,0,250,255,255,255,127,0,160,223,204,204,204,5,0,250,5,0,0,0,0,160,
+    95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,
+    250,205,204,204,188,0,160,255,255,255,255,14,0,0,0,204,0,0,0,0,0,241,47,0,0,0,0,0,203,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,236,206,7,0,0,177,239,187,254,11,0,144,159,0,16,251,8,
+    32,223,0,0,32,239,0,246,8,0,0,224,47,144,255,255,255,255,255,3,250,155,153,153,153,41,144,127,0,0,0,0,
+    0,247,10,0,0,0,0,32,255,2,0,0,0,0,144,223,3,0,48,4,0,177,255,188,236,175,0,0,80,235,239,141,
+    3,0,250,255,255,255,239,0,160,223,204,204,204,10,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,
+    0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,255,255,255,255,7,0,250,205,204,204,92,0,160,95,0,0,
+    0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,
+    0,0,0,160,223,204,204,204,11,0,250,255,255,255,239,0,0,0,0,48,94,0,0,0,0,0,173,0,0,0,0,0,
+    242,7,0,0,0,0,32,207,86,0,0,0,0,112,238,8,0,0,199,238,124,0,0,16,251,190,235,191,0,0,249,9,
+    0,177,143,0,242,13,0,0,242,14,96,143,0,0,0,254,2,249,255,255,255,255,63,160,191,153,153,153,153,2,249,7,
+    0,0,0,0,112,175,0,0,0,0,0,242,47,0,0,0,0,0,249,61,0,0,67,0,16,251,207,203,254,10,0,0,
+    181,254,254,59,0,0,0,0,80,78,0,0,0,0,16,142,0,0,0,0,0,245,5,0,0,0,0,64,191,70,0,0,
+    0,0,128,238,7,0,112,94,0,177,46,0,0,144,111,193,62,0,0,0,192,223,79,0,0,0,0,226,143,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,255,255,239,0,160,223,204,204,204,10,0,250,5,0,0,0,0,
+    160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,255,255,255,255,7,
+    0,250,205,204,204,92,0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,
+    0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,223,204,204,204,11,0,250,255,255,255,239,0,0,176,61,0,210,
+    11,0,0,193,62,227,28,0,0,0,226,238,46,0,0,0,0,244,79,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,199,238,124,0,0,16,251,190,235,191,0,0,249,9,0,177,143,0,242,13,0,0,242,14,96,143,0,0,
+    0,254,2,249,255,255,255,255,63,160,191,153,153,153,153,2,249,7,0,0,0,0,112,175,0,0,0,0,0,242,47,0,
+    0,0,0,0,249,61,0,0,67,0,16,251,207,203,254,10,0,0,181,254,222,56,0,0,0,0,0,247,46,0,0,0,
+    0,0,0,244,254,12,0,0,0,0,0,226,45,246,10,0,0,0,0,209,28,0,228,8,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,165,237,223,156,4,0,0,48,253,239,205,254,255,3,0,80,255,58,0,
+    0,97,9,0,32,254,7,0,0,0,0,0,0,251,9,0,0,0,0,0,0,241,47,0,0,0,0,0,0,80,207,0,
+    0,0,0,0,0,0,247,10,0,0,0,0,0,0,128,159,0,0,32,255,255,191,0,247,10,0,0,193,204,253,11,80,
+    207,0,0,0,0,64,191,0,242,31,0,0,0,0,244,11,0,252,8,0,0,0,64,191,0,64,255,4,0,0,0,244,
+    11,0,128,255,41,0,0,80,191,0,0,112,255,239,204,236,255,11,0,0,32,200,254,239,172,38,0,0,0,208,191,0,
+    0,0,0,144,223,127,0,0,0,112,159,176,95,0,0,64,127,0,144,63,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,96,236,255,255,255,9,160,223,120,250,175,37,48,223,1,0,245,11,0,247,7,0,0,254,0,112,127,0,0,
+    224,15,0,244,12,0,64,191,0,0,250,124,150,238,3,0,0,250,254,157,2,0,0,244,7,0,0,0,0,176,14,0,
+    0,0,0,0,252,4,0,0,0,0,80,255,255,239,124,1,32,234,189,187,236,207,16,237,3,0,0,193,79,246,7,0,
+    0,0,248,134,111,0,0,0,160,79,245,12,0,0,96,223,0,251,158,136,217,223,3,0,182,254,223,107,1,0,0,0,
+    0,215,0,0,155,0,0,0,0,32,222,170,253,3,0,0,0,0,48,235,190,4,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,80,218,254,205,73,0,0,0,211,255,222,236,255,63,0,0,245,175,3,0,16,
+    150,0,0,226,127,0,0,0,0,0,0,176,159,0,0,0,0,0,0,16,255,2,0,0,0,0,0,0,245,12,0,0,
+    0,0,0,0,112,175,0,0,0,0,0,0,0,248,9,0,0,242,255,255,11,112,175,0,0,16,204,220,191,0,245,12,
+    0,0,0,0,244,11,32,255,1,0,0,0,64,191,0,192,143,0,0,0,0,244,11,0,244,79,0,0,0,64,191,0,
+    0,248,159,2,0,0,245,11,0,0,247,255,206,204,254,191,0,0,0,130,236,255,206,106,2,0,241,4,0,229,0,0,
+    0,234,154,251,8,0,0,16,217,223,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,198,254,255,255,159,
+    0,250,141,167,255,90,2,243,29,0,80,191,0,112,127,0,0,224,15,0,247,7,0,0,254,0,64,207,0,0,244,11,
+    0,160,207,103,233,62,0,0,160,239,223,41,0,0,64,127,0,0,0,0,0,235,0,0,0,0,0,192,79,0,0,0,
+    0,0,245,255,255,206,23,0,162,222,187,203,254,12,209,62,0,0,16,252,100,127,0,0,0,128,111,248,6,0,0,0,
+    250,84,207,0,0,0,246,13,176,239,137,152,253,61,0,96,235,255,189,22,0,0,0,0,0,144,46,0,0,0,0,0,
+    0,0,253,5,0,0,0,0,0,0,144,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,80,218,254,205,73,0,0,0,211,255,222,236,255,63,0,0,245,175,3,0,16,150,0,0,226,127,0,0,0,0,
+    0,0,176,159,0,0,0,0,0,0,16,255,2,0,0,0,0,0,0,245,12,0,0,0,0,0,0,112,175,0,0,0,
+    0,0,0,0,248,9,0,0,242,255,255,11,112,175,0,0,16,204,220,191,0,245,12,0,0,0,0,244,11,32,255,1,
+    0,0,0,64,191,0,192,143,0,0,0,0,244,11,0,244,79,0,0,0,64,191,0,0,248,159,2,0,0,245,11,0,
+    0,247,255,206,204,254,191,0,0,0,130,236,255,206,106,2,0,0,96,78,0,0,0,0,0,251,8,0,0,0,0,96,
+    78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,198,254,255,255,159,0,250,141,167,255,90,2,243,29,
+    0,80,191,0,112,127,0,0,224,15,0,247,7,0,0,254,0,64,207,0,0,244,11,0,160,207,103,233,62,0,0,160,
+    239,223,41,0,0,64,127,0,0,0,0,0,235,0,0,0,0,0,192,79,0,0,0,0,0,245,255,255,206,23,0,162,
+    222,187,203,254,12,209,62,0,0,16,252,100,127,0,0,0,128,111,248,6,0,0,0,250,84,207,0,0,0,246,13,176,
+    239,137,152,253,61,0,96,235,255,189,22,0,0,0,0,165,237,223,156,4,0,0,48,253,239,205,254,255,3,0,80,255,
+    58,0,0,97,9,0,32,254,7,0,0,0,0,0,0,251,9,0,0,0,0,0,0,241,47,0,0,0,0,0,0,80,
+    207,0,0,0,0,0,0,0,247,10,0,0,0,0,0,0,128,159,0,0,32,255,255,191,0,247,10,0,0,193,204,253,
+    11,80,207,0,0,0,0,64,191,0,242,31,0,0,0,0,244,11,0,252,8,0,0,0,64,191,0,64,255,4,0,0,
+    0,244,11,0,128,255,41,0,0,80,191,0,0,112,255,239,204,236,255,11,0,0,32,200,254,239,172,38,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,245,10,0,0,0,0,0,0,128,79,0,0,0,0,0,0,0,204,0,0,0,0,0,
+    0,0,242,3,0,0,0,0,0,0,243,3,0,0,0,0,176,13,0,0,0,0,64,143,0,0,0,0,0,249,5,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,236,255,255,255,9,160,223,120,250,175,37,48,223,1,0,245,
+    11,0,247,7,0,0,254,0,112,127,0,0,224,15,0,244,12,0,64,191,0,0,250,124,150,238,3,0,0,250,254,157,
+    2,0,0,244,7,0,0,0,0,176,14,0,0,0,0,0,252,4,0,0,0,0,80,255,255,239,124,1,32,234,189,187,
+    236,207,16,237,3,0,0,193,79,246,7,0,0,0,248,134,111,0,0,0,160,79,245,12,0,0,96,223,0,251,158,136,
+    217,223,3,0,182,254,223,107,1,0,0,0,0,112,255,2,0,0,0,0,0,0,243,254,28,0,0,0,0,0,32,222,
+    82,175,0,0,0,0,0,208,44,0,228,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,
+    0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,
+    250,255,255,255,255,255,95,0,0,250,205,204,204,204,236,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,
+    144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,
+    5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,0,0,253,11,0,0,
+    0,0,0,249,253,7,0,0,0,0,247,9,251,5,0,0,0,244,7,0,249,3,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,0,0,0,0,0,0,224,15,0,
+    0,0,0,0,0,254,0,0,0,0,0,0,224,15,181,254,141,1,0,0,254,248,172,235,223,1,0,224,239,4,0,193,
+    127,0,0,254,7,0,0,245,10,0,224,63,0,0,48,207,0,0,254,1,0,0,242,12,0,224,15,0,0,32,207,0,
+    0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,
+    0,0,0,242,12,0,224,15,0,0,32,207,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,
+    250,5,0,0,0,144,95,0,255,255,255,255,255,255,255,255,191,170,253,172,170,170,170,218,207,122,0,250,5,0,0,0,
+    144,95,0,0,250,5,0,0,0,144,95,0,0,250,255,255,255,255,255,95,0,0,250,205,204,204,204,236,95,0,0,250,
+    5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,
+    95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,0,0,0,144,95,0,0,250,5,
+    0,0,0,144,95,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,252,255,255,255,79,0,0,96,247,127,119,
+    119,2,0,0,0,254,0,0,0,0,0,0,224,15,0,0,0,0,0,0,254,164,253,223,25,0,0,224,255,223,186,254,
+    29,0,0,254,78,0,16,252,7,0,224,127,0,0,80,191,0,0,254,2,0,0,242,12,0,224,31,0,0,32,207,0,
+    0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,
+    0,0,0,242,12,0,224,15,0,0,32,207,0,161,206,5,144,137,174,253,173,79,93,0,215,142,0,0,0,0,0,0,
+    0,0,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,
+    250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,0,160,
+    95,0,0,0,250,5,0,0,160,95,0,0,0,250,5,0,48,236,58,0,78,208,172,255,203,30,227,1,146,222,4,0,
+    0,0,0,0,0,0,0,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,
+    0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,
+    0,0,254,0,0,0,0,254,0,0,145,153,153,137,242,255,255,223,0,0,0,0,0,0,0,0,0,160,95,0,0,160,
+    95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,
+    95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,148,153,
+    153,89,247,255,255,159,0,0,0,0,0,0,0,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,
+    15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,
+    15,0,243,2,0,215,192,174,185,111,32,234,206,6,0,0,0,0,0,0,0,0,0,160,95,0,0,160,95,0,0,160,
+    95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,
+    95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,0,160,95,0,199,0,0,140,242,156,
+    218,46,64,235,190,3,0,0,0,0,0,0,0,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,
+    15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,
+    15,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,
+    5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,251,6,0,209,9,
+    0,144,14,0,0,190,0,0,208,110,6,0,212,207,0,0,118,0,16,255,2,0,220,1,0,0,0,0,0,0,0,254,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    254,0,0,255,0,80,62,0,225,8,0,245,5,0,244,107,4,144,238,6,0,231,3,0,192,127,0,0,231,3,0,0,
+    0,0,0,0,0,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,
+    5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,0,0,250,5,0,160,95,
+    0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,
+    254,0,0,254,0,0,254,0,0,250,5,0,241,14,0,160,95,0,16,239,0,0,250,5,0,241,14,0,160,95,0,16,
+    239,0,0,250,5,0,241,14,0,160,95,0,16,239,0,0,250,5,0,241,14,0,160,95,0,16,239,0,0,250,5,0,
+    241,14,0,160,95,0,16,239,0,0,250,5,0,241,14,0,160,95,0,16,239,0,0,250,5,0,241,14,0,160,95,0,
+    16,239,0,0,250,5,0,241,14,0,160,95,0,16,239,0,0,250,5,0,241,13,0,0,0,0,48,207,0,0,0,0,
+    16,251,8,0,0,48,206,254,30,0,0,0,210,239,42,0,0,0,118,0,0,117,0,16,255,2,0,255,3,0,220,1,
+    0,219,1,0,0,0,0,0,0,0,0,0,0,0,0,0,254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,
+    1,0,254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,1,0,
+    254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,1,0,254,0,0,253,1,0,0,0,
+    0,253,1,0,0,0,0,253,1,0,0,0,0,253,1,0,0,0,32,239,0,0,0,195,234,143,0,0,0,210,223,8,
+    0,0,32,254,7,0,0,192,239,79,0,0,250,38,237,2,112,94,0,177,29,0,0,0,0,0,0,0,0,0,0,0,
+    0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,
+    3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,
+    0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,252,3,0,0,0,254,2,0,0,112,223,0,0,205,253,
+    95,0,0,251,190,4,0,0,0,80,255,4,0,32,238,222,1,16,237,67,206,1,219,2,48,189,0,0,0,0,0,0,
+    0,0,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,
+    254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,
+    15,0,0,0,254,0,0,0,240,14,0,0,48,207,0,64,171,254,6,0,227,223,7,0,0,0,250,5,0,0,80,223,
+    2,160,95,0,0,64,239,2,0,250,5,0,48,238,3,0,160,95,0,48,238,4,0,0,250,5,32,254,4,0,0,160,
+    95,16,253,5,0,0,0,250,21,252,6,0,0,0,160,111,251,12,0,0,0,0,250,254,254,6,0,0,0,160,255,69,
+    255,3,0,0,0,250,6,128,223,1,0,0,160,95,0,176,175,0,0,0,250,5,0,226,111,0,0,160,95,0,0,244,
+    46,0,0,250,5,0,0,248,29,0,160,95,0,0,0,251,9,0,250,5,0,0,16,254,5,0,0,0,0,0,0,0,
+    0,0,0,242,12,0,0,0,0,0,96,111,0,0,0,0,0,0,218,1,0,0,0,0,0,224,5,0,0,0,0,254,
+    0,0,0,0,0,224,15,0,0,0,0,0,254,0,0,0,0,0,224,15,0,0,0,0,0,254,0,0,0,0,0,224,
+    15,0,0,251,8,0,254,0,0,250,9,0,224,15,0,249,9,0,0,254,0,248,10,0,0,224,15,246,11,0,0,0,
+    238,244,30,0,0,0,224,238,255,7,0,0,0,254,76,255,4,0,0,224,15,96,223,1,0,0,254,0,160,191,0,0,
+    224,15,0,209,127,0,0,254,0,0,243,79,0,224,15,0,0,246,29,0,0,0,0,0,0,0,0,0,244,11,0,0,
+    0,0,112,95,0,0,0,0,0,203,0,0,0,0,0,241,3,0,0,0,0,254,2,0,193,143,0,224,47,0,160,191,
+    0,0,254,2,128,207,1,0,224,47,80,239,2,0,0,254,50,239,3,0,0,224,63,254,6,0,0,0,254,252,175,0,
+    0,0,224,239,212,111,0,0,0,254,3,243,46,0,0,224,47,0,248,12,0,0,254,2,0,252,8,0,224,47,0,32,
+    254,4,0,254,2,0,96,223,1,0,0,244,63,0,0,0,0,252,6,0,0,0,96,143,0,0,0,0,226,9,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,
+    250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,
+    0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,
+    0,0,250,5,0,0,0,0,250,205,204,204,188,0,250,255,255,255,239,0,32,255,5,0,250,8,0,244,10,0,209,11,
+    0,0,0,0,0,0,0,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,
+    0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,0,254,0,0,224,15,0,
+    0,254,0,0,224,15,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,
+    250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,
+    0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,
+    0,0,250,205,204,204,188,0,250,255,255,255,239,0,0,0,0,0,0,0,0,48,207,0,0,0,0,96,111,0,0,0,
+    0,160,13,0,0,0,0,225,4,0,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,
+    0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,0,0,254,
+    0,0,0,0,16,239,0,64,143,0,128,30,0,208,7,0,0,250,5,0,245,9,0,250,5,0,248,4,0,250,5,0,
+    203,0,0,250,5,0,94,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,
+    0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,
+    5,0,0,0,0,250,5,0,0,0,0,250,205,204,204,188,0,250,255,255,255,239,0,254,48,207,0,254,80,127,0,254,
+    128,30,0,254,192,7,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,
+    0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,250,
+    5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,
+    0,0,0,250,5,0,0,0,0,250,5,0,219,1,0,250,5,0,255,3,0,250,5,0,219,1,0,250,5,0,0,0,
+    0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,5,0,0,0,0,250,205,204,204,188,0,250,
+    255,255,255,239,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,
+    0,254,0,0,0,254,16,173,0,254,64,239,0,254,16,173,0,254,0,0,0,254,0,0,0,254,0,0,0,254,0,0,
+    0,254,0,0,0,254,0,0,0,254,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,0,0,0,0,
+    160,95,0,0,0,0,0,250,5,0,0,0,0,160,95,0,0,0,0,0,250,5,179,2,0,0,160,111,249,95,0,0,
+    0,250,255,59,0,0,0,194,239,6,0,0,0,245,255,5,0,0,0,48,203,95,0,0,0,0,0,250,5,0,0,0,
+    0,160,95,0,0,0,0,0,250,5,0,0,0,0,160,223,204,204,204,11,0,250,255,255,255,239,0,0,224,15,0,0,
+    224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,79,27,0,224,255,61,0,
+    245,159,1,160,255,15,0,128,232,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,224,15,0,0,
+    224,15,0,0,0,0,0,96,239,2,0,0,0,0,0,0,209,95,0,0,0,0,0,0,0,248,6,0,0,0,0,0,
+    0,48,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,29,0,0,0,32,
+    191,0,0,250,159,0,0,0,32,191,0,0,250,254,4,0,0,32,191,0,0,250,247,29,0,0,32,191,0,0,250,178,
+    159,0,0,32,191,0,0,250,34,254,3,0,32,191,0,0,250,3,246,13,0,32,191,0,0,250,3,176,143,0,32,191,
+    0,0,250,3,32,254,3,32,191,0,0,250,3,0,247,12,32,191,0,0,250,3,0,192,143,32,191,0,0,250,3,0,
+    32,255,35,191,0,0,250,3,0,0,247,28,191,0,0,250,3,0,0,192,127,191,0,0,250,3,0,0,48,255,191,0,
+    0,250,3,0,0,0,248,191,0,0,250,3,0,0,0,208,191,0,0,0,0,16,254,7,0,0,0,0,0,248,10,0,
+    0,0,0,0,243,28,0,0,0,0,0,192,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    190,80,235,223,25,0,0,224,141,223,186,254,29,0,0,254,94,0,16,252,7,0,224,143,0,0,80,175,0,0,254,3,
+    0,0,243,12,0,224,31,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,
+    242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,
+    0,0,250,29,0,0,0,32,191,0,0,250,159,0,0,0,32,191,0,0,250,254,4,0,0,32,191,0,0,250,247,29,
+    0,0,32,191,0,0,250,178,159,0,0,32,191,0,0,250,34,254,3,0,32,191,0,0,250,3,246,13,0,32,191,0,
+    0,250,3,176,143,0,32,191,0,0,250,3,32,254,3,32,191,0,0,250,3,0,247,12,32,191,0,0,250,3,0,192,
+    143,32,191,0,0,250,3,0,32,255,35,191,0,0,250,3,0,0,247,28,191,0,0,250,3,0,0,192,127,191,0,0,
+    250,3,0,0,48,255,191,0,0,250,3,0,0,0,248,191,0,0,250,3,0,0,0,208,191,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,80,159,0,0,0,0,0,0,0,144,63,0,0,0,0,0,0,0,208,11,0,0,0,0,0,0,
+    0,243,2,0,0,0,0,0,190,80,235,223,25,0,0,224,141,223,186,254,29,0,0,254,94,0,16,252,7,0,224,143,
+    0,0,80,175,0,0,254,3,0,0,243,12,0,224,31,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,
+    32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,
+    0,0,254,0,0,0,242,12,0,0,0,0,0,0,0,0,0,0,0,251,3,0,0,0,0,0,224,13,0,0,0,0,
+    0,64,95,0,0,0,0,0,0,185,0,0,0,0,0,0,176,61,0,210,12,0,0,0,0,16,236,51,206,1,0,0,
+    0,0,0,226,238,46,0,0,0,0,0,0,64,255,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,250,29,0,0,0,32,191,0,0,250,159,0,0,0,32,191,0,0,250,254,4,0,0,32,191,0,0,
+    250,247,29,0,0,32,191,0,0,250,178,159,0,0,32,191,0,0,250,34,254,3,0,32,191,0,0,250,3,246,13,0,
+    32,191,0,0,250,3,176,143,0,32,191,0,0,250,3,32,254,3,32,191,0,0,250,3,0,247,12,32,191,0,0,250,
+    3,0,192,143,32,191,0,0,250,3,0,32,255,35,191,0,0,250,3,0,0,247,28,191,0,0,250,3,0,0,192,127,
+    191,0,0,250,3,0,0,48,255,191,0,0,250,3,0,0,0,248,191,0,0,250,3,0,0,0,208,191,0,0,64,127,
+    0,144,63,0,0,0,112,159,160,95,0,0,0,0,144,223,127,0,0,0,0,0,208,191,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,190,80,235,223,25,0,0,224,141,223,186,254,29,0,0,254,94,0,16,252,7,
+    0,224,143,0,0,80,175,0,0,254,3,0,0,243,12,0,224,31,0,0,32,207,0,0,254,0,0,0,242,12,0,224,
+    15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,
+    0,32,207,0,0,254,0,0,0,242,12,0,208,111,0,0,0,0,0,0,241,47,0,0,0,0,0,0,243,12,0,0,
+    0,0,0,0,247,7,0,0,0,0,0,0,250,81,95,129,253,206,5,0,173,80,143,253,171,252,143,0,0,80,255,27,
+    0,80,255,1,0,80,255,2,0,0,251,4,0,80,207,0,0,0,249,5,0,80,175,0,0,0,248,6,0,80,159,0,
+    0,0,248,6,0,80,159,0,0,0,248,6,0,80,159,0,0,0,248,6,0,80,159,0,0,0,248,6,0,80,159,0,
+    0,0,248,6,0,80,159,0,0,0,248,6,0,80,159,0,0,0,248,6,0,250,29,0,0,0,32,191,0,0,250,159,
+    0,0,0,32,191,0,0,250,254,4,0,0,32,191,0,0,250,246,29,0,0,32,191,0,0,250,162,159,0,0,32,191,
+    0,0,250,18,253,4,0,32,191,0,0,250,3,244,29,0,32,191,0,0,250,3,128,159,0,32,191,0,0,250,3,0,
+    252,4,32,191,0,0,250,3,0,242,29,32,191,0,0,250,3,0,96,159,32,191,0,0,250,3,0,0,251,20,191,0,
+    0,250,3,0,0,225,45,191,0,0,250,3,0,0,80,159,191,0,0,250,3,0,0,0,249,191,0,0,250,3,0,0,
+    0,209,191,0,0,250,3,0,0,0,64,191,0,0,0,0,0,0,0,64,175,0,0,0,0,0,0,0,193,111,0,0,
+    0,0,0,96,205,254,12,0,0,0,0,0,80,254,157,1,0,0,190,96,236,223,25,0,0,224,174,223,186,254,29,0,
+    0,254,94,0,16,252,7,0,224,143,0,0,80,175,0,0,254,3,0,0,243,12,0,224,31,0,0,32,207,0,0,254,
+    0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,
+    0,242,12,0,224,15,0,0,32,207,0,0,254,0,0,0,242,12,0,0,0,0,0,32,207,0,0,0,0,0,0,242,
+    12,0,0,0,0,0,48,191,0,0,0,0,0,0,246,9,0,0,0,0,179,250,63,0,0,0,0,32,253,92,0,0,
+    0,0,16,153,153,153,8,0,0,0,0,0,242,255,255,223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,48,201,254,190,23,0,0,0,0,144,255,223,220,255,94,0,0,0,160,239,22,0,32,248,
+    95,0,0,96,239,3,0,0,0,246,30,0,0,253,6,0,0,0,0,250,8,0,242,30,0,0,0,0,64,223,0,96,
+    191,0,0,0,0,0,241,31,0,247,10,0,0,0,0,0,254,2,128,159,0,0,0,0,0,208,63,0,247,10,0,0,
+    0,0,0,254,2,96,191,0,0,0,0,0,241,31,0,242,30,0,0,0,0,64,223,0,0,252,6,0,0,0,0,250,
+    8,0,96,239,2,0,0,0,245,30,0,0,160,239,22,0,16,248,95,0,0,0,144,255,207,220,255,94,0,0,0,0,
+    48,201,254,190,23,0,0,0,0,32,153,153,153,7,0,0,0,244,255,255,207,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,182,254,157,2,0,0,16,252,190,218,255,5,0,0,250,26,0,80,239,2,0,242,30,0,
+    0,112,159,0,112,159,0,0,0,242,14,0,249,6,0,0,0,254,1,160,111,0,0,0,208,47,0,248,6,0,0,0,
+    254,1,96,159,0,0,0,242,14,0,241,30,0,0,112,159,0,0,249,27,0,64,238,2,0,16,251,190,202,255,5,0,
+    0,0,182,254,157,2,0,0,0,0,48,47,0,112,13,0,0,0,0,0,192,174,185,111,0,0,0,0,0,0,162,238,
+    108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,236,239,123,1,0,
+    0,0,0,249,255,205,253,239,5,0,0,0,250,110,1,0,130,255,5,0,0,246,62,0,0,0,96,239,1,0,208,111,
+    0,0,0,0,160,143,0,32,239,1,0,0,0,0,244,13,0,246,11,0,0,0,0,16,255,1,112,175,0,0,0,0,
+    0,224,47,0,248,9,0,0,0,0,0,253,3,112,175,0,0,0,0,0,224,47,0,246,11,0,0,0,0,16,255,1,
+    32,239,1,0,0,0,0,244,13,0,192,111,0,0,0,0,160,143,0,0,246,46,0,0,0,80,239,1,0,0,250,110,
+    1,0,129,255,5,0,0,0,249,255,204,253,239,5,0,0,0,0,147,236,239,123,1,0,0,0,64,30,0,144,11,0,
+    0,0,209,173,201,95,0,0,0,0,162,238,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    96,235,223,41,0,0,0,193,239,171,253,95,0,0,160,175,1,0,245,46,0,32,239,1,0,0,247,9,0,247,9,0,
+    0,32,239,0,144,111,0,0,0,224,31,0,250,6,0,0,0,253,2,128,111,0,0,0,224,31,0,246,9,0,0,32,
+    239,0,16,239,1,0,0,247,9,0,144,191,1,0,228,46,0,0,177,239,171,252,95,0,0,0,96,235,223,41,0,0,
+    0,0,0,48,239,17,254,3,0,0,0,0,0,251,5,248,8,0,0,0,0,0,245,8,242,10,0,0,0,0,0,208,
+    9,176,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,201,254,190,23,
+    0,0,0,0,144,255,223,220,255,94,0,0,0,160,239,22,0,32,248,95,0,0,96,239,3,0,0,0,246,30,0,0,
+    253,6,0,0,0,0,250,8,0,242,30,0,0,0,0,64,223,0,96,191,0,0,0,0,0,241,31,0,247,10,0,0,
+    0,0,0,254,2,128,159,0,0,0,0,0,208,63,0,247,10,0,0,0,0,0,254,2,96,191,0,0,0,0,0,241,
+    31,0,242,30,0,0,0,0,64,223,0,0,252,6,0,0,0,0,250,8,0,96,239,2,0,0,0,245,30,0,0,160,
+    239,22,0,16,248,95,0,0,0,144,255,207,220,255,94,0,0,0,0,48,201,254,190,23,0,0,0,0,0,96,223,48,
+    239,1,0,0,0,253,3,251,5,0,0,0,247,5,245,8,0,0,0,226,6,208,9,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,182,254,157,2,0,0,16,252,190,218,255,5,0,0,250,26,0,80,239,2,0,242,
+    30,0,0,112,159,0,112,159,0,0,0,242,14,0,249,6,0,0,0,254,1,160,111,0,0,0,208,47,0,248,6,0,
+    0,0,254,1,96,159,0,0,0,242,14,0,241,30,0,0,112,159,0,0,249,27,0,64,238,2,0,16,251,190,202,255,
+    5,0,0,0,182,254,157,2,0,0,0,0,48,201,254,255,255,255,255,255,11,0,0,249,255,205,253,239,204,204,204,8,
+    0,176,239,23,0,48,207,0,0,0,0,0,246,62,0,0,48,207,0,0,0,0,0,253,6,0,0,48,207,0,0,0,
+    0,48,239,1,0,0,48,207,0,0,0,0,96,191,0,0,0,48,207,0,0,0,0,112,175,0,0,0,48,255,255,255,
+    255,4,128,159,0,0,0,48,239,204,204,204,3,112,175,0,0,0,48,207,0,0,0,0,80,191,0,0,0,48,207,0,
+    0,0,0,32,239,1,0,0,48,207,0,0,0,0,0,253,6,0,0,48,207,0,0,0,0,0,245,46,0,0,48,207,
+    0,0,0,0,0,160,239,22,0,48,207,0,0,0,0,0,0,249,255,204,253,239,204,204,204,8,0,0,48,200,254,255,
+    255,255,255,255,11,0,0,199,238,124,1,64,234,223,24,0,0,16,252,173,218,223,98,239,171,253,29,0,0,250,9,0,
+    112,207,223,2,0,249,10,0,243,13,0,0,176,255,4,0,16,254,1,112,159,0,0,0,246,14,0,0,192,79,0,249,
+    6,0,0,64,255,255,255,255,255,5,160,111,0,0,0,243,158,153,153,153,57,0,249,6,0,0,64,239,0,0,0,0,
+    0,112,159,0,0,0,246,31,0,0,0,0,0,242,13,0,0,176,255,7,0,0,0,0,0,250,9,0,112,175,253,5,
+    0,32,5,0,16,252,174,218,207,49,254,189,220,207,0,0,0,198,238,124,0,32,217,255,173,4,0,0,0,0,16,254,
+    7,0,0,0,0,0,248,10,0,0,0,0,0,243,28,0,0,0,0,0,192,28,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,250,255,255,190,23,0,0,160,223,187,220,255,45,0,0,250,5,0,32,252,11,0,160,
+    95,0,0,32,255,1,0,250,5,0,0,224,63,0,160,95,0,0,0,254,2,0,250,5,0,0,245,13,0,160,95,0,
+    32,230,79,0,0,250,255,255,255,76,0,0,160,207,187,251,30,0,0,0,250,5,0,250,9,0,0,160,95,0,32,254,
+    3,0,0,250,5,0,112,191,0,0,160,95,0,0,209,95,0,0,250,5,0,0,245,29,0,160,95,0,0,0,252,8,
+    0,250,5,0,0,48,255,2,0,0,0,252,9,0,0,96,207,1,0,0,225,45,0,0,0,218,2,0,0,0,0,0,
+    0,0,0,0,0,0,0,190,48,234,94,0,206,227,207,77,0,238,173,1,0,0,254,12,0,0,0,254,4,0,0,0,
+    254,1,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,
+    0,0,0,254,0,0,0,0,250,255,255,190,23,0,0,160,223,187,220,255,45,0,0,250,5,0,32,252,11,0,160,95,
+    0,0,32,255,1,0,250,5,0,0,224,63,0,160,95,0,0,0,254,2,0,250,5,0,0,245,13,0,160,95,0,32,
+    230,79,0,0,250,255,255,255,76,0,0,160,207,187,251,30,0,0,0,250,5,0,250,9,0,0,160,95,0,32,254,3,
+    0,0,250,5,0,112,191,0,0,160,95,0,0,209,95,0,0,250,5,0,0,245,29,0,160,95,0,0,0,252,8,0,
+    250,5,0,0,48,255,2,0,0,0,0,0,0,0,0,0,0,244,10,0,0,0,0,0,128,79,0,0,0,0,0,0,
+    204,0,0,0,0,0,0,242,3,0,0,0,0,190,48,234,94,0,206,227,207,77,0,238,173,1,0,0,254,12,0,0,
+    0,254,4,0,0,0,254,1,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,
+    0,0,0,0,254,0,0,0,0,254,0,0,0,0,0,0,0,0,0,238,0,0,0,48,159,0,0,0,112,47,0,0,
+    0,192,8,0,0,0,0,80,111,0,144,62,0,0,0,128,143,176,79,0,0,0,0,160,223,111,0,0,0,0,0,209,
+    175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,250,255,255,190,23,0,0,160,223,187,220,255,
+    45,0,0,250,5,0,32,252,11,0,160,95,0,0,32,255,1,0,250,5,0,0,224,63,0,160,95,0,0,0,254,2,
+    0,250,5,0,0,245,13,0,160,95,0,32,230,79,0,0,250,255,255,255,76,0,0,160,207,187,251,30,0,0,0,250,
+    5,0,250,9,0,0,160,95,0,32,254,3,0,0,250,5,0,112,191,0,0,160,95,0,0,209,95,0,0,250,5,0,
+    0,245,29,0,160,95,0,0,0,252,8,0,250,5,0,0,48,255,2,64,127,0,144,63,0,247,9,250,5,0,144,223,
+    127,0,0,0,252,11,0,0,0,0,0,0,0,0,0,0,0,0,190,48,234,94,0,206,227,207,77,0,238,173,1,0,
+    0,254,12,0,0,0,254,4,0,0,0,254,1,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,
+    0,0,0,0,254,0,0,0,0,254,0,0,0,0,254,0,0,0,0,0,0,112,223,1,0,0,0,16,254,3,0,0,
+    0,0,250,5,0,0,0,0,244,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,217,239,189,22,0,
+    96,255,206,237,255,6,32,255,6,0,48,24,0,247,10,0,0,0,0,128,143,0,0,0,0,0,245,12,0,0,0,0,
+    16,254,42,0,0,0,0,48,253,175,5,0,0,0,16,232,255,109,0,0,0,0,80,251,207,1,0,0,0,0,211,159,
+    0,0,0,0,0,243,14,0,0,0,0,0,255,0,0,0,0,0,243,13,112,21,0,0,212,127,0,251,239,204,254,175,
+    0,64,218,254,223,74,0,0,0,0,0,250,11,0,0,0,244,45,0,0,0,192,62,0,0,0,112,62,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,130,236,222,90,0,226,207,186,253,12,144,111,0,0,50,0,251,2,0,0,0,112,
+    207,2,0,0,0,160,255,91,0,0,0,64,251,239,7,0,0,0,130,254,10,0,0,0,32,253,3,0,0,0,144,95,
+    0,0,0,16,253,2,202,170,185,254,8,80,235,255,190,5,0,0,0,112,239,2,0,0,0,64,239,207,0,0,0,32,
+    222,98,175,0,0,16,205,1,64,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,217,239,189,22,0,96,
+    255,206,237,255,6,32,255,6,0,48,24,0,247,10,0,0,0,0,128,143,0,0,0,0,0,245,12,0,0,0,0,16,
+    254,42,0,0,0,0,48,253,175,5,0,0,0,16,232,255,109,0,0,0,0,80,251,207,1,0,0,0,0,211,159,0,
+    0,0,0,0,243,14,0,0,0,0,0,255,0,0,0,0,0,243,13,112,21,0,0,212,127,0,251,239,204,254,175,0,
+    64,218,254,223,74,0,0,0,0,247,47,0,0,0,243,254,28,0,0,226,45,245,10,0,208,44,0,228,9,0,0,0,
+    0,0,0,0,0,0,0,0,0,130,236,222,90,0,226,207,186,253,12,144,111,0,0,50,0,251,2,0,0,0,112,207,
+    2,0,0,0,160,255,91,0,0,0,64,251,239,7,0,0,0,130,254,10,0,0,0,32,253,3,0,0,0,144,95,0,
+    0,0,16,253,2,202,170,185,254,8,80,235,255,190,5,0,0,48,217,239,189,22,0,96,255,206,237,255,6,32,255,6,
+    0,48,24,0,247,10,0,0,0,0,128,143,0,0,0,0,0,245,12,0,0,0,0,16,254,42,0,0,0,0,48,253,
+    175,5,0,0,0,16,232,255,109,0,0,0,0,80,251,207,1,0,0,0,0,211,159,0,0,0,0,0,243,14,0,0,
+    0,0,0,255,0,0,0,0,0,243,13,112,21,0,0,212,127,0,251,239,204,254,175,0,64,218,254,223,74,0,0,0,
+    0,199,0,0,0,0,0,209,142,0,0,0,0,0,112,111,0,0,0,0,0,241,8,0,0,0,65,148,79,0,0,0,
+    16,238,92,0,0,0,0,130,236,222,90,0,226,207,186,253,12,144,111,0,0,50,0,251,2,0,0,0,112,207,2,0,
+    0,0,160,255,91,0,0,0,64,251,239,7,0,0,0,130,254,10,0,0,0,32,253,3,0,0,0,144,95,0,0,0,
+    16,253,2,202,170,185,254,8,80,235,255,190,5,0,0,112,12,0,0,0,0,237,8,0,0,0,0,246,6,0,0,0,
+    0,143,0,0,0,68,249,4,0,0,225,206,5,0,0,0,225,27,0,229,7,0,0,227,28,246,9,0,0,0,245,253,
+    11,0,0,0,0,248,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,217,239,189,22,0,96,255,206,
+    237,255,6,32,255,6,0,48,24,0,247,10,0,0,0,0,128,143,0,0,0,0,0,245,12,0,0,0,0,16,254,42,
+    0,0,0,0,48,253,175,5,0,0,0,16,232,255,109,0,0,0,0,80,251,207,1,0,0,0,0,211,159,0,0,0,
+    0,0,243,14,0,0,0,0,0,255,0,0,0,0,0,243,13,112,21,0,0,212,127,0,251,239,204,254,175,0,64,218,
+    254,223,74,0,0,0,205,2,64,158,0,32,222,66,191,0,0,48,223,207,1,0,0,96,255,3,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,130,236,222,90,0,226,207,186,253,12,144,111,0,0,50,0,251,2,0,0,0,112,207,2,0,
+    0,0,160,255,91,0,0,0,64,251,239,7,0,0,0,130,254,10,0,0,0,32,253,3,0,0,0,144,95,0,0,0,
+    16,253,2,202,170,185,254,8,80,235,255,190,5,0,252,255,255,255,255,255,31,201,204,220,239,204,204,28,0,0,80,159,
+    0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,
+    0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,
+    0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,
+    80,159,0,0,0,0,0,48,46,0,0,0,0,0,160,175,1,0,0,0,0,0,228,10,0,0,0,0,0,192,12,0,
+    0,0,0,68,247,8,0,0,0,0,252,141,0,0,0,0,242,2,0,0,246,2,0,0,251,2,0,229,255,255,223,133,
+    254,137,120,0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,252,2,0,0,
+    251,3,0,0,249,9,0,0,243,207,186,0,64,236,206,0,0,153,0,0,32,238,7,0,0,144,79,0,0,48,95,0,
+    65,181,46,0,227,190,4,0,226,26,0,246,6,0,0,64,191,113,143,0,0,0,0,246,253,10,0,0,0,0,160,223,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,255,255,255,255,255,31,201,204,220,239,204,204,28,0,
+    0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,
+    0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,
+    80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,
+    0,0,0,80,159,0,0,0,0,0,0,248,7,0,0,160,47,0,242,2,174,0,96,47,242,2,0,251,2,0,80,254,
+    255,255,13,133,254,137,120,0,192,47,0,0,0,252,2,0,0,192,47,0,0,0,252,2,0,0,192,47,0,0,0,252,
+    2,0,0,192,47,0,0,0,251,3,0,0,144,159,0,0,0,243,207,186,0,0,196,238,12,252,255,255,255,255,255,31,
+    201,204,220,239,204,204,28,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,
+    0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,255,255,255,255,79,0,0,170,202,223,170,58,0,0,
+    0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,0,80,159,0,
+    0,0,0,0,80,159,0,0,0,0,0,80,159,0,0,0,0,242,2,0,0,246,2,0,0,251,2,0,229,255,255,223,
+    133,254,137,120,0,252,2,0,0,252,2,0,247,255,255,175,131,254,137,88,0,252,2,0,0,252,2,0,0,252,2,0,
+    0,251,4,0,0,249,9,0,0,243,207,185,0,64,252,190,0,0,96,222,24,48,15,0,0,0,48,191,252,174,173,0,
+    0,0,0,183,0,180,190,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,63,0,0,0,
+    0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,
+    0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,
+    63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,251,3,0,0,0,176,79,
+    0,144,111,0,0,0,0,254,2,0,245,13,0,0,0,246,12,0,0,252,43,0,0,247,79,0,0,32,252,223,204,254,
+    94,0,0,0,0,182,254,206,40,0,0,0,16,234,92,0,153,0,0,0,233,234,207,250,4,0,0,224,5,112,237,7,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,
+    241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,
+    0,0,64,175,0,16,223,0,0,0,245,10,0,241,14,0,0,112,175,0,0,255,1,0,0,252,10,0,176,159,0,0,
+    247,175,0,0,244,223,170,253,247,10,0,0,163,254,174,3,175,0,0,0,112,153,153,153,2,0,0,0,0,252,255,255,
+    79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,0,0,176,79,0,192,63,0,
+    0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,
+    63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,
+    0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,0,0,251,4,0,249,6,0,0,0,
+    224,47,0,80,223,0,0,0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,255,205,236,239,5,0,0,0,96,235,
+    239,140,2,0,0,0,32,153,153,153,8,0,0,0,243,255,255,223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,
+    0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,80,175,0,16,
+    239,0,0,0,247,10,0,240,31,0,0,192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,175,0,0,48,234,
+    239,58,240,10,0,0,0,192,7,0,242,3,0,0,0,0,247,155,234,12,0,0,0,0,0,215,223,25,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,
+    0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,
+    176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,
+    0,0,176,79,0,192,63,0,0,0,0,251,4,0,251,3,0,0,0,176,79,0,144,111,0,0,0,0,254,2,0,245,
+    13,0,0,0,246,12,0,0,252,43,0,0,247,79,0,0,32,252,223,204,254,94,0,0,0,0,182,254,206,40,0,0,
+    0,48,47,0,128,12,0,0,0,208,174,201,111,0,0,0,0,162,238,92,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,
+    0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,245,
+    10,0,241,14,0,0,112,175,0,0,255,1,0,0,252,10,0,176,159,0,0,247,175,0,0,244,223,170,253,247,10,0,
+    0,163,254,174,3,175,0,0,0,0,178,222,5,0,0,0,0,0,160,59,246,2,0,0,0,0,0,109,0,94,0,0,
+    0,0,0,160,59,246,2,0,0,0,0,0,177,222,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,
+    0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,
+    3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,
+    0,251,3,0,0,0,176,79,0,144,111,0,0,0,0,254,2,0,245,13,0,0,0,246,12,0,0,252,43,0,0,247,
+    79,0,0,32,252,223,204,254,94,0,0,0,0,182,254,206,40,0,0,0,0,80,237,43,0,0,0,0,16,111,179,10,
+    0,0,0,0,228,0,214,0,0,0,0,16,111,179,10,0,0,0,0,80,237,43,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,
+    0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,
+    0,245,10,0,241,14,0,0,112,175,0,0,255,1,0,0,252,10,0,176,159,0,0,247,175,0,0,244,223,170,253,247,
+    10,0,0,163,254,174,3,175,0,0,0,0,192,111,160,159,0,0,0,0,80,191,32,223,1,0,0,0,0,221,1,235,
+    3,0,0,0,0,215,2,229,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,3,0,
+    0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,
+    3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,
+    0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,0,0,
+    251,4,0,249,6,0,0,0,224,47,0,80,223,0,0,0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,255,205,
+    236,239,5,0,0,0,96,235,239,140,2,0,0,0,0,64,239,17,255,3,0,0,0,251,5,249,7,0,0,0,245,8,
+    243,10,0,0,0,208,9,176,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,223,0,0,0,244,
+    10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,
+    241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,80,175,0,16,239,0,0,0,247,10,0,240,31,
+    0,0,192,175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,175,0,0,48,234,239,58,240,10,0,0,252,3,0,
+    0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,
+    3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,
+    0,252,3,0,0,0,176,79,0,192,63,0,0,0,0,251,4,0,252,3,0,0,0,176,79,0,176,63,0,0,0,0,
+    251,4,0,249,6,0,0,0,224,47,0,80,223,0,0,0,96,207,0,0,192,191,2,0,112,255,4,0,0,194,255,205,
+    236,239,5,0,0,0,96,235,255,140,2,0,0,0,0,0,227,6,0,0,0,0,0,0,192,11,0,0,0,0,0,0,
+    32,143,0,0,0,0,0,0,0,241,109,5,0,0,0,0,0,0,214,158,0,0,0,16,223,0,0,0,244,10,0,241,
+    13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,
+    0,64,175,0,16,223,0,0,0,244,10,0,241,13,0,0,80,175,0,16,239,0,0,0,247,10,0,240,31,0,0,192,
+    175,0,0,251,9,0,112,255,10,0,64,255,173,218,127,175,0,0,48,234,239,58,240,12,0,0,0,0,0,160,28,0,
+    0,0,0,0,80,63,0,0,0,0,0,0,250,0,0,0,0,0,0,144,143,22,0,0,0,0,0,178,222,2,0,0,
+    0,0,64,255,5,0,0,0,0,0,0,0,0,209,238,46,0,0,0,0,0,0,0,0,236,52,222,1,0,0,0,0,
+    0,0,160,61,0,210,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    248,8,0,0,48,255,3,0,0,80,191,244,12,0,0,112,255,8,0,0,144,127,241,31,0,0,192,238,13,0,0,208,
+    63,176,95,0,0,241,188,47,0,0,242,14,112,159,0,0,246,120,127,0,0,246,10,48,223,0,0,250,36,191,0,0,
+    250,6,0,254,1,0,238,0,253,1,0,253,2,0,250,5,64,175,0,248,6,32,223,0,0,246,9,144,95,0,244,10,
+    96,159,0,0,242,13,208,31,0,224,30,160,95,0,0,208,47,242,11,0,160,95,224,31,0,0,144,95,246,7,0,80,
+    159,242,12,0,0,80,159,250,3,0,16,223,246,8,0,0,16,207,221,0,0,0,251,250,4,0,0,0,236,159,0,0,
+    0,246,238,0,0,0,0,248,79,0,0,0,242,191,0,0,0,0,244,14,0,0,0,192,127,0,0,0,0,0,16,253,
+    9,0,0,0,0,0,0,0,250,253,5,0,0,0,0,0,0,248,24,252,4,0,0,0,0,0,246,6,16,234,2,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,249,7,0,0,253,9,0,0,251,84,175,0,
+    0,242,223,0,0,240,14,241,14,0,112,191,63,0,64,191,0,252,3,0,236,245,7,0,248,7,128,127,0,242,26,207,
+    0,192,63,0,244,10,96,111,192,47,16,239,0,0,238,0,251,2,247,6,244,9,0,176,63,241,12,32,191,128,95,0,
+    0,247,87,127,0,208,31,252,1,0,48,175,250,2,0,248,245,12,0,0,224,221,12,0,48,207,143,0,0,0,250,127,
+    0,0,224,255,4,0,0,96,255,3,0,0,249,14,0,0,0,0,144,239,1,0,0,0,0,245,253,11,0,0,0,48,
+    206,113,143,0,0,0,225,26,0,246,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,251,7,0,0,0,225,
+    63,243,30,0,0,0,248,9,160,143,0,0,16,238,2,32,239,1,0,144,143,0,0,248,9,0,242,30,0,0,225,47,
+    0,250,6,0,0,112,175,48,223,0,0,0,16,253,179,95,0,0,0,0,246,253,11,0,0,0,0,192,255,3,0,0,
+    0,0,80,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,
+    0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,243,111,0,0,0,0,209,239,62,0,0,0,176,
+    79,226,29,0,0,144,78,0,194,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,5,0,0,48,223,96,175,
+    0,0,0,248,8,225,31,0,0,208,47,0,249,7,0,64,207,0,48,207,0,0,249,6,0,192,63,0,224,31,0,0,
+    246,9,64,175,0,0,16,239,0,250,5,0,0,160,79,225,14,0,0,0,244,89,159,0,0,0,0,237,250,3,0,0,
+    0,112,255,12,0,0,0,0,241,127,0,0,0,0,0,254,2,0,0,0,0,244,11,0,0,0,0,176,95,0,0,0,
+    0,96,207,0,0,0,144,202,239,3,0,0,0,234,174,3,0,0,0,0,0,80,110,0,204,0,0,0,80,110,0,204,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,251,7,0,0,0,225,63,243,30,0,0,0,248,9,160,143,
+    0,0,16,238,2,32,239,1,0,144,143,0,0,248,9,0,242,30,0,0,225,47,0,250,6,0,0,112,175,48,223,0,
+    0,0,16,253,179,95,0,0,0,0,246,253,11,0,0,0,0,192,255,3,0,0,0,0,80,191,0,0,0,0,0,64,
+    191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,0,0,64,191,0,0,0,
+    0,0,64,191,0,0,0,0,0,0,160,207,0,0,0,0,0,243,46,0,0,0,0,0,236,3,0,0,0,0,112,78,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,255,255,255,255,7,144,204,204,204,204,255,6,0,
+    0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,
+    0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,
+    207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,224,223,204,204,204,204,
+    9,240,255,255,255,255,255,11,0,0,0,250,11,0,0,0,244,29,0,0,0,208,62,0,0,0,128,62,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,144,255,255,255,255,2,133,136,136,249,31,0,0,0,176,127,0,0,0,96,191,0,0,
+    0,32,238,2,0,0,0,252,5,0,0,0,247,10,0,0,0,243,29,0,0,0,192,79,0,0,0,128,159,0,0,0,
+    64,223,0,0,0,0,253,138,136,136,40,240,255,255,255,255,4,0,0,16,173,0,0,0,0,0,64,255,0,0,0,0,
+    0,16,173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,255,255,255,255,7,144,204,204,204,204,
+    255,6,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,
+    0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,
+    0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,224,223,204,
+    204,204,204,9,240,255,255,255,255,255,11,0,0,227,7,0,0,0,112,207,0,0,0,0,227,7,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,249,255,255,255,47,80,136,136,152,255,1,0,0,0,251,7,0,0,0,246,11,0,0,0,226,
+    46,0,0,0,192,95,0,0,0,112,175,0,0,0,48,223,1,0,0,0,252,4,0,0,0,248,9,0,0,0,244,13,
+    0,0,0,208,175,136,136,136,2,255,255,255,255,79,0,208,44,0,228,9,0,0,32,222,82,191,0,0,0,0,243,253,
+    28,0,0,0,0,112,255,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,255,255,255,255,7,144,
+    204,204,204,204,255,6,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,
+    0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,
+    251,8,0,0,0,0,96,207,0,0,0,0,0,226,63,0,0,0,0,0,251,8,0,0,0,0,96,207,0,0,0,0,
+    0,224,223,204,204,204,204,9,240,255,255,255,255,255,11,32,158,0,96,111,0,64,191,129,143,0,0,96,223,175,0,0,
+    0,160,223,1,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,255,2,133,136,136,249,31,0,0,0,176,127,
+    0,0,0,96,191,0,0,0,32,238,2,0,0,0,252,5,0,0,0,247,10,0,0,0,243,29,0,0,0,192,79,0,
+    0,0,128,159,0,0,0,64,223,0,0,0,0,253,138,136,136,40,240,255,255,255,255,4,0,48,235,223,5,48,255,172,
+    61,0,250,8,0,0,208,47,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,
+    0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,0,254,0,0,0,224,15,0,0,
+    0,254,0,0,0,224,15,0,0,240,255,255,255,255,31,192,204,204,204,204,28,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,255,255,255,255,255,255,255,255,31,192,
+    204,204,204,204,204,204,204,204,204,204,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,173,64,127,160,63,241,31,245,13,249,10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,144,175,192,127,224,47,242,11,246,5,233,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,173,0,232,0,244,7,224,11,160,63,80,143,16,255,1,251,5,245,13,241,
+    47,144,175,80,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,175,64,255,0,252,7,247,
+    11,224,47,160,111,32,191,0,253,1,246,5,241,10,144,14,80,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,33,0,0,32,0,0,32,0,0,225,95,0,176,143,0,128,207,0,48,255,9,0,255,12,0,251,
+    15,0,192,78,0,144,110,0,96,158,0,0,0,16,199,254,190,6,0,0,210,255,205,254,111,0,16,253,42,0,48,9,
+    0,128,191,0,0,0,0,0,224,47,0,0,0,0,0,243,12,0,0,0,0,244,255,255,255,255,9,0,130,251,139,136,
+    136,5,0,0,247,7,0,0,0,0,0,247,7,0,0,0,0,244,255,255,255,239,0,0,130,250,141,136,120,0,0,0,
+    241,31,0,0,0,0,0,160,175,0,0,0,0,0,32,254,42,0,16,21,0,0,227,255,205,253,47,0,0,16,199,254,
+    189,6,
+};
+
+const bitmap_font::glyph font_large_glyphs[] = {
+    { 0x0020, 6, 0, 0, 0, 6, 0 },
+    { 0x0021, 6, 17, 0, -17, 6, 0 },
+    { 0x0022, 10, 17, 0, -17, 10, 51 },
+    { 0x0023, 16, 17, 0, -17, 16, 136 },
+    { 0x0024, 14, 19, 0, -18, 14, 272 },
+    { 0x0025, 20, 17, 0, -17, 20, 405 },
+    { 0x0026, 18, 17, 0, -17, 18, 575 },
+    { 0x0027, 5, 17, 0, -17, 5, 728 },
+    { 0x0028, 7, 21, 0, -17, 7, 771 },
+    { 0x0029, 7, 21, 0, -17, 7, 845 },
+    { 0x002a, 13, 18, 0, -18, 13, 919 },
+    { 0x002b, 14, 15, 0, -15, 14, 1036 },
+    { 0x002c, 6, 6, 0, -3, 6, 1141 },
+    { 0x002d, 8, 7, 0, -7, 8, 1159 },
+    { 0x002e, 6, 4, 0, -4, 6, 1187 },
+    { 0x002f, 9, 17, 0, -17, 9, 1199 },
+    { 0x0030, 14, 17, 0, -17, 14, 1276 },
+    { 0x0031, 14, 17, 0, -17, 14, 1395 },
+    { 0x0032, 14, 17, 0, -17, 14, 1514 },
+    { 0x0033, 14, 17, 0, -17, 14, 1633 },
+    { 0x0034, 14, 17, 0, -17, 14, 1752 },
+    { 0x0035, 14, 17, 0, -17, 14, 1871 },
+    { 0x0036, 14, 17, 0, -17, 14, 1990 },
+    { 0x0037, 14, 17, 0, -17, 14, 2109 },
+    { 0x0038, 14, 17, 0, -17, 14, 2228 },
+    { 0x0039, 14, 17, 0, -17, 14, 2347 },
+    { 0x003a, 6, 13, 0, -13, 6, 2466 },
+    { 0x003b, 6, 16, 0, -13, 6, 2505 },
+    { 0x003c, 14, 15, 0, -15, 14, 2553 },
+    { 0x003d, 14, 12, 0, -12, 14, 2658 },
+    { 0x003e, 14, 15, 0, -15, 14, 2742 },
+    { 0x003f, 10, 17, 0, -17, 10, 2847 },
+    { 0x0040, 22, 19, 0, -17, 22, 2932 },
+    { 0x0041, 16, 17, 0, -17, 15, 3141 },
+    { 0x0042, 16, 17, 0, -17, 16, 3277 },
+    { 0x0043, 15, 17, 0, -17, 15, 3413 },
+    { 0x0044, 18, 17, 0, -17, 18, 3541 },
+    { 0x0045, 13, 17, 0, -17, 13, 3694 },
+    { 0x0046, 12, 17, 0, -17, 12, 3805 },
+    { 0x0047, 17, 17, 0, -17, 17, 3907 },
+    { 0x0048, 18, 17, 0, -17, 18, 4052 },
+    { 0x0049, 7, 17, 0, -17, 7, 4205 },
+    { 0x004a, 8, 21, -2, -17, 6, 4265 },
+    { 0x004b, 15, 17, 0, -17, 15, 4349 },
+    { 0x004c, 12, 17, 0, -17, 12, 4477 },
+    { 0x004d, 22, 17, 0, -17, 22, 4579 },
+    { 0x004e, 18, 17, 0, -17, 18, 4766 },
+    { 0x004f, 19, 17, 0, -17, 19, 4919 },
+    { 0x0050, 14, 17, 0, -17, 14, 5081 },
+    { 0x0051, 19, 21, 0, -17, 19, 5200 },
+    { 0x0052, 15, 17, 0, -17, 15, 5400 },
+    { 0x0053, 13, 17, 0, -17, 13, 5528 },
+    { 0x0054, 14, 17, 0, -17, 13, 5639 },
+    { 0x0055, 17, 17, 0, -17, 17, 5758 },
+    { 0x0056, 15, 17, 0, -17, 14, 5903 },
+    { 0x0057, 22, 17, 0, -17, 22, 6031 },
+    { 0x0058, 14, 17, 0, -17, 14, 6218 },
+    { 0x0059, 14, 17, 0, -17, 13, 6337 },
+    { 0x005a, 14, 17, 0, -17, 14, 6456 },
+    { 0x005b, 8, 21, 0, -17, 8, 6575 },
+    { 0x005c, 9, 17, 0, -17, 9, 6659 },
+    { 0x005d, 8, 21, 0, -17, 8, 6736 },
+    { 0x005e, 13, 17, 0, -17, 13, 6820 },
+    { 0x005f, 12, 4, -1, 0, 11, 6931 },
+    { 0x0060, 14, 19, 0, -19, 14, 6955 },
+    { 0x0061, 13, 13, 0, -13, 13, 7088 },
+    { 0x0062, 15, 18, 0, -18, 15, 7173 },
+    { 0x0063, 11, 13, 0, -13, 11, 7308 },
+    { 0x0064, 15, 18, 0, -18, 15, 7380 },
+    { 0x0065, 13, 13, 0, -13, 13, 7515 },
+    { 0x0066, 10, 18, 0, -18, 8, 7600 },
+    { 0x0067, 13, 19, 0, -13, 13, 7690 },
+    { 0x0068, 15, 18, 0, -18, 15, 7814 },
+    { 0x0069, 6, 18, 0, -18, 6, 7949 },
+    { 0x006a, 8, 24, -2, -18, 6, 8003 },
+    { 0x006b, 13, 18, 0, -18, 13, 8099 },
+    { 0x006c, 6, 18, 0, -18, 6, 8216 },
+    { 0x006d, 22, 13, 0, -13, 22, 8270 },
+    { 0x006e, 15, 13, 0, -13, 15, 8413 },
+    { 0x006f, 15, 13, 0, -13, 15, 8511 },
+    { 0x0070, 15, 19, 0, -13, 15, 8609 },
+    { 0x0071, 15, 19, 0, -13, 15, 8752 },
+    { 0x0072, 10, 13, 0, -13, 10, 8895 },
+    { 0x0073, 11, 13, 0, -13, 11, 8960 },
+    { 0x0074, 8, 16, 0, -16, 8, 9032 },
+    { 0x0075, 15, 13, 0, -13, 15, 9096 },
+    { 0x0076, 13, 13, 0, -13, 12, 9194 },
+    { 0x0077, 19, 13, 0, -13, 19, 9279 },
+    { 0x0078, 13, 13, 0, -13, 13, 9403 },
+    { 0x0079, 13, 19, 0, -13, 12, 9488 },
+    { 0x007a, 11, 13, 0, -13, 11, 9612 },
+    { 0x007b, 9, 21, 0, -17, 9, 9684 },
+    { 0x007c, 13, 24, 0, -18, 13, 9779 },
+    { 0x007d, 9, 21, 0, -17, 9, 9935 },
+    { 0x007e, 14, 10, 0, -10, 14, 10030 },
+    { 0x00a0, 6, 0, 0, 0, 6, 10100 },
+    { 0x00a1, 6, 17, 0, -13, 6, 10100 },
+    { 0x00a2, 14, 17, 0, -17, 14, 10151 },
+    { 0x00a3, 14, 17, 0, -17, 14, 10270 },
+    { 0x00a4, 14, 14, 0, -14, 14, 10389 },
+    { 0x00a5, 14, 17, 0, -17, 14, 10487 },
+    { 0x00a6, 13, 24, 0, -18, 13, 10606 },
+    { 0x00a7, 12, 18, 0, -18, 12, 10762 },
+    { 0x00a8, 14, 17, 0, -17, 14, 10870 },
+    { 0x00a9, 20, 17, 0, -17, 20, 10989 },
+    { 0x00aa, 9, 17, 0, -17, 9, 11159 },
+    { 0x00ab, 12, 11, 0, -11, 12, 11236 },
+    { 0x00ac, 14, 9, 0, -9, 14, 11302 },
+    { 0x00ad, 8, 7, 0, -7, 8, 11365 },
+    { 0x00ae, 20, 17, 0, -17, 20, 11393 },
+    { 0x00af, 14, 20, -1, -20, 12, 11563 },
+    { 0x00b0, 10, 17, 0, -17, 10, 11703 },
+    { 0x00b1, 14, 16, 0, -15, 14, 11788 },
+    { 0x00b2, 8, 17, 0, -17, 8, 11900 },
+    { 0x00b3, 8, 17, 0, -17, 8, 11968 },
+    { 0x00b4, 14, 19, 0, -19, 14, 12036 },
+    { 0x00b5, 15, 19, 0, -13, 15, 12169 },
+    { 0x00b6, 16, 21, 0, -18, 16, 12312 },
+    { 0x00b7, 6, 10, 0, -10, 6, 12480 },
+    { 0x00b8, 6, 6, 0, 0, 5, 12510 },
+    { 0x00b9, 8, 17, 0, -17, 8, 12528 },
+    { 0x00ba, 9, 17, 0, -17, 9, 12596 },
+    { 0x00bb, 12, 11, 0, -11, 12, 12673 },
+    { 0x00bc, 19, 17, 0, -17, 19, 12739 },
+    { 0x00bd, 19, 17, 0, -17, 19, 12901 },
+    { 0x00be, 19, 17, 0, -17, 19, 13063 },
+    { 0x00bf, 10, 17, 0, -13, 10, 13225 },
+    { 0x00c0, 16, 23, 0, -23, 15, 13310 },
+    { 0x00c1, 16, 23, 0, -23, 15, 13494 },
+    { 0x00c2, 16, 23, 0, -23, 15, 13678 },
+    { 0x00c3, 16, 22, 0, -22, 15, 13862 },
+    { 0x00c4, 16, 21, 0, -21, 15, 14038 },
+    { 0x00c5, 16, 22, 0, -22, 15, 14206 },
+    { 0x00c6, 22, 17, -1, -17, 21, 14382 },
+    { 0x00c7, 15, 23, 0, -17, 15, 14569 },
+    { 0x00c8, 13, 23, 0, -23, 13, 14742 },
+    { 0x00c9, 13, 23, 0, -23, 13, 14892 },
+    { 0x00ca, 13, 23, 0, -23, 13, 15042 },
+    { 0x00cb, 13, 21, 0, -21, 13, 15192 },
+    { 0x00cc, 7, 23, 0, -23, 7, 15329 },
+    { 0x00cd, 7, 23, 0, -23, 7, 15410 },
+    { 0x00ce, 9, 23, -1, -23, 7, 15491 },
+    { 0x00cf, 7, 21, 0, -21, 7, 15595 },
+    { 0x00d0, 17, 17, 0, -17, 17, 15669 },
+    { 0x00d1, 18, 22, 0, -22, 18, 15814 },
+    { 0x00d2, 19, 23, 0, -23, 19, 16012 },
+    { 0x00d3, 19, 23, 0, -23, 19, 16231 },
+    { 0x00d4, 19, 23, 0, -23, 19, 16450 },
+    { 0x00d5, 19, 22, 0, -22, 19, 16669 },
+    { 0x00d6, 19, 21, 0, -21, 19, 16878 },
+    { 0x00d7, 14, 14, 0, -14, 14, 17078 },
+    { 0x00d8, 19, 17, 0, -17, 19, 17176 },
+    { 0x00d9, 17, 23, 0, -23, 17, 17338 },
+    { 0x00da, 17, 23, 0, -23, 17, 17534 },
+    { 0x00db, 17, 23, 0, -23, 17, 17730 },
+    { 0x00dc, 17, 21, 0, -21, 17, 17926 },
+    { 0x00dd, 14, 23, 0, -23, 13, 18105 },
+    { 0x00de, 15, 17, 0, -17, 15, 18266 },
+    { 0x00df, 15, 18, 0, -18, 15, 18394 },
+    { 0x00e0, 13, 19, 0, -19, 13, 18529 },
+    { 0x00e1, 13, 19, 0, -19, 13, 18653 },
+    { 0x00e2, 13, 19, 0, -19, 13, 18777 },
+    { 0x00e3, 13, 18, 0, -18, 13, 18901 },
+    { 0x00e4, 13, 17, 0, -17, 13, 19018 },
+    { 0x00e5, 13, 20, 0, -20, 13, 19129 },
+    { 0x00e6, 21, 14, 0, -14, 21, 19259 },
+    { 0x00e7, 11, 19, 0, -13, 11, 19406 },
+    { 0x00e8, 13, 19, 0, -19, 13, 19511 },
+    { 0x00e9, 13, 19, 0, -19, 13, 19635 },
+    { 0x00ea, 13, 19, 0, -19, 13, 19759 },
+    { 0x00eb, 13, 17, 0, -17, 13, 19883 },
+    { 0x00ec, 7, 19, -1, -19, 6, 19994 },
+    { 0x00ed, 7, 19, 0, -19, 6, 20061 },
+    { 0x00ee, 8, 19, -1, -19, 6, 20128 },
+    { 0x00ef, 8, 17, -1, -17, 6, 20204 },
+    { 0x00f0, 14, 18, 0, -18, 14, 20272 },
+    { 0x00f1, 15, 18, 0, -18, 15, 20398 },
+    { 0x00f2, 15, 19, 0, -19, 15, 20533 },
+    { 0x00f3, 15, 19, 0, -19, 15, 20676 },
+    { 0x00f4, 15, 19, 0, -19, 15, 20819 },
+    { 0x00f5, 15, 18, 0, -18, 15, 20962 },
+    { 0x00f6, 15, 17, 0, -17, 15, 21097 },
+    { 0x00f7, 14, 14, 0, -14, 14, 21225 },
+    { 0x00f8, 15, 15, 0, -14, 15, 21323 },
+    { 0x00f9, 15, 19, 0, -19, 15, 21436 },
+    { 0x00fa, 15, 19, 0, -19, 15, 21579 },
+    { 0x00fb, 15, 19, 0, -19, 15, 21722 },
+    { 0x00fc, 15, 17, 0, -17, 15, 21865 },
+    { 0x00fd, 13, 25, 0, -19, 12, 21993 },
+    { 0x00fe, 15, 24, 0, -18, 15, 22156 },
+    { 0x00ff, 13, 23, 0, -17, 12, 22336 },
+    { 0x0100, 16, 21, 0, -21, 15, 22486 },
+    { 0x0101, 13, 17, 0, -17, 13, 22654 },
+    { 0x0102, 16, 22, 0, -22, 15, 22765 },
+    { 0x0103, 13, 18, 0, -18, 13, 22941 },
+    { 0x0104, 16, 22, 0, -17, 15, 23058 },
+    { 0x0105, 13, 18, 0, -13, 13, 23234 },
+    { 0x0106, 15, 23, 0, -23, 15, 23351 },
+    { 0x0107, 11, 19, 0, -19, 11, 23524 },
+    { 0x0108, 15, 23, 0, -23, 15, 23629 },
+    { 0x0109, 11, 19, 0, -19, 11, 23802 },
+    { 0x010a, 15, 22, 0, -22, 15, 23907 },
+    { 0x010b, 11, 18, 0, -18, 11, 24072 },
+    { 0x010c, 15, 23, 0, -23, 15, 24171 },
+    { 0x010d, 11, 19, 0, -19, 11, 24344 },
+    { 0x010e, 18, 23, 0, -23, 18, 24449 },
+    { 0x010f, 17, 18, 0, -18, 15, 24656 },
+    { 0x0110, 17, 17, 0, -17, 17, 24809 },
+    { 0x0111, 15, 18, 0, -18, 15, 24954 },
+    { 0x0112, 13, 21, 0, -21, 13, 25089 },
+    { 0x0113, 13, 17, 0, -17, 13, 25226 },
+    { 0x0114, 13, 22, 0, -22, 13, 25337 },
+    { 0x0115, 13, 18, 0, -18, 13, 25480 },
+    { 0x0116, 13, 22, 0, -22, 13, 25597 },
+    { 0x0117, 13, 18, 0, -18, 13, 25740 },
+    { 0x0118, 13, 22, 0, -17, 13, 25857 },
+    { 0x0119, 13, 18, 0, -13, 13, 26000 },
+    { 0x011a, 13, 23, 0, -23, 13, 26117 },
+    { 0x011b, 13, 19, 0, -19, 13, 26267 },
+    { 0x011c, 17, 23, 0, -23, 17, 26391 },
+    { 0x011d, 13, 25, 0, -19, 13, 26587 },
+    { 0x011e, 17, 22, 0, -22, 17, 26750 },
+    { 0x011f, 13, 24, 0, -18, 13, 26937 },
+    { 0x0120, 17, 22, 0, -22, 17, 27093 },
+    { 0x0121, 13, 24, 0, -18, 13, 27280 },
+    { 0x0122, 17, 22, 0, -17, 17, 27436 },
+    { 0x0123, 13, 25, 0, -19, 13, 27623 },
+    { 0x0124, 18, 23, 0, -23, 18, 27786 },
+    { 0x0125, 15, 24, 0, -24, 15, 27993 },
+    { 0x0126, 18, 17, 0, -17, 18, 28173 },
+    { 0x0127, 15, 18, 0, -18, 15, 28326 },
+    { 0x0128, 9, 22, -1, -22, 7, 28461 },
+    { 0x0129, 10, 18, -2, -18, 6, 28560 },
+    { 0x012a, 8, 21, -1, -21, 7, 28650 },
+    { 0x012b, 8, 17, -1, -17, 6, 28734 },
+    { 0x012c, 8, 22, -1, -22, 7, 28802 },
+    { 0x012d, 8, 18, -1, -18, 6, 28890 },
+    { 0x012e, 7, 22, 0, -17, 7, 28962 },
+    { 0x012f, 6, 23, 0, -18, 6, 29039 },
+    { 0x0130, 7, 22, 0, -22, 7, 29108 },
+    { 0x0131, 6, 13, 0, -13, 6, 29185 },
+    { 0x0132, 13, 21, 0, -17, 13, 29224 },
+    { 0x0133, 12, 24, 0, -18, 12, 29361 },
+    { 0x0134, 10, 27, -2, -23, 6, 29505 },
+    { 0x0135, 9, 25, -2, -19, 6, 29640 },
+    { 0x0136, 15, 22, 0, -17, 15, 29753 },
+    { 0x0137, 13, 23, 0, -18, 13, 29918 },
+    { 0x0138, 13, 13, 0, -13, 12, 30068 },
+    { 0x0139, 12, 23, 0, -23, 12, 30153 },
+    { 0x013a, 7, 24, 0, -24, 6, 30291 },
+    { 0x013b, 12, 22, 0, -17, 12, 30375 },
+    { 0x013c, 6, 23, 0, -18, 6, 30507 },
+    { 0x013d, 12, 17, 0, -17, 12, 30576 },
+    { 0x013e, 8, 18, 0, -18, 6, 30678 },
+    { 0x013f, 12, 17, 0, -17, 12, 30750 },
+    { 0x0140, 8, 18, 0, -18, 8, 30852 },
+    { 0x0141, 13, 17, 0, -17, 13, 30924 },
+    { 0x0142, 8, 18, -1, -18, 6, 31035 },
+    { 0x0143, 18, 23, 0, -23, 18, 31107 },
+    { 0x0144, 15, 19, 0, -19, 15, 31314 },
+    { 0x0145, 18, 22, 0, -17, 18, 31457 },
+    { 0x0146, 15, 18, 0, -13, 15, 31655 },
+    { 0x0147, 18, 23, 0, -23, 18, 31790 },
+    { 0x0148, 15, 19, 0, -19, 15, 31997 },
+    { 0x0149, 16, 17, 0, -17, 16, 32140 },
+    { 0x014a, 18, 21, 0, -17, 18, 32276 },
+    { 0x014b, 15, 19, 0, -13, 15, 32465 },
+    { 0x014c, 19, 21, 0, -21, 19, 32608 },
+    { 0x014d, 15, 17, 0, -17, 15, 32808 },
+    { 0x014e, 19, 22, 0, -22, 19, 32936 },
+    { 0x014f, 15, 18, 0, -18, 15, 33145 },
+    { 0x0150, 19, 23, 0, -23, 19, 33280 },
+    { 0x0151, 15, 19, 0, -19, 15, 33499 },
+    { 0x0152, 22, 17, 0, -17, 22, 33642 },
+    { 0x0153, 23, 13, 0, -13, 23, 33829 },
+    { 0x0154, 15, 23, 0, -23, 15, 33979 },
+    { 0x0155, 10, 19, 0, -19, 10, 34152 },
+    { 0x0156, 15, 22, 0, -17, 15, 34247 },
+    { 0x0157, 10, 18, 0, -13, 10, 34412 },
+    { 0x0158, 15, 23, 0, -23, 15, 34502 },
+    { 0x0159, 10, 19, 0, -19, 10, 34675 },
+    { 0x015a, 13, 23, 0, -23, 13, 34770 },
+    { 0x015b, 11, 19, 0, -19, 11, 34920 },
+    { 0x015c, 13, 23, 0, -23, 13, 35025 },
+    { 0x015d, 11, 19, 0, -19, 11, 35175 },
+    { 0x015e, 13, 23, 0, -17, 13, 35280 },
+    { 0x015f, 11, 19, 0, -13, 11, 35430 },
+    { 0x0160, 13, 23, 0, -23, 13, 35535 },
+    { 0x0161, 11, 19, 0, -19, 11, 35685 },
+    { 0x0162, 14, 23, 0, -17, 13, 35790 },
+    { 0x0163, 8, 22, 0, -16, 8, 35951 },
+    { 0x0164, 14, 23, 0, -23, 13, 36039 },
+    { 0x0165, 9, 18, 0, -18, 8, 36200 },
+    { 0x0166, 14, 17, 0, -17, 13, 36281 },
+    { 0x0167, 8, 16, 0, -16, 8, 36400 },
+    { 0x0168, 17, 22, 0, -22, 17, 36464 },
+    { 0x0169, 15, 18, 0, -18, 15, 36651 },
+    { 0x016a, 17, 21, 0, -21, 17, 36786 },
+    { 0x016b, 15, 17, 0, -17, 15, 36965 },
+    { 0x016c, 17, 22, 0, -22, 17, 37093 },
+    { 0x016d, 15, 18, 0, -18, 15, 37280 },
+    { 0x016e, 17, 24, 0, -24, 17, 37415 },
+    { 0x016f, 15, 20, 0, -20, 15, 37619 },
+    { 0x0170, 17, 23, 0, -23, 17, 37769 },
+    { 0x0171, 15, 19, 0, -19, 15, 37965 },
+    { 0x0172, 17, 22, 0, -17, 17, 38108 },
+    { 0x0173, 15, 18, 0, -13, 15, 38295 },
+    { 0x0174, 22, 23, 0, -23, 22, 38430 },
+    { 0x0175, 19, 19, 0, -19, 19, 38683 },
+    { 0x0176, 14, 23, 0, -23, 13, 38864 },
+    { 0x0177, 13, 25, 0, -19, 12, 39025 },
+    { 0x0178, 14, 21, 0, -21, 13, 39188 },
+    { 0x0179, 14, 23, 0, -23, 14, 39335 },
+    { 0x017a, 11, 19, 0, -19, 11, 39496 },
+    { 0x017b, 14, 22, 0, -22, 14, 39601 },
+    { 0x017c, 11, 18, 0, -18, 11, 39755 },
+    { 0x017d, 14, 23, 0, -23, 14, 39854 },
+    { 0x017e, 11, 19, 0, -19, 11, 40015 },
+    { 0x017f, 9, 18, 0, -18, 8, 40120 },
+    { 0x2013, 12, 7, 0, -7, 12, 40201 },
+    { 0x2014, 24, 7, 0, -7, 24, 40243 },
+    { 0x2018, 4, 17, 0, -17, 4, 40327 },
+    { 0x2019, 4, 17, 0, -17, 4, 40361 },
+    { 0x201c, 9, 17, 0, -17, 8, 40395 },
+    { 0x201d, 9, 17, 0, -17, 8, 40472 },
+    { 0x2026, 19, 4, 0, -4, 19, 40549 },
+    { 0x20ac, 14, 17, 0, -17, 14, 40587 },
+};
+
+} // namespace
+
+const bitmap_font font_small = { 16, 18, 5, font_small_glyphs, 327, font_small_alpha };
+
+const bitmap_font font_large = { 24, 26, 8, font_large_glyphs, 327, font_large_alpha };
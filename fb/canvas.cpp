@@ -0,0 +1,184 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "canvas.h"
+
+#include <algorithm>
+
+namespace {
+
+constexpr uint32_t replacement_character = 0xfffd;
+constexpr uint32_t ellipsis = 0x2026;
+
+} // namespace
+
+const bitmap_font::glyph* bitmap_font::find( uint32_t codepoint ) const
+{
+    auto* end = glyphs + glyph_count;
+    auto* itr = std::lower_bound( glyphs, end, codepoint, []( const glyph& g, uint32_t c ) {
+        return g.codepoint < c;
+    } );
+    return itr != end && itr->codepoint == codepoint ? itr : nullptr;
+}
+
+int bitmap_font::text_width( const std::string& utf8 ) const
+{
+    int width = 0;
+    for ( size_t i = 0; i < utf8.size(); )
+    {
+        auto* g = find( next_codepoint( utf8, i ) );
+        width += g ? g->advance : size / 2;
+    }
+    return width;
+}
+
+uint32_t bitmap_font::next_codepoint( const std::string& utf8, size_t& index )
+{
+    auto lead = static_cast<uint8_t>( utf8[index++] );
+    int continuation = lead >= 0xf0 ? 3 : lead >= 0xe0 ? 2 : lead >= 0xc0 ? 1 : 0;
+    if ( lead >= 0x80 && continuation == 0 )
+        return replacement_character;
+
+    uint32_t codepoint = continuation ? lead & ( 0x3f >> continuation ) : lead;
+    for ( ; continuation > 0; continuation-- )
+    {
+        if ( index >= utf8.size() || ( static_cast<uint8_t>( utf8[index] ) & 0xc0 ) != 0x80 )
+            return replacement_character;
+        codepoint = ( codepoint << 6 ) | ( static_cast<uint8_t>( utf8[index++] ) & 0x3f );
+    }
+    return codepoint;
+}
+
+bool rect::intersects( const rect& other ) const
+{
+    return !intersected( other ).empty();
+}
+
+rect rect::united( const rect& other ) const
+{
+    if ( empty() )
+        return other;
+    if ( other.empty() )
+        return *this;
+    auto left = std::min( x, other.x );
+    auto top = std::min( y, other.y );
+    return { left, top, std::max( x + width, other.x + other.width ) - left, std::max( y + height, other.y + other.height ) - top };
+}
+
+rect rect::intersected( const rect& other ) const
+{
+    auto left = std::max( x, other.x );
+    auto top = std::max( y, other.y );
+    return { left, top, std::min( x + width, other.x + other.width ) - left, std::min( y + height, other.y + other.height ) - top };
+}
+
+canvas::canvas( int width, int height ) :   m_width( width ),
+                                            m_height( height ),
+                                            m_pixels( static_cast<size_t>( width ) * height, 0 )
+{
+}
+
+void canvas::fill( const rect& area, uint32_t color )
+{
+    auto clipped = area.intersected( { 0, 0, m_width, m_height } );
+    if ( clipped.empty() )
+        return;
+
+    for ( auto y = clipped.y; y < clipped.y + clipped.height; y++ )
+    {
+        auto* line = &m_pixels[static_cast<size_t>( y ) * m_width + clipped.x];
+        std::fill( line, line + clipped.width, color );
+    }
+}
+
+void canvas::blend( const alpha_mask& mask, int x, int y, uint32_t color )
+{
+    auto clipped = rect{ x, y, mask.width, mask.height }.intersected( { 0, 0, m_width, m_height } );
+    for ( auto py = clipped.y; py < clipped.y + clipped.height; py++ )
+    {
+        const auto* coverage = &mask.alpha[static_cast<size_t>( py - y ) * mask.width + ( clipped.x - x )];
+        auto* line = &m_pixels[static_cast<size_t>( py ) * m_width + clipped.x];
+        for ( auto px = 0; px < clipped.width; px++ )
+            _blend_pixel( line[px], coverage[px], color );
+    }
+}
+
+void canvas::draw_text( const bitmap_font& font, int x, int baseline, const std::string& utf8, uint32_t color, int max_width, const rect& clip )
+{
+    auto* dots = font.find( ellipsis );
+    auto elide = font.text_width( utf8 ) > max_width;
+    auto limit = x + max_width - ( elide && dots ? dots->advance : 0 );
+
+    auto pen = x;
+    for ( size_t i = 0; i < utf8.size(); )
+    {
+        auto* g = font.find( bitmap_font::next_codepoint( utf8, i ) );
+        auto advance = g ? g->advance : font.size / 2;
+        if ( elide && pen + advance > limit )
+            break;
+        if ( g )
+            _draw_glyph( font, *g, pen, baseline, color, clip );
+        pen += advance;
+    }
+
+    if ( elide && dots )
+        _draw_glyph( font, *dots, pen, baseline, color, clip );
+}
+
+void canvas::_blend_pixel( uint32_t& pixel, unsigned int alpha, uint32_t color )
+{
+    if ( alpha == 0 )
+        return;
+    if ( alpha == 255 )
+    {
+        pixel = color;
+        return;
+    }
+
+    // red and blue blended together, then green
+    auto inverse = 255 - alpha;
+    auto rb = ( ( color & 0xff00ff ) * alpha + ( pixel & 0xff00ff ) * inverse ) >> 8;
+    auto g = ( ( color & 0x00ff00 ) * alpha + ( pixel & 0x00ff00 ) * inverse ) >> 8;
+    pixel = ( rb & 0xff00ff ) | ( g & 0x00ff00 );
+}
+
+void canvas::_draw_glyph( const bitmap_font& font, const bitmap_font::glyph& g, int x, int baseline, uint32_t color, const rect& clip )
+{
+    auto left = x + g.left;
+    auto top = baseline + g.top;
+    auto clipped = rect{ left, top, g.width, g.height }.intersected( clip ).intersected( { 0, 0, m_width, m_height } );
+
+    const auto* data = font.alpha + g.offset;
+    for ( auto py = clipped.y; py < clipped.y + clipped.height; py++ )
+    {
+        auto* line = &m_pixels[static_cast<size_t>( py ) * m_width];
+        for ( auto px = clipped.x; px < clipped.x + clipped.width; px++ )
+        {
+            auto index = static_cast<size_t>( py - top ) * g.width + ( px - left );
+            auto nibble = ( data[index / 2] >> ( ( index & 1 ) * 4 ) ) & 0xf;
+            _blend_pixel( line[px], nibble * 17, color );
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "bitmap_font.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct rect
+{
+    int x;
+    int y;
+    int width;
+    int height;
+
+    bool empty() const { return width <= 0 || height <= 0; }
+    bool intersects( const rect& other ) const;
+    rect united( const rect& other ) const;
+    rect intersected( const rect& other ) const;
+    bool contains( int px, int py ) const { return px >= x && px < x + width && py >= y && py < y + height; }
+};
+
+// coverage mask, 8 bits per pixel
+struct alpha_mask
+{
+    int width;
+    int height;
+    std::vector<uint8_t> alpha;
+};
+
+/*
+ * Software drawing into a 0x00RRGGBB memory buffer : everything the framebuffer UI draws is a flat fill,
+ * a coverage mask (glyphs, icons) blended with a flat color, or a copy between buffers.
+ */
+class canvas
+{
+public:
+    canvas( int width, int height );
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    const uint32_t* row( int y ) const { return &m_pixels[static_cast<size_t>( y ) * m_width]; }
+
+    void fill( const rect& area, uint32_t color );
+    void blend( const alpha_mask& mask, int x, int y, uint32_t color );
+
+    // draws on the baseline, clipped to clip, ending with an ellipsis when wider than max_width
+    void draw_text( const bitmap_font& font, int x, int baseline, const std::string& utf8, uint32_t color, int max_width, const rect& clip );
+
+private:
+    void _blend_pixel( uint32_t& pixel, unsigned int alpha, uint32_t color );
+    void _draw_glyph( const bitmap_font& font, const bitmap_font::glyph& g, int x, int baseline, uint32_t color, const rect& clip );
+
+private:
+    const int m_width;
+    const int m_height;
+    std::vector<uint32_t> m_pixels;
+};
@@ -0,0 +1,322 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "fb_ui.h"
+#include "framebuffer.h"
+#include "touch_input.h"
+
+#include "deezer_wrapper/memory_profile.h"
+
+#include <chrono>
+#include <iostream>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+fb_ui::fb_ui( deezer_wrapper& wrapper, framebuffer& screen, touch_input& touch, const std::string& content ) :
+    m_wrapper( wrapper ),
+    m_screen( screen ),
+    m_touch( touch ),
+    m_content( content ),
+    m_view( screen.width(), screen.height() )
+{
+    if ( pipe2( m_wake_pipe, O_NONBLOCK | O_CLOEXEC ) < 0 )
+        std::cerr << "cannot create the UI wake pipe" << std::endl;
+
+    m_state.status = "connecting...";
+    m_wrapper.register_observer( this );
+}
+
+fb_ui::~fb_ui()
+{
+    m_wrapper.register_observer( nullptr );
+
+    for ( auto fd : m_wake_pipe )
+    {
+        if ( fd >= 0 )
+            close( fd );
+    }
+}
+
+void fb_ui::run()
+{
+    while ( !m_quit )
+    {
+        auto state = _snapshot();
+        _render( state );
+
+        // no timer at all unless the seek bar is moving
+        auto timeout_ms = -1;
+        if ( !m_dragging && m_wrapper.playback_clock_running() )
+            timeout_ms = m_view.next_change_ms( state.position_ms, state.duration_ms );
+
+        pollfd fds[2] = { { m_wake_pipe[0], POLLIN, 0 }, { m_touch.fd(), POLLIN, 0 } };
+        if ( poll( fds, m_touch.fd() >= 0 ? 2 : 1, timeout_ms ) < 0 )
+            continue;   // interrupted by a signal, quit() has written to the pipe
+
+        if ( fds[0].revents & POLLIN )
+        {
+            char buffer[64];
+            while ( read( m_wake_pipe[0], buffer, sizeof( buffer ) ) > 0 ) {}
+        }
+        if ( fds[1].revents & POLLIN )
+            _on_touch();
+    }
+}
+
+void fb_ui::quit()
+{
+    m_quit = true;
+    _wake();
+}
+
+void fb_ui::_wake()
+{
+    char byte = 0;
+    auto written = write( m_wake_pipe[1], &byte, 1 );
+    (void)written;  // a full pipe already wakes the UI
+}
+
+void fb_ui::_set_status( const std::string& status )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_state.status = status;
+}
+
+view_state fb_ui::_snapshot()
+{
+    view_state state;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        state = m_state;
+        state.playing = m_playback == playback::playing;
+    }
+    state.position_ms = m_dragging ? m_drag_position_ms : m_wrapper.playback_position_ms();
+    return state;
+}
+
+void fb_ui::_render( const view_state& state )
+{
+    auto start = std::chrono::steady_clock::now();
+
+    auto dirty = m_view.update( state );
+    if ( dirty.empty() )
+        return;
+    m_screen.present( m_view.surface(), dirty );
+
+    m_infos.frames++;
+    m_infos.render_us += std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count();
+
+    if ( m_infos.first_frame_ms < 0 )
+    {
+        m_infos.first_frame_ms = memory_profile::process_age_ms();
+        std::cout << "STARTUP => first frame after " << m_infos.first_frame_ms << "ms" << std::endl;
+    }
+}
+
+void fb_ui::_on_touch()
+{
+    auto event = m_touch.read();
+    auto duration_ms = 0;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        duration_ms = m_state.duration_ms;
+    }
+
+    switch( event.type )
+    {
+        case touch_input::phase::none:
+            break;
+        case touch_input::phase::press:
+        case touch_input::phase::move:
+            // only the seek bar follows the finger, buttons act on release
+            if ( event.type == touch_input::phase::press )
+                m_dragging = m_view.hit_test( event.x, event.y ) == player_view::control::seek_bar && duration_ms > 0;
+            if ( m_dragging )
+                m_drag_position_ms = m_view.seek_position_ms( event.x, duration_ms );
+            break;
+        case touch_input::phase::release:
+            if ( m_dragging )
+            {
+                m_dragging = false;
+                m_wrapper.playback_seek( m_view.seek_position_ms( event.x, duration_ms ) );
+            }
+            else
+            {
+                _on_control( m_view.hit_test( event.x, event.y ) );
+            }
+            break;
+    }
+}
+
+void fb_ui::_on_control( player_view::control control )
+{
+    playback state;
+    bool loaded;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        state = m_playback;
+        loaded = m_content_loaded;
+    }
+
+    switch( control )
+    {
+        case player_view::control::none:
+        case player_view::control::seek_bar:
+            break;
+        case player_view::control::previous:
+            m_wrapper.playback_previous();
+            break;
+        case player_view::control::next:
+            m_wrapper.playback_next();
+            break;
+        case player_view::control::play_pause:
+            if ( state == playback::playing )
+            {
+                m_wrapper.playback_pause();
+            }
+            else if ( state == playback::paused )
+            {
+                m_wrapper.playback_resume();
+            }
+            else if ( loaded )
+            {
+                m_wrapper.playback_start();
+            }
+            else
+            {
+                // same default as the QML application : the user flow
+                // then the daypart in progress, if any
+                auto content = m_content.empty() ? m_wrapper.scheduled_content() : m_content;
+                m_wrapper.set_content( content.empty() ? "dzradio:///user-" + m_wrapper.user_id() : content );
+                m_wrapper.load_content();
+                _set_status( "loading..." );
+            }
+            break;
+        case player_view::control::like:
+            m_wrapper.playback_like();
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                m_state.liked = true;
+            }
+            break;
+    }
+}
+
+void fb_ui::on_connect_event( const deezer_wrapper::connect_event& event )
+{
+    switch( event )
+    {
+        case deezer_wrapper::connect_event::user_offline_available:
+            _set_status( "offline" );
+            break;
+        case deezer_wrapper::connect_event::user_login_ok:
+            _set_status( "connected" );
+            break;
+        case deezer_wrapper::connect_event::user_login_fail_network_error:
+        case deezer_wrapper::connect_event::user_login_fail_bad_credentials:
+        case deezer_wrapper::connect_event::user_login_fail_user_info:
+        case deezer_wrapper::connect_event::user_login_fail_offline_mode:
+            _set_status( "login failed" );
+            break;
+        default:
+            return;
+    }
+    _wake();
+}
+
+void fb_ui::on_player_event( const deezer_wrapper::player_event& event )
+{
+    switch( event )
+    {
+        case deezer_wrapper::player_event::queuelist_loaded:
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                m_content_loaded = true;
+            }
+            m_wrapper.playback_start();
+            break;
+        case deezer_wrapper::player_event::queuelist_no_right:
+            _set_status( "no right to play this content" );
+            break;
+        case deezer_wrapper::player_event::queuelist_track_selected:
+        {
+            const auto& infos = m_wrapper.current_track_infos();
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_state.title = infos.title;
+            m_state.artist = infos.artist;
+            m_state.album = infos.album_title;
+            m_state.duration_ms = infos.duration * 1000;
+            m_state.liked = false;
+            break;
+        }
+        case deezer_wrapper::player_event::render_track_start:
+        case deezer_wrapper::player_event::render_track_resumed:
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_playback = playback::playing;
+            m_state.status = m_wrapper.ad_break() ? "advertisement" : "playing";
+            break;
+        }
+        case deezer_wrapper::player_event::render_track_paused:
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_playback = playback::paused;
+            m_state.status = "paused";
+            break;
+        }
+        case deezer_wrapper::player_event::render_track_underflow:
+            _set_status( "buffering..." );
+            break;
+        case deezer_wrapper::player_event::render_track_start_failure:
+            _set_status( "track unavailable" );
+            break;
+        case deezer_wrapper::player_event::render_track_removed:
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_playback = playback::stopped;
+            m_state.status = "stopped";
+            break;
+        }
+        case deezer_wrapper::player_event::render_track_end:
+        case deezer_wrapper::player_event::render_track_seeking:
+        case deezer_wrapper::player_event::mediastream_data_ready_after_seek:
+            // the clock froze or restarted
+            break;
+        default:
+            return;
+    }
+    _wake();
+}
+
+void fb_ui::on_track_duration( int duration_ms )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_state.duration_ms = duration_ms;
+    }
+    _wake();
+}
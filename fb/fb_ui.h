@@ -0,0 +1,105 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "player_view.h"
+
+#include "deezer_wrapper/deezer_wrapper.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+class framebuffer;
+class touch_input;
+
+/*
+ * Framebuffer front-end : the same observer of the wrapper as the QML application, without any
+ * toolkit. SDK callbacks only update the shared state and wake the UI thread, which sleeps in poll()
+ * until the next input, event, or (while playing) the next visible change of the seek bar.
+ */
+class fb_ui : public deezer_wrapper::observer
+{
+public:
+    fb_ui( deezer_wrapper& wrapper, framebuffer& screen, touch_input& touch, const std::string& content );
+    ~fb_ui();
+
+    // draws and handles input until quit()
+    void run();
+
+    // async-signal-safe
+    void quit();
+
+    struct infos
+    {
+        long first_frame_ms;    ///< process start to first frame on screen
+        int frames;
+        long render_us;         ///< drawing and presenting, over all frames
+    };
+    infos current_infos() const { return m_infos; }
+
+protected:
+    void on_connect_event( const deezer_wrapper::connect_event& event ) final override;
+    void on_player_event( const deezer_wrapper::player_event& event ) final override;
+    void on_track_duration( int duration_ms ) final override;
+
+private:
+    enum class playback
+    {
+        stopped,
+        playing,
+        paused
+    };
+
+    void _wake();
+    void _set_status( const std::string& status );
+    view_state _snapshot();
+    void _render( const view_state& state );
+    void _on_touch();
+    void _on_control( player_view::control control );
+
+private:
+    deezer_wrapper& m_wrapper;
+    framebuffer& m_screen;
+    touch_input& m_touch;
+    std::string m_content;
+
+    player_view m_view;
+
+    int m_wake_pipe[2] = { -1, -1 };
+    std::atomic<bool> m_quit{ false };
+
+    std::mutex m_mutex;
+    view_state m_state;
+    playback m_playback = playback::stopped;
+    bool m_content_loaded = false;
+
+    // touch state, UI thread only
+    bool m_dragging = false;
+    int m_drag_position_ms = 0;
+
+    infos m_infos{ -1, 0, 0 };
+};
@@ -0,0 +1,149 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "framebuffer.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <linux/fb.h>
+#include <linux/kd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+framebuffer::framebuffer( const std::string& device )
+{
+    m_fd = open( device.c_str(), O_RDWR | O_CLOEXEC );
+    if ( m_fd < 0 )
+        throw std::runtime_error( "cannot open " + device + " : " + strerror( errno ) );
+
+    fb_var_screeninfo variable{};
+    fb_fix_screeninfo fixed{};
+    if ( ioctl( m_fd, FBIOGET_VSCREENINFO, &variable ) < 0 || ioctl( m_fd, FBIOGET_FSCREENINFO, &fixed ) < 0 )
+    {
+        close( m_fd );
+        throw std::runtime_error( device + " is not a framebuffer device" );
+    }
+
+    m_width = static_cast<int>( variable.xres );
+    m_height = static_cast<int>( variable.yres );
+    m_bits_per_pixel = static_cast<int>( variable.bits_per_pixel );
+    m_line_length = fixed.line_length;
+    m_red = { variable.red.offset, variable.red.length };
+    m_green = { variable.green.offset, variable.green.length };
+    m_blue = { variable.blue.offset, variable.blue.length };
+
+    if ( m_bits_per_pixel != 16 && m_bits_per_pixel != 32 )
+    {
+        close( m_fd );
+        throw std::runtime_error( "unsupported framebuffer depth : " + std::to_string( m_bits_per_pixel ) );
+    }
+
+    m_size = fixed.smem_len;
+    auto* memory = mmap( nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0 );
+    if ( memory == MAP_FAILED )
+    {
+        close( m_fd );
+        throw std::runtime_error( "cannot map " + device + " : " + strerror( errno ) );
+    }
+    m_memory = static_cast<uint8_t*>( memory );
+
+    ioctl( m_fd, FBIOBLANK, FB_BLANK_UNBLANK );
+
+    // keeps the console (cursor, kernel messages) from drawing over the UI when it shares the screen
+    m_tty = open( "/dev/tty0", O_RDWR | O_CLOEXEC );
+    if ( m_tty >= 0 && ioctl( m_tty, KDSETMODE, KD_GRAPHICS ) < 0 )
+    {
+        close( m_tty );
+        m_tty = -1;
+    }
+}
+
+framebuffer::framebuffer( int width, int height, int bits_per_pixel ) : m_width( width ),
+                                                                        m_height( height ),
+                                                                        m_bits_per_pixel( bits_per_pixel ),
+                                                                        m_line_length( static_cast<size_t>( width ) * bits_per_pixel / 8 )
+{
+    if ( m_bits_per_pixel == 16 )
+    {
+        m_red = { 11, 5 };
+        m_green = { 5, 6 };
+        m_blue = { 0, 5 };
+    }
+    m_offscreen.resize( m_line_length * height );
+    m_memory = m_offscreen.data();
+}
+
+framebuffer::~framebuffer()
+{
+    if ( m_tty >= 0 )
+    {
+        ioctl( m_tty, KDSETMODE, KD_TEXT );
+        close( m_tty );
+    }
+    if ( m_fd >= 0 )
+    {
+        munmap( m_memory, m_size );
+        close( m_fd );
+    }
+}
+
+void framebuffer::present( const canvas& source, const std::vector<rect>& areas )
+{
+    for ( const auto& area : areas )
+    {
+        auto clipped = area.intersected( { 0, 0, std::min( m_width, source.width() ), std::min( m_height, source.height() ) } );
+        if ( clipped.empty() )
+            continue;
+
+        for ( auto y = clipped.y; y < clipped.y + clipped.height; y++ )
+        {
+            const auto* from = source.row( y ) + clipped.x;
+            auto* line = m_memory + static_cast<size_t>( y ) * m_line_length;
+            if ( m_bits_per_pixel == 16 )
+            {
+                auto* to = reinterpret_cast<uint16_t*>( line ) + clipped.x;
+                for ( auto x = 0; x < clipped.width; x++ )
+                    to[x] = static_cast<uint16_t>( _pack( from[x] ) );
+            }
+            else
+            {
+                auto* to = reinterpret_cast<uint32_t*>( line ) + clipped.x;
+                for ( auto x = 0; x < clipped.width; x++ )
+                    to[x] = _pack( from[x] );
+            }
+        }
+    }
+}
+
+uint32_t framebuffer::_pack( uint32_t rgb ) const
+{
+    auto component = []( uint32_t value, const channel& c ) {
+        return ( value >> ( 8 - c.length ) ) << c.offset;
+    };
+    return component( ( rgb >> 16 ) & 0xff, m_red ) | component( ( rgb >> 8 ) & 0xff, m_green ) | component( rgb & 0xff, m_blue );
+}
@@ -0,0 +1,80 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "canvas.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Linux framebuffer device (e.g. /dev/fb1 for SPI screens) mapped in memory : the UI draws into a canvas,
+ * and only the dirty areas are converted to the device pixel format (16 or 32 bits) and copied.
+ * Without a device, presents into memory so that rendering can be benchmarked anywhere.
+ */
+class framebuffer
+{
+public:
+    explicit framebuffer( const std::string& device );
+    framebuffer( int width, int height, int bits_per_pixel );
+    ~framebuffer();
+
+    framebuffer( const framebuffer& ) = delete;
+    framebuffer& operator=( const framebuffer& ) = delete;
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    int bits_per_pixel() const { return m_bits_per_pixel; }
+
+    void present( const canvas& source, const std::vector<rect>& areas );
+
+private:
+    struct channel
+    {
+        unsigned int offset;
+        unsigned int length;
+    };
+
+    uint32_t _pack( uint32_t rgb ) const;
+
+private:
+    int m_fd = -1;
+    int m_tty = -1;     ///< console switched to graphics mode while the UI runs
+
+    int m_width = 0;
+    int m_height = 0;
+    int m_bits_per_pixel = 0;
+    size_t m_line_length = 0;
+
+    channel m_red{ 16, 8 };
+    channel m_green{ 8, 8 };
+    channel m_blue{ 0, 8 };
+
+    uint8_t* m_memory = nullptr;
+    size_t m_size = 0;
+    std::vector<uint8_t> m_offscreen;
+};
@@ -0,0 +1,105 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "icons.h"
+
+#include <cmath>
+#include <functional>
+
+namespace {
+
+constexpr int supersampling = 4;
+
+using shape = std::function<bool( float x, float y )>;    // unit square, y downwards
+
+alpha_mask rasterize( int size, const shape& inside )
+{
+    alpha_mask mask{ size, size, std::vector<uint8_t>( static_cast<size_t>( size ) * size, 0 ) };
+    for ( auto y = 0; y < size; y++ )
+    {
+        for ( auto x = 0; x < size; x++ )
+        {
+            int hits = 0;
+            for ( auto sy = 0; sy < supersampling; sy++ )
+            {
+                for ( auto sx = 0; sx < supersampling; sx++ )
+                {
+                    auto u = ( x + ( sx + .5f ) / supersampling ) / size;
+                    auto v = ( y + ( sy + .5f ) / supersampling ) / size;
+                    hits += inside( u, v ) ? 1 : 0;
+                }
+            }
+            mask.alpha[static_cast<size_t>( y ) * size + x] = static_cast<uint8_t>( 255 * hits / ( supersampling * supersampling ) );
+        }
+    }
+    return mask;
+}
+
+// triangle pointing right, with its left edge at x0 and its tip at x1
+bool in_triangle( float x, float y, float x0, float x1, float top, float bottom )
+{
+    if ( x < x0 || x > x1 )
+        return false;
+    auto half = ( bottom - top ) / 2.f * ( x1 - x ) / ( x1 - x0 );
+    auto middle = ( top + bottom ) / 2.f;
+    return y >= middle - half && y <= middle + half;
+}
+
+bool in_box( float x, float y, float x0, float x1, float top, float bottom )
+{
+    return x >= x0 && x <= x1 && y >= top && y <= bottom;
+}
+
+} // namespace
+
+icon_set::icon_set( int size ) :
+    play( rasterize( size, []( float x, float y ) {
+        return in_triangle( x, y, .11f, .89f, 0.f, 1.f );
+    } ) ),
+    pause( rasterize( size, []( float x, float y ) {
+        return in_box( x, y, .15f, .4f, .05f, .95f ) || in_box( x, y, .6f, .85f, .05f, .95f );
+    } ) ),
+    next( rasterize( size, []( float x, float y ) {
+        return in_triangle( x, y, .1f, .7f, .1f, .9f ) || in_box( x, y, .74f, .88f, .1f, .9f );
+    } ) ),
+    previous( rasterize( size, []( float x, float y ) {
+        return in_triangle( 1.f - x, y, .1f, .7f, .1f, .9f ) || in_box( 1.f - x, y, .74f, .88f, .1f, .9f );
+    } ) ),
+    heart( rasterize( size, []( float x, float y ) {
+        // (x² + y² - 1)³ - x²y³ <= 0, scaled to the unit square
+        auto u = ( x - .5f ) * 2.5f;
+        auto v = ( .53f - y ) * 2.5f;
+        auto a = u * u + v * v - 1.f;
+        return a * a * a - u * u * v * v * v <= 0.f;
+    } ) )
+{
+}
+
+alpha_mask rasterize_disc( int diameter )
+{
+    return rasterize( diameter, []( float x, float y ) {
+        return ( x - .5f ) * ( x - .5f ) + ( y - .5f ) * ( y - .5f ) <= .25f;
+    } );
+}
@@ -0,0 +1,177 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "fb_ui.h"
+#include "framebuffer.h"
+#include "touch_input.h"
+
+#include "deezer_wrapper/deezer_wrapper.h"
+#include "deezer_wrapper/memory_profile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+
+#define DEEZZY_FB_APPLICATION_ID      "247082"	// SET YOUR APPLICATION ID
+#define DEEZZY_FB_APPLICATION_NAME    "Deezzy"  // SET YOUR APPLICATION NAME
+#define DEEZZY_FB_APPLICATION_VERSION "00001"   // SET YOUR APPLICATION VERSION
+
+namespace {
+
+fb_ui* running_ui = nullptr;
+
+void on_signal( int )
+{
+    if ( running_ui )
+        running_ui->quit();
+}
+
+char* get_option( char ** begin, char ** end, const std::string& option )
+{
+    auto** itr = std::find( begin, end, option );
+    if ( itr != end && ++itr != end )
+    {
+        return *itr;
+    }
+    return nullptr;
+}
+
+bool has_option( char ** begin, char ** end, const std::string& option )
+{
+    return std::find( begin, end, option ) != end;
+}
+
+// renders the player screen into memory : full frames, then one second of playback per frame
+void benchmark( int frames )
+{
+    using clock = std::chrono::steady_clock;
+    auto elapsed_us = []( clock::time_point start ) {
+        return std::chrono::duration_cast<std::chrono::microseconds>( clock::now() - start ).count();
+    };
+
+    auto start = clock::now();
+    player_view view( 480, 320 );
+    framebuffer screen( 480, 320, 16 );
+    std::cout << "BENCH => view setup " << elapsed_us( start ) << "us" << std::endl;
+
+    view_state state;
+    state.status = "playing";
+    state.title = "Ne me quitte pas (Live à l'Olympia)";
+    state.artist = "Jacques Brel";
+    state.album = "Olympia 1961 - Intégrale";
+    state.duration_ms = 225000;
+    state.playing = true;
+
+    start = clock::now();
+    for ( auto i = 0; i < frames; i++ )
+    {
+        view.invalidate();
+        screen.present( view.surface(), view.update( state ) );
+    }
+    std::cout << "BENCH => full frame " << elapsed_us( start ) / frames << "us" << std::endl;
+
+    long pixels = 0;
+    start = clock::now();
+    for ( auto i = 0; i < frames; i++ )
+    {
+        state.position_ms = ( i * 1000 ) % state.duration_ms;
+        auto dirty = view.update( state );
+        for ( const auto& area : dirty )
+            pixels += area.width * area.height;
+        screen.present( view.surface(), dirty );
+    }
+    std::cout << "BENCH => progress frame " << elapsed_us( start ) / frames << "us, "
+              << pixels / frames << " pixels" << std::endl;
+}
+
+} // namespace
+
+int main( int argc, char *argv[] )
+{
+    // exit status 1 when the peak resident size goes over it, for regression runs
+    auto* rss_budget = get_option( argv, argv+argc, "-rss-budget" );
+    auto budget_kB = rss_budget ? std::atol( rss_budget ) : 0;
+
+    if ( has_option( argv, argv+argc, "-bench" ) )
+    {
+        benchmark( 500 );
+        return memory_profile::check_peak_rss( budget_kB ) ? 0 : 1;
+    }
+
+    auto* playlist = get_option( argv, argv+argc, "-p" );
+    auto* fb_device = get_option( argv, argv+argc, "-fb" );
+    auto* touch_device = get_option( argv, argv+argc, "-touch" );
+
+    try
+    {
+        framebuffer screen( fb_device ? fb_device : "/dev/fb1" );
+        std::cout << "DISPLAY => " << screen.width() << "x" << screen.height() << " " << screen.bits_per_pixel() << "bpp" << std::endl;
+
+        // rotated SPI screens report the panel axes
+        touch_input touch( touch_device ? touch_device : "/dev/input/event0",
+                           screen.width(), screen.height(),
+                           has_option( argv, argv+argc, "-swap-xy" ),
+                           has_option( argv, argv+argc, "-invert-x" ),
+                           has_option( argv, argv+argc, "-invert-y" ) );
+
+        deezer_wrapper wrapper( DEEZZY_FB_APPLICATION_ID, DEEZZY_FB_APPLICATION_NAME, DEEZZY_FB_APPLICATION_VERSION, true );
+        // optional features are opt-in, as in the QML player
+        wrapper.enable_loudness_normalization( has_option( argv, argv+argc, "-loudness" ) );
+        wrapper.enable_ram_cache( has_option( argv, argv+argc, "-ram-cache" ) );
+        wrapper.enable_skip_prediction( has_option( argv, argv+argc, "-skip-prediction" ) );
+        wrapper.enable_equalizer( has_option( argv, argv+argc, "-eq" ) );
+        wrapper.enable_schedule( has_option( argv, argv+argc, "-schedule" ) );
+        wrapper.enable_thread_policy( has_option( argv, argv+argc, "-thread-policy" ) );
+
+        {
+            fb_ui ui( wrapper, screen, touch, playlist ? playlist : "" );
+
+            running_ui = &ui;
+            std::signal( SIGINT, on_signal );
+            std::signal( SIGTERM, on_signal );
+
+            wrapper.connect();
+            ui.run();
+
+            running_ui = nullptr;
+
+            auto infos = ui.current_infos();
+            std::cout << "RENDER => " << infos.frames << " frames, "
+                      << ( infos.frames ? infos.render_us / infos.frames : 0 ) << "us per frame" << std::endl;
+        }
+
+        wrapper.disconnect();
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "CPU => " << memory_profile::cpu_time_ms() << "ms over " << memory_profile::process_age_ms() << "ms" << std::endl;
+    return memory_profile::check_peak_rss( budget_kB ) ? 0 : 1;
+}
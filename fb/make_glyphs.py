@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+#The MIT License
+#
+#Copyright (c) 2017-2017 Albert Murienne
+#
+#Permission is hereby granted, free of charge, to any person obtaining a copy
+#of this software and associated documentation files (the "Software"), to deal
+#in the Software without restriction, including without limitation the rights
+#to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#copies of the Software, and to permit persons to whom the Software is
+#furnished to do so, subject to the following conditions:
+#
+#The above copyright notice and this permission notice shall be included in
+#all copies or substantial portions of the Software.
+#
+#THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+#AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#THE SOFTWARE.
+
+# Pre-rasterizes the Latin glyphs of the UI font into 4 bits coverage masks (bitmap_fonts.cpp), so that
+# the framebuffer UI draws text without any font engine at runtime. Requires Pillow built with FreeType
+# (see requirements.txt) :
+#   pip3 install -r requirements.txt
+#   python3 make_glyphs.py ../src/fonts/OpenSans-Regular.ttf > bitmap_fonts.cpp
+
+import sys
+from PIL import ImageFont
+
+SIZES = { 'font_small': 16, 'font_large': 24 }
+CODEPOINTS = list( range( 0x20, 0x7f ) ) + list( range( 0xa0, 0x180 ) ) + [ 0x2013, 0x2014, 0x2018, 0x2019, 0x201c, 0x201d, 0x2026, 0x20ac ]
+
+def rasterize( path, name, size ):
+    font = ImageFont.truetype( path, size )
+    ascent, descent = font.getmetrics()
+    glyphs = []
+    alpha = bytearray()
+    for cp in CODEPOINTS:
+        char = chr( cp )
+        mask, ( left, top ) = font.getmask2( char, mode='L' )
+        width, height = mask.size
+        # getmask2 offsets are relative to the ascender line
+        glyphs.append( ( cp, width, height, left, top - ascent, round( font.getlength( char ) ), len( alpha ) ) )
+        # two pixels per byte, low nibble first, each glyph starting on a byte
+        pixels = bytes( mask )
+        for i in range( 0, len( pixels ), 2 ):
+            low = ( pixels[i] + 8 ) // 17
+            high = ( pixels[i + 1] + 8 ) // 17 if i + 1 < len( pixels ) else 0
+            alpha.append( low | ( high << 4 ) )
+    return ascent, descent, glyphs, alpha
+
+def main():
+    path = sys.argv[1]
+    out = sys.stdout
+    out.write( '// generated by make_glyphs.py from %s, do not edit\n\n' % path.split( '/' )[-1] )
+    out.write( '#include "bitmap_font.h"\n\nnamespace {\n' )
+    fonts = []
+    for name, size in SIZES.items():
+        ascent, descent, glyphs, alpha = rasterize( path, name, size )
+        out.write( '\nconst uint8_t %s_alpha[] = {' % name )
+        for i in range( 0, len( alpha ), 32 ):
+            out.write( '\n    ' + ','.join( '%d' % b for b in alpha[i:i + 32] ) + ',' )
+        out.write( '\n};\n\nconst bitmap_font::glyph %s_glyphs[] = {\n' % name )
+        for g in glyphs:
+            out.write( '    { 0x%04x, %d, %d, %d, %d, %d, %d },\n' % g )
+        out.write( '};\n' )
+        fonts.append( ( name, size, ascent, descent, len( glyphs ) ) )
+    out.write( '\n} // namespace\n' )
+    for name, size, ascent, descent, count in fonts:
+        out.write( '\nconst bitmap_font %s = { %d, %d, %d, %s_glyphs, %d, %s_alpha };\n' % ( name, size, ascent, descent, name, count, name ) )
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,203 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "player_view.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+// same palette as the QML screens
+constexpr uint32_t background_color = 0x111111;
+constexpr uint32_t text_color = 0xeeeeee;
+constexpr uint32_t secondary_color = 0x9a9a9a;
+constexpr uint32_t groove_color = 0x3a3a3a;
+constexpr uint32_t progress_color = 0x4682b4;     // steelblue
+constexpr uint32_t inactive_color = 0x6d6d6d;
+
+constexpr int margin = 16;
+constexpr int knob_size = 16;
+constexpr int groove_height = 6;
+constexpr int icon_size = 48;
+
+std::string format_time( int ms )
+{
+    auto seconds = std::max( ms, 0 ) / 1000;
+    char text[8];
+    snprintf( text, sizeof( text ), "%02d:%02d", ( seconds / 60 ) % 60, seconds % 60 );
+    return text;
+}
+
+} // namespace
+
+player_view::player_view( int width, int height ) : m_canvas( width, height ),
+                                                    m_icons( icon_size ),
+                                                    m_knob( rasterize_disc( knob_size ) )
+{
+    // laid out for 480x320, buttons taking the remaining height
+    m_status_area = { margin, 0, width - 2 * margin, 24 };
+    m_title_area = { margin, 36, width - 2 * margin, 34 };
+    m_artist_area = { margin, 76, width - 2 * margin, 22 };
+    m_album_area = { margin, 100, width - 2 * margin, 22 };
+    m_seek_area = { 0, 136, width, 24 };
+    m_time_area = { margin, 162, width - 2 * margin, 22 };
+
+    auto button_top = 192;
+    auto button_width = width / 4;
+    auto button_height = height - button_top;
+    m_previous_area = { 0, button_top, button_width, button_height };
+    m_play_area = { button_width, button_top, button_width, button_height };
+    m_next_area = { 2 * button_width, button_top, button_width, button_height };
+    m_like_area = { 3 * button_width, button_top, width - 3 * button_width, button_height };
+
+    m_groove_left = margin + knob_size / 2;
+    m_groove_width = std::max( 1, width - 2 * m_groove_left );
+}
+
+std::vector<rect> player_view::update( const view_state& state )
+{
+    std::vector<rect> dirty;
+
+    const auto full = !m_valid;
+    if ( full )
+    {
+        m_canvas.fill( { 0, 0, m_canvas.width(), m_canvas.height() }, background_color );
+        _draw_button( m_previous_area, m_icons.previous, text_color );
+        _draw_button( m_next_area, m_icons.next, text_color );
+        dirty.push_back( { 0, 0, m_canvas.width(), m_canvas.height() } );
+    }
+
+    auto changed = [&]( bool differs, const rect& area ) {
+        if ( !full && differs )
+            dirty.push_back( area );
+        return full || differs;
+    };
+
+    if ( changed( state.status != m_drawn.status, m_status_area ) )
+        _draw_text_area( m_status_area, font_small, "Deezzy - " + state.status, secondary_color );
+    if ( changed( state.title != m_drawn.title, m_title_area ) )
+        _draw_text_area( m_title_area, font_large, state.title, text_color );
+    if ( changed( state.artist != m_drawn.artist, m_artist_area ) )
+        _draw_text_area( m_artist_area, font_small, state.artist, text_color );
+    if ( changed( state.album != m_drawn.album, m_album_area ) )
+        _draw_text_area( m_album_area, font_small, state.album, secondary_color );
+
+    auto knob_moved = _knob_x( state.position_ms, state.duration_ms ) != _knob_x( m_drawn.position_ms, m_drawn.duration_ms );
+    if ( changed( knob_moved, m_seek_area ) )
+        _draw_seek_bar( state.position_ms, state.duration_ms );
+
+    auto times_changed = state.position_ms / 1000 != m_drawn.position_ms / 1000 || state.duration_ms / 1000 != m_drawn.duration_ms / 1000;
+    if ( changed( times_changed, m_time_area ) )
+        _draw_times( state.position_ms, state.duration_ms );
+
+    if ( changed( state.playing != m_drawn.playing, m_play_area ) )
+        _draw_button( m_play_area, state.playing ? m_icons.pause : m_icons.play, text_color );
+    if ( changed( state.liked != m_drawn.liked, m_like_area ) )
+        _draw_button( m_like_area, m_icons.heart, state.liked ? progress_color : inactive_color );
+
+    m_drawn = state;
+    m_valid = true;
+
+    return dirty;
+}
+
+player_view::control player_view::hit_test( int x, int y ) const
+{
+    // the bar is thin : the touch area extends over the time labels
+    if ( rect{ 0, m_seek_area.y - 8, m_canvas.width(), m_seek_area.height + 16 }.contains( x, y ) )
+        return control::seek_bar;
+    if ( m_previous_area.contains( x, y ) )
+        return control::previous;
+    if ( m_play_area.contains( x, y ) )
+        return control::play_pause;
+    if ( m_next_area.contains( x, y ) )
+        return control::next;
+    if ( m_like_area.contains( x, y ) )
+        return control::like;
+    return control::none;
+}
+
+int player_view::seek_position_ms( int x, int duration_ms ) const
+{
+    auto offset = std::min( std::max( x - m_groove_left, 0 ), m_groove_width );
+    return static_cast<int>( static_cast<long>( offset ) * duration_ms / m_groove_width );
+}
+
+int player_view::next_change_ms( int position_ms, int duration_ms ) const
+{
+    auto next = 1000 - position_ms % 1000;
+    if ( duration_ms > 0 )
+    {
+        // first position drawn one pixel further
+        auto pixel = _knob_x( position_ms, duration_ms ) - m_groove_left + 1;
+        auto pixel_ms = static_cast<int>( ( static_cast<long>( pixel ) * duration_ms + m_groove_width - 1 ) / m_groove_width );
+        next = std::min( next, pixel_ms - position_ms );
+    }
+    return std::max( next, 10 );
+}
+
+void player_view::_draw_text_area( const rect& area, const bitmap_font& font, const std::string& text, uint32_t color )
+{
+    m_canvas.fill( area, background_color );
+    auto baseline = area.y + ( area.height + font.ascent - font.descent ) / 2;
+    m_canvas.draw_text( font, area.x, baseline, text, color, area.width, area );
+}
+
+void player_view::_draw_seek_bar( int position_ms, int duration_ms )
+{
+    m_canvas.fill( m_seek_area, background_color );
+
+    auto middle = m_seek_area.y + m_seek_area.height / 2;
+    auto knob_x = _knob_x( position_ms, duration_ms );
+    m_canvas.fill( { m_groove_left, middle - groove_height / 2, m_groove_width, groove_height }, groove_color );
+    m_canvas.fill( { m_groove_left, middle - groove_height / 2, knob_x - m_groove_left, groove_height }, progress_color );
+    m_canvas.blend( m_knob, knob_x - knob_size / 2, middle - knob_size / 2, text_color );
+}
+
+void player_view::_draw_times( int position_ms, int duration_ms )
+{
+    m_canvas.fill( m_time_area, background_color );
+
+    auto baseline = m_time_area.y + ( m_time_area.height + font_small.ascent - font_small.descent ) / 2;
+    auto duration = format_time( duration_ms );
+    auto duration_width = font_small.text_width( duration );
+    m_canvas.draw_text( font_small, m_time_area.x, baseline, format_time( position_ms ), secondary_color, m_time_area.width, m_time_area );
+    m_canvas.draw_text( font_small, m_time_area.x + m_time_area.width - duration_width, baseline, duration, secondary_color, duration_width, m_time_area );
+}
+
+void player_view::_draw_button( const rect& area, const alpha_mask& icon, uint32_t color )
+{
+    m_canvas.fill( area, background_color );
+    m_canvas.blend( icon, area.x + ( area.width - icon.width ) / 2, area.y + ( area.height - icon.height ) / 2, color );
+}
+
+int player_view::_knob_x( int position_ms, int duration_ms ) const
+{
+    if ( duration_ms <= 0 )
+        return m_groove_left;
+    auto clamped = std::min( std::max( position_ms, 0 ), duration_ms );
+    return m_groove_left + static_cast<int>( static_cast<long>( clamped ) * m_groove_width / duration_ms );
+}
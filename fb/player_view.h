@@ -0,0 +1,107 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "canvas.h"
+#include "icons.h"
+
+#include <string>
+#include <vector>
+
+struct view_state
+{
+    std::string status;
+    std::string title;
+    std::string artist;
+    std::string album;
+    int position_ms = 0;
+    int duration_ms = 0;
+    bool playing = false;
+    bool liked = false;
+};
+
+/*
+ * Player screen of the framebuffer UI (status line, track infos, seek bar and transport buttons) :
+ * each area is redrawn only when the state it shows has visibly changed, the seek bar moving when
+ * the knob crosses a pixel and the time label when the second changes.
+ */
+class player_view
+{
+public:
+    enum class control
+    {
+        none,
+        previous,
+        play_pause,
+        next,
+        like,
+        seek_bar
+    };
+
+    player_view( int width, int height );
+
+    const canvas& surface() const { return m_canvas; }
+
+    // redraws what changed since the previous update, and returns the areas to present
+    std::vector<rect> update( const view_state& state );
+    void invalidate() { m_valid = false; }
+
+    control hit_test( int x, int y ) const;
+    int seek_position_ms( int x, int duration_ms ) const;
+
+    // time until the seek bar or the time label next change while playing
+    int next_change_ms( int position_ms, int duration_ms ) const;
+
+private:
+    void _draw_text_area( const rect& area, const bitmap_font& font, const std::string& text, uint32_t color );
+    void _draw_seek_bar( int position_ms, int duration_ms );
+    void _draw_times( int position_ms, int duration_ms );
+    void _draw_button( const rect& area, const alpha_mask& icon, uint32_t color );
+
+    int _knob_x( int position_ms, int duration_ms ) const;
+
+private:
+    canvas m_canvas;
+    icon_set m_icons;
+    alpha_mask m_knob;
+
+    rect m_status_area;
+    rect m_title_area;
+    rect m_artist_area;
+    rect m_album_area;
+    rect m_seek_area;
+    rect m_time_area;
+    rect m_previous_area;
+    rect m_play_area;
+    rect m_next_area;
+    rect m_like_area;
+
+    int m_groove_left;
+    int m_groove_width;
+
+    view_state m_drawn;
+    bool m_valid = false;
+};
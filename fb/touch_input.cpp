@@ -0,0 +1,129 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "touch_input.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <linux/input.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+touch_input::touch_input( const std::string& device, int screen_width, int screen_height, bool swap_xy, bool invert_x, bool invert_y ) :
+    m_screen_width( screen_width ),
+    m_screen_height( screen_height ),
+    m_swap_xy( swap_xy ),
+    m_invert_x( invert_x ),
+    m_invert_y( invert_y )
+{
+    m_fd = open( device.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC );
+    if ( m_fd < 0 )
+    {
+        std::cerr << "cannot open touch device " << device << " : " << strerror( errno ) << std::endl;
+        return;
+    }
+
+    input_absinfo info{};
+    if ( ioctl( m_fd, EVIOCGABS( ABS_X ), &info ) == 0 )
+        m_range_x = { info.minimum, info.maximum };
+    if ( ioctl( m_fd, EVIOCGABS( ABS_Y ), &info ) == 0 )
+        m_range_y = { info.minimum, info.maximum };
+}
+
+touch_input::~touch_input()
+{
+    if ( m_fd >= 0 )
+        close( m_fd );
+}
+
+touch_input::event touch_input::read()
+{
+    event result{ phase::none, 0, 0 };
+    if ( m_fd < 0 )
+        return result;
+
+    input_event events[64];
+    ssize_t bytes;
+    while ( ( bytes = ::read( m_fd, events, sizeof( events ) ) ) > 0 )
+    {
+        for ( size_t i = 0; i < static_cast<size_t>( bytes ) / sizeof( input_event ); i++ )
+        {
+            const auto& e = events[i];
+            if ( e.type == EV_ABS && ( e.code == ABS_X || e.code == ABS_MT_POSITION_X ) )
+            {
+                m_raw_x = e.value;
+                m_moved = true;
+            }
+            else if ( e.type == EV_ABS && ( e.code == ABS_Y || e.code == ABS_MT_POSITION_Y ) )
+            {
+                m_raw_y = e.value;
+                m_moved = true;
+            }
+            else if ( e.type == EV_KEY && e.code == BTN_TOUCH )
+            {
+                m_down = e.value != 0;
+            }
+            else if ( e.type == EV_SYN && e.code == SYN_REPORT )
+            {
+                // a frame is complete : coordinates and touch state are consistent
+                auto type = phase::none;
+                if ( m_down && !m_was_down )
+                    type = phase::press;
+                else if ( !m_down && m_was_down )
+                    type = phase::release;
+                else if ( m_down && m_moved )
+                    type = phase::move;
+                m_was_down = m_down;
+                m_moved = false;
+
+                if ( type == phase::none )
+                    continue;
+
+                auto raw_x = m_swap_xy ? m_raw_y : m_raw_x;
+                auto raw_y = m_swap_xy ? m_raw_x : m_raw_y;
+                const auto& range_x = m_swap_xy ? m_range_y : m_range_x;
+                const auto& range_y = m_swap_xy ? m_range_x : m_range_y;
+
+                // a release wins over an earlier move of the same batch
+                if ( result.type != phase::release || type == phase::press )
+                    result = { type, _scale( raw_x, range_x, m_screen_width, m_invert_x ), _scale( raw_y, range_y, m_screen_height, m_invert_y ) };
+            }
+        }
+    }
+    return result;
+}
+
+int touch_input::_scale( int value, const axis& range, int size, bool invert ) const
+{
+    if ( range.maximum <= range.minimum )
+        return std::min( std::max( value, 0 ), size - 1 );
+
+    auto scaled = static_cast<int>( static_cast<long>( value - range.minimum ) * ( size - 1 ) / ( range.maximum - range.minimum ) );
+    scaled = std::min( std::max( scaled, 0 ), size - 1 );
+    return invert ? size - 1 - scaled : scaled;
+}
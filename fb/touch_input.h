@@ -0,0 +1,91 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <string>
+
+/*
+ * Single touch reader on a Linux input event device (resistive or capacitive screen), reporting
+ * taps and drags in screen coordinates. The device range comes from the driver, and the axes can be
+ * swapped or inverted to follow the screen rotation.
+ */
+class touch_input
+{
+public:
+    enum class phase
+    {
+        none,
+        press,
+        move,
+        release
+    };
+
+    struct event
+    {
+        phase type;
+        int x;
+        int y;
+    };
+
+    touch_input( const std::string& device, int screen_width, int screen_height, bool swap_xy, bool invert_x, bool invert_y );
+    ~touch_input();
+
+    touch_input( const touch_input& ) = delete;
+    touch_input& operator=( const touch_input& ) = delete;
+
+    // to be polled for reading, invalid when the device could not be opened
+    int fd() const { return m_fd; }
+
+    // consumes the pending input reports, returns the last touch transition (phase::none if nothing changed)
+    event read();
+
+private:
+    struct axis
+    {
+        int minimum = 0;
+        int maximum = 0;
+    };
+
+    int _scale( int value, const axis& range, int size, bool invert ) const;
+
+private:
+    int m_fd = -1;
+
+    const int m_screen_width;
+    const int m_screen_height;
+    const bool m_swap_xy;
+    const bool m_invert_x;
+    const bool m_invert_y;
+
+    axis m_range_x;
+    axis m_range_y;
+
+    int m_raw_x = 0;
+    int m_raw_y = 0;
+    bool m_down = false;
+    bool m_was_down = false;
+    bool m_moved = false;
+};
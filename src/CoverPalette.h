@@ -0,0 +1,297 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <QColor>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QSet>
+#include <QtConcurrent>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DEEZZY_PALETTE_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DEEZZY_PALETTE_SSE
+#endif
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/*
+ * Extracts dominant and accent colors from album covers : the cover is fetched asynchronously,
+ * then decoded, box filtered down to a small thumbnail and median cut in the thread pool.
+ * Results of the last albums are cached (LRU) so that going back to an album does not redo the work.
+ */
+class CoverPalette : public QObject
+{
+    Q_OBJECT
+public:
+    struct Palette
+    {
+        QColor dominant;
+        QColor accent;
+    };
+
+    CoverPalette( QObject* parent ) : QObject( parent ), m_network( new QNetworkAccessManager( this ) )
+    {
+    }
+
+    // to be called on the owner thread (queued from SDK callbacks) : only the last requested album is reported
+    Q_INVOKABLE void request( qint64 album_id, const QString& cover_url )
+    {
+        m_requested = album_id;
+
+        auto itr = m_cache.constFind( album_id );
+        if ( itr != m_cache.constEnd() )
+        {
+            m_recent.removeOne( album_id );
+            m_recent.append( album_id );
+            emit paletteReady( album_id, itr->dominant, itr->accent );
+            return;
+        }
+
+        if ( cover_url.isEmpty() || m_pending.contains( album_id ) )
+            return;
+        m_pending.insert( album_id );
+
+        QNetworkRequest network_request( QUrl( cover_url ) );
+        network_request.setAttribute( QNetworkRequest::FollowRedirectsAttribute, true );
+
+        auto* reply = m_network->get( network_request );
+        connect( reply, &QNetworkReply::finished, this, [this, reply, album_id]() {
+            reply->deleteLater();
+            if ( reply->error() != QNetworkReply::NoError )
+            {
+                m_pending.remove( album_id );
+                return;
+            }
+
+            auto* watcher = new QFutureWatcher<Palette>( this );
+            connect( watcher, &QFutureWatcher<Palette>::finished, this, [this, watcher, album_id]() {
+                watcher->deleteLater();
+                m_pending.remove( album_id );
+
+                auto palette = watcher->result();
+                if ( !palette.dominant.isValid() )
+                    return;
+
+                m_cache.insert( album_id, palette );
+                m_recent.removeOne( album_id );
+                m_recent.append( album_id );
+                while ( m_recent.size() > cache_size )
+                    m_cache.remove( m_recent.takeFirst() );
+                if ( album_id == m_requested )
+                    emit paletteReady( album_id, palette.dominant, palette.accent );
+            } );
+            watcher->setFuture( QtConcurrent::run( &CoverPalette::extract, reply->readAll() ) );
+        } );
+    }
+
+    static Palette extract( const QByteArray& encoded )
+    {
+        QImage image;
+        if ( !image.loadFromData( encoded ) )
+            return {};
+
+        image = image.convertToFormat( QImage::Format_RGB32 );
+        if ( image.width() < thumbnail_size || image.height() < thumbnail_size )
+            image = image.scaled( thumbnail_size, thumbnail_size );
+
+        return median_cut( box_filter( image ) );
+    }
+
+signals:
+    void paletteReady( qint64 album_id, QColor dominant, QColor accent );
+
+private:
+    static constexpr int thumbnail_size = 32;
+    static constexpr int box_count = 8;
+    static constexpr int cache_size = 32;
+
+    // averages each block of the source into one thumbnail pixel (B, G, R order as in Format_RGB32)
+    static std::vector<std::array<int, 3>> box_filter( const QImage& image )
+    {
+        const int bw = image.width() / thumbnail_size;
+        const int bh = image.height() / thumbnail_size;
+        const int area = bw * bh;
+
+        std::vector<std::array<int, 3>> pixels( thumbnail_size * thumbnail_size );
+
+        for ( int ty = 0; ty < thumbnail_size; ty++ )
+        {
+            for ( int tx = 0; tx < thumbnail_size; tx++ )
+            {
+                std::array<uint32_t, 4> sums = { { 0, 0, 0, 0 } };
+                for ( int y = ty * bh; y < ( ty + 1 ) * bh; y++ )
+                {
+                    auto* row = image.constScanLine( y ) + 4 * tx * bw;
+                    accumulate_row( row, bw, sums );
+                }
+                pixels[ty * thumbnail_size + tx] = { { static_cast<int>( sums[0] / area ),
+                                                       static_cast<int>( sums[1] / area ),
+                                                       static_cast<int>( sums[2] / area ) } };
+            }
+        }
+
+        return pixels;
+    }
+
+    // adds the 4 channels of 'count' consecutive 32 bits pixels into 'sums'
+    static void accumulate_row( const uchar* row, int count, std::array<uint32_t, 4>& sums )
+    {
+        int x = 0;
+
+#if defined(DEEZZY_PALETTE_NEON)
+        // de-interleaves 8 pixels into one 16 bits accumulator per channel (block rows stay far below overflow)
+        uint16x8_t acc[4] = { vdupq_n_u16( 0 ), vdupq_n_u16( 0 ), vdupq_n_u16( 0 ), vdupq_n_u16( 0 ) };
+        for ( ; x + 8 <= count; x += 8 )
+        {
+            auto px = vld4_u8( row + 4 * x );
+            for ( int c = 0; c < 4; c++ )
+                acc[c] = vaddw_u8( acc[c], px.val[c] );
+        }
+        for ( int c = 0; c < 4; c++ )
+        {
+            auto wide = vpaddlq_u32( vpaddlq_u16( acc[c] ) );
+            sums[c] += static_cast<uint32_t>( vgetq_lane_u64( wide, 0 ) + vgetq_lane_u64( wide, 1 ) );
+        }
+#elif defined(DEEZZY_PALETTE_SSE)
+        const auto zero = _mm_setzero_si128();
+        auto acc = _mm_setzero_si128();
+        for ( ; x + 4 <= count; x += 4 )
+        {
+            // 4 pixels -> 2 x 2 pixels of 16 bits channels -> 4 x 32 bits channel sums
+            auto px = _mm_loadu_si128( reinterpret_cast<const __m128i*>( row + 4 * x ) );
+            auto pairs = _mm_add_epi16( _mm_unpacklo_epi8( px, zero ), _mm_unpackhi_epi8( px, zero ) );
+            acc = _mm_add_epi32( acc, _mm_add_epi32( _mm_unpacklo_epi16( pairs, zero ), _mm_unpackhi_epi16( pairs, zero ) ) );
+        }
+        uint32_t partial[4];
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( partial ), acc );
+        for ( int c = 0; c < 4; c++ )
+            sums[c] += partial[c];
+#endif
+
+        for ( ; x < count; x++ )
+            for ( int c = 0; c < 4; c++ )
+                sums[c] += row[4 * x + c];
+    }
+
+    static Palette median_cut( std::vector<std::array<int, 3>> pixels )
+    {
+        struct box
+        {
+            size_t begin, end;
+            int channel, range;
+            double priority;    ///< volume x count
+        };
+
+        auto measure = [&pixels]( size_t begin, size_t end ) {
+            box b{ begin, end, 0, -1, 0. };
+            double volume = 1.;
+            for ( int c = 0; c < 3; c++ )
+            {
+                auto minmax = std::minmax_element( pixels.begin() + begin, pixels.begin() + end,
+                    [c]( const std::array<int, 3>& l, const std::array<int, 3>& r ) { return l[c] < r[c]; } );
+                auto range = ( *minmax.second )[c] - ( *minmax.first )[c];
+                volume *= range + 1;
+                if ( range > b.range )
+                {
+                    b.channel = c;
+                    b.range = range;
+                }
+            }
+            b.priority = b.range > 0 ? volume * ( end - begin ) : 0.;
+            return b;
+        };
+
+        std::vector<box> boxes = { measure( 0, pixels.size() ) };
+
+        // the box spanning the most volume x pixels is split first : a large area of close colors stays one
+        // populated box, while sparse color ranges are split, so that box populations end up meaningful
+        while ( static_cast<int>( boxes.size() ) < box_count )
+        {
+            auto widest = std::max_element( boxes.begin(), boxes.end(), []( const box& l, const box& r ) {
+                return l.priority < r.priority;
+            } );
+            if ( widest->range <= 0 || widest->end - widest->begin < 2 )
+                break;
+
+            auto b = *widest;
+            auto middle = b.begin + ( b.end - b.begin ) / 2;
+            std::nth_element( pixels.begin() + b.begin, pixels.begin() + middle, pixels.begin() + b.end,
+                [c = b.channel]( const std::array<int, 3>& l, const std::array<int, 3>& r ) { return l[c] < r[c]; } );
+
+            *widest = measure( b.begin, middle );
+            boxes.push_back( measure( middle, b.end ) );
+        }
+
+        // dominant : most populated box, accent : most saturated box among the well populated ones
+        Palette palette;
+        size_t dominant_count = 0;
+        float accent_score = -1.f;
+
+        for ( const auto& b : boxes )
+        {
+            std::array<long, 3> sums = { { 0, 0, 0 } };
+            for ( auto i = b.begin; i < b.end; i++ )
+                for ( int c = 0; c < 3; c++ )
+                    sums[c] += pixels[i][c];
+
+            auto count = b.end - b.begin;
+            QColor color( static_cast<int>( sums[2] / count ), static_cast<int>( sums[1] / count ), static_cast<int>( sums[0] / count ) );
+
+            if ( count > dominant_count )
+            {
+                dominant_count = count;
+                palette.dominant = color;
+            }
+
+            auto score = color.hsvSaturationF() * color.valueF() * ( count * box_count >= pixels.size() / 2 ? 1.f : 0.5f );
+            if ( score > accent_score )
+            {
+                accent_score = score;
+                palette.accent = color;
+            }
+        }
+
+        return palette;
+    }
+
+private:
+    QNetworkAccessManager* m_network;
+
+    QHash<qint64, Palette> m_cache;
+    QList<qint64> m_recent;         ///< cached album ids, least recently used first
+    QSet<qint64> m_pending;
+    qint64 m_requested = 0;
+};
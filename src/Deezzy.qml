@@ -27,6 +27,8 @@ import QtQuick.Controls 1.0
 import QtQuick.Layouts 1.2
 
 import Native.DeezzyApp 1.0
+import Native.SeekBar 1.0
+import Native.SpectrumView 1.0
 
 ApplicationWindow {
 
@@ -37,28 +39,12 @@ ApplicationWindow {
     height: 250
     visible: true
 
-    property int currentTrackDuration: 0 // TODO-TMP : Manage with a C++ binding?
-
-    signal bufferProgress( int progress )
-    signal renderProgress( int progress )
-
-    function seek(progress) {
-        deezzy.seek(progress);
-    }
-
     DeezzyApp
     {
         id: deezzy
         objectName: "deezzy"
 
-        Component.onCompleted: {
-            sliderBar.setBufferProgress(0);
-            sliderBar.setRenderProgress(0);
-            appWindow.bufferProgress.connect(sliderBar.setBufferProgress);
-            appWindow.renderProgress.connect(sliderBar.setRenderProgress);
-            sliderBar.seek.connect(appWindow.seek);
-            deezzy.connect();
-        }
+        Component.onCompleted: deezzy.connect();
         Component.onDestruction: deezzy.disconnect();
     }
 
@@ -97,24 +83,13 @@ ApplicationWindow {
         }
 
         function love(){
-            //deezzy.like();
-            console.log("LOVE TRACK NOT IMPLEMENTED YET :-(");
+            deezzy.like();
         }
 
         function ban(){
             deezzy.dislike();
         }
 
-        function msToTime(duration) {
-            var seconds = parseInt((duration/1000)%60);
-            var minutes = parseInt((duration/(1000*60))%60);
-
-            minutes = (minutes < 10) ? "0" + minutes : minutes;
-            seconds = (seconds < 10) ? "0" + seconds : seconds;
-
-            return minutes + ":" + seconds;
-        }
-
         Connections {
             target: deezzy
 
@@ -135,8 +110,6 @@ ApplicationWindow {
             onStopped: {
                 console.log("DEEZZY ONSTOPPED");
                 playPause.source = "icons/play.svg";
-                sliderBar.setRenderProgress(0);
-                currentTime.text = '00:00';
             }
 
             onLoggedIn: {
@@ -144,23 +117,6 @@ ApplicationWindow {
                 controlWrapper.enabled = true;
             }
 
-            onBufferProgress: {
-                console.log("DEEZZY BUFFER PROGRESS " + progress.toFixed(2));
-                bufferProgress(progress);
-            }
-
-            onRenderProgress: {
-                console.log("DEEZZY RENDER PROGRESS " + progress.toFixed(2));
-                currentTime.text = playLogic.msToTime(progress*appWindow.currentTrackDuration/100)
-                renderProgress(progress);
-            }
-
-            onTrackDuration: {
-                console.log("DEEZZY TRACK DURATION " + (duration_ms/1000));
-                appWindow.currentTrackDuration = duration_ms;
-                totalTime.text = playLogic.msToTime(duration_ms);
-            }
-
             onError: {
                 console.log("DEEZZY ONERROR");
             }
@@ -181,7 +137,8 @@ ApplicationWindow {
     Rectangle {
         id: foreground
 
-        color: "black"
+        color: Qt.darker(deezzy.trackInfos.dominantColor, 2.5)
+        Behavior on color { ColorAnimation { duration: 800 } }
         anchors.verticalCenterOffset: 0
         anchors.horizontalCenterOffset: 0
         width: parent.width
@@ -190,6 +147,13 @@ ApplicationWindow {
         anchors.horizontalCenter: parent.horizontalCenter
         anchors.verticalCenter: parent.verticalCenter
 
+        SpectrumView {
+            id: spectrum
+            anchors.fill: parent
+            opacity: 0.35
+            active: !deezzy.idle
+        }
+
         Row{
             id: topRow
             x: 5
@@ -224,6 +188,36 @@ ApplicationWindow {
                     }
                 }
 
+                Image {
+                    id: searchButton
+                    source: "icons/search.svg"
+                    width: 30
+                    height: 30
+                    mipmap: true
+                    anchors.left: powerOff.right
+                    anchors.leftMargin: 20
+                    anchors.top: parent.top
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: searchPanel.visible = true;
+                    }
+                }
+
+                Image {
+                    id: queueButton
+                    source: "icons/queue.svg"
+                    width: 30
+                    height: 30
+                    mipmap: true
+                    anchors.left: searchButton.right
+                    anchors.leftMargin: 20
+                    anchors.top: parent.top
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: queuePanel.visible = true;
+                    }
+                }
+
                 Rectangle {
                     id: spacer
                     width: 800
@@ -277,6 +271,10 @@ ApplicationWindow {
                             anchors.verticalCenter: parent.verticalCenter
                             width: 108
                             height: 108
+                            // decoded at display size, and not kept in the pixmap cache on low memory builds
+                            sourceSize.width: 108
+                            sourceSize.height: 108
+                            cache: !lowMemory
                             onStatusChanged: {
                                 if (coverPic.status == Image.Ready)
                                     loadingPic.opacity = 0.
@@ -469,7 +467,7 @@ ApplicationWindow {
 
                                 id: loveRect
 
-                                enabled: false // NOT IMPLEMENTED YET
+                                enabled: true
                                 opacity: enabled ? 1. : 0.3
 
                                 width: 30
@@ -553,24 +551,25 @@ ApplicationWindow {
 
                             Text {
                                 id: currentTime
-                                text: '00:00'
+                                text: sliderBar.positionText
                                 font.family: appFont.name
                                 color: "#dedede"
                                 font.pointSize: 18
                             }
 
-                            SliderBar{
+                            SeekBar {
                                 id: sliderBar
                                 Layout.fillWidth: true
-                                bgImg: "images/slider_background.png"
-                                bufferImg: "images/slider_value_right.png"
-                                progressImg: "images/slider_value_left.png"
-                                knobImg: "images/slider_knob.png"
+                                position: deezzy.renderPosition
+                                buffered: deezzy.bufferPosition
+                                duration: deezzy.duration
+                                enabled: !deezzy.advertising
+                                onSeek: deezzy.seek(progress)
                             }
 
                             Text {
                                 id: totalTime
-                                text: '00:00'
+                                text: sliderBar.durationText
                                 font.family: appFont.name
                                 color: "#dedede"
                                 font.pointSize: 18
@@ -580,5 +579,234 @@ ApplicationWindow {
                 }
             }
         }
+
+        Rectangle {
+            id: searchPanel
+            anchors.fill: parent
+            color: "#e0111111"
+            visible: false
+
+            onVisibleChanged: {
+                if (visible) {
+                    searchField.text = "";
+                    searchField.forceActiveFocus();
+                }
+            }
+
+            MouseArea {
+                // swallows the clicks aimed at the player controls underneath
+                anchors.fill: parent
+            }
+
+            RowLayout {
+                id: searchBar
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.top: parent.top
+                anchors.margins: 10
+                spacing: 10
+
+                TextField {
+                    id: searchField
+                    Layout.fillWidth: true
+                    font.pointSize: 18
+                    placeholderText: "Search your library (" + deezzy.library.librarySize + " items)"
+                    onTextChanged: deezzy.library.query = text
+                }
+
+                Image {
+                    source: "icons/cross.svg"
+                    Layout.preferredWidth: 30
+                    Layout.preferredHeight: 30
+                    mipmap: true
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: searchPanel.visible = false;
+                    }
+                }
+            }
+
+            ListView {
+                id: searchResults
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.top: searchBar.bottom
+                anchors.bottom: parent.bottom
+                anchors.margins: 10
+                clip: true
+                model: deezzy.library
+
+                delegate: Item {
+                    width: searchResults.width
+                    height: 64
+
+                    Column {
+                        anchors.verticalCenter: parent.verticalCenter
+                        Text {
+                            text: title
+                            color: "#eeeeee"
+                            font.family: appFont.name
+                            font.pointSize: 18
+                            font.bold: true
+                            elide: Text.ElideRight
+                            width: searchResults.width
+                        }
+                        Text {
+                            text: ["Artist", "Album", "Playlist", "Track"][kind] + (subtitle ? " - " + subtitle : "")
+                            color: "steelblue"
+                            font.family: appFont.name
+                            font.pointSize: 14
+                            elide: Text.ElideRight
+                            width: searchResults.width
+                        }
+                    }
+
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: {
+                            if (deezzy.playLibraryItem(index))
+                                searchPanel.visible = false;
+                        }
+                    }
+                }
+            }
+
+            Text {
+                anchors.right: parent.right
+                anchors.bottom: parent.bottom
+                anchors.margins: 5
+                text: deezzy.library.resultCount + " results in " + deezzy.library.queryMicroseconds + " us"
+                color: "#6d6d6d"
+                font.family: appFont.name
+                font.pointSize: 14
+            }
+        }
+
+        Rectangle {
+            id: queuePanel
+            anchors.fill: parent
+            color: "#e0111111"
+            visible: false
+
+            onVisibleChanged: {
+                if (visible && deezzy.queue.currentRow >= 0)
+                    queueList.positionViewAtIndex(deezzy.queue.currentRow, ListView.Center);
+            }
+
+            MouseArea {
+                // swallows the clicks aimed at the player controls underneath
+                anchors.fill: parent
+            }
+
+            RowLayout {
+                id: queueBar
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.top: parent.top
+                anchors.margins: 10
+                spacing: 20
+
+                Text {
+                    text: "Up next"
+                    Layout.fillWidth: true
+                    color: "#eeeeee"
+                    font.family: appFont.name
+                    font.pointSize: 18
+                    font.bold: true
+                }
+                Text {
+                    text: ["Repeat off", "Repeat one", "Repeat all"][deezzy.queue.repeatMode]
+                    color: deezzy.queue.repeatMode > 0 ? "steelblue" : "#6d6d6d"
+                    font.family: appFont.name
+                    font.pointSize: 14
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: deezzy.toggleRepeat();
+                    }
+                }
+                Text {
+                    text: "Shuffle"
+                    color: deezzy.queue.shuffle ? "steelblue" : "#6d6d6d"
+                    font.family: appFont.name
+                    font.pointSize: 14
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: deezzy.toggleShuffle();
+                    }
+                }
+                Image {
+                    source: "icons/cross.svg"
+                    Layout.preferredWidth: 30
+                    Layout.preferredHeight: 30
+                    mipmap: true
+                    MouseArea {
+                        anchors.fill: parent
+                        onClicked: queuePanel.visible = false;
+                    }
+                }
+            }
+
+            ListView {
+                id: queueList
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.top: queueBar.bottom
+                anchors.bottom: parent.bottom
+                anchors.margins: 10
+                clip: true
+                cacheBuffer: 60 * 4
+                model: deezzy.queue
+
+                delegate: Item {
+                    width: queueList.width
+                    height: 60
+
+                    Column {
+                        anchors.verticalCenter: parent.verticalCenter
+                        width: parent.width - queueDuration.width - 10
+                        Text {
+                            text: loaded ? title : "..."
+                            color: current ? "steelblue" : "#eeeeee"
+                            font.family: appFont.name
+                            font.pointSize: 18
+                            font.bold: current
+                            elide: Text.ElideRight
+                            width: parent.width
+                        }
+                        Text {
+                            text: artist
+                            color: "#9a9a9a"
+                            font.family: appFont.name
+                            font.pointSize: 14
+                            elide: Text.ElideRight
+                            width: parent.width
+                        }
+                    }
+                    Text {
+                        id: queueDuration
+                        anchors.right: parent.right
+                        anchors.verticalCenter: parent.verticalCenter
+                        text: loaded ? Math.floor(duration / 60) + ":" + ("0" + duration % 60).slice(-2) : ""
+                        color: "#6d6d6d"
+                        font.family: appFont.name
+                        font.pointSize: 14
+                    }
+
+                    MouseArea {
+                        anchors.fill: parent
+                        enabled: deezzy.queue.seekable
+                        onClicked: deezzy.queue.playRow(index);
+                    }
+                }
+
+                Connections {
+                    target: deezzy.queue
+                    onCurrentRowChanged: {
+                        if (queuePanel.visible && deezzy.queue.currentRow >= 0)
+                            queueList.positionViewAtIndex(deezzy.queue.currentRow, ListView.Contain);
+                    }
+                }
+            }
+        }
     }
 }
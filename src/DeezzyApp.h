@@ -23,11 +23,18 @@ THE SOFTWARE.
 */
 
 #include "deezer_wrapper/deezer_wrapper.h"
+#include "deezer_wrapper/room_sync.h"
+#include "CoverPalette.h"
+#include "LibraryModel.h"
+#include "PlaybackClock.h"
+#include "QueueModel.h"
 
 #include <QtQml>
 #include <QQmlApplicationEngine>
 #include <QGuiApplication>
 
+#include <atomic>
+
 #define DEEZZY_APPLICATION_ID      "247082"	// SET YOUR APPLICATION ID
 #define DEEZZY_APPLICATION_NAME    "Deezzy" // SET YOUR APPLICATION NAME
 #define DEEZZY_APPLICATION_VERSION "00001"	// SET YOUR APPLICATION VERSION
@@ -40,6 +47,8 @@ class TrackInfos : public QObject
     Q_PROPERTY(int duration READ duration NOTIFY durationChanged)
     Q_PROPERTY(QString albumTitle READ albumTitle NOTIFY albumTitleChanged)
     Q_PROPERTY(QString coverArtUrl READ coverArtUrl NOTIFY coverArtUrlChanged)
+    Q_PROPERTY(QColor dominantColor READ dominantColor NOTIFY paletteChanged)
+    Q_PROPERTY(QColor accentColor READ accentColor NOTIFY paletteChanged)
 public:
     TrackInfos( QObject* parent ) : QObject( parent ) {}
     QString title() { return m_title; }
@@ -47,18 +56,23 @@ public:
     int duration() { return m_duration; }
     QString albumTitle() { return m_albumTitle; }
     QString coverArtUrl() { return m_coverArtUrl; }
+    QColor dominantColor() { return m_dominantColor; }
+    QColor accentColor() { return m_accentColor; }
 signals:
 	void titleChanged();
     void artistChanged();
     void durationChanged();
 	void albumTitleChanged();
 	void coverArtUrlChanged();
+    void paletteChanged();
 public:
     QString m_title;
     QString m_artist;
     int m_duration;
     QString m_albumTitle;
     QString m_coverArtUrl;
+    QColor m_dominantColor = QColor( "black" );
+    QColor m_accentColor = QColor( "steelblue" );
 };
 
 class DeezzyApp :   public QObject,
@@ -69,6 +83,13 @@ class DeezzyApp :   public QObject,
     Q_PROPERTY(PlaybackState playbackState READ playbackState)
     Q_PROPERTY(QString content READ content WRITE setContent)
     Q_PROPERTY(TrackInfos* trackInfos READ trackInfos NOTIFY trackInfosChanged)
+    Q_PROPERTY(int renderPosition READ renderPosition NOTIFY renderPositionChanged)
+    Q_PROPERTY(int bufferPosition READ bufferPosition NOTIFY bufferPositionChanged)
+    Q_PROPERTY(int duration READ duration NOTIFY durationChanged)
+    Q_PROPERTY(bool idle READ idle NOTIFY idleChanged)
+    Q_PROPERTY(bool advertising READ advertising NOTIFY advertisingChanged)
+    Q_PROPERTY(LibraryModel* library READ library CONSTANT)
+    Q_PROPERTY(QueueModel* queue READ queue CONSTANT)
 public:
     enum class PlaybackState
     {
@@ -78,11 +99,19 @@ public:
     };
 public:
     DeezzyApp() :   m_current_track_infos( new TrackInfos( this ) ),
+                    m_cover_palette( new CoverPalette( this ) ),
                     m_deezer_wrapper( std::make_shared<deezer_wrapper>( DEEZZY_APPLICATION_ID,
                                                                         DEEZZY_APPLICATION_NAME,
                                                                         DEEZZY_APPLICATION_VERSION,
                                                                         true /*print_version*/ ) )
     {
+        QObject::connect( m_cover_palette, &CoverPalette::paletteReady, this, &DeezzyApp::on_palette_ready );
+
+        m_library_model = new LibraryModel( m_deezer_wrapper, this );
+        m_queue_model = new QueueModel( m_deezer_wrapper, this );
+
+        m_playback_clock = new PlaybackClock( m_deezer_wrapper, this );
+        QObject::connect( m_playback_clock, &PlaybackClock::positionChanged, this, &DeezzyApp::renderPositionChanged );
     }
 
     void setPlaylist( QString playlist )
@@ -90,15 +119,71 @@ public:
         emit playlistChanged( playlist );
     }
 
+    // multi-room playback : leads on port when no leader host is given, follows host:port otherwise
+    void startRoomSync( const QString& leader_host, int port )
+    {
+        m_room_sync.reset( new room_sync( leader_host.isEmpty() ? room_sync::role::leader : room_sync::role::follower,
+                                          leader_host.toStdString(), port, room_sync::bind( *m_deezer_wrapper ) ) );
+    }
+
     /************ Q_INVOKABLEs ************/
 
+    // the daypart in progress when a schedule is configured, the user flow otherwise
     Q_INVOKABLE QString defaultPlaylist()
     {
+        auto scheduled = m_deezer_wrapper->scheduled_content();
+        if ( !scheduled.empty() )
+            return QString::fromStdString( scheduled );
         return "dzradio:///user-" + QString::fromStdString( m_deezer_wrapper->user_id() );
     }
+    Q_INVOKABLE QStringList profiles()
+    {
+        QStringList names;
+        for ( const auto& profile : m_deezer_wrapper->profiles() )
+            names << QString::fromStdString( profile.name );
+        return names;
+    }
+    Q_INVOKABLE QString activeProfile()
+    {
+        for ( const auto& profile : m_deezer_wrapper->profiles() )
+            if ( profile.active )
+                return QString::fromStdString( profile.name );
+        return QString();
+    }
+    // the player is handed over without reconnecting, the new profile resuming its own session
+    Q_INVOKABLE bool switchProfile( QString name )
+    {
+        if ( !m_deezer_wrapper->switch_profile( name.toStdString() ) )
+            return false;
+
+        // the player was stopped : the state follows the player events of the content the profile resumes
+        m_playback_state = PlaybackState::Stopped;
+        emit playlistChanged( content() );
+        return true;
+    }
+    Q_INVOKABLE QStringList eqZones()
+    {
+        QStringList zones;
+        for ( const auto& zone : m_deezer_wrapper->eq_presets() )
+            zones << QString::fromStdString( zone );
+        return zones;
+    }
+    Q_INVOKABLE bool setEqZone( QString zone )
+    {
+        return m_deezer_wrapper->set_eq_preset( zone.toStdString() );
+    }
     Q_INVOKABLE bool connect()
     {
         m_deezer_wrapper->register_observer( this );
+
+        // optional features are opt-in, from the command line
+        auto arguments = QCoreApplication::arguments();
+        m_deezer_wrapper->enable_loudness_normalization( arguments.contains( "-loudness" ) );
+        m_deezer_wrapper->enable_ram_cache( arguments.contains( "-ram-cache" ) );
+        m_deezer_wrapper->enable_skip_prediction( arguments.contains( "-skip-prediction" ) );
+        m_deezer_wrapper->enable_equalizer( arguments.contains( "-eq" ) );
+        m_deezer_wrapper->enable_schedule( arguments.contains( "-schedule" ) );
+        m_deezer_wrapper->enable_thread_policy( arguments.contains( "-thread-policy" ) );
         m_deezer_wrapper->connect();
 
         return true;
@@ -106,14 +191,16 @@ public:
     Q_INVOKABLE bool disconnect()
     {
         m_deezer_wrapper->register_observer( nullptr );
-        m_deezer_wrapper->disconnect();
+        m_room_sync.reset();
 
-        return true;
+        // no-op when already disconnected (on quit, then on QML destruction)
+        return !m_deezer_wrapper->disconnect().timed_out;
     }
     Q_INVOKABLE bool play()
     {
         m_deezer_wrapper->load_content();
         m_playback_state = PlaybackState::Playing;
+        m_queue_model->refresh();
 
         return true;
     }
@@ -144,6 +231,7 @@ public:
         {
             auto position_ms = 10 * progress * m_current_track_infos->m_duration;
             m_deezer_wrapper->playback_seek( position_ms );
+            m_playback_clock->refresh();
         }
 
         return true;
@@ -160,18 +248,55 @@ public:
 
         return true;
     }
+    Q_INVOKABLE bool toggleRepeat()
+    {
+        m_deezer_wrapper->playback_toogle_repeat();
+        m_queue_model->refresh();
+
+        return true;
+    }
+    Q_INVOKABLE bool toggleShuffle()
+    {
+        m_deezer_wrapper->playback_toogle_random();
+        m_queue_model->refresh();
+
+        return true;
+    }
     Q_INVOKABLE bool like()
     {
         m_deezer_wrapper->playback_like();
 
         return true;
     }
+    Q_INVOKABLE bool playLibraryItem( int row )
+    {
+        auto content = m_library_model->contentUrl( row );
+        if ( content.isEmpty() )
+            return false;
+
+        setContent( content );
+        return play();
+    }
+    Q_INVOKABLE bool likeAlbum()
+    {
+        m_deezer_wrapper->playback_like_album();
+
+        return true;
+    }
     Q_INVOKABLE bool dislike()
     {
         m_deezer_wrapper->playback_dislike();
 
         return true;
     }
+    Q_INVOKABLE float wakeupsPerSecond()
+    {
+        return m_deezer_wrapper->wakeups_per_second();
+    }
+    Q_INVOKABLE float bufferedAheadMinutes()
+    {
+        return m_deezer_wrapper->current_offline_infos().buffered_ahead_minutes;
+    }
 
     /************ Q_PROPERTYs ************/
 
@@ -194,6 +319,42 @@ public:
         return m_current_track_infos;
     }
 
+    // interpolated between the SDK progress callbacks
+    int renderPosition() const
+    {
+        return m_playback_clock->position();
+    }
+
+    int bufferPosition() const
+    {
+        return m_deezer_wrapper->current_progress_infos().index_ms;
+    }
+
+    int duration() const
+    {
+        return m_deezer_wrapper->current_progress_infos().duration_ms;
+    }
+
+    bool idle() const
+    {
+        return m_deezer_wrapper->idle();
+    }
+
+    bool advertising() const
+    {
+        return m_deezer_wrapper->ad_break();
+    }
+
+    LibraryModel* library() const
+    {
+        return m_library_model;
+    }
+
+    QueueModel* queue() const
+    {
+        return m_queue_model;
+    }
+
 signals:
     void paused();
     void playing();
@@ -201,22 +362,40 @@ signals:
     void loggedIn();
     void error();
     void seeking();
-    void bufferProgress( float progress );
-    void renderProgress( float progress );
-    void trackDuration( int duration_ms );
+    void renderPositionChanged();
+    void bufferPositionChanged();
+    void durationChanged();
+    void idleChanged();
+    void advertisingChanged();
     void playlistChanged( QString playlist );
 
 	void trackInfosChanged();
 
 private:
+    // player events come from SDK threads, the animation lives on the GUI thread
+    void refresh_clock()
+    {
+        QMetaObject::invokeMethod( m_playback_clock, "refresh", Qt::QueuedConnection );
+    }
     void update_current_track_infos()
     {
-        auto& _track_infos = m_deezer_wrapper->current_track_infos();
+        auto _track_infos = m_deezer_wrapper->current_track_infos();
         m_current_track_infos->m_title = QString::fromStdString( _track_infos.title );
         m_current_track_infos->m_artist = QString::fromStdString( _track_infos.artist );
         m_current_track_infos->m_duration = _track_infos.duration;
         m_current_track_infos->m_albumTitle = QString::fromStdString( _track_infos.album_title );
         m_current_track_infos->m_coverArtUrl = QString::fromStdString( _track_infos.cover_art );
+
+        // called from the SDK thread : palette extraction is started from (and reported on) the GUI thread
+        QMetaObject::invokeMethod( m_cover_palette, "request", Qt::QueuedConnection,
+                                   Q_ARG( qint64, _track_infos.album_id ),
+                                   Q_ARG( QString, m_current_track_infos->m_coverArtUrl ) );
+    }
+    void on_palette_ready( qint64 album_id, QColor dominant, QColor accent )
+    {
+        m_current_track_infos->m_dominantColor = dominant;
+        m_current_track_infos->m_accentColor = accent;
+        emit m_current_track_infos->paletteChanged();
     }
     void on_connect_event( const deezer_wrapper::connect_event& event ) final override
     {
@@ -244,8 +423,8 @@ private:
             case deezer_wrapper::connect_event::user_new_options:
                 break;
             case deezer_wrapper::connect_event::advertisement_start:
-                break;
             case deezer_wrapper::connect_event::advertisement_stop:
+                emit advertisingChanged();
                 break;
             default:
                 break;
@@ -272,6 +451,9 @@ private:
                 break;
             case deezer_wrapper::player_event::queuelist_track_selected:
                 update_current_track_infos();
+                QMetaObject::invokeMethod( m_queue_model, "refresh", Qt::QueuedConnection );
+                refresh_clock();
+                emit bufferPositionChanged();
                 break;
             case deezer_wrapper::player_event::queuelist_need_natural_next:
                 break;
@@ -282,53 +464,73 @@ private:
             case deezer_wrapper::player_event::render_track_start_failure:
                 break;
             case deezer_wrapper::player_event::render_track_start:
+                m_playback_state = PlaybackState::Playing;
+                refresh_clock();
+                emit idleChanged();
+                emit advertisingChanged();
                 emit playing();
                 break;
             case deezer_wrapper::player_event::render_track_end:
+                refresh_clock();
+                // the wrapper already resumes the music after an ad : no stopped blink in between
+                if ( m_deezer_wrapper->ad_break() )
+                    break;
                 emit stopped();
                 break;
             case deezer_wrapper::player_event::render_track_paused:
+                m_playback_state = PlaybackState::Paused;
+                refresh_clock();
+                emit idleChanged();
                 emit paused();
                 break;
             case deezer_wrapper::player_event::render_track_seeking:
                 emit seeking();
                 break;
             case deezer_wrapper::player_event::render_track_underflow:
+                refresh_clock();
                 break;
             case deezer_wrapper::player_event::render_track_resumed:
+                m_playback_state = PlaybackState::Playing;
+                refresh_clock();
+                emit idleChanged();
                 emit playing();
                 break;
             case deezer_wrapper::player_event::render_track_removed:
+                m_playback_state = PlaybackState::Stopped;
+                refresh_clock();
+                emit idleChanged();
                 emit stopped();
                 break;
             default:
                 break;
         }
     }
+    // while idle, progress is not forwarded so that the scene has nothing to re-render
     void on_index_progress( int progress_ms ) final override
     {
-        if ( m_current_track_infos )
-        {
-            auto p = progress_ms / ( 10.f * m_current_track_infos->m_duration );
-            bufferProgress( std::min( p, 100.f ) );
-        }
+        if ( !m_deezer_wrapper->idle() )
+            emit bufferPositionChanged();
     }
     void on_render_progress( int progress_ms ) final override
     {
-        if ( m_current_track_infos )
-        {
-            auto p = progress_ms / ( 10.f * m_current_track_infos->m_duration );
-            renderProgress( std::min( p, 100.f ) );
-        }
+        // re-anchors the clock, and restarts it after a seek or a stall
+        if ( !m_deezer_wrapper->idle() )
+            refresh_clock();
     }
     void on_track_duration( int duration_ms ) final override
     {
-        trackDuration( duration_ms );
+        emit durationChanged();
     }
 private:
 
     TrackInfos* m_current_track_infos = nullptr;
-    PlaybackState m_playback_state = PlaybackState::Stopped;
+    CoverPalette* m_cover_palette = nullptr;
+    LibraryModel* m_library_model = nullptr;
+    QueueModel* m_queue_model = nullptr;
+    PlaybackClock* m_playback_clock = nullptr;
+    // written by the player events too, from the SDK thread
+    std::atomic<PlaybackState> m_playback_state{ PlaybackState::Stopped };
 
     std::shared_ptr<deezer_wrapper> m_deezer_wrapper;
+    std::unique_ptr<room_sync> m_room_sync;
 };
@@ -0,0 +1,160 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "deezer_wrapper/deezer_wrapper.h"
+#include "deezer_wrapper/library_index.h"
+
+#include <QAbstractListModel>
+
+#include <algorithm>
+#include <memory>
+
+/*
+ * Type-ahead search over the local library : each query change runs synchronously against the
+ * in-memory index (well under a millisecond), rows being materialized lazily as the view scrolls.
+ */
+class LibraryModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(QString query READ query WRITE setQuery NOTIFY queryChanged)
+    Q_PROPERTY(int resultCount READ resultCount NOTIFY resultsChanged)
+    Q_PROPERTY(int queryMicroseconds READ queryMicroseconds NOTIFY resultsChanged)
+    Q_PROPERTY(int librarySize READ librarySize NOTIFY resultsChanged)
+public:
+    enum Roles
+    {
+        KindRole = Qt::UserRole + 1,
+        TitleRole,
+        SubtitleRole
+    };
+
+    // the wrapper is shared : as a child object, the model outlives the members of its parent
+    LibraryModel( std::shared_ptr<deezer_wrapper> wrapper, QObject* parent )
+        : QAbstractListModel( parent ), m_wrapper( wrapper ), m_index( wrapper->library() )
+    {
+        // a sync or the initial load published a new snapshot : refresh the current query
+        m_index.set_update_callback( [this]() {
+            QMetaObject::invokeMethod( this, "refresh", Qt::QueuedConnection );
+        } );
+    }
+    ~LibraryModel()
+    {
+        m_index.set_update_callback( nullptr );
+    }
+
+    QString contentUrl( int row ) const
+    {
+        if ( row < 0 || row >= static_cast<int>( m_results.size() ) )
+            return QString();
+        return QString::fromStdString( m_results.at( row ).content_url() );
+    }
+
+    /************ QAbstractListModel ************/
+
+    int rowCount( const QModelIndex& parent = QModelIndex() ) const override
+    {
+        return parent.isValid() ? 0 : m_loaded;
+    }
+    QVariant data( const QModelIndex& index, int role ) const override
+    {
+        if ( !index.isValid() || index.row() >= m_loaded )
+            return QVariant();
+
+        auto item = m_results.at( index.row() );
+        switch( role )
+        {
+            case KindRole:
+                return static_cast<int>( item.type );
+            case TitleRole:
+                return QString::fromStdString( item.title );
+            case SubtitleRole:
+                return QString::fromStdString( item.subtitle );
+            default:
+                return QVariant();
+        }
+    }
+    QHash<int, QByteArray> roleNames() const override
+    {
+        return { { KindRole, "kind" }, { TitleRole, "title" }, { SubtitleRole, "subtitle" } };
+    }
+    bool canFetchMore( const QModelIndex& parent ) const override
+    {
+        return !parent.isValid() && m_loaded < static_cast<int>( m_results.size() );
+    }
+    void fetchMore( const QModelIndex& parent ) override
+    {
+        if ( parent.isValid() )
+            return;
+
+        auto count = std::min( static_cast<int>( m_results.size() ) - m_loaded, +fetch_batch );
+        if ( count <= 0 )
+            return;
+
+        beginInsertRows( QModelIndex(), m_loaded, m_loaded + count - 1 );
+        m_loaded += count;
+        endInsertRows();
+    }
+
+    /************ Q_PROPERTYs ************/
+
+    QString query() const { return m_query; }
+    int resultCount() const { return static_cast<int>( m_results.size() ); }
+    int queryMicroseconds() const { return m_results.micros(); }
+    int librarySize() const { return static_cast<int>( m_index.size() ); }
+
+    void setQuery( const QString& query )
+    {
+        if ( query == m_query )
+            return;
+        m_query = query;
+        emit queryChanged();
+        refresh();
+    }
+
+    Q_INVOKABLE void refresh()
+    {
+        beginResetModel();
+        m_results = m_index.search( m_query.toStdString(), max_results );
+        m_loaded = std::min( static_cast<int>( m_results.size() ), +fetch_batch );
+        endResetModel();
+        emit resultsChanged();
+    }
+
+signals:
+    void queryChanged();
+    void resultsChanged();
+
+private:
+    static constexpr int fetch_batch = 30;
+    static constexpr size_t max_results = 500;
+
+    std::shared_ptr<deezer_wrapper> m_wrapper;
+    library_index& m_index;
+    library_index::results m_results;
+    int m_loaded = 0;
+    QString m_query;
+};
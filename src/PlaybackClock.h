@@ -0,0 +1,88 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "deezer_wrapper/deezer_wrapper.h"
+
+#include <QAbstractAnimation>
+
+#include <memory>
+
+/*
+ * Render position for the UI, read from the wrapper's interpolated playback clock on each animation
+ * tick : motion follows the scene graph frames (vsync) while the SDK keeps reporting progress once
+ * per second. The animation only runs while the clock does, so a paused or idle player does not tick.
+ */
+class PlaybackClock : public QAbstractAnimation
+{
+    Q_OBJECT
+    Q_PROPERTY(int position READ position NOTIFY positionChanged)
+public:
+    PlaybackClock( std::shared_ptr<deezer_wrapper> wrapper, QObject* parent ) : QAbstractAnimation( parent ),
+                                                                                m_deezer_wrapper( wrapper )
+    {
+    }
+
+    int duration() const override { return -1; }
+
+    int position() const { return m_position; }
+
+    // to be called (on the GUI thread) when the clock may have started, stopped or jumped
+    Q_INVOKABLE void refresh()
+    {
+        _sync();
+
+        auto running = m_deezer_wrapper->playback_clock_running();
+        if ( running && state() != QAbstractAnimation::Running )
+            start();
+        else if ( !running && state() != QAbstractAnimation::Stopped )
+            stop();
+    }
+
+signals:
+    void positionChanged();
+
+protected:
+    void updateCurrentTime( int ) override
+    {
+        _sync();
+    }
+
+private:
+    void _sync()
+    {
+        auto position = m_deezer_wrapper->playback_position_ms();
+        if ( position != m_position )
+        {
+            m_position = position;
+            emit positionChanged();
+        }
+    }
+
+private:
+    std::shared_ptr<deezer_wrapper> m_deezer_wrapper;
+    int m_position = 0;
+};
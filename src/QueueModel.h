@@ -0,0 +1,381 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "deezer_wrapper/deezer_wrapper.h"
+
+#include <QAbstractListModel>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointer>
+#include <QSet>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*
+ * Up-next queue followed incrementally from queuelist events. Albums and playlists are laid out in
+ * full, their rows being filled from the Web API one page at a time as the view displays them ;
+ * radios and shuffled queues are built from the selected and announced next tracks. Rows keep a
+ * stable id, and a track change only notifies the rows whose state actually changed.
+ */
+class QueueModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int currentRow READ currentRow NOTIFY currentRowChanged)
+    Q_PROPERTY(bool seekable READ seekable NOTIFY layoutModeChanged)
+    Q_PROPERTY(int repeatMode READ repeatMode NOTIFY modesChanged)
+    Q_PROPERTY(bool shuffle READ shuffle NOTIFY modesChanged)
+public:
+    enum Roles
+    {
+        UidRole = Qt::UserRole + 1,
+        TitleRole,
+        ArtistRole,
+        DurationRole,
+        CurrentRole,
+        LoadedRole
+    };
+
+    QueueModel( std::shared_ptr<deezer_wrapper> wrapper, QObject* parent )
+        : QAbstractListModel( parent ), m_wrapper( wrapper ) {}
+
+    // in album/playlist layout, rows are queuelist indexes and can be played directly
+    Q_INVOKABLE bool playRow( int row )
+    {
+        if ( !m_list_layout || row < 0 || row >= static_cast<int>( m_rows.size() ) )
+            return false;
+
+        m_wrapper->playback_start_at( m_rows[row].queue_index );
+        return true;
+    }
+
+    // pulls the queuelist state from the wrapper, to be called on the GUI thread after queue events
+    Q_INVOKABLE void refresh()
+    {
+        auto infos = m_wrapper->current_queue_infos();
+
+        if ( infos.generation != m_generation || infos.shuffle != m_shuffle )
+        {
+            m_generation = infos.generation;
+            m_shuffle = infos.shuffle;
+            m_tracks_path = m_shuffle ? QString() : tracks_path( QString::fromStdString( m_wrapper->get_content() ) );
+            reset_rows( false );
+            if ( !m_tracks_path.isEmpty() )
+                request_page( 0 );
+            emit modesChanged();
+        }
+        if ( infos.repeat_mode != m_repeat_mode )
+        {
+            m_repeat_mode = infos.repeat_mode;
+            emit modesChanged();
+        }
+
+        if ( infos.index < 0 )
+            return;
+
+        auto current = m_wrapper->current_track_infos();
+        if ( m_list_layout )
+            follow_list( infos, current );
+        else
+            follow_history( infos, current );
+    }
+
+    /************ QAbstractListModel ************/
+
+    int rowCount( const QModelIndex& parent = QModelIndex() ) const override
+    {
+        return parent.isValid() ? 0 : static_cast<int>( m_rows.size() );
+    }
+    QVariant data( const QModelIndex& index, int role ) const override
+    {
+        if ( !index.isValid() || index.row() >= static_cast<int>( m_rows.size() ) )
+            return QVariant();
+
+        const auto& row = m_rows[index.row()];
+        if ( !row.loaded && m_list_layout )
+            const_cast<QueueModel*>( this )->request_page( index.row() / page_size );
+
+        switch( role )
+        {
+            case UidRole:
+                return row.uid;
+            case TitleRole:
+                return row.title;
+            case ArtistRole:
+                return row.artist;
+            case DurationRole:
+                return row.duration;
+            case CurrentRole:
+                return index.row() == m_current_row;
+            case LoadedRole:
+                return row.loaded;
+            default:
+                return QVariant();
+        }
+    }
+    QHash<int, QByteArray> roleNames() const override
+    {
+        return { { UidRole, "uid" }, { TitleRole, "title" }, { ArtistRole, "artist" },
+                 { DurationRole, "duration" }, { CurrentRole, "current" }, { LoadedRole, "loaded" } };
+    }
+
+    /************ Q_PROPERTYs ************/
+
+    int currentRow() const { return m_current_row; }
+    bool seekable() const { return m_list_layout; }
+    int repeatMode() const { return m_repeat_mode; }
+    bool shuffle() const { return m_shuffle; }
+
+signals:
+    void currentRowChanged();
+    void layoutModeChanged();
+    void modesChanged();
+
+private:
+    static constexpr int page_size = 25;
+    static constexpr int history_rows = 20;
+    static constexpr int page_ttl_s = 600;
+
+    struct Row
+    {
+        quint32 uid;
+        int queue_index;
+        qint64 track_id;
+        QString title;
+        QString artist;
+        int duration;
+        bool loaded;
+    };
+
+    // Web API listing of the loaded content, empty when the queue is not a plain track list
+    static QString tracks_path( const QString& content )
+    {
+        for ( auto type : { QStringLiteral( "album" ), QStringLiteral( "playlist" ) } )
+        {
+            auto prefix = QStringLiteral( "dzmedia:///" ) + type + '/';
+            if ( content.startsWith( prefix ) )
+                return type + '/' + content.mid( prefix.size() ) + QStringLiteral( "/tracks" );
+        }
+        return QString();
+    }
+
+    Row make_row( int queue_index, const deezer_wrapper::track_infos& infos )
+    {
+        return { m_next_uid++, queue_index, infos.id, QString::fromStdString( infos.title ),
+                 QString::fromStdString( infos.artist ), infos.duration, infos.id != 0 };
+    }
+    void fill_row( int row, const deezer_wrapper::track_infos& infos )
+    {
+        auto& target = m_rows[row];
+        if ( infos.id == 0 || ( target.loaded && target.track_id == infos.id ) )
+            return;
+
+        target.track_id = infos.id;
+        target.title = QString::fromStdString( infos.title );
+        target.artist = QString::fromStdString( infos.artist );
+        target.duration = infos.duration;
+        target.loaded = true;
+        emit dataChanged( index( row ), index( row ) );
+    }
+    void set_current_row( int row )
+    {
+        if ( row == m_current_row )
+            return;
+
+        auto previous = m_current_row;
+        m_current_row = row;
+        if ( previous >= 0 && previous < static_cast<int>( m_rows.size() ) )
+            emit dataChanged( index( previous ), index( previous ), { CurrentRole } );
+        if ( row >= 0 )
+            emit dataChanged( index( row ), index( row ), { CurrentRole } );
+        emit currentRowChanged();
+    }
+    void reset_rows( bool list_layout, int count = 0 )
+    {
+        beginResetModel();
+        m_rows.clear();
+        m_requested_pages.clear();
+        for ( auto i = 0; i < count; i++ )
+            m_rows.push_back( { m_next_uid++, i, 0, QString(), QString(), 0, false } );
+        m_current_row = -1;
+        endResetModel();
+
+        if ( list_layout != m_list_layout )
+        {
+            m_list_layout = list_layout;
+            emit layoutModeChanged();
+        }
+        emit currentRowChanged();
+    }
+
+    void follow_list( const deezer_wrapper::queue_infos& infos, const deezer_wrapper::track_infos& current )
+    {
+        if ( infos.index >= static_cast<int>( m_rows.size() ) )
+            return;
+
+        // the selected and next tracks come with the event : no need to wait for their page
+        fill_row( infos.index, current );
+        if ( infos.index + 1 < static_cast<int>( m_rows.size() ) )
+            fill_row( infos.index + 1, infos.next );
+        set_current_row( infos.index );
+    }
+    void follow_history( const deezer_wrapper::queue_infos& infos, const deezer_wrapper::track_infos& current )
+    {
+        auto size = static_cast<int>( m_rows.size() );
+
+        // the announced next track usually is the one being selected, otherwise look back in history
+        auto row = -1;
+        if ( m_current_row + 1 < size && m_rows[m_current_row + 1].track_id == current.id )
+            row = m_current_row + 1;
+        for ( auto i = size - 1; row < 0 && i >= 0; i-- )
+            if ( m_rows[i].queue_index == infos.index && m_rows[i].track_id == current.id )
+                row = i;
+
+        if ( row < 0 )
+        {
+            // jumped somewhere else : what was announced as next is obsolete
+            if ( m_current_row + 1 < size )
+            {
+                beginRemoveRows( QModelIndex(), m_current_row + 1, size - 1 );
+                m_rows.erase( m_rows.begin() + m_current_row + 1, m_rows.end() );
+                endRemoveRows();
+            }
+            row = static_cast<int>( m_rows.size() );
+            beginInsertRows( QModelIndex(), row, row );
+            m_rows.push_back( make_row( infos.index, current ) );
+            endInsertRows();
+        }
+        else
+        {
+            m_rows[row].queue_index = infos.index;
+            fill_row( row, current );
+        }
+        set_current_row( row );
+
+        if ( infos.next.id != 0 )
+        {
+            if ( row + 1 < static_cast<int>( m_rows.size() ) )
+            {
+                m_rows[row + 1].queue_index = infos.index + 1;
+                fill_row( row + 1, infos.next );
+            }
+            else
+            {
+                beginInsertRows( QModelIndex(), row + 1, row + 1 );
+                m_rows.push_back( make_row( infos.index + 1, infos.next ) );
+                endInsertRows();
+            }
+        }
+
+        // bounded history, removed in a single range
+        auto excess = m_current_row - history_rows;
+        if ( excess > 0 )
+        {
+            beginRemoveRows( QModelIndex(), 0, excess - 1 );
+            m_rows.erase( m_rows.begin(), m_rows.begin() + excess );
+            endRemoveRows();
+            m_current_row -= excess;
+            emit currentRowChanged();
+        }
+    }
+
+    void request_page( int page )
+    {
+        if ( m_tracks_path.isEmpty() || m_requested_pages.contains( page ) )
+            return;
+        m_requested_pages.insert( page );
+
+        auto path = QString( "%1?index=%2&limit=%3" ).arg( m_tracks_path ).arg( page * page_size ).arg( page_size );
+        auto generation = m_generation;
+        QPointer<QueueModel> guard( this );
+
+        // answered on a Web API client thread
+        m_wrapper->api_get( path.toStdString(), page_ttl_s, [guard, generation, page]( bool ok, const std::string& body ) {
+            if ( guard )
+                QMetaObject::invokeMethod( guard.data(), "on_page", Qt::QueuedConnection,
+                                           Q_ARG( int, generation ), Q_ARG( int, page ), Q_ARG( bool, ok ),
+                                           Q_ARG( QByteArray, QByteArray::fromStdString( body ) ) );
+        } );
+    }
+    Q_INVOKABLE void on_page( int generation, int page, bool ok, QByteArray body )
+    {
+        if ( generation != m_generation || m_tracks_path.isEmpty() )
+            return;
+
+        auto json = QJsonDocument::fromJson( body ).object();
+        if ( !ok || !json.contains( "data" ) )
+        {
+            std::cerr << "cannot fetch queue page " << page << " of " << m_tracks_path.toStdString() << std::endl;
+            m_requested_pages.remove( page );
+            return;
+        }
+
+        // the first page gives the queue length : switch to the full list layout
+        if ( !m_list_layout )
+        {
+            reset_rows( true, json.value( "total" ).toInt() );
+            m_requested_pages.insert( page );
+        }
+
+        auto tracks = json.value( "data" ).toArray();
+        auto first = page * page_size;
+        auto last = std::min( first + tracks.size(), static_cast<int>( m_rows.size() ) ) - 1;
+        for ( auto row = first; row <= last; row++ )
+        {
+            auto track = tracks.at( row - first ).toObject();
+            auto& target = m_rows[row];
+            target.track_id = track.value( "id" ).toVariant().toLongLong();
+            target.title = track.value( "title" ).toString();
+            target.artist = track.value( "artist" ).toObject().value( "name" ).toString();
+            target.duration = track.value( "duration" ).toInt();
+            target.loaded = true;
+        }
+        if ( last >= first )
+            emit dataChanged( index( first ), index( last ) );
+
+        if ( m_current_row < 0 )
+            refresh();
+    }
+
+private:
+    std::shared_ptr<deezer_wrapper> m_wrapper;
+
+    std::vector<Row> m_rows;
+    quint32 m_next_uid = 1;
+    int m_current_row = -1;
+
+    int m_generation = -1;
+    QString m_tracks_path;
+    bool m_list_layout = false;
+    QSet<int> m_requested_pages;
+
+    int m_repeat_mode = 0;
+    bool m_shuffle = false;
+};
@@ -0,0 +1,154 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "DeezzyApp.h"
+
+#include "deezer_wrapper/remote_server.h"
+
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSocketNotifier>
+
+#include <memory>
+
+/*
+ * Remote control of the application over HTTP/WebSocket (see remote_server.h) : the server is driven
+ * by the GUI event loop through a socket notifier, so that commands call DeezzyApp directly, and state
+ * deltas (playback state, track, position by the second) are published as DeezzyApp signals them.
+ */
+class RemoteControl : public QObject
+{
+    Q_OBJECT
+public:
+    RemoteControl( DeezzyApp* app, const QString& address, int port, const QString& token )
+        : QObject( app ),
+          m_app( app ),
+          m_server( new remote_server( address.toStdString(), port, token.toStdString(), [this]( const std::string& command, const std::string& argument ) {
+              return execute( QString::fromStdString( command ), QString::fromStdString( argument ) );
+          } ) )
+    {
+        if ( m_server->fd() < 0 )
+            return;
+
+        m_notifier = new QSocketNotifier( m_server->fd(), QSocketNotifier::Read, this );
+        QObject::connect( m_notifier, &QSocketNotifier::activated, this, [this]() { m_server->process(); } );
+
+        QObject::connect( m_app, &DeezzyApp::playing, this, [this]() { publish_playback( "playing" ); } );
+        QObject::connect( m_app, &DeezzyApp::paused, this, [this]() { publish_playback( "paused" ); } );
+        QObject::connect( m_app, &DeezzyApp::stopped, this, [this]() { publish_playback( "stopped" ); } );
+        QObject::connect( m_app, &DeezzyApp::renderPositionChanged, this, &RemoteControl::publish_position );
+
+        m_state["state"] = "stopped";
+    }
+
+    bool execute( const QString& command, const QString& argument )
+    {
+        if ( command == "play" )
+        {
+            if ( !argument.isEmpty() )
+                m_app->setContent( argument );
+            else if ( m_app->content().isEmpty() )
+                m_app->setContent( m_app->defaultPlaylist() );
+            return m_app->play();
+        }
+        else if ( command == "pause" )
+            return m_app->pause();
+        else if ( command == "resume" )
+            return m_app->resume();
+        else if ( command == "stop" )
+            return m_app->stop();
+        else if ( command == "next" )
+            return m_app->next();
+        else if ( command == "previous" )
+            return m_app->previous();
+        else if ( command == "seek" )   // percent of the track
+            return m_app->seek( qBound( 0, argument.toInt(), 100 ) );
+        else if ( command == "repeat" )
+            return m_app->toggleRepeat();
+        else if ( command == "shuffle" )
+            return m_app->toggleShuffle();
+        else if ( command == "like" )
+            return m_app->like();
+        else if ( command == "like_album" )
+            return m_app->likeAlbum();
+        else if ( command == "dislike" )
+            return m_app->dislike();
+        else if ( command == "profile" )
+            return m_app->switchProfile( argument );
+        else if ( command == "eq" )
+            return m_app->setEqZone( argument );
+
+        return false;
+    }
+
+private:
+    void publish_playback( const QString& state )
+    {
+        QJsonObject delta;
+        delta["state"] = state;
+
+        // QML reads the track infos on the same signal
+        auto* infos = m_app->trackInfos();
+        QJsonObject track;
+        track["title"] = infos->title();
+        track["artist"] = infos->artist();
+        track["album"] = infos->albumTitle();
+        track["duration"] = infos->duration() * 1000;
+        track["cover"] = infos->coverArtUrl();
+        if ( track != m_state["track"].toObject() )
+            delta["track"] = track;
+
+        publish( delta );
+    }
+    void publish_position()
+    {
+        auto position = m_app->renderPosition();
+        if ( position / 1000 == m_published_second )
+            return;
+        m_published_second = position / 1000;
+
+        QJsonObject delta;
+        delta["position"] = position;
+        publish( delta );
+    }
+    void publish( const QJsonObject& delta )
+    {
+        for ( auto it = delta.begin(); it != delta.end(); ++it )
+            m_state[it.key()] = it.value();
+
+        m_server->publish( QJsonDocument( delta ).toJson( QJsonDocument::Compact ).toStdString(),
+                           QJsonDocument( m_state ).toJson( QJsonDocument::Compact ).toStdString() );
+    }
+
+private:
+    DeezzyApp* m_app;
+    std::unique_ptr<remote_server> m_server;
+    QSocketNotifier* m_notifier = nullptr;
+
+    QJsonObject m_state;
+    int m_published_second = -1;
+};
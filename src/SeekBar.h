@@ -0,0 +1,309 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <QMouseEvent>
+#include <QQuickItem>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Track progress/seek bar drawn with plain scene graph nodes (groove, buffer, progress and knob)
+ * instead of composited images. Time labels are formatted here so that no javascript runs on
+ * each progress update, and only the nodes whose geometry changed are touched.
+ */
+class SeekBar : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(int position READ position WRITE setPosition NOTIFY positionChanged)
+    Q_PROPERTY(int buffered READ buffered WRITE setBuffered NOTIFY bufferedChanged)
+    Q_PROPERTY(int duration READ duration WRITE setDuration NOTIFY durationChanged)
+    Q_PROPERTY(QString positionText READ positionText NOTIFY positionTextChanged)
+    Q_PROPERTY(QString durationText READ durationText NOTIFY durationTextChanged)
+    Q_PROPERTY(QColor grooveColor MEMBER m_groove_color NOTIFY colorsChanged)
+    Q_PROPERTY(QColor bufferColor MEMBER m_buffer_color NOTIFY colorsChanged)
+    Q_PROPERTY(QColor progressColor MEMBER m_progress_color NOTIFY colorsChanged)
+    Q_PROPERTY(QColor knobColor MEMBER m_knob_color NOTIFY colorsChanged)
+public:
+    SeekBar( QQuickItem* parent = nullptr ) : QQuickItem( parent )
+    {
+        setFlag( QQuickItem::ItemHasContents, true );
+        setAcceptedMouseButtons( Qt::LeftButton );
+        setImplicitHeight( 20 );
+
+        connect( this, &SeekBar::colorsChanged, this, [this]() {
+            m_dirty_colors = true;
+            update();
+        } );
+    }
+
+    static QString formatTime( int ms )
+    {
+        auto seconds = std::max( ms, 0 ) / 1000;
+        return QString( "%1:%2" ).arg( ( seconds / 60 ) % 60, 2, 10, QChar( '0' ) )
+                                 .arg( seconds % 60, 2, 10, QChar( '0' ) );
+    }
+
+    /************ Q_PROPERTYs ************/
+
+    int position() const { return m_position; }
+    int buffered() const { return m_buffered; }
+    int duration() const { return m_duration; }
+    QString positionText() const { return m_position_text; }
+    QString durationText() const { return m_duration_text; }
+
+    void setPosition( int position_ms )
+    {
+        if ( position_ms == m_position )
+            return;
+        m_position = position_ms;
+        emit positionChanged();
+        if ( !m_dragging )
+        {
+            update_position_text( m_position );
+            update_geometry();
+        }
+    }
+    void setBuffered( int buffered_ms )
+    {
+        if ( buffered_ms == m_buffered )
+            return;
+        m_buffered = buffered_ms;
+        emit bufferedChanged();
+        update_geometry();
+    }
+    void setDuration( int duration_ms )
+    {
+        if ( duration_ms == m_duration )
+            return;
+        m_duration = duration_ms;
+        emit durationChanged();
+
+        auto text = formatTime( m_duration );
+        if ( text != m_duration_text )
+        {
+            m_duration_text = text;
+            emit durationTextChanged();
+        }
+        update_geometry();
+    }
+
+signals:
+    void seek( int progress );
+
+    void positionChanged();
+    void bufferedChanged();
+    void durationChanged();
+    void positionTextChanged();
+    void durationTextChanged();
+    void colorsChanged();
+
+protected:
+    void mousePressEvent( QMouseEvent* event ) override
+    {
+        m_dragging = true;
+        drag_to( event->localPos().x() );
+    }
+    void mouseMoveEvent( QMouseEvent* event ) override
+    {
+        drag_to( event->localPos().x() );
+    }
+    void mouseReleaseEvent( QMouseEvent* event ) override
+    {
+        drag_to( event->localPos().x() );
+        m_dragging = false;
+        emit seek( static_cast<int>( 100.f * m_drag_ratio ) );
+    }
+    // the grab was taken by another item (Flickable, popup) : no release will come, the drag is cancelled without seeking
+    void mouseUngrabEvent() override
+    {
+        if ( !m_dragging )
+            return;
+        m_dragging = false;
+        update_position_text( m_position );
+        update_geometry();
+    }
+    void geometryChanged( const QRectF& new_geometry, const QRectF& old_geometry ) override
+    {
+        QQuickItem::geometryChanged( new_geometry, old_geometry );
+        if ( new_geometry.size() != old_geometry.size() )
+            update_geometry( true );
+    }
+
+    QSGNode* updatePaintNode( QSGNode* old_node, UpdatePaintNodeData* ) override
+    {
+        auto* root = old_node;
+        if ( !root )
+        {
+            root = new QSGNode;
+            for ( auto i = 0; i < node_count; i++ )
+                root->appendChildNode( create_node( i == knob ? knob_segments + 2 : 4,
+                                                    i == knob ? QSGGeometry::DrawTriangleFan : QSGGeometry::DrawTriangleStrip ) );
+            m_dirty_colors = true;
+            m_dirty_nodes = all_nodes;
+        }
+
+        if ( m_dirty_colors )
+        {
+            const QColor colors[node_count] = { m_groove_color, m_buffer_color, m_progress_color, m_knob_color };
+            for ( auto i = 0; i < node_count; i++ )
+            {
+                auto* node = static_cast<QSGGeometryNode*>( root->childAtIndex( i ) );
+                static_cast<QSGFlatColorMaterial*>( node->material() )->setColor( colors[i] );
+                node->markDirty( QSGNode::DirtyMaterial );
+            }
+            m_dirty_colors = false;
+        }
+
+        const auto bar_height = std::min<float>( 8.f, height() );
+        const auto radius = std::min<float>( 8.f, height() / 2.f );
+        const auto left = radius;
+        const auto usable = std::max<float>( 0.f, width() - 2.f * radius );
+        const auto top = ( height() - bar_height ) / 2.f;
+
+        if ( m_dirty_nodes & ( 1 << groove ) )
+            set_rect( root, groove, left, top, usable, bar_height );
+        if ( m_dirty_nodes & ( 1 << buffer ) )
+            set_rect( root, buffer, left, top, usable * m_buffer_ratio, bar_height );
+        if ( m_dirty_nodes & ( 1 << progress ) )
+            set_rect( root, progress, left, top, usable * m_progress_ratio, bar_height );
+        if ( m_dirty_nodes & ( 1 << knob ) )
+            set_circle( root, knob, left + usable * m_progress_ratio, height() / 2.f, radius );
+
+        m_dirty_nodes = 0;
+
+        return root;
+    }
+
+private:
+    enum { groove, buffer, progress, knob, node_count };
+    static constexpr int all_nodes = ( 1 << node_count ) - 1;
+    static constexpr int knob_segments = 16;
+
+    static QSGGeometryNode* create_node( int vertex_count, unsigned int drawing_mode )
+    {
+        auto* geometry = new QSGGeometry( QSGGeometry::defaultAttributes_Point2D(), vertex_count );
+        geometry->setDrawingMode( drawing_mode );
+
+        auto* node = new QSGGeometryNode;
+        node->setGeometry( geometry );
+        node->setFlag( QSGNode::OwnsGeometry );
+        node->setMaterial( new QSGFlatColorMaterial );
+        node->setFlag( QSGNode::OwnsMaterial );
+        return node;
+    }
+    static void set_rect( QSGNode* root, int index, float x, float y, float w, float h )
+    {
+        auto* node = static_cast<QSGGeometryNode*>( root->childAtIndex( index ) );
+        auto* v = node->geometry()->vertexDataAsPoint2D();
+        v[0].set( x, y );
+        v[1].set( x + w, y );
+        v[2].set( x, y + h );
+        v[3].set( x + w, y + h );
+        node->markDirty( QSGNode::DirtyGeometry );
+    }
+    static void set_circle( QSGNode* root, int index, float cx, float cy, float r )
+    {
+        auto* node = static_cast<QSGGeometryNode*>( root->childAtIndex( index ) );
+        auto* v = node->geometry()->vertexDataAsPoint2D();
+        v[0].set( cx, cy );
+        for ( auto i = 0; i <= knob_segments; i++ )
+        {
+            auto a = 2.f * static_cast<float>( M_PI ) * i / knob_segments;
+            v[i + 1].set( cx + r * std::cos( a ), cy + r * std::sin( a ) );
+        }
+        node->markDirty( QSGNode::DirtyGeometry );
+    }
+
+    static float ratio( int value, int total )
+    {
+        return total > 0 ? std::min( std::max( static_cast<float>( value ) / total, 0.f ), 1.f ) : 0.f;
+    }
+
+    void update_position_text( int position_ms )
+    {
+        auto text = formatTime( position_ms );
+        if ( text != m_position_text )
+        {
+            m_position_text = text;
+            emit positionTextChanged();
+        }
+    }
+    // only schedules a repaint when a node actually moves by at least one pixel
+    void update_geometry( bool force = false )
+    {
+        auto usable = std::max<float>( 1.f, width() );
+        auto buffer_ratio = ratio( m_buffered, m_duration );
+        auto progress_ratio = m_dragging ? m_drag_ratio : ratio( m_position, m_duration );
+
+        int dirty = force ? all_nodes : 0;
+        if ( std::abs( buffer_ratio - m_buffer_ratio ) * usable >= 1.f || ( buffer_ratio == 0.f && m_buffer_ratio != 0.f ) )
+        {
+            m_buffer_ratio = buffer_ratio;
+            dirty |= ( 1 << buffer );
+        }
+        if ( std::abs( progress_ratio - m_progress_ratio ) * usable >= 1.f || ( progress_ratio == 0.f && m_progress_ratio != 0.f ) )
+        {
+            m_progress_ratio = progress_ratio;
+            dirty |= ( 1 << progress ) | ( 1 << knob );
+        }
+
+        if ( dirty )
+        {
+            m_dirty_nodes |= dirty;
+            update();
+        }
+    }
+    void drag_to( qreal x )
+    {
+        m_drag_ratio = width() > 0 ? std::min( std::max( static_cast<float>( x / width() ), 0.f ), 1.f ) : 0.f;
+        update_position_text( static_cast<int>( m_drag_ratio * m_duration ) );
+        update_geometry();
+    }
+
+private:
+    int m_position = 0;
+    int m_buffered = 0;
+    int m_duration = 0;
+
+    float m_buffer_ratio = 0.f;
+    float m_progress_ratio = 0.f;
+    float m_drag_ratio = 0.f;
+    bool m_dragging = false;
+
+    bool m_dirty_colors = true;
+    int m_dirty_nodes = all_nodes;
+
+    QString m_position_text = "00:00";
+    QString m_duration_text = "00:00";
+
+    QColor m_groove_color = QColor( "#3a3a3a" );
+    QColor m_buffer_color = QColor( "#6d6d6d" );
+    QColor m_progress_color = QColor( "steelblue" );
+    QColor m_knob_color = QColor( "#eeeeee" );
+};
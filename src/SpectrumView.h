@@ -0,0 +1,191 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "deezer_wrapper/spectrum_analyzer.h"
+
+#include <QElapsedTimer>
+#include <QQuickItem>
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+#include <algorithm>
+
+/*
+ * Spectrum bars fed by a spectrum_analyzer capture thread, drawn as a single scene graph geometry.
+ * While active the item re-renders at display rate, then lets the bars fall down and goes quiet.
+ */
+class SpectrumView : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(bool active READ active WRITE setActive NOTIFY activeChanged)
+    Q_PROPERTY(QColor color MEMBER m_color NOTIFY colorChanged)
+public:
+    SpectrumView( QQuickItem* parent = nullptr ) : QQuickItem( parent )
+    {
+        setFlag( QQuickItem::ItemHasContents, true );
+        m_levels.fill( 0.f );
+
+        connect( this, &SpectrumView::colorChanged, this, [this]() {
+            m_dirty_color = true;
+            update();
+        } );
+    }
+
+    Q_INVOKABLE float cpuLoad()
+    {
+        return m_analyzer ? m_analyzer->cpu_load() : 0.f;
+    }
+
+    /************ Q_PROPERTYs ************/
+
+    bool active() const { return m_active; }
+
+    void setActive( bool active )
+    {
+        if ( active == m_active )
+            return;
+        m_active = active;
+
+        if ( m_active )
+            m_analyzer = std::make_unique<spectrum_analyzer>();
+        else
+            m_analyzer.reset();
+
+        emit activeChanged();
+        animate();
+    }
+
+signals:
+    void activeChanged();
+    void colorChanged();
+
+protected:
+    void itemChange( ItemChange change, const ItemChangeData& value ) override
+    {
+        QQuickItem::itemChange( change, value );
+
+        if ( change == ItemSceneChange && value.window )
+        {
+            // chains frames for as long as bars are moving
+            connect( value.window, &QQuickWindow::frameSwapped, this, [this]() {
+                if ( m_animating )
+                    update();
+            }, Qt::QueuedConnection );
+        }
+    }
+
+    QSGNode* updatePaintNode( QSGNode* old_node, UpdatePaintNodeData* ) override
+    {
+        auto* node = static_cast<QSGGeometryNode*>( old_node );
+        if ( !node )
+        {
+            auto* geometry = new QSGGeometry( QSGGeometry::defaultAttributes_Point2D(), bar_count * 6 );
+            geometry->setDrawingMode( QSGGeometry::DrawTriangles );
+
+            node = new QSGGeometryNode;
+            node->setGeometry( geometry );
+            node->setFlag( QSGNode::OwnsGeometry );
+            node->setMaterial( new QSGFlatColorMaterial );
+            node->setFlag( QSGNode::OwnsMaterial );
+            m_dirty_color = true;
+        }
+
+        if ( m_dirty_color )
+        {
+            static_cast<QSGFlatColorMaterial*>( node->material() )->setColor( m_color );
+            node->markDirty( QSGNode::DirtyMaterial );
+            m_dirty_color = false;
+        }
+
+        // bars jump up to new levels and fall down at a constant rate
+        auto elapsed = m_frame_timer.isValid() ? m_frame_timer.restart() / 1000.f : 0.f;
+        m_frame_timer.start();
+
+        spectrum_analyzer::bands bands;
+        auto fresh = m_analyzer && m_analyzer->latest( bands );
+
+        auto moving = false;
+        for ( size_t b = 0; b < bar_count; b++ )
+        {
+            auto level = std::max( m_levels[b] - fall_rate * elapsed, 0.f );
+            if ( fresh )
+                level = std::max( level, bands[b] );
+            moving |= level > 0.f;
+            m_levels[b] = level;
+        }
+
+        m_animating = m_active || moving;
+        if ( !m_animating )
+            m_frame_timer.invalidate();
+
+        const auto slot = static_cast<float>( width() ) / bar_count;
+        const auto gap = std::min( 2.f, slot / 4.f );
+        const auto bottom = static_cast<float>( height() );
+
+        auto* v = node->geometry()->vertexDataAsPoint2D();
+        for ( size_t b = 0; b < bar_count; b++ )
+        {
+            auto left = b * slot + gap / 2.f;
+            auto right = left + slot - gap;
+            auto top = bottom * ( 1.f - m_levels[b] );
+
+            v[0].set( left, top );
+            v[1].set( right, top );
+            v[2].set( left, bottom );
+            v[3].set( right, top );
+            v[4].set( right, bottom );
+            v[5].set( left, bottom );
+            v += 6;
+        }
+        node->markDirty( QSGNode::DirtyGeometry );
+
+        return node;
+    }
+
+private:
+    void animate()
+    {
+        m_animating = true;
+        update();
+    }
+
+private:
+    static constexpr size_t bar_count = spectrum_analyzer::band_count;
+    static constexpr float fall_rate = 1.5f; // full height per second
+
+    bool m_active = false;
+    bool m_animating = false;
+    bool m_dirty_color = true;
+
+    QColor m_color = QColor( "steelblue" );
+    QElapsedTimer m_frame_timer;
+
+    std::array<float, bar_count> m_levels;
+
+    std::unique_ptr<spectrum_analyzer> m_analyzer;
+};
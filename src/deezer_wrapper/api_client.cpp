@@ -0,0 +1,491 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "api_client.h"
+#include "memory_profile.h"
+#include "thread_policy.h"
+
+#include "third_party/json.hpp"
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+constexpr auto coalesce_delay = std::chrono::seconds( 2 );  // lets close actions share one flush
+constexpr auto min_backoff = std::chrono::seconds( 5 );
+constexpr auto max_backoff = std::chrono::seconds( 300 );
+
+size_t on_body( char* data, size_t size, size_t count, void* user )
+{
+    static_cast<std::string*>( user )->append( data, size * count );
+    return size * count;
+}
+
+size_t on_header( char* data, size_t size, size_t count, void* user )
+{
+    std::string header( data, size * count );
+    if ( header.size() > 5 && std::equal( header.begin(), header.begin() + 5, "etag:", []( char l, char r ) {
+            return std::tolower( l ) == r;
+        } ) )
+    {
+        auto begin = header.find_first_not_of( " ", 5 );
+        auto end = header.find_last_not_of( "\r\n " );
+        if ( begin != std::string::npos && end >= begin )
+            *static_cast<std::string*>( user ) = header.substr( begin, end - begin + 1 );
+    }
+    return size * count;
+}
+
+// called at least once per second during a transfer : a non zero result aborts it
+int abort_transfer( void* aborting, curl_off_t, curl_off_t, curl_off_t, curl_off_t )
+{
+    return static_cast<std::atomic<bool>*>( aborting )->load() ? 1 : 0;
+}
+
+void* new_connection( std::atomic<bool>* aborting )
+{
+    auto* curl = curl_easy_init();
+    if ( curl )
+    {
+        curl_easy_setopt( curl, CURLOPT_NOPROGRESS, 0L );
+        curl_easy_setopt( curl, CURLOPT_XFERINFOFUNCTION, abort_transfer );
+        curl_easy_setopt( curl, CURLOPT_XFERINFODATA, aborting );
+        curl_easy_setopt( curl, CURLOPT_NOSIGNAL, 1L );
+        curl_easy_setopt( curl, CURLOPT_TCP_KEEPALIVE, 1L );
+        curl_easy_setopt( curl, CURLOPT_CONNECTTIMEOUT, 5L );
+        curl_easy_setopt( curl, CURLOPT_TIMEOUT, 15L );
+        curl_easy_setopt( curl, CURLOPT_ACCEPT_ENCODING, "" );
+        curl_easy_setopt( curl, CURLOPT_USERAGENT, "deezzy" );
+    }
+    return curl;
+}
+
+} // namespace
+
+api_client::api_client( const std::string& base_url, const std::string& access_token, const std::string& queue_file, size_t pool_size,
+                        token_rejected_callback on_token_rejected )
+    : m_base_url( base_url ), m_access_token( access_token ), m_queue_file( queue_file ),
+      m_on_token_rejected( std::move( on_token_rejected ) ), m_backoff( min_backoff )
+{
+    curl_global_init( CURL_GLOBAL_DEFAULT );
+
+    _load_queue();
+    m_flush_time = std::chrono::steady_clock::now();
+
+    for ( size_t i = 0; i < pool_size; i++ )
+        m_readers.emplace_back( &api_client::_read_loop, this );
+    m_writer = std::thread( &api_client::_write_loop, this );
+}
+
+api_client::~api_client()
+{
+    // in-flight transfers are aborted rather than waited for : unsent actions stay in the queue file
+    m_aborting = true;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_read_wakeup.notify_all();
+    m_write_wakeup.notify_one();
+
+    for ( auto& reader : m_readers )
+        reader.join();
+    m_writer.join();
+
+    curl_global_cleanup();
+}
+
+void api_client::enqueue( action_type type, long long id, long long target )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    action a{ type, id, target };
+    if ( id == 0 || std::find( m_pending.begin(), m_pending.end(), a ) != m_pending.end() )
+        return;
+
+    m_pending.push_back( a );
+    std::ofstream( m_queue_file, std::ios::app ) << static_cast<int>( type ) << " " << id << " " << target << std::endl;
+
+    m_flush_time = std::max( m_flush_time, std::chrono::steady_clock::now() + coalesce_delay );
+    m_write_wakeup.notify_one();
+}
+
+void api_client::get( const std::string& path, std::chrono::seconds ttl, response_callback callback )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_jobs.emplace_back( [this, path, ttl, callback]( void* curl ) {
+        _fetch( curl, path, ttl, callback );
+    } );
+    m_read_wakeup.notify_one();
+}
+
+api_client::infos api_client::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return { static_cast<int>( m_pending.size() ), m_sent_actions, m_requests, m_cache_hits, m_revalidations, m_cache_bytes };
+}
+
+void api_client::set_access_token( const std::string& access_token )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( access_token == m_access_token )
+        return;
+    m_access_token = access_token;
+
+    // actions held back by a refused token go out right away
+    if ( m_token_rejected )
+    {
+        m_token_rejected = false;
+        m_backoff = min_backoff;
+        m_flush_time = std::chrono::steady_clock::now();
+        m_write_wakeup.notify_one();
+    }
+}
+
+void api_client::_read_loop()
+{
+    thread_policy::name_current_thread( "dz-api-read" );
+
+    auto* curl = new_connection( &m_aborting );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( true )
+    {
+        m_read_wakeup.wait( lock, [this]() { return !m_running || !m_jobs.empty(); } );
+        if ( !m_running )
+            break;
+
+        auto job = std::move( m_jobs.front() );
+        m_jobs.pop_front();
+
+        lock.unlock();
+        job( curl );
+        lock.lock();
+    }
+
+    curl_easy_cleanup( curl );
+}
+
+void api_client::_write_loop()
+{
+    thread_policy::name_current_thread( "dz-api-write" );
+
+    auto* curl = new_connection( &m_aborting );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        if ( m_pending.empty() )
+        {
+            m_write_wakeup.wait( lock );
+            continue;
+        }
+        if ( std::chrono::steady_clock::now() < m_flush_time )
+        {
+            m_write_wakeup.wait_until( lock, m_flush_time );
+            continue;
+        }
+
+        auto batch = m_pending;
+        lock.unlock();
+
+        // playlist additions are grouped per playlist, the other actions only exist one item at a time
+        std::vector<action> done;
+        auto result = send_result::done;
+        std::map<long long, std::vector<action>> playlists;
+
+        for ( const auto& a : batch )
+        {
+            if ( a.type == action_type::add_to_playlist )
+            {
+                playlists[a.target].push_back( a );
+                continue;
+            }
+
+            auto path = a.type == action_type::like_track ? "user/me/tracks" : "user/me/albums";
+            auto fields = std::string( a.type == action_type::like_track ? "track_id=" : "album_id=" ) + std::to_string( a.id );
+            result = _send( curl, path, fields );
+            if ( result == send_result::retry || result == send_result::unauthorized )
+                break;
+            done.push_back( a );
+        }
+
+        for ( const auto& playlist : playlists )
+        {
+            if ( result == send_result::retry || result == send_result::unauthorized )
+                break;
+
+            std::string songs;
+            for ( const auto& a : playlist.second )
+                songs += ( songs.empty() ? "" : "," ) + std::to_string( a.id );
+
+            result = _send( curl, "playlist/" + std::to_string( playlist.first ) + "/tracks", "songs=" + songs );
+            if ( result != send_result::retry && result != send_result::unauthorized )
+                done.insert( done.end(), playlist.second.begin(), playlist.second.end() );
+        }
+
+        // the refresh is asked for once per refused token, the callback being free to take its own locks
+        if ( result == send_result::unauthorized && m_on_token_rejected )
+        {
+            lock.lock();
+            auto first_refusal = !m_token_rejected;
+            m_token_rejected = true;
+            lock.unlock();
+
+            if ( first_refusal )
+            {
+                std::cout << "API => token refused, waiting for a refreshed one" << std::endl;
+                m_on_token_rejected();
+            }
+        }
+
+        lock.lock();
+
+        for ( const auto& a : done )
+            m_pending.erase( std::remove( m_pending.begin(), m_pending.end(), a ), m_pending.end() );
+        m_sent_actions += static_cast<int>( done.size() );
+
+        // a refused token is retried with backoff too, in case no new token comes
+        if ( result == send_result::retry || result == send_result::unauthorized )
+        {
+            m_flush_time = std::chrono::steady_clock::now() + m_backoff;
+            m_backoff = std::min( max_backoff, m_backoff * 2 );
+        }
+        else
+            m_backoff = min_backoff;
+
+        if ( !done.empty() )
+            _store_queue();
+    }
+
+    lock.unlock();
+    curl_easy_cleanup( curl );
+}
+
+void api_client::_fetch( void* curl, const std::string& path, std::chrono::seconds ttl, const response_callback& callback )
+{
+    std::string etag;
+    std::string fresh_body;
+    bool fresh = false;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+
+        auto itr = m_cache.find( path );
+        if ( itr != m_cache.end() )
+        {
+            fresh = std::chrono::steady_clock::now() < itr->second.expiry;
+            if ( fresh )
+            {
+                m_cache_hits++;
+                fresh_body = itr->second.body;
+            }
+            etag = itr->second.etag;
+        }
+    }
+
+    if ( fresh )
+    {
+        callback( true, fresh_body );
+        return;
+    }
+
+    response result;
+    if ( !_perform( curl, path, "", etag, result ) || ( result.status != 200 && result.status != 304 ) )
+    {
+        callback( false, result.body );
+        return;
+    }
+
+    std::string body;
+    bool cached = true;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        memory_profile::scope tagged( memory_profile::tag::api );
+
+        auto itr = m_cache.find( path );
+        if ( result.status == 304 )
+        {
+            m_revalidations++;
+            // the entry may have been evicted while revalidating
+            cached = itr != m_cache.end();
+        }
+        else
+        {
+            if ( itr == m_cache.end() )
+                itr = m_cache.emplace( path, cached_response{} ).first;
+            m_cache_bytes -= itr->second.body.size();
+            m_cache_bytes += result.body.size();
+            itr->second = { result.body, result.etag, {} };
+        }
+
+        if ( cached )
+        {
+            itr->second.expiry = std::chrono::steady_clock::now() + ttl;
+            body = itr->second.body;
+            _evict_cache();
+        }
+    }
+
+    callback( cached, body );
+}
+
+void api_client::_evict_cache()
+{
+    // entries closest to expiry go first : they are the least likely to be served again
+    while ( m_cache_bytes > cache_budget_bytes && !m_cache.empty() )
+    {
+        auto oldest = std::min_element( m_cache.begin(), m_cache.end(), []( const auto& a, const auto& b ) {
+            return a.second.expiry < b.second.expiry;
+        } );
+        m_cache_bytes -= oldest->second.body.size();
+        m_cache.erase( oldest );
+    }
+}
+
+api_client::send_result api_client::_send( void* curl, const std::string& path, const std::string& fields )
+{
+    response result;
+    if ( !_perform( curl, path, fields, "", result ) || result.status >= 500 )
+        return send_result::retry;
+    if ( result.status == 401 || result.status == 403 )
+    {
+        std::cerr << "api " << path << " " << fields << " refused : HTTP " << result.status << std::endl;
+        return send_result::unauthorized;
+    }
+
+    // the API answers 'true', or an error object with an HTTP 200
+    try
+    {
+        auto json = nlohmann::json::parse( result.body );
+        if ( json.is_object() && json.count( "error" ) )
+        {
+            auto code = json["error"].value( "code", 0 );
+            std::cerr << "api " << path << " " << fields << " failed : " << json["error"].dump() << std::endl;
+            // an invalid or expired token (300) waits for a refreshed one, quota exceeded (4) and
+            // service busy (700) are worth retrying
+            if ( code == 300 )
+                return send_result::unauthorized;
+            return code == 4 || code == 700 ? send_result::retry : send_result::dropped;
+        }
+    }
+    catch( std::exception& e )
+    {
+        std::cerr << "api " << path << " unexpected answer : " << e.what() << std::endl;
+    }
+
+    std::cout << "API => " << path << " " << fields << std::endl;
+    return send_result::done;
+}
+
+bool api_client::_perform( void* curl, const std::string& path, const std::string& post_fields, const std::string& etag, response& result )
+{
+    if ( !curl )
+        return false;
+
+    result = { 0, "", "" };
+
+    auto url = _url( path );
+    curl_easy_setopt( curl, CURLOPT_URL, url.c_str() );
+    curl_easy_setopt( curl, CURLOPT_WRITEFUNCTION, on_body );
+    curl_easy_setopt( curl, CURLOPT_WRITEDATA, &result.body );
+    curl_easy_setopt( curl, CURLOPT_HEADERFUNCTION, on_header );
+    curl_easy_setopt( curl, CURLOPT_HEADERDATA, &result.etag );
+
+    curl_slist* headers = nullptr;
+    if ( !etag.empty() )
+        headers = curl_slist_append( headers, ( "If-None-Match: " + etag ).c_str() );
+    curl_easy_setopt( curl, CURLOPT_HTTPHEADER, headers );
+
+    if ( post_fields.empty() )
+    {
+        curl_easy_setopt( curl, CURLOPT_HTTPGET, 1L );
+    }
+    else
+    {
+        curl_easy_setopt( curl, CURLOPT_POST, 1L );
+        curl_easy_setopt( curl, CURLOPT_POSTFIELDS, post_fields.c_str() );
+    }
+
+    auto code = curl_easy_perform( curl );
+    curl_easy_getinfo( curl, CURLINFO_RESPONSE_CODE, &result.status );
+
+    curl_easy_setopt( curl, CURLOPT_HTTPHEADER, static_cast<curl_slist*>( nullptr ) );
+    curl_slist_free_all( headers );
+
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_requests++;
+    }
+
+    if ( code != CURLE_OK )
+    {
+        std::cerr << "api " << path << " request failed : " << curl_easy_strerror( code ) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+std::string api_client::_url( const std::string& path )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_base_url + "/" + path + ( path.find( '?' ) == std::string::npos ? "?" : "&" ) + "access_token=" + m_access_token;
+}
+
+void api_client::_load_queue()
+{
+    std::ifstream queue( m_queue_file );
+
+    int type;
+    long long id, target;
+    while ( queue >> type >> id >> target )
+    {
+        action a{ static_cast<action_type>( type ), id, target };
+        if ( std::find( m_pending.begin(), m_pending.end(), a ) == m_pending.end() )
+            m_pending.push_back( a );
+    }
+
+    if ( !m_pending.empty() )
+        std::cout << "API queue restored " << m_pending.size() << " actions" << std::endl;
+}
+
+void api_client::_store_queue()
+{
+    auto tmp = m_queue_file + ".tmp";
+    {
+        std::ofstream queue( tmp, std::ios::trunc );
+        for ( const auto& a : m_pending )
+            queue << static_cast<int>( a.type ) << " " << a.id << " " << a.target << "\n";
+    }
+    std::rename( tmp.c_str(), m_queue_file.c_str() );
+}
@@ -0,0 +1,163 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Deezer Web API client : user actions go through a persistent write-behind queue (deduplicated,
+ * batched where the API allows it, retried with backoff) and reads are served from an ETag/TTL
+ * response cache. Requests run on a small pool of threads each holding a keep-alive connection,
+ * so that callers (GUI or SDK threads) never wait on the network.
+ */
+class api_client
+{
+public:
+    enum class action_type
+    {
+        like_track,
+        like_album,
+        add_to_playlist
+    };
+
+    using response_callback = std::function<void( bool ok, const std::string& body )>;
+    using token_rejected_callback = std::function<void()>;
+
+    struct infos
+    {
+        int pending_actions;    ///< actions not yet acknowledged by the API
+        int sent_actions;
+        int requests;           ///< HTTP requests actually performed
+        int cache_hits;         ///< reads served without any request
+        int revalidations;      ///< reads answered by a 304
+        size_t cache_bytes;     ///< response bodies currently cached
+    };
+
+    // oldest entries are evicted past this size
+#ifdef DEEZZY_LOW_MEMORY
+    static constexpr size_t cache_budget_bytes = 256 * 1024;
+#else
+    static constexpr size_t cache_budget_bytes = 4 * 1024 * 1024;
+#endif
+
+    // on_token_rejected runs on the write thread, once per token refused by the API : the actions
+    // stay queued and are sent again as soon as set_access_token() brings a new one
+    api_client( const std::string& base_url, const std::string& access_token, const std::string& queue_file, size_t pool_size,
+                token_rejected_callback on_token_rejected = nullptr );
+    ~api_client();
+
+    // returns immediately, the action being persisted before it is sent
+    void enqueue( action_type type, long long id, long long target = 0 );
+
+    // callback runs on a pool thread, from the cache while younger than ttl
+    void get( const std::string& path, std::chrono::seconds ttl, response_callback callback );
+
+    infos current_infos();
+
+    // hot swapped on refresh : requests already sent complete with the previous token
+    void set_access_token( const std::string& access_token );
+
+private:
+    struct action
+    {
+        action_type type;
+        long long id;
+        long long target;   ///< playlist id for add_to_playlist
+
+        bool operator==( const action& other ) const
+        {
+            return type == other.type && id == other.id && target == other.target;
+        }
+    };
+
+    struct cached_response
+    {
+        std::string body;
+        std::string etag;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    struct response
+    {
+        long status;
+        std::string body;
+        std::string etag;
+    };
+
+    enum class send_result { done, dropped, retry, unauthorized };
+
+    void _read_loop();
+    void _write_loop();
+    void _fetch( void* curl, const std::string& path, std::chrono::seconds ttl, const response_callback& callback );
+    void _evict_cache();
+    send_result _send( void* curl, const std::string& path, const std::string& fields );
+
+    bool _perform( void* curl, const std::string& path, const std::string& post_fields, const std::string& etag, response& result );
+    std::string _url( const std::string& path );
+
+    void _load_queue();
+    void _store_queue();
+
+private:
+    const std::string m_base_url;
+    std::string m_access_token;
+    const std::string m_queue_file;
+    const token_rejected_callback m_on_token_rejected;
+
+    std::mutex m_mutex;
+    bool m_running = true;
+    std::atomic<bool> m_aborting{ false };
+
+    // write-behind queue
+    std::condition_variable m_write_wakeup;
+    std::vector<action> m_pending;
+    std::chrono::steady_clock::time_point m_flush_time;
+    std::chrono::seconds m_backoff;
+    bool m_token_rejected = false;  ///< the current token was refused, a new one is awaited
+
+    // read jobs, and the response cache
+    std::condition_variable m_read_wakeup;
+    std::deque<std::function<void( void* )>> m_jobs;
+    std::map<std::string, cached_response> m_cache;
+    size_t m_cache_bytes = 0;
+
+    int m_sent_actions = 0;
+    int m_requests = 0;
+    int m_cache_hits = 0;
+    int m_revalidations = 0;
+
+    std::vector<std::thread> m_readers;
+    std::thread m_writer;
+};
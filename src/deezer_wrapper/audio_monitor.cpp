@@ -0,0 +1,242 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "audio_monitor.h"
+#include "thread_policy.h"
+
+#include <pulse/context.h>
+#include <pulse/error.h>
+#include <pulse/introspect.h>
+#include <pulse/mainloop.h>
+#include <pulse/proplist.h>
+#include <pulse/stream.h>
+#include <pulse/subscribe.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include <unistd.h>
+
+constexpr unsigned int audio_monitor::sample_rate;
+constexpr const char* audio_monitor::default_source;
+constexpr const char* audio_monitor::own_output;
+
+namespace {
+
+// keeps the newest sink input of this process : the player stream rather than the long lived equalizer output
+void on_sink_input_info( pa_context*, const pa_sink_input_info* info, int eol, void* userdata )
+{
+    if ( eol || !info )
+        return;
+
+    const auto* pid = pa_proplist_gets( info->proplist, PA_PROP_APPLICATION_PROCESS_ID );
+    auto* found = static_cast<uint32_t*>( userdata );
+    if ( pid && std::to_string( ::getpid() ) == pid && ( *found == PA_INVALID_INDEX || info->index > *found ) )
+        *found = info->index;
+}
+
+void on_sink_input_event( pa_context*, pa_subscription_event_type_t event, uint32_t, void* userdata )
+{
+    if ( ( event & PA_SUBSCRIPTION_EVENT_TYPE_MASK ) == PA_SUBSCRIPTION_EVENT_NEW )
+        *static_cast<bool*>( userdata ) = true;
+}
+
+} // namespace
+
+audio_monitor::audio_monitor( const std::string& name, const std::string& source, size_t block_frames, block_callback callback )
+    : m_name( name ), m_source( source ), m_block_frames( block_frames ), m_callback( callback ),
+      m_loop( pa_mainloop_new() ), m_block( block_frames * 2 )
+{
+    m_thread = std::thread( &audio_monitor::_capture, this );
+}
+
+audio_monitor::~audio_monitor()
+{
+    m_running = false;
+    pa_mainloop_wakeup( m_loop );
+    if ( m_thread.joinable() )
+        m_thread.join();
+    pa_mainloop_free( m_loop );
+}
+
+float audio_monitor::cpu_load() const
+{
+    return m_cpu_load;
+}
+
+bool audio_monitor::_iterate()
+{
+    // returns once woken up by the destructor, whatever the stream state
+    return m_running && pa_mainloop_iterate( m_loop, 1, nullptr ) >= 0 && m_running;
+}
+
+void audio_monitor::_capture()
+{
+    thread_policy::name_current_thread( "dz-monitor" );
+
+    auto* context = pa_context_new( pa_mainloop_get_api( m_loop ), "deezzy" );
+    if ( pa_context_connect( context, nullptr, PA_CONTEXT_NOFLAGS, nullptr ) >= 0 )
+    {
+        while ( pa_context_get_state( context ) != PA_CONTEXT_READY && PA_CONTEXT_IS_GOOD( pa_context_get_state( context ) ) && _iterate() )
+            ;
+    }
+
+    if ( pa_context_get_state( context ) != PA_CONTEXT_READY )
+    {
+        if ( m_running )
+            std::cerr << "cannot open " << m_name << " source " << m_source << " : " << pa_strerror( pa_context_errno( context ) ) << std::endl;
+    }
+    else if ( m_source != own_output )
+    {
+        _record( context, PA_INVALID_INDEX );
+    }
+    else
+    {
+        pa_context_set_subscribe_callback( context, &on_sink_input_event, &m_new_output );
+        pa_operation_unref( pa_context_subscribe( context, PA_SUBSCRIPTION_MASK_SINK_INPUT, nullptr, nullptr ) );
+
+        // the player stream is closed and reopened along playback : its tap follows it
+        while ( m_running && pa_context_get_state( context ) == PA_CONTEXT_READY )
+        {
+            m_new_output = false;
+            auto sink_input = _find_own_output( context );
+            if ( sink_input == PA_INVALID_INDEX || !_record( context, sink_input ) )
+                while ( !m_new_output && _iterate() )
+                    ;
+        }
+    }
+
+    pa_context_disconnect( context );
+    pa_context_unref( context );
+}
+
+bool audio_monitor::_record( pa_context* context, uint32_t sink_input )
+{
+    const pa_sample_spec spec = { PA_SAMPLE_FLOAT32NE, sample_rate, 2 };
+
+    // one fragment per block, so that the capture thread only wakes up once per block
+    pa_buffer_attr attr;
+    attr.maxlength = static_cast<uint32_t>( -1 );
+    attr.fragsize = static_cast<uint32_t>( m_block_frames * 2 * sizeof( float ) );
+    attr.tlength = attr.prebuf = attr.minreq = static_cast<uint32_t>( -1 );
+
+    auto* stream = pa_stream_new( context, m_name.c_str(), &spec, nullptr );
+    pa_stream_set_read_callback( stream, &audio_monitor::_static_read_callback, this );
+
+    // a sink input tap records from the monitor of the sink it plays on
+    auto tapped = sink_input == PA_INVALID_INDEX || pa_stream_set_monitor_stream( stream, sink_input ) >= 0;
+    auto* source = sink_input == PA_INVALID_INDEX ? m_source.c_str() : nullptr;
+    if ( tapped && pa_stream_connect_record( stream, source, &attr, PA_STREAM_ADJUST_LATENCY ) >= 0 )
+    {
+        while ( pa_stream_get_state( stream ) == PA_STREAM_CREATING && _iterate() )
+            ;
+    }
+
+    auto ready = pa_stream_get_state( stream ) == PA_STREAM_READY;
+    if ( ready )
+    {
+        if ( sink_input == PA_INVALID_INDEX )
+            std::cout << "MONITOR " << m_name << " listening to => " << m_source << std::endl;
+        else
+            std::cout << "MONITOR " << m_name << " listening to => sink input " << sink_input << std::endl;
+
+        // a tapped sink input going away terminates the stream
+        while ( !m_new_output && _iterate() && pa_stream_get_state( stream ) == PA_STREAM_READY )
+            ;
+    }
+    else if ( m_running )
+    {
+        std::cerr << "cannot open " << m_name << " source " << m_source << " : " << pa_strerror( pa_context_errno( context ) ) << std::endl;
+    }
+
+    pa_stream_disconnect( stream );
+    pa_stream_unref( stream );
+    return ready;
+}
+
+uint32_t audio_monitor::_find_own_output( pa_context* context )
+{
+    auto found = PA_INVALID_INDEX;
+    auto* operation = pa_context_get_sink_input_info_list( context, &on_sink_input_info, &found );
+    while ( operation && pa_operation_get_state( operation ) == PA_OPERATION_RUNNING && _iterate() )
+        ;
+    if ( operation )
+        pa_operation_unref( operation );
+    return found;
+}
+
+void audio_monitor::_static_read_callback( pa_stream* stream, size_t length, void* userdata )
+{
+    static_cast<audio_monitor*>( userdata )->_on_readable( stream );
+}
+
+void audio_monitor::_on_readable( pa_stream* stream )
+{
+    const void* data;
+    size_t length;
+
+    while ( pa_stream_peek( stream, &data, &length ) == 0 && length > 0 )
+    {
+        // a hole in the recording (data == nullptr) is skipped
+        const auto* bytes = static_cast<const char*>( data );
+        auto frames = length / ( 2 * sizeof( float ) );
+
+        while ( bytes && frames > 0 )
+        {
+            auto count = std::min( frames, m_block_frames - m_block_fill );
+            std::memcpy( m_block.data() + 2 * m_block_fill, bytes, count * 2 * sizeof( float ) );
+            bytes += count * 2 * sizeof( float );
+            frames -= count;
+
+            m_block_fill += count;
+            if ( m_block_fill == m_block_frames )
+            {
+                _on_block();
+                m_block_fill = 0;
+            }
+        }
+
+        pa_stream_drop( stream );
+    }
+}
+
+void audio_monitor::_on_block()
+{
+    auto start = std::chrono::steady_clock::now();
+
+    m_callback( m_block.data(), m_block_frames );
+
+    m_busy_s += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+    m_captured_s += static_cast<double>( m_block_frames ) / sample_rate;
+
+    // cpu load is refreshed every 10s of audio
+    if ( m_captured_s >= 10. )
+    {
+        m_cpu_load = static_cast<float>( m_busy_s / m_captured_s );
+        m_busy_s = m_captured_s = 0.;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct pa_context;
+struct pa_mainloop;
+struct pa_stream;
+
+/*
+ * Records a PulseAudio source (typically the monitor of the output sink) as interleaved stereo
+ * float frames in a background thread, handing fixed size blocks to a callback, and accounts for
+ * the time spent in that callback. The capture runs its own PulseAudio main loop, which the
+ * destructor wakes up : stopping never waits for data (a suspended sink monitor delivers none).
+ * The own_output source taps the playback stream of this process instead of a whole sink, so that
+ * the audio of other applications is left out : the tap follows the player stream as it is
+ * reopened, and waits while there is none.
+ */
+class audio_monitor
+{
+public:
+    static constexpr unsigned int sample_rate = 48000;
+    static constexpr const char* default_source = "@DEFAULT_MONITOR@";
+    static constexpr const char* own_output = "@DEEZZY_OUTPUT@";
+
+    using block_callback = std::function<void( const float* frames, size_t frame_count )>;
+
+    audio_monitor( const std::string& name, const std::string& source, size_t block_frames, block_callback callback );
+    ~audio_monitor();
+
+    // ratio of processing time over captured audio time
+    float cpu_load() const;
+
+private:
+    bool _iterate();
+    void _capture();
+    bool _record( pa_context* context, uint32_t sink_input );
+    uint32_t _find_own_output( pa_context* context );
+    static void _static_read_callback( pa_stream* stream, size_t length, void* userdata );
+    void _on_readable( pa_stream* stream );
+    void _on_block();
+
+private:
+    const std::string m_name;
+    const std::string m_source;
+    const size_t m_block_frames;
+    block_callback m_callback;
+
+    pa_mainloop* m_loop;
+
+    // capture thread only
+    std::vector<float> m_block;
+    size_t m_block_fill = 0;
+    double m_busy_s = 0.;
+    double m_captured_s = 0.;
+
+    // set on each new sink input, so that the own output tap moves to the newest player stream
+    bool m_new_output = false;
+
+    std::atomic<bool> m_running{ true };
+    std::atomic<float> m_cpu_load{ 0.f };
+
+    std::thread m_thread;
+};
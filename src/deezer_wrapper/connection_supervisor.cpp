@@ -0,0 +1,140 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "connection_supervisor.h"
+#include "thread_policy.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+constexpr auto base_delay = std::chrono::milliseconds( 1000 );
+constexpr auto max_delay = std::chrono::milliseconds( 60000 );
+
+} // namespace
+
+connection_supervisor::connection_supervisor( action retry, action recovered )
+    : m_retry( retry ), m_recovered( recovered )
+{
+    m_thread = std::thread( &connection_supervisor::_run, this );
+}
+
+connection_supervisor::~connection_supervisor()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_wakeup.notify_one();
+
+    if ( m_thread.joinable() )
+        m_thread.join();
+}
+
+void connection_supervisor::on_login_ok()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+
+    m_connected = true;
+    m_retry_scheduled = false;
+    m_attempt = 0;
+
+    if ( !m_recovering )
+        return;
+    m_recovering = false;
+
+    auto elapsed = std::chrono::steady_clock::now() - m_outage_start;
+    m_last_recover_ms = static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( elapsed ).count() );
+    m_max_recover_ms = std::max( m_max_recover_ms, m_last_recover_ms );
+
+    std::cout << "RECONNECT recovered in " << m_last_recover_ms << "ms" << std::endl;
+
+    lock.unlock();
+    m_recovered();
+}
+
+void connection_supervisor::on_login_failure()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_connected = false;
+    if ( !m_recovering )
+    {
+        m_recovering = true;
+        m_outage_start = std::chrono::steady_clock::now();
+        m_outage_count++;
+    }
+
+    // one pending retry at a time : failures reported meanwhile belong to the same attempt
+    if ( m_retry_scheduled )
+        return;
+
+    // equal jitter : half of the exponential delay, plus a random share of the other half
+    auto delay = std::min( max_delay, base_delay * ( 1 << std::min( m_attempt, 6 ) ) );
+    std::uniform_int_distribution<int> jitter( 0, static_cast<int>( delay.count() / 2 ) );
+    delay = delay / 2 + std::chrono::milliseconds( jitter( m_random ) );
+
+    m_attempt++;
+    m_retry_scheduled = true;
+    m_retry_time = std::chrono::steady_clock::now() + delay;
+
+    std::cout << "RECONNECT attempt " << m_attempt << " in " << delay.count() << "ms" << std::endl;
+
+    m_wakeup.notify_one();
+}
+
+connection_supervisor::infos connection_supervisor::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return { m_connected, m_outage_count, m_retry_count, m_last_recover_ms, m_max_recover_ms };
+}
+
+void connection_supervisor::_run()
+{
+    thread_policy::name_current_thread( "dz-supervisor" );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+
+    while ( m_running )
+    {
+        if ( !m_retry_scheduled )
+        {
+            m_wakeup.wait( lock );
+            continue;
+        }
+
+        if ( m_wakeup.wait_until( lock, m_retry_time ) == std::cv_status::no_timeout )
+            continue;
+
+        m_retry_scheduled = false;
+        m_retry_count++;
+
+        lock.unlock();
+        m_retry();
+        lock.lock();
+    }
+}
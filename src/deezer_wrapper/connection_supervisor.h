@@ -0,0 +1,87 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+
+/*
+ * Retries a lost login with a jittered exponential backoff from its own timer thread, and accounts
+ * for outages (retries, time to recover) so that their impact can be measured.
+ */
+class connection_supervisor
+{
+public:
+    using action = std::function<void()>;
+
+    struct infos
+    {
+        bool connected;
+        int outage_count;
+        int retry_count;            ///< retries over all outages
+        int last_recover_ms;        ///< duration of the last outage, from first failure to login
+        int max_recover_ms;
+    };
+
+    connection_supervisor( action retry, action recovered );
+    ~connection_supervisor();
+
+    void on_login_ok();
+    void on_login_failure();
+
+    infos current_infos();
+
+private:
+    void _run();
+
+private:
+    action m_retry;
+    action m_recovered;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_running = true;
+
+    bool m_connected = false;
+    bool m_recovering = false;
+    bool m_retry_scheduled = false;
+    int m_attempt = 0;
+    std::chrono::steady_clock::time_point m_outage_start;
+    std::chrono::steady_clock::time_point m_retry_time;
+
+    int m_outage_count = 0;
+    int m_retry_count = 0;
+    int m_last_recover_ms = 0;
+    int m_max_recover_ms = 0;
+
+    std::mt19937 m_random{ std::random_device{}() };
+
+    std::thread m_thread;
+};
@@ -0,0 +1,307 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "content_schedule.h"
+#include "thread_policy.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+constexpr const char* week_days[] = { "sun", "mon", "tue", "wed", "thu", "fri", "sat" };
+
+// wall clock steps (NTP at boot on boards without RTC) are caught up within this period
+constexpr std::chrono::seconds max_sleep{ 10 };
+constexpr int max_start_lead_ms = 10000;
+
+int week_day( const std::string& name )
+{
+    for ( auto i = 0; i < 7; i++ )
+        if ( name == week_days[i] )
+            return i;
+    return -1;
+}
+
+} // namespace
+
+constexpr std::chrono::seconds content_schedule::preload_lead;
+constexpr std::chrono::seconds content_schedule::late_grace;
+constexpr int content_schedule::minutes_per_day;
+
+content_schedule::content_schedule( const std::string& schedule_file, preload_request preload, load_request load )
+    : m_preload( std::move( preload ) ), m_load( std::move( load ) )
+{
+    _load( schedule_file );
+    if ( m_slots.empty() )
+        return;
+
+    std::cout << "SCHEDULE => " << m_slots.size() << " slots" << std::endl;
+
+    // slots already past at startup are the front-end's initial content, see current_content()
+    m_last_fired = clock::now();
+    m_thread = std::thread( &content_schedule::_run, this );
+}
+
+content_schedule::~content_schedule()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_wakeup.notify_all();
+    if ( m_thread.joinable() )
+        m_thread.join();
+}
+
+std::string content_schedule::current_content()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    occurrence current{ 0, clock::time_point() };
+    return _find( clock::now(), false, current ) ? m_slots[current.slot].content : std::string();
+}
+
+void content_schedule::on_preload_done( const std::string& content, bool success )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_has_next || m_preload_status != preload_status::pending || m_slots[m_next.slot].content != content )
+        return;
+
+    m_preload_status = success ? preload_status::ready : preload_status::failed;
+    std::cout << "SCHEDULE preload => " << ( success ? "ready " : "failed " ) << content << std::endl;
+}
+
+void content_schedule::on_audio_started()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_transition_pending )
+        return;
+    m_transition_pending = false;
+
+    auto now = clock::now();
+    auto latency_ms = static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( now - m_load_time ).count() );
+    m_last_offset_ms = static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( now - m_slot_time ).count() );
+    m_transitions++;
+
+    // smoothed, and bounded so that an outlier does not cut dayparts short
+    m_start_lead_ms = std::min( std::max( ( 3 * m_start_lead_ms + latency_ms ) / 4, 0 ), max_start_lead_ms );
+
+    std::cout << "SCHEDULE audio => " << m_last_offset_ms << "ms from slot (load latency " << latency_ms
+              << "ms, next lead " << m_start_lead_ms << "ms)" << std::endl;
+}
+
+content_schedule::infos content_schedule::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return { m_has_next ? m_slots[m_next.slot].content : std::string(),
+             m_next.time,
+             m_preload_status,
+             m_transitions,
+             m_last_offset_ms,
+             m_start_lead_ms };
+}
+
+bool content_schedule::_parse_days( const std::string& field, uint8_t& days )
+{
+    days = 0;
+    if ( field == "*" )
+    {
+        days = 0x7f;
+        return true;
+    }
+
+    std::istringstream items( field );
+    std::string item;
+    while ( std::getline( items, item, ',' ) )
+    {
+        auto dash = item.find( '-' );
+        auto first = week_day( item.substr( 0, dash ) );
+        auto last = dash == std::string::npos ? first : week_day( item.substr( dash + 1 ) );
+        if ( first < 0 || last < 0 )
+            return false;
+
+        // ranges may wrap around the week end (fri-mon)
+        for ( auto day = first; ; day = ( day + 1 ) % 7 )
+        {
+            days |= static_cast<uint8_t>( 1 << day );
+            if ( day == last )
+                break;
+        }
+    }
+    return days != 0;
+}
+
+void content_schedule::_load( const std::string& schedule_file )
+{
+    std::ifstream file( schedule_file );
+    std::string line;
+    while ( std::getline( file, line ) )
+    {
+        std::istringstream fields( line );
+        std::string days, time, content;
+        if ( line.empty() || line[0] == '#' || !( fields >> days >> time >> content ) )
+            continue;
+
+        slot s{ 0, 0, 0, content };
+        int hour = -1, minute = -1;
+        auto parsed = std::sscanf( time.c_str(), "%d:%d:%d", &hour, &minute, &s.second );
+        if ( !_parse_days( days, s.days ) || parsed < 2 || hour < 0 || hour > 23 || minute < 0 || minute > 59 || s.second < 0 || s.second > 59 )
+        {
+            std::cerr << "ignoring schedule slot : " << line << std::endl;
+            continue;
+        }
+        s.minute = hour * 60 + minute;
+        m_slots.push_back( s );
+    }
+
+    if ( m_slots.empty() )
+        return;
+
+    m_wheel.resize( minutes_per_day );
+    for ( size_t i = 0; i < m_slots.size(); i++ )
+        m_wheel[m_slots[i].minute].push_back( i );
+}
+
+bool content_schedule::_find( clock::time_point from, bool forward, occurrence& result ) const
+{
+    auto t = clock::to_time_t( from );
+    std::tm local;
+    localtime_r( &t, &local );
+    const auto from_minute = local.tm_hour * 60 + local.tm_min;
+
+    // a week and a day : the same slot one week later (or earlier) is always reached
+    for ( auto day = 0; day <= 7; day++ )
+    {
+        // noon keeps the date normalization away from daylight saving changes
+        std::tm date = local;
+        date.tm_mday += forward ? day : -day;
+        date.tm_hour = 12;
+        date.tm_min = date.tm_sec = 0;
+        date.tm_isdst = -1;
+        std::mktime( &date );
+        const auto day_bit = 1 << date.tm_wday;
+
+        for ( auto step = 0; step < minutes_per_day; step++ )
+        {
+            auto minute = forward ? step : minutes_per_day - 1 - step;
+            if ( day == 0 && ( forward ? minute < from_minute : minute > from_minute ) )
+                continue;
+
+            auto found = false;
+            for ( auto index : m_wheel[minute] )
+            {
+                const auto& s = m_slots[index];
+                if ( !( s.days & day_bit ) )
+                    continue;
+
+                std::tm at = date;
+                at.tm_hour = minute / 60;
+                at.tm_min = minute % 60;
+                at.tm_sec = s.second;
+                at.tm_isdst = -1;
+                auto time = clock::from_time_t( std::mktime( &at ) );
+                if ( forward ? time <= from : time > from )
+                    continue;
+
+                if ( !found || ( forward ? time < result.time : time > result.time ) )
+                    result = { index, time };
+                found = true;
+            }
+            if ( found )
+                return true;
+        }
+    }
+    return false;
+}
+
+void content_schedule::_run()
+{
+    thread_policy::name_current_thread( "dz-schedule" );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        auto now = clock::now();
+
+        occurrence next{ 0, clock::time_point() };
+        m_has_next = _find( std::max( now - late_grace, m_last_fired ), true, next );
+        if ( !m_has_next )
+        {
+            m_wakeup.wait_for( lock, max_sleep );
+            continue;
+        }
+        if ( next.slot != m_next.slot || next.time != m_next.time )
+        {
+            m_next = next;
+            m_preload_status = preload_status::waiting;
+        }
+
+        const auto content = m_slots[next.slot].content;
+        const auto load_time = next.time - std::chrono::milliseconds( m_start_lead_ms );
+        const auto preload_time = next.time - preload_lead;
+
+        if ( now >= load_time )
+        {
+            m_last_fired = next.time;
+            m_transition_pending = true;
+            m_load_time = now;
+            m_slot_time = next.time;
+            lock.unlock();
+
+            std::cout << "SCHEDULE => " << content << std::endl;
+            auto loaded = m_load( content );
+
+            lock.lock();
+            if ( !loaded )
+                m_transition_pending = false;
+            continue;
+        }
+
+        if ( m_preload_status == preload_status::waiting && now >= preload_time )
+        {
+            m_preload_status = preload_status::pending;
+            lock.unlock();
+
+            std::cout << "SCHEDULE preload => " << content << std::endl;
+            auto started = m_preload( content );
+
+            lock.lock();
+            if ( !started && m_preload_status == preload_status::pending )
+                m_preload_status = preload_status::unavailable;
+            continue;
+        }
+
+        auto wake = m_preload_status == preload_status::waiting ? std::min( load_time, preload_time ) : load_time;
+        m_wakeup.wait_until( lock, std::min( wake, now + max_sleep ) );
+    }
+}
@@ -0,0 +1,145 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Weekly calendar of content URLs (dayparts) driving the player : slots are hashed by minute of the
+ * day into a timer wheel, each slot holding its days of the week and its second. The upcoming content
+ * is preloaded ahead of its slot, and loaded early by the learnt load-to-audio latency, so that its
+ * audio starts on the second.
+ *
+ * Schedule file format, times being local :
+ *
+ *      # days      time        content
+ *      mon-fri     08:00       dzmedia:///playlist/1234
+ *      mon-fri     12:00:30    dzradio:///user-5678
+ *      sat,sun     10:00       dzmedia:///album/659384
+ *      *           22:00       dzmedia:///playlist/4321
+ */
+class content_schedule
+{
+public:
+    using clock = std::chrono::system_clock;
+
+    // returns false when the content cannot be preloaded (radios and flows are only known when loaded)
+    using preload_request = std::function<bool( const std::string& content )>;
+    // returns false when the content is already playing
+    using load_request = std::function<bool( const std::string& content )>;
+
+    enum class preload_status
+    {
+        waiting,        ///< the next slot is not due for preload yet
+        pending,
+        ready,
+        failed,
+        unavailable     ///< nothing to preload for this content
+    };
+
+    struct infos
+    {
+        std::string next_content;   ///< empty when nothing is scheduled
+        clock::time_point next_time;
+        preload_status preload;
+        int transitions;
+        int last_offset_ms;         ///< audio start of the last transition minus its slot time
+        int start_lead_ms;          ///< learnt load-to-audio latency, the loads are issued this early
+    };
+
+    static constexpr std::chrono::seconds preload_lead{ 300 };
+    // slots missed by less than this (clock step, stall) still fire, late
+    static constexpr std::chrono::seconds late_grace{ 300 };
+
+    content_schedule( const std::string& schedule_file, preload_request preload, load_request load );
+    ~content_schedule();
+
+    bool empty() const { return m_slots.empty(); }
+
+    // content of the daypart in progress, for the initial load
+    std::string current_content();
+
+    void on_preload_done( const std::string& content, bool success );
+    // first audio after a scheduled load closes the transition
+    void on_audio_started();
+
+    infos current_infos();
+
+private:
+    static constexpr int minutes_per_day = 24 * 60;
+
+    struct slot
+    {
+        uint8_t days;       ///< bit per week day, 0 being sunday
+        int minute;         ///< of the day
+        int second;
+        std::string content;
+    };
+
+    struct occurrence
+    {
+        size_t slot;
+        clock::time_point time;
+    };
+
+    static bool _parse_days( const std::string& field, uint8_t& days );
+    void _load( const std::string& schedule_file );
+    // first occurrence after (or last occurrence not after, backwards) the given time
+    bool _find( clock::time_point from, bool forward, occurrence& result ) const;
+    void _run();
+
+private:
+    preload_request m_preload;
+    load_request m_load;
+
+    std::vector<slot> m_slots;
+    std::vector<std::vector<size_t>> m_wheel;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_running = true;
+
+    occurrence m_next{ 0, clock::time_point() };
+    bool m_has_next = false;
+    preload_status m_preload_status = preload_status::waiting;
+    clock::time_point m_last_fired;
+
+    bool m_transition_pending = false;
+    clock::time_point m_load_time;
+    clock::time_point m_slot_time;
+    int m_transitions = 0;
+    int m_last_offset_ms = 0;
+    int m_start_lead_ms = 1500;
+
+    std::thread m_thread;
+};
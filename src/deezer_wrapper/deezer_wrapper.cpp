@@ -23,6 +23,20 @@ THE SOFTWARE.
 */
 
 #include "deezer_wrapper.h"
+#include "api_client.h"
+#include "connection_supervisor.h"
+#include "content_schedule.h"
+#include "equalizer.h"
+#include "library_index.h"
+#include "loudness.h"
+#include "memory_profile.h"
+#include "offline_sync.h"
+#include "playback_clock.h"
+#include "profile_manager.h"
+#include "qoe_tracker.h"
+#include "ram_cache.h"
+#include "skip_predictor.h"
+#include "thread_policy.h"
 
 #include "private/private_user.h"
 
@@ -31,7 +45,15 @@ THE SOFTWARE.
 #include <deezer-connect.h>
 #include <deezer-player.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <mutex>
 
 using namespace std::placeholders;
 
@@ -44,6 +66,52 @@ private:
         const std::string product_id;
         const std::string product_build_id;
     };
+
+    // progress callbacks refresh period while playing, and while paused/stopped (idle)
+    static constexpr dz_useconds_t active_progress_period = 1000000; /*1s*/
+    static constexpr dz_useconds_t idle_progress_period = 60000000; /*60s*/
+
+    // output volume used when loudness normalization is off, and as its reference otherwise
+    static constexpr int default_output_volume = 20;
+
+    // offline store resource holding the pre-synced window, and the content url playing it
+    static constexpr const char* presync_resource_id = "/dzlocal/tracklist/deezzy_presync";
+    static constexpr const char* presync_content = "dzmedia:///dzlocal/tracklist/deezzy_presync";
+    static constexpr size_t presync_window_size = 10;
+    static constexpr unsigned int presync_budget_kbps = 256;
+
+    // RAM tier location, streaming cache and profile quotas (the profile holds the offline store), and profile write back period
+    static constexpr const char* ram_cache_path = "/dev/shm/deezzy";
+#ifdef DEEZZY_LOW_MEMORY
+    // tmpfs pages are taken from the same 512MB as the process itself
+    static constexpr int ram_cache_quota_kB = 32 * 1024;
+    static constexpr unsigned long ram_profile_quota_kB = 32 * 1024;
+#else
+    static constexpr int ram_cache_quota_kB = 100 * 1024;
+    static constexpr unsigned long ram_profile_quota_kB = 160 * 1024;
+#endif
+    static constexpr std::chrono::seconds ram_cache_flush_period{ 300 };
+
+    // Web API endpoint, and number of keep-alive connections for reads
+    static constexpr const char* api_base_url = "https://api.deezer.com";
+    static constexpr size_t api_pool_size = 2;
+
+    // library pages are not fetched again within this delay (e.g. on reconnections)
+    static constexpr int library_ttl_s = 3600;
+
+    // content, queuelist index and position at shutdown, relative to the user cache path
+    static constexpr const char* session_file = "/session.state";
+
+    // per track quality of experience records kept for the aggregates
+    static constexpr size_t qoe_window_size = 256;
+
+    // predicted radio skips skipped in a row before a track is played anyway, and radio skips always left to the user
+    static constexpr int max_consecutive_pre_skips = 2;
+    static constexpr int reserved_user_skips = 1;
+
+    // offline store resource holding the first tracks of the upcoming daypart
+    static constexpr const char* schedule_resource_id = "/dzlocal/tracklist/deezzy_schedule";
+    static constexpr int schedule_preload_tracks = 3;
 public:
     deezer_wrapper_impl(    const std::string& app_id,
                             const std::string& product_id,
@@ -65,6 +133,30 @@ public:
         {
             std::cout << "<-- Deezer native SDK Version : " << dz_connect_get_build_id() << std::endl;
         }
+
+        // refreshed tokens of the active profile are swapped into the live connect handle and api client
+        token_manager::token seed{ deezzy::USER_ACCESS_TOKEN, deezzy::USER_REFRESH_TOKEN, 0, deezzy::USER_ACCESS_TOKEN_EXPIRES };
+        m_profiles = std::make_unique<profile_manager>( deezzy::USER_CACHE_PATH, deezzy::USER_ID, seed,
+                                                        profile_manager::oauth_settings{ deezzy::OAUTH_TOKEN_URL, m_ctx.app_id, deezzy::APP_SECRET },
+                                                        [this]( const std::string& access_token ) {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            if ( !m_token_sink )
+                return;
+            dz_connect_set_access_token( m_dzconnect, nullptr, nullptr, access_token.c_str() );
+            if ( m_api )
+                m_api->set_access_token( access_token );
+            // a login refused for an expired token is retried right away
+            if ( m_token_relogin.exchange( false ) )
+            {
+                std::cout << "RECONNECT => login with refreshed token" << std::endl;
+                dz_connect_offline_mode( m_dzconnect, nullptr, nullptr, false );
+            }
+        } );
+
+        m_library = std::make_unique<library_index>( m_profiles->active().cache_path + "/library.store",
+                                                     [this]( const std::string& path, library_index::page_callback callback ) {
+            api_get( path, library_ttl_s, callback );
+        } );
     }
     void register_observer( deezer_wrapper::observer* observer )
     {
@@ -72,27 +164,87 @@ public:
     }
     void set_content( const std::string& content )
     {
+        std::lock_guard<std::mutex> lock( m_content_mutex );
         m_content_url = content;
         std::cout << "CHANGE => " << m_content_url << std::endl;
     }
     void load_content()
+    {
+        std::lock_guard<std::mutex> lock( m_content_mutex );
+        _load_content();
+    }
+    void load_content( const std::string& content )
+    {
+        std::lock_guard<std::mutex> lock( m_content_mutex );
+        m_content_url = content;
+        std::cout << "CHANGE => " << m_content_url << std::endl;
+        _load_content();
+    }
+    // m_content_mutex held
+    void _load_content()
     {
         std::cout << "LOAD => " << m_content_url << std::endl;
+        // the content playing at last shutdown restarts where it was left, once
+        if ( !m_session_content.empty() && m_session_content == m_content_url )
+        {
+            std::cout << "SESSION resume => idx " << m_session_idx << " at " << m_session_position_ms << "ms" << std::endl;
+            m_resume_idx = m_session_idx;
+            m_resume_position_ms = m_session_position_ms;
+            m_resume_pending = true;
+        }
+        m_session_content.clear();
+        m_qoe.on_user_action( qoe_tracker::end_reason::jump );
+        m_user_selection = true;
+        _skip_drop();
+        {
+            std::lock_guard<std::mutex> lock( m_queue_mutex );
+            m_queue_generation++;
+            m_next_track_infos = track_infos{};
+        }
+        m_current_idx = DZ_INDEX_IN_QUEUELIST_INVALID;
+        m_ad_state = ad_none;
         dz_player_load( m_dzplayer, nullptr, nullptr,
                         m_content_url.c_str() );
     }
     std::string get_content()
     {
+        std::lock_guard<std::mutex> lock( m_content_mutex );
         return m_content_url;
     }
     bool active()
     {
+        std::lock_guard<std::mutex> lock( m_activation_mutex );
         return m_activation_count > 0;
     }
     void connect()
     {
         dz_error_t dzerr = DZ_ERROR_NO_ERROR;
 
+        // first, so that SDK threads get placed as soon as they are created
+        if ( m_thread_policy_enabled )
+            m_thread_policy = std::make_unique<thread_policy>( std::string( deezzy::USER_CACHE_PATH ) + "/thread_policy.conf" );
+
+        // before the SDK opens its output stream, so that it plays into the equalizer sink
+        if ( m_equalizer_enabled )
+            _start_equalizer();
+
+        _load_session();
+
+        if ( m_ram_cache_enabled )
+        {
+            m_ram_cache = std::make_unique<ram_cache>( deezzy::USER_CACHE_PATH, ram_cache_path, ram_cache_flush_period, ram_profile_quota_kB );
+            m_profile_path = m_ram_cache->profile_path();
+            m_config.user_profile_path = m_profile_path.c_str();
+        }
+        else
+        {
+            m_config.user_profile_path = deezzy::USER_CACHE_PATH;
+        }
+
+        // stopped by a previous disconnect
+        m_profiles->start();
+        _open_gate();
+
         m_dzconnect = dz_connect_new( &m_config );
         if ( m_dzconnect == nullptr )
         {
@@ -101,6 +253,25 @@ public:
 
         std::cout << "Device ID : " << dz_connect_get_device_id( m_dzconnect ) << std::endl;
 
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            m_api = std::make_unique<api_client>( api_base_url, m_profiles->access_token(),
+                                                  m_profiles->active().cache_path + "/api_actions.queue", api_pool_size,
+                                                  [this]() { m_profiles->refresh_async(); } );
+        }
+
+        // lost logins are retried on this same connect handle, without leaving an offline fallback in
+        // progress : its playback stays on the offline store until the login succeeds and _resume() goes online
+        m_supervisor = std::make_unique<connection_supervisor>( [this]() {
+            std::cout << "RECONNECT => login" << std::endl;
+            auto access_token = m_profiles->access_token();
+            dz_connect_set_access_token( m_dzconnect, nullptr, nullptr, access_token.c_str() );
+            if ( !m_offline || !m_offline->current_infos().offline )
+                dz_connect_offline_mode( m_dzconnect, nullptr, nullptr, false );
+        }, [this]() {
+            _resume();
+        } );
+
         dzerr = dz_connect_debug_log_disable( m_dzconnect );
         if ( dzerr != DZ_ERROR_NO_ERROR )
         {
@@ -112,11 +283,33 @@ public:
         {
             throw deezer_wrapper_exception( "cannot activate connection" );
         }
-        m_activation_count++;
+        _activated();
 
         /* Calling dz_connect_cache_path_set()
          * is mandatory in order to have the attended behavior */
-        dz_connect_cache_path_set( m_dzconnect, nullptr, nullptr, deezzy::USER_CACHE_PATH );
+        if ( m_ram_cache )
+        {
+            dz_connect_cache_path_set( m_dzconnect, nullptr, nullptr, m_ram_cache->cache_path().c_str() );
+            dz_connect_smartcache_quota_set( m_dzconnect, nullptr, nullptr, ram_cache_quota_kB );
+        }
+        else
+        {
+            dz_connect_cache_path_set( m_dzconnect, nullptr, nullptr, deezzy::USER_CACHE_PATH );
+        }
+
+        m_offline = std::make_unique<offline_scheduler>( presync_window_size, presync_budget_kbps, [this]( const std::string& tracklist ) {
+            auto version = std::to_string( ++m_presync_version );
+            dz_offline_synchronize( m_dzconnect, deezer_wrapper_impl::_static_offline_sync_callback, nullptr,
+                                    presync_resource_id, version.c_str(), tracklist.c_str() );
+        } );
+        if ( m_skip_prediction_enabled )
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            m_skip = std::make_unique<skip_predictor>( m_profiles->active().cache_path + "/skip_model.bin" );
+        }
+        if ( m_schedule_enabled )
+            _start_schedule();
+
 
         m_dzplayer = dz_player_new( m_dzconnect );
         if ( m_dzplayer == nullptr )
@@ -129,7 +322,7 @@ public:
         {
             throw deezer_wrapper_exception( "cannot activate player" );
         }
-        m_activation_count++;
+        _activated();
 
         dzerr = dz_player_set_event_cb( m_dzplayer, deezer_wrapper_impl::_static_player_callback );
         if ( dzerr != DZ_ERROR_NO_ERROR )
@@ -137,13 +330,16 @@ public:
             throw deezer_wrapper_exception( "cannot set event callback" );
         }
 
-        dzerr = dz_player_set_index_progress_cb( m_dzplayer, deezer_wrapper_impl::_static_index_progress_callback, 1000000/*1s*/ );
+        // nothing is playing yet : start in idle mode, switched to active on render_track_start
+        m_idle = true;
+
+        dzerr = dz_player_set_index_progress_cb( m_dzplayer, deezer_wrapper_impl::_static_index_progress_callback, idle_progress_period );
         if ( dzerr != DZ_ERROR_NO_ERROR )
         {
             throw deezer_wrapper_exception( "cannot set index progress callback" );
         }
 
-        dzerr = dz_player_set_render_progress_cb( m_dzplayer, deezer_wrapper_impl::_static_render_progress_callback, 1000000/*1s*/ );
+        dzerr = dz_player_set_render_progress_cb( m_dzplayer, deezer_wrapper_impl::_static_render_progress_callback, idle_progress_period );
         if ( dzerr != DZ_ERROR_NO_ERROR )
         {
             throw deezer_wrapper_exception( "cannot set render progress callback" );
@@ -155,12 +351,15 @@ public:
             throw deezer_wrapper_exception( "cannot set metadata callback" );
         }
 
-        dzerr = dz_player_set_output_volume( m_dzplayer, nullptr, nullptr, 20 );
+        dzerr = dz_player_set_output_volume( m_dzplayer, nullptr, nullptr, default_output_volume );
         if ( dzerr != DZ_ERROR_NO_ERROR )
         {
             throw deezer_wrapper_exception( "cannot set output volume" );
         }
 
+        if ( m_loudness_enabled )
+            _start_loudness();
+
         dzerr = dz_player_set_crossfading_duration( m_dzplayer, nullptr, nullptr, 3000 );
         if ( dzerr != DZ_ERROR_NO_ERROR )
         {
@@ -170,7 +369,12 @@ public:
         m_repeat_mode = DZ_QUEUELIST_REPEAT_MODE_OFF;
         m_shuffle_mode = false;
 
-        dzerr = dz_connect_set_access_token( m_dzconnect, nullptr, nullptr, deezzy::USER_ACCESS_TOKEN );
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            m_token_sink = true;
+        }
+        auto access_token = m_profiles->access_token();
+        dzerr = dz_connect_set_access_token( m_dzconnect, nullptr, nullptr, access_token.c_str() );
         if ( dzerr != DZ_ERROR_NO_ERROR )
         {
             throw deezer_wrapper_exception( "cannot set access token" );
@@ -183,53 +387,150 @@ public:
             throw deezer_wrapper_exception( "cannot enforce mandatory login" );
         }
     }
-    void disconnect()
+    deezer_wrapper::shutdown_infos disconnect( int deadline_ms )
     {
+        using clock = std::chrono::steady_clock;
+
+        if ( !m_dzconnect )
+            return { 0, 0, 0, 0, false };
+
+        auto start = clock::now();
+        auto elapsed_ms = []( clock::time_point from, clock::time_point to ) {
+            return static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( to - from ).count() );
+        };
+
+        auto deadline = start + std::chrono::milliseconds( deadline_ms );
+
+        // session first, while the queuelist index and position are still meaningful
+        _store_session();
+        if ( m_dzplayer )
+            dz_player_stop( m_dzplayer, nullptr, nullptr );
+
+        // SDK callbacks are no-ops from now on : the helpers below are only released once those in flight returned
+        if ( !_close_gate( deadline ) )
+            std::cerr << "SDK callbacks still running after " << deadline_ms << "ms, releasing anyway" << std::endl;
+
+        m_supervisor.reset();
+        std::unique_ptr<api_client> api;
+        std::unique_ptr<skip_predictor> skip;
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            m_token_sink = false;
+            api = std::move( m_api );
+            skip = std::move( m_skip );
+        }
+        // joins the API pool outside the lock, its callbacks may be waiting for it
+        api.reset();
+        // after the API pool, whose callbacks report preloads
+        m_schedule.reset();
+        _stop_loudness();
+        m_offline.reset();
+        skip.reset();
+        if ( m_equalizer )
+        {
+            m_equalizer.reset();
+            unsetenv( "PULSE_SINK" );
+        }
+
+        auto stopped = clock::now();
+
+        // deactivation completes asynchronously : the objects are only released once confirmed (or late)
         if ( m_dzplayer )
         {
-            std::cout << "-- DEACTIVATE & RELEASE PLAYER @" << m_dzplayer << " --" << std::endl;
+            std::cout << "-- DEACTIVATE PLAYER @" << m_dzplayer << " --" << std::endl;
             dz_player_deactivate( m_dzplayer, deezer_wrapper_impl::_static_player_on_deactivate, nullptr );
-            dz_object_release( reinterpret_cast<dz_object_handle>( m_dzplayer ) );
-            m_dzplayer = nullptr;
         }
+        std::cout << "-- DEACTIVATE CONNECT @" << m_dzconnect << " --" << std::endl;
+        dz_connect_deactivate( m_dzconnect, deezer_wrapper_impl::_static_connect_on_deactivate, nullptr );
 
-        if ( m_dzconnect )
+        // meanwhile, background token checks and refreshes abort their transfers and the library sync is dropped
+        m_profiles->stop();
+        m_library->stop();
+
+        bool timed_out;
         {
-            std::cout << "-- DEACTIVATE & RELEASE CONNECT @" << m_dzconnect << " --" << std::endl;
-            dz_connect_deactivate( m_dzconnect, deezer_wrapper_impl::_static_connect_on_deactivate, nullptr );
-            dz_object_release( reinterpret_cast<dz_object_handle>( m_dzconnect ) );
-            m_dzconnect = nullptr;
+            std::unique_lock<std::mutex> lock( m_activation_mutex );
+            timed_out = !m_deactivation.wait_until( lock, deadline,
+                                                    [this]() { return m_activation_count <= 0; } );
         }
+        if ( timed_out )
+            std::cerr << "SDK deactivation not confirmed within " << deadline_ms << "ms, releasing anyway" << std::endl;
+
+        auto deactivated = clock::now();
+
+        if ( m_dzplayer )
+        {
+            std::cout << "-- RELEASE PLAYER @" << m_dzplayer << " --" << std::endl;
+            dz_object_release( reinterpret_cast<dz_object_handle>( m_dzplayer ) );
+            m_dzplayer = nullptr;
+        }
+        std::cout << "-- RELEASE CONNECT @" << m_dzconnect << " --" << std::endl;
+        dz_object_release( reinterpret_cast<dz_object_handle>( m_dzconnect ) );
+        m_dzconnect = nullptr;
+
+        // last profile batch, once the SDK stopped writing to it
+        m_ram_cache.reset();
+        m_thread_policy.reset();
+
+        auto end = clock::now();
+
+        deezer_wrapper::shutdown_infos infos{ elapsed_ms( start, end ), elapsed_ms( start, stopped ),
+                                              elapsed_ms( stopped, deactivated ), elapsed_ms( deactivated, end ), timed_out };
+        std::cout << "SHUTDOWN => " << infos.total_ms << "ms (stop " << infos.stop_ms << "ms - deactivation " << infos.deactivation_ms
+                  << "ms - flush " << infos.flush_ms << "ms)" << std::endl;
+        std::cerr << std::flush;
+        return infos;
     }
     void playback_start()
     {
-        std::cout << "PLAY track n° " << m_track_played_count << " of => " << m_content_url << std::endl;
+        // after a recovered outage, restart from the track that was playing
+        auto idx = m_resume_pending.exchange( false ) ? m_resume_idx.load() : DZ_INDEX_IN_QUEUELIST_CURRENT;
+
+        std::cout << "PLAY track n° " << m_track_played_count << " of => " << get_content() << std::endl;
+        m_user_selection = true;
         dz_player_play( m_dzplayer, nullptr, nullptr,
                         DZ_PLAYER_PLAY_CMD_START_TRACKLIST,
-                        DZ_INDEX_IN_QUEUELIST_CURRENT );
+                        idx );
+    }
+    void playback_start_at( int index )
+    {
+        std::cout << "PLAY queue index " << index << " of => " << get_content() << std::endl;
+        m_qoe.on_user_action( qoe_tracker::end_reason::jump );
+        m_user_selection = true;
+        _skip_drop();
+        dz_player_play( m_dzplayer, nullptr, nullptr,
+                        DZ_PLAYER_PLAY_CMD_START_TRACKLIST,
+                        index );
     }
     void playback_stop()
     {
-        std::cout << "STOP => " << m_content_url << std::endl;
+        std::cout << "STOP => " << get_content() << std::endl;
+        m_qoe.on_user_action( qoe_tracker::end_reason::stopped );
+        _skip_drop();
+        m_ad_state = ad_none;
         dz_player_stop( m_dzplayer, nullptr, nullptr );
     }
     void playback_pause()
     {
-        std::cout << "PAUSE track n° " << m_track_played_count << " of => " << m_content_url << std::endl;
+        std::cout << "PAUSE track n° " << m_track_played_count << " of => " << get_content() << std::endl;
         dz_player_pause( m_dzplayer, nullptr, nullptr );
+        m_clock.pause();
 
         // This infamous hack is here because of this bug : https://github.com/deezer/native-sdk-samples/issues/20
+        _set_idle( true );
         if ( m_observer )
             m_observer->on_player_event( player_event::render_track_paused );
     }
     void playback_resume()
     {
-        std::cout << "RESUME track n° " << m_track_played_count << " of => " << m_content_url << std::endl;
+        std::cout << "RESUME track n° " << m_track_played_count << " of => " << get_content() << std::endl;
         dz_player_resume( m_dzplayer, nullptr, nullptr );
     }
     void playback_seek( int position_ms )
     {
-        std::cout << "SEEK track n° " << m_track_played_count << " of => " << m_content_url << " @" << position_ms << "ms" << std::endl;
+        std::cout << "SEEK track n° " << m_track_played_count << " of => " << get_content() << " @" << position_ms << "ms" << std::endl;
+        m_qoe.on_seek();
+        m_clock.seek( position_ms );
         dz_player_seek( m_dzplayer, nullptr, nullptr, position_ms * 1000 );
     }
     void playback_toogle_repeat()
@@ -263,49 +564,877 @@ public:
     }
     void playback_next()
     {
-        std::cout << "NEXT => " << m_content_url << std::endl;
+        std::cout << "NEXT => " << get_content() << std::endl;
+        m_qoe.on_user_action( qoe_tracker::end_reason::next );
+        m_user_selection = true;
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            if ( m_skip )
+                m_skip->on_next( m_render_progress_ms );
+        }
         dz_player_play( m_dzplayer, nullptr, nullptr,
                         DZ_PLAYER_PLAY_CMD_START_TRACKLIST,
                         DZ_INDEX_IN_QUEUELIST_NEXT );
     }
     void playback_previous()
     {
-        std::cout << "PREVIOUS => " << m_content_url << std::endl;
+        std::cout << "PREVIOUS => " << get_content() << std::endl;
+        m_qoe.on_user_action( qoe_tracker::end_reason::previous );
+        m_user_selection = true;
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            if ( m_skip )
+            {
+                // back to a track skipped ahead of time : the prediction was wrong, the track plays again
+                if ( m_after_pre_skip && m_pre_skipped_id )
+                {
+                    std::cout << "SKIP undone => back to predicted track " << m_pre_skipped_id << std::endl;
+                    m_skip->on_mispredicted();
+                }
+                m_skip->on_drop();
+            }
+        }
         dz_player_play( m_dzplayer, nullptr, nullptr,
                         DZ_PLAYER_PLAY_CMD_START_TRACKLIST,
                         DZ_INDEX_IN_QUEUELIST_PREVIOUS );
     }
     void playback_like()
     {
-        std::cout << "LIKE => " << m_content_url << std::endl;
-        //request = dz_api_request_new(DZ_API_CMD_POST, "user/<user_id>/tracks");
-        //result = dz_api_request_add_string_parameter(request, "track_id","<track_id_value>");
-        //dz_api_request_processing_async(...);
+        auto track_id = current_track_infos().id;
+        std::cout << "LIKE track => " << track_id << std::endl;
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( m_api )
+            m_api->enqueue( api_client::action_type::like_track, track_id );
+    }
+    void playback_like_album()
+    {
+        auto album_id = current_track_infos().album_id;
+        std::cout << "LIKE album => " << album_id << std::endl;
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( m_api )
+            m_api->enqueue( api_client::action_type::like_album, album_id );
+    }
+    void playlist_add_current( long long playlist_id )
+    {
+        auto track_id = current_track_infos().id;
+        std::cout << "ADD track => " << track_id << " to playlist " << playlist_id << std::endl;
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( m_api )
+            m_api->enqueue( api_client::action_type::add_to_playlist, track_id, playlist_id );
     }
     void playback_dislike()
     {
         // TODO : can only apply to the listening of a radio!
 
-        std::cout << "DISLIKE => " << m_content_url << std::endl;
+        std::cout << "DISLIKE => " << get_content() << std::endl;
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            if ( m_skip )
+                m_skip->on_dislike();
+        }
         dz_player_play( m_dzplayer, nullptr, nullptr,
                         DZ_PLAYER_PLAY_CMD_DISLIKE,
                         DZ_INDEX_IN_QUEUELIST_NEXT );
     }
     void play_audioads()
     {
-        dz_player_play_audioads( m_dzplayer, nullptr, nullptr );
+        {
+            std::lock_guard<std::mutex> lock( m_ad_mutex );
+            m_ad_infos.breaks++;
+        }
+        std::cout << "ADS => break requested" << std::endl;
+        m_ad_state = ad_requested;
+        if ( dz_player_play_audioads( m_dzplayer, deezer_wrapper_impl::_static_audioads_callback, nullptr ) != DZ_ERROR_NO_ERROR )
+            _on_ad_failure();
+    }
+    bool ad_break()
+    {
+        return m_ad_state != ad_none;
+    }
+    deezer_wrapper::ad_infos current_ad_infos()
+    {
+        std::lock_guard<std::mutex> lock( m_ad_mutex );
+        auto infos = m_ad_infos;
+        infos.in_break = ad_break();
+        return infos;
     }
-    const deezer_wrapper::track_infos& current_track_infos()
+    deezer_wrapper::track_infos current_track_infos()
     {
+        std::lock_guard<std::mutex> lock( m_queue_mutex );
         return m_current_track_infos;
     }
+    queue_infos current_queue_infos()
+    {
+        std::lock_guard<std::mutex> lock( m_queue_mutex );
+
+        queue_infos infos;
+        infos.generation = m_queue_generation;
+        infos.index = m_current_idx;
+        infos.next = m_next_track_infos;
+        infos.repeat_mode = m_repeat_mode == DZ_QUEUELIST_REPEAT_MODE_ONE ? 1 : m_repeat_mode == DZ_QUEUELIST_REPEAT_MODE_ALL ? 2 : 0;
+        infos.shuffle = m_shuffle_mode;
+        return infos;
+    }
+    deezer_wrapper::progress_infos current_progress_infos()
+    {
+        return { m_render_progress_ms.load(), m_index_progress_ms.load(), m_duration_ms.load() };
+    }
+    void enable_loudness_normalization( bool enable )
+    {
+        m_loudness_enabled = enable;
+
+        if ( !m_dzplayer )
+            return;
+
+        if ( enable && !m_loudness )
+        {
+            _start_loudness();
+        }
+        else if ( !enable && m_loudness )
+        {
+            _stop_loudness();
+            dz_player_set_output_volume( m_dzplayer, nullptr, nullptr, default_output_volume );
+        }
+    }
+    deezer_wrapper::loudness_infos current_loudness_infos()
+    {
+        if ( !m_loudness )
+            return { 0.f, 0.f, default_output_volume, 0.f };
+
+        auto infos = m_loudness->current_infos();
+        return { infos.short_term_lufs, infos.track_lufs, infos.volume, infos.cpu_load };
+    }
+    deezer_wrapper::offline_infos current_offline_infos()
+    {
+        if ( !m_offline )
+            return { 0, 0, 0.f, false };
+
+        auto infos = m_offline->current_infos();
+        return { infos.synced_tracks, infos.pending_tracks, infos.buffered_ahead_minutes, infos.offline };
+    }
+    void enable_ram_cache( bool enable )
+    {
+        m_ram_cache_enabled = enable;
+    }
+    void enable_skip_prediction( bool enable )
+    {
+        m_skip_prediction_enabled = enable;
+    }
+    deezer_wrapper::skip_infos current_skip_infos()
+    {
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( !m_skip )
+            return { 0, 0, 0, 0, 0, 0 };
+
+        auto infos = m_skip->current_infos();
+        return { infos.entries, infos.skipped, infos.listened, infos.predicted, infos.pre_skipped, infos.mispredicted };
+    }
+    void enable_equalizer( bool enable )
+    {
+        m_equalizer_enabled = enable;
+    }
+    std::vector<std::string> eq_presets()
+    {
+        if ( !m_equalizer )
+            return {};
+
+        return m_equalizer->presets();
+    }
+    bool set_eq_preset( const std::string& zone )
+    {
+        return m_equalizer && m_equalizer->set_preset( zone );
+    }
+    deezer_wrapper::eq_infos current_eq_infos()
+    {
+        if ( !m_equalizer )
+            return { "", 0, 0, 0.f, 0, 0, "" };
+
+        auto infos = m_equalizer->current_infos();
+        return { infos.preset, infos.bands, infos.switches, infos.cpu_load, infos.max_block_us, infos.latency_ms, infos.kernel };
+    }
+    void enable_schedule( bool enable )
+    {
+        m_schedule_enabled = enable;
+    }
+    void enable_thread_policy( bool enable )
+    {
+        m_thread_policy_enabled = enable;
+    }
+    std::string scheduled_content()
+    {
+        if ( !m_schedule )
+            return "";
+
+        return m_schedule->current_content();
+    }
+    deezer_wrapper::schedule_infos current_schedule_infos()
+    {
+        if ( !m_schedule )
+            return { "", -1, "", 0, 0, 0 };
+
+        static const char* preload_names[] = { "waiting", "pending", "ready", "failed", "unavailable" };
+
+        auto infos = m_schedule->current_infos();
+        auto next_in = std::chrono::duration_cast<std::chrono::seconds>( infos.next_time - content_schedule::clock::now() );
+        return { infos.next_content, infos.next_content.empty() ? -1 : static_cast<int>( next_in.count() ),
+                 preload_names[static_cast<int>( infos.preload )], infos.transitions, infos.last_offset_ms, infos.start_lead_ms };
+    }
+    deezer_wrapper::storage_infos current_storage_infos()
+    {
+        if ( !m_ram_cache )
+            return { 0, 0, 0, ram_cache::process_written_kB(), m_underflow_count.load() };
+
+        auto infos = m_ram_cache->current_infos();
+        return { infos.ram_kB, infos.flushed_kB, infos.flush_count, infos.written_kB, m_underflow_count.load() };
+    }
+    deezer_wrapper::connection_infos current_connection_infos()
+    {
+        if ( !m_supervisor )
+            return { false, 0, 0, 0, 0 };
+
+        auto infos = m_supervisor->current_infos();
+        return { infos.connected, infos.outage_count, infos.retry_count, infos.last_recover_ms, infos.max_recover_ms };
+    }
+    std::string user_id()
+    {
+        return m_profiles->active().user_id;
+    }
+    std::vector<deezer_wrapper::profile_infos> profiles()
+    {
+        std::vector<deezer_wrapper::profile_infos> infos;
+        for ( const auto& p : m_profiles->statuses() )
+            infos.push_back( { p.infos.name, p.infos.user_id, p.active, p.ready } );
+        return infos;
+    }
+    bool switch_profile( const std::string& name )
+    {
+        auto known = false;
+        for ( const auto& p : m_profiles->statuses() )
+            known |= p.infos.name == name && !p.active;
+        if ( !m_dzconnect || !known )
+            return false;
+
+        if ( !m_profiles->ready( name ) )
+            std::cerr << "profile " << name << " is not pre-authenticated yet" << std::endl;
+        std::cout << "PROFILE switch => " << name << std::endl;
+
+        m_switch_start = std::chrono::steady_clock::now();
+
+        // the session, pending actions and models of the profile left stay in its own cache directory
+        _store_session();
+        dz_player_stop( m_dzplayer, nullptr, nullptr );
+        m_qoe.on_user_action( qoe_tracker::end_reason::stopped );
+        m_resume_pending = false;
+        m_resume_position_ms = 0;
+        m_predicted_skip_id = 0;
+        m_played_prediction_id = 0;
+
+        // the helpers of the profile left are taken out under the lock, then destroyed outside of it : the
+        // api client aborts its transfers and joins its pool, whose callbacks may be waiting for the lock
+        std::unique_ptr<api_client> api;
+        std::unique_ptr<skip_predictor> skip;
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            api = std::move( m_api );
+            skip = std::move( m_skip );
+        }
+        auto skip_enabled = skip != nullptr;
+        api.reset();
+        skip.reset();
+
+        m_profiles->activate( name );
+        auto profile = m_profiles->active();
+        api = std::make_unique<api_client>( api_base_url, m_profiles->access_token(),
+                                            profile.cache_path + "/api_actions.queue", api_pool_size,
+                                            [this]() { m_profiles->refresh_async(); } );
+        if ( skip_enabled )
+            skip = std::make_unique<skip_predictor>( profile.cache_path + "/skip_model.bin" );
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            m_api = std::move( api );
+            m_skip = std::move( skip );
+        }
+        m_library->open( profile.cache_path + "/library.store" );
+
+        _load_session();
+        set_content( m_session_content.empty() ? "dzradio:///user-" + profile.user_id : m_session_content );
+
+        // same connect and player handles : only the login changes, the content being loaded once logged in
+        m_switch_state = switch_login;
+        auto access_token = m_profiles->access_token();
+        dz_connect_set_access_token( m_dzconnect, nullptr, nullptr, access_token.c_str() );
+        dz_connect_offline_mode( m_dzconnect, nullptr, nullptr, false );
+        return true;
+    }
+    deezer_wrapper::switch_infos current_switch_infos()
+    {
+        std::lock_guard<std::mutex> lock( m_switch_mutex );
+        return m_switch_infos;
+    }
+    deezer_wrapper::token_infos current_token_infos()
+    {
+        auto infos = m_profiles->token_infos();
+        return { infos.expires_in_s, infos.refreshes, infos.failures, infos.coalesced };
+    }
+    void api_get( const std::string& path, int ttl_s, deezer_wrapper::api_callback callback )
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            if ( m_api )
+            {
+                m_api->get( path, std::chrono::seconds( ttl_s ), callback );
+                return;
+            }
+        }
+        callback( false, "" );
+    }
+    deezer_wrapper::api_infos current_api_infos()
+    {
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( !m_api )
+            return { 0, 0, 0, 0, 0, 0 };
+
+        auto infos = m_api->current_infos();
+        return { infos.pending_actions, infos.sent_actions, infos.requests, infos.cache_hits, infos.revalidations,
+                 static_cast<int>( infos.cache_bytes / 1024 ) };
+    }
+    std::vector<deezer_wrapper::thread_infos> current_thread_infos()
+    {
+        std::vector<deezer_wrapper::thread_infos> infos;
+        if ( !m_thread_policy )
+            return infos;
+
+        for ( const auto& thread : m_thread_policy->current_infos() )
+            infos.push_back( { thread.tid, thread.name, thread.placement, thread.cpu_ms, thread.cpu_load, thread.involuntary_switches } );
+        return infos;
+    }
+    int playback_position_ms()
+    {
+        return m_clock.position_ms();
+    }
+    bool playback_clock_running()
+    {
+        return m_clock.running();
+    }
+    deezer_wrapper::qoe_infos current_qoe_infos()
+    {
+        auto infos = m_qoe.current_aggregates();
+        return { infos.tracks,
+                 infos.first_data_ms.p50, infos.first_data_ms.p99,
+                 infos.first_audio_ms.p50, infos.first_audio_ms.p99,
+                 infos.seek_ms.p50, infos.seek_ms.p99,
+                 infos.stall_ms.p50, infos.stall_ms.p99,
+                 infos.stalled_tracks, infos.stall_ratio, infos.skips, infos.failures };
+    }
+    std::vector<deezer_wrapper::qoe_record> recent_qoe_records()
+    {
+        std::vector<deezer_wrapper::qoe_record> records;
+        for ( const auto& r : m_qoe.records() )
+            records.push_back( { r.track_id, r.first_data_ms, r.first_audio_ms, r.played_ms, r.stall_count, r.stall_ms,
+                                 r.seek_count, r.seek_max_ms, qoe_tracker::reason_name( r.reason ), r.format } );
+        return records;
+    }
+    library_index& library()
+    {
+        return *m_library;
+    }
+    bool idle()
+    {
+        return m_idle;
+    }
+    float wakeups_per_second()
+    {
+        std::lock_guard<std::mutex> lock( m_wakeups_mutex );
+
+        auto now = std::chrono::steady_clock::now();
+        auto count = m_wakeups.load() + ( m_loudness ? m_loudness->blocks() : 0 );
+        auto elapsed = std::chrono::duration<float>( now - m_wakeups_sample_time ).count();
+        auto rate = elapsed > 0.f ? ( count - m_wakeups_sample_count ) / elapsed : 0.f;
+
+        m_wakeups_sample_time = now;
+        m_wakeups_sample_count = count;
+
+        return rate;
+    }
 private:
+    void _start_loudness()
+    {
+        m_loudness = std::make_unique<loudness_normalizer>( deezzy::USER_CACHE_PATH, default_output_volume, [this]( int volume ) {
+            dz_player_set_output_volume( m_dzplayer, nullptr, nullptr, volume );
+        } );
+        m_loudness->set_active( !m_idle );
+    }
+    // the capture wakeups of the meter going away stay accounted for
+    void _stop_loudness()
+    {
+        if ( !m_loudness )
+            return;
+        m_wakeups += m_loudness->blocks();
+        m_loudness.reset();
+    }
+    // without any zone configured, the output is left alone
+    void _start_equalizer()
+    {
+        auto presets = output_equalizer::load_presets( std::string( deezzy::USER_CACHE_PATH ) + "/eq.conf" );
+        if ( presets.size() < 2 )
+            return;
+
+        m_equalizer = std::make_unique<output_equalizer>( deezzy::USER_CACHE_PATH, std::move( presets ) );
+        if ( m_equalizer->active() )
+            setenv( "PULSE_SINK", output_equalizer::sink_name, 1 );
+        else
+            m_equalizer.reset();
+    }
+    void _start_schedule()
+    {
+        m_schedule = std::make_unique<content_schedule>( std::string( deezzy::USER_CACHE_PATH ) + "/schedule.conf",
+            [this]( const std::string& content ) {
+                return _preload_content( content );
+            },
+            [this]( const std::string& content ) {
+                // a daypart repeating the content in progress goes on uninterrupted
+                std::lock_guard<std::mutex> lock( m_content_mutex );
+                if ( content == m_content_url && !m_idle )
+                    return false;
+                m_content_url = content;
+                std::cout << "CHANGE => " << m_content_url << std::endl;
+                _load_content();
+                return true;
+            } );
+        if ( m_schedule->empty() )
+            m_schedule.reset();
+    }
+    // the first tracks of playlists and albums are synced to the offline store, so that the daypart starts
+    // without buffering : radios and flows are only known once loaded
+    bool _preload_content( const std::string& content )
+    {
+        auto id_of = [&content]( const std::string& prefix ) {
+            return content.compare( 0, prefix.size(), prefix ) == 0 ? content.substr( prefix.size() ) : std::string();
+        };
+
+        auto track_id = id_of( "dzmedia:///track/" );
+        if ( !track_id.empty() )
+            return _sync_preload( content, { track_id } );
+
+        auto path = _api_tracks_path( content );
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( path.empty() || !m_api )
+            return false;
+
+        m_api->get( path + "?limit=" + std::to_string( schedule_preload_tracks ), std::chrono::seconds( library_ttl_s ),
+                    [this, content]( bool ok, const std::string& body ) {
+            std::vector<std::string> track_ids;
+            try
+            {
+                auto page = nlohmann::json::parse( ok ? body : "{}" );
+                for ( const auto& track : page.value( "data", nlohmann::json::array() ) )
+                    track_ids.push_back( std::to_string( track.value( "id", 0LL ) ) );
+            }
+            catch( const std::exception& e )
+            {
+                std::cerr << "bad tracklist response : " << e.what() << std::endl;
+            }
+
+            if ( track_ids.empty() || !_sync_preload( content, track_ids ) )
+                m_schedule->on_preload_done( content, false );
+        } );
+        return true;
+    }
+    // Web API tracks of a playlist or an album, empty for any other content
+    static std::string _api_tracks_path( const std::string& content )
+    {
+        for ( const std::string type : { "playlist", "album" } )
+        {
+            auto prefix = "dzmedia:///" + type + "/";
+            if ( content.compare( 0, prefix.size(), prefix ) == 0 )
+                return "/" + type + "/" + content.substr( prefix.size() ) + "/tracks";
+        }
+        return std::string();
+    }
+    // albums and playlists are known ahead : the whole offline window is filled with the tracks queued after
+    // the selected one, radios and shuffled queues only announcing their next track
+    void _prefetch_offline_window( int idx, long long track_id )
+    {
+        auto path = m_shuffle_mode ? std::string() : _api_tracks_path( get_content() );
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( path.empty() || !m_api || idx < 0 || !track_id )
+            return;
+
+        auto query = "?index=" + std::to_string( idx + 1 ) + "&limit=" + std::to_string( presync_window_size - 1 );
+        m_api->get( path + query, std::chrono::seconds( library_ttl_s ), [this, track_id]( bool ok, const std::string& body ) {
+            std::vector<offline_scheduler::track> upcoming;
+            try
+            {
+                auto page = nlohmann::json::parse( ok ? body : "{}" );
+                for ( const auto& track : page.value( "data", nlohmann::json::array() ) )
+                    upcoming.push_back( { track.value( "id", 0LL ), track.value( "duration", 0 ) } );
+            }
+            catch( const std::exception& e )
+            {
+                std::cerr << "bad tracklist response : " << e.what() << std::endl;
+            }
+
+            m_offline->on_upcoming_tracks( track_id, upcoming );
+        } );
+    }
+    bool _sync_preload( const std::string& content, const std::vector<std::string>& track_ids )
+    {
+        std::string tracklist = "{\"data\":[";
+        for ( size_t i = 0; i < track_ids.size(); i++ )
+            tracklist += ( i ? ",{\"id\":\"" : "{\"id\":\"" ) + track_ids[i] + "\"}";
+        tracklist += "]}";
+
+        // the content comes back with the sync callback, which tells it from the pre-synced window
+        auto* userdata = new std::string( content );
+        auto version = std::to_string( ++m_schedule_preload_version );
+        if ( dz_offline_synchronize( m_dzconnect, deezer_wrapper_impl::_static_offline_sync_callback, userdata,
+                                     schedule_resource_id, version.c_str(), tracklist.c_str() ) != DZ_ERROR_NO_ERROR )
+        {
+            delete userdata;
+            return false;
+        }
+        return true;
+    }
+    // remembers where an interrupted on demand playback was, radios being simply reloaded
+    void _save_resume_point()
+    {
+        if ( m_idle || m_resume_pending || get_content().compare( 0, 7, "dzradio" ) == 0 )
+            return;
+
+        m_resume_idx = m_current_idx.load();
+        m_resume_position_ms = m_render_progress_ms.load();
+        m_resume_pending = true;
+    }
+    // the login is retried as soon as the refreshed token is in place
+    void _refresh_token()
+    {
+        m_token_relogin = true;
+        m_profiles->refresh_async();
+    }
+    void _skip_drop()
+    {
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( m_skip )
+            m_skip->on_drop();
+    }
+    // the track announced last time as a predicted skip is skipped as soon as it is selected, before its
+    // stream buffers (a few in a row at most, not to skip through a radio) : only when the radio advanced by
+    // itself, a track the user asked for always playing, and never with the last radio skips
+    void _predict_skips( int nb_skip_allowed, const track_infos& next_track_infos, bool automatic )
+    {
+        // read before the profile lock, taken after the content one when loading
+        auto radio = get_content().compare( 0, 7, "dzradio" ) == 0;
+
+        std::lock_guard<std::mutex> lock( m_profile_mutex );
+        if ( !m_skip )
+            return;
+
+        m_skip->on_track_selected( m_current_track_infos.artist_id, m_current_track_infos.album_id );
+
+        // a predicted skip that played anyway and was left to its end was a wrong prediction
+        if ( m_played_prediction_id && automatic )
+        {
+            std::cout << "SKIP mispredicted => track " << m_played_prediction_id << " listened through" << std::endl;
+            m_skip->on_mispredicted();
+        }
+        m_played_prediction_id = 0;
+
+        // the track reached through a pre-skip is the only one whose previous was pre-skipped
+        m_after_pre_skip = m_pre_skip_landing;
+        m_pre_skip_landing = false;
+
+        auto predicted = m_predicted_skip_id != 0 && m_predicted_skip_id == m_current_track_infos.id;
+        m_pre_skip = predicted && automatic && ( nb_skip_allowed < 0 || nb_skip_allowed > reserved_user_skips )
+                  && m_consecutive_pre_skips < max_consecutive_pre_skips;
+        if ( predicted && !m_pre_skip )
+            m_played_prediction_id = m_current_track_infos.id;
+        m_consecutive_pre_skips = m_pre_skip ? m_consecutive_pre_skips + 1 : 0;
+
+        m_predicted_skip_id = 0;
+        if ( radio && next_track_infos.id
+             && m_skip->predict_skip( next_track_infos.artist_id, next_track_infos.album_id ) )
+        {
+            std::cout << "SKIP predicted => next track " << next_track_infos.id << " (" << next_track_infos.artist << ")" << std::endl;
+            m_predicted_skip_id = next_track_infos.id;
+        }
+    }
+    void _pre_skip()
+    {
+        std::cout << "SKIP => predicted track " << m_current_track_infos.id << std::endl;
+        m_pre_skip = false;
+        {
+            std::lock_guard<std::mutex> lock( m_profile_mutex );
+            if ( m_skip )
+                m_skip->on_pre_skipped();
+            m_pre_skipped_id = m_current_track_infos.id;
+            m_pre_skip_landing = true;
+        }
+        m_qoe.on_user_action( qoe_tracker::end_reason::interrupted );
+        dz_player_play( m_dzplayer, nullptr, nullptr,
+                        DZ_PLAYER_PLAY_CMD_START_TRACKLIST,
+                        DZ_INDEX_IN_QUEUELIST_NEXT );
+    }
+    void _on_switch_step( int next_state )
+    {
+        auto elapsed_ms = static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - m_switch_start ).count() );
+
+        std::lock_guard<std::mutex> lock( m_switch_mutex );
+        if ( next_state == switch_audio )
+        {
+            m_switch_infos.login_ms = elapsed_ms;
+        }
+        else
+        {
+            m_switch_infos.audio_ms = elapsed_ms;
+            m_switch_infos.switches++;
+            std::cout << "SWITCH => audio after " << elapsed_ms << "ms (logged in after " << m_switch_infos.login_ms << "ms)" << std::endl;
+        }
+        m_switch_state = next_state;
+    }
+    // the ad could not be rendered : the rights are granted anyway, the music goes on without it
+    void _on_ad_failure()
+    {
+        auto state = m_ad_state.load();
+        if ( state != ad_requested && state != ad_playing )
+            return;
+        {
+            std::lock_guard<std::mutex> lock( m_ad_mutex );
+            m_ad_infos.failures++;
+        }
+        std::cerr << "ADS => could not render the ad, resuming the music" << std::endl;
+        _resume_after_ad();
+    }
+    // called straight from the SDK thread on the ad end, so that the next track is requested with no
+    // front-end round trip : the gap measured until its first rendered audio is the dead air heard
+    void _resume_after_ad()
+    {
+        auto now = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock( m_ad_mutex );
+            if ( m_ad_state == ad_playing )
+                m_ad_infos.ads_ms += static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( now - m_ad_start ).count() );
+            m_ad_end = now;
+        }
+        m_ad_state = ad_resuming;
+        std::cout << "ADS => resuming the music" << std::endl;
+        dz_player_play( m_dzplayer, deezer_wrapper_impl::_static_resume_after_ads_callback, nullptr,
+                        DZ_PLAYER_PLAY_CMD_RESUMED_AFTER_ADS,
+                        DZ_INDEX_IN_QUEUELIST_CURRENT );
+    }
+    void _on_ad_render_start()
+    {
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock( m_ad_mutex );
+        if ( m_ad_state == ad_resuming )
+        {
+            auto gap_ms = static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( now - m_ad_end ).count() );
+            m_ad_infos.last_gap_ms = gap_ms;
+            m_ad_infos.max_gap_ms = std::max( m_ad_infos.max_gap_ms, gap_ms );
+            std::cout << "ADS => music after " << gap_ms << "ms (max " << m_ad_infos.max_gap_ms << "ms)" << std::endl;
+            m_ad_state = ad_none;
+        }
+        else
+        {
+            std::cout << "ADS => ad rendering" << std::endl;
+            m_ad_start = now;
+            m_ad_state = ad_playing;
+        }
+    }
+    void _resume()
+    {
+        if ( m_offline && m_offline->current_infos().offline )
+            _go_online();
+        else if ( m_resume_pending )
+            load_content();
+    }
+    // plays the pre-synced window from the offline store until the link can be trusted again
+    void _go_offline()
+    {
+        auto first_ahead = m_offline->first_synced_ahead();
+        std::cout << "OFFLINE fallback => " << presync_content << " from idx " << first_ahead << std::endl;
+        m_offline->set_offline( true );
+        // the online resume point is put aside, the offline window playing from the first synced track after
+        // the one left (the fallback is only taken when there is one)
+        _save_resume_point();
+        m_online_resume_pending = m_resume_pending.exchange( false );
+        m_online_resume_idx = m_resume_idx.load();
+        m_online_resume_position_ms = m_resume_position_ms.exchange( 0 );
+        m_resume_idx = std::max( first_ahead, 0 );
+        m_resume_pending = true;
+        dz_connect_offline_mode( m_dzconnect, nullptr, nullptr, true );
+
+        std::lock_guard<std::mutex> lock( m_content_mutex );
+        m_online_content_url = m_content_url;
+        m_content_url = presync_content;
+        _load_content();
+    }
+    void _go_online()
+    {
+        m_offline->set_offline( false );
+        dz_connect_offline_mode( m_dzconnect, nullptr, nullptr, false );
+
+        std::lock_guard<std::mutex> lock( m_content_mutex );
+        std::cout << "ONLINE back => " << m_online_content_url << std::endl;
+        m_content_url = m_online_content_url;
+        // back to the track and position left when going offline, through the session resume path
+        // (a resume point taken while offline belongs to the offline window and is dropped)
+        m_resume_idx = m_online_resume_idx.load();
+        m_resume_position_ms = m_online_resume_pending ? m_online_resume_position_ms.load() : 0;
+        m_resume_pending = m_online_resume_pending.exchange( false );
+        if ( m_resume_pending )
+            std::cout << "ONLINE resume => idx " << m_resume_idx << " at " << m_resume_position_ms << "ms" << std::endl;
+        _load_content();
+    }
+    void _activated()
+    {
+        std::lock_guard<std::mutex> lock( m_activation_mutex );
+        m_activation_count++;
+    }
+    int _deactivated()
+    {
+        std::lock_guard<std::mutex> lock( m_activation_mutex );
+        m_activation_count--;
+        m_deactivation.notify_all();
+        return m_activation_count;
+    }
+    // SDK callbacks only reach the wrapper while the gate is open : disconnect closes it and waits for the
+    // ones in flight, so that no late callback runs into the helpers released next (deactivations excepted)
+    bool _enter_callback()
+    {
+        std::lock_guard<std::mutex> lock( m_gate_mutex );
+        if ( !m_gate_open )
+            return false;
+        m_gate_inflight++;
+        return true;
+    }
+    void _leave_callback()
+    {
+        std::lock_guard<std::mutex> lock( m_gate_mutex );
+        if ( --m_gate_inflight == 0 )
+            m_gate_drained.notify_all();
+    }
+    void _open_gate()
+    {
+        std::lock_guard<std::mutex> lock( m_gate_mutex );
+        m_gate_open = true;
+    }
+    bool _close_gate( std::chrono::steady_clock::time_point deadline )
+    {
+        std::unique_lock<std::mutex> lock( m_gate_mutex );
+        m_gate_open = false;
+        return m_gate_drained.wait_until( lock, deadline, [this]() { return m_gate_inflight == 0; } );
+    }
+    // holds the gate for the duration of one SDK callback
+    class callback_pass
+    {
+    public:
+        explicit callback_pass( void* delegate ) : m_impl( reinterpret_cast<deezer_wrapper_impl*>( delegate ) ),
+                                                   m_entered( m_impl->_enter_callback() ) {}
+        ~callback_pass()
+        {
+            if ( m_entered )
+                m_impl->_leave_callback();
+        }
+        callback_pass( const callback_pass& ) = delete;
+        callback_pass& operator=( const callback_pass& ) = delete;
+
+        explicit operator bool() const { return m_entered; }
+
+    private:
+        deezer_wrapper_impl* m_impl;
+        bool m_entered;
+    };
+    void _store_session()
+    {
+        auto file = m_profiles->active().cache_path + session_file;
+        auto content = get_content();
+
+        // radios cannot be restarted at a given index
+        if ( content.empty() || content.compare( 0, 7, "dzradio" ) == 0 || m_current_idx < 0 )
+        {
+            std::remove( file.c_str() );
+            return;
+        }
+
+        std::ofstream( file + ".tmp" ) << content << "\n" << m_current_idx << " " << m_render_progress_ms << std::endl;
+        std::rename( ( file + ".tmp" ).c_str(), file.c_str() );
+    }
+    void _load_session()
+    {
+        std::ifstream file( m_profiles->active().cache_path + session_file );
+        std::string content;
+        int idx = 0;
+        int position_ms = 0;
+        if ( std::getline( file, content ) && file >> idx >> position_ms )
+        {
+            m_session_content = content;
+            m_session_idx = idx;
+            m_session_position_ms = position_ms;
+        }
+    }
+    // the thread delivering player events gets its own placement
+    void _on_dispatcher_thread()
+    {
+        static thread_local auto tid = thread_policy::current_thread_id();
+        if ( m_thread_policy )
+            m_thread_policy->set_dispatcher_thread( tid );
+    }
+    static bool _parse_track_infos( const char* dzapiinfo, track_infos& infos )
+    {
+        try
+        {
+            using json = nlohmann::json;
+            memory_profile::scope tagged( memory_profile::tag::json );
+
+            // only the used keys are kept while parsing, the full document is never built
+            auto json_infos = json::parse( dzapiinfo, []( int, json::parse_event_t event, json& parsed ) {
+                if ( event != json::parse_event_t::key )
+                    return true;
+                const auto& key = parsed.get_ref<const std::string&>();
+                return key == "id" || key == "title" || key == "artist" || key == "name"
+                    || key == "duration" || key == "album" || key == "cover";
+            } );
+            infos.id = json_infos["id"].get<long long>();
+            infos.title = json_infos["title"].get<std::string>();
+            infos.artist = json_infos["artist"]["name"].get<std::string>();
+            infos.artist_id = json_infos["artist"]["id"].get<long long>();
+            infos.duration = json_infos["duration"].get<int>();
+            infos.album_title = json_infos["album"]["title"].get<std::string>();
+            infos.album_id = json_infos["album"]["id"].get<long long>();
+            infos.cover_art = json_infos["album"]["cover"].get<std::string>();
+            return true;
+        }
+        catch( std::exception& e )
+        {
+            std::cerr << "error parsing track infos : " << e.what() << std::endl;
+            return false;
+        }
+    }
+    // slows down progress callbacks while nothing is rendered, so that an idle player stays quiet
+    void _set_idle( bool idle )
+    {
+        if ( m_idle.exchange( idle ) == idle || !m_dzplayer )
+            return;
+
+        std::cout << "POWER mode => " << std::string( idle ? "IDLE" : "ACTIVE" ) << std::endl;
+
+        // the output monitor is not captured while nothing is rendered
+        if ( m_loudness )
+            m_loudness->set_active( !idle );
+
+        auto period = idle ? idle_progress_period : active_progress_period;
+        dz_player_set_index_progress_cb( m_dzplayer, deezer_wrapper_impl::_static_index_progress_callback, period );
+        dz_player_set_render_progress_cb( m_dzplayer, deezer_wrapper_impl::_static_render_progress_callback, period );
+    }
     // callback for dzconnect events
     static void _static_connect_callback(   dz_connect_handle handle,
                                             dz_connect_event_handle event,
                                             void* delegate )
     {
-        reinterpret_cast<deezer_wrapper_impl*>( delegate )->_connect_callback( handle, event );
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_connect_callback( handle, event );
     }
     void _connect_callback( dz_connect_handle handle,
                             dz_connect_event_handle event )
@@ -331,11 +1460,25 @@ private:
             case DZ_CONNECT_EVENT_USER_ACCESS_TOKEN_FAILED:
                 std::cout << "(App:" << &m_ctx << ") ++++ CONNECT_EVENT ++++ USER_ACCESS_TOKEN_FAILED" << std::endl;
                 output_event = connect_event::user_access_token_failed;
+                _save_resume_point();
+                _refresh_token();
+                if ( m_supervisor )
+                    m_supervisor->on_login_failure();
                 break;
 
             case DZ_CONNECT_EVENT_USER_LOGIN_OK:
                 std::cout << "(App:" << &m_ctx << ") ++++ CONNECT_EVENT ++++ USER_LOGIN_OK" << std::endl;
                 output_event = connect_event::user_login_ok;
+                m_token_relogin = false;
+                if ( m_supervisor )
+                    m_supervisor->on_login_ok();
+                m_library->sync();
+                // the front-end starts the playback once the queuelist is loaded, as for any content
+                if ( m_switch_state == switch_login )
+                {
+                    _on_switch_step( switch_audio );
+                    load_content();
+                }
                 break;
 
             case DZ_CONNECT_EVENT_USER_NEW_OPTIONS:
@@ -346,16 +1489,25 @@ private:
             case DZ_CONNECT_EVENT_USER_LOGIN_FAIL_NETWORK_ERROR:
                 std::cout << "(App:" << &m_ctx << ") ++++ CONNECT_EVENT ++++ USER_LOGIN_FAIL_NETWORK_ERROR" << std::endl;
                 output_event = connect_event::user_login_fail_network_error;
+                _save_resume_point();
+                if ( m_offline && m_offline->on_network_error() )
+                    _go_offline();
+                if ( m_supervisor )
+                    m_supervisor->on_login_failure();
                 break;
 
             case DZ_CONNECT_EVENT_USER_LOGIN_FAIL_BAD_CREDENTIALS:
                 std::cout << "(App:" << &m_ctx << ") ++++ CONNECT_EVENT ++++ USER_LOGIN_FAIL_BAD_CREDENTIALS" << std::endl;
                 output_event = connect_event::user_login_fail_bad_credentials;
+                _refresh_token();
                 break;
 
             case DZ_CONNECT_EVENT_USER_LOGIN_FAIL_USER_INFO:
                 std::cout << "(App:" << &m_ctx << ") ++++ CONNECT_EVENT ++++ USER_LOGIN_FAIL_USER_INFO" << std::endl;
                 output_event = connect_event::user_login_fail_user_info;
+                _save_resume_point();
+                if ( m_supervisor )
+                    m_supervisor->on_login_failure();
                 break;
 
             case DZ_CONNECT_EVENT_USER_LOGIN_FAIL_OFFLINE_MODE:
@@ -388,6 +1540,11 @@ private:
                                             dz_player_event_handle event,
                                             void* delegate )
     {
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( !pass )
+            return;
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->_on_dispatcher_thread();
         reinterpret_cast<deezer_wrapper_impl*>( delegate )->_player_callback( handle, event );
     }
     void _player_callback(  dz_player_handle handle,
@@ -434,6 +1591,10 @@ private:
 
             case DZ_PLAYER_EVENT_QUEUELIST_TRACK_RIGHTS_AFTER_AUDIOADS:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== QUEUELIST_TRACK_RIGHTS_AFTER_AUDIOADS for idx: " << idx << std::endl;
+                if ( auto json = dz_player_event_get_advertisement_infos_json( event ) )
+                    std::cout << "- advertisement : " << json << std::endl;
+                if ( m_ad_state == ad_none )
+                    play_audioads();
                 output_event = player_event::queuelist_track_rights_after_audioads;
                 break;
 
@@ -444,6 +1605,7 @@ private:
 
             case DZ_PLAYER_EVENT_QUEUELIST_TRACK_SELECTED:
                 {
+
                     bool is_preview;
                     bool can_pause_unpause;
                     bool can_seek;
@@ -461,73 +1623,119 @@ private:
                     if ( selected_dzapiinfo )
                     {
                         std::cout << "\tnow:" << selected_dzapiinfo << std::endl;
-                        try
-                        {
-                            using json = nlohmann::json;
-                            auto json_infos = json::parse( selected_dzapiinfo );
-                            m_current_track_infos.id = json_infos["id"].get<int>();
-                            m_current_track_infos.title = json_infos["title"].get<std::string>();
-                            m_current_track_infos.artist = json_infos["artist"]["name"].get<std::string>();
-                            m_current_track_infos.duration = json_infos["duration"].get<int>();
-                            m_current_track_infos.album_title = json_infos["album"]["title"].get<std::string>();
-                            m_current_track_infos.cover_art = json_infos["album"]["cover"].get<std::string>();
-                        }
-                        catch( std::exception& e )
-                        {
-                            std::cerr << "error parsing track infos : " << e.what() << std::endl;
-                        }
+                        track_infos current_track_infos{};
+                        _parse_track_infos( selected_dzapiinfo, current_track_infos );
+                        std::lock_guard<std::mutex> lock( m_queue_mutex );
+                        m_current_track_infos = current_track_infos;
                     }
+                    track_infos next_track_infos{};
                     if ( next_dzapiinfo )
+                    {
                         std::cout << "\tnext:" << next_dzapiinfo << std::endl;
+                        _parse_track_infos( next_dzapiinfo, next_track_infos );
+                    }
+                    if ( m_offline )
+                    {
+                        m_offline->on_track_selected( m_current_track_infos.id, m_current_track_infos.duration,
+                                                      next_track_infos.id, next_track_infos.duration );
+                        _prefetch_offline_window( idx, m_current_track_infos.id );
+                    }
+                    _predict_skips( nb_skip_allowed, next_track_infos, !m_user_selection.exchange( false ) );
+
+                    std::lock_guard<std::mutex> lock( m_queue_mutex );
+                    m_next_track_infos = next_track_infos;
                 }
+                m_current_idx = idx;
+                m_qoe.on_track_selected( m_current_track_infos.id );
+                m_clock.reset();
                 m_track_played_count++;
+                m_render_progress_ms = 0;
+                m_index_progress_ms = 0;
+                // a track skipped ahead of time is never shown : the next selection follows right away
+                if ( m_pre_skip )
+                {
+                    _pre_skip();
+                    return;
+                }
                 output_event = player_event::queuelist_track_selected;
                 break;
 
             case DZ_PLAYER_EVENT_MEDIASTREAM_DATA_READY:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== MEDIASTREAM_DATA_READY for idx: " << idx << std::endl;
+                m_qoe.on_data_ready();
                 output_event = player_event::mediastream_data_ready;
                 break;
 
             case DZ_PLAYER_EVENT_MEDIASTREAM_DATA_READY_AFTER_SEEK:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== MEDIASTREAM_DATA_READY_AFTER_SEEK for idx: " << idx << std::endl;
+                m_qoe.on_seek_ready();
                 output_event = player_event::mediastream_data_ready_after_seek;
                 break;
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_START_FAILURE:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_START_FAILURE for idx: " << idx << std::endl;
+                m_qoe.on_start_failure();
+                _on_ad_failure();
                 output_event = player_event::render_track_start_failure;
                 break;
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_START:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_START for idx: " << idx << std::endl;
+                _set_idle( false );
+                m_qoe.on_render_start();
+                m_clock.start( 0 );
+                // an ad is rendered out of the queuelist : it was either requested, or started by the SDK itself
+                if ( m_ad_state != ad_none || idx == DZ_INDEX_IN_QUEUELIST_INVALID )
+                    _on_ad_render_start();
+                if ( m_loudness )
+                    m_loudness->on_track_started( m_ad_state == ad_playing ? 0 : m_current_track_infos.id );
+                if ( m_switch_state == switch_audio )
+                    _on_switch_step( switch_none );
+                if ( m_schedule )
+                    m_schedule->on_audio_started();
+                if ( auto position_ms = m_resume_position_ms.exchange( 0 ) )
+                    playback_seek( position_ms );
                 output_event = player_event::render_track_start;
                 break;
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_END:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_END for idx: " << idx << std::endl;
                 std::cout << "- track_played_count : " << m_track_played_count << std::endl;
-                // Detect if we come from from playing an ad, if yes restart automatically the playback.
-                if ( idx == DZ_INDEX_IN_QUEUELIST_INVALID )
+                m_qoe.on_track_end();
+                m_clock.reset();
+                if ( m_ad_state == ad_playing )
+                {
+                    _resume_after_ad();
+                }
+                else if ( m_offline && m_offline->may_go_online() )
                 {
-                    std::cout << "NOT VERY SURE ABOUT THIS..." << std::endl;
-                    playback_start(); // TODO : not very sure about that...
+                    _go_online();
                 }
                 output_event = player_event::render_track_end;
                 break;
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_PAUSED:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_PAUSED for idx: " << idx << std::endl;
+                _set_idle( true );
+                m_clock.pause();
                 output_event = player_event::render_track_paused;
                 break;
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_UNDERFLOW:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_UNDERFLOW for idx: " << idx << std::endl;
                 output_event = player_event::render_track_underflow;
+                m_underflow_count++;
+                m_qoe.on_underflow();
+                m_clock.stall();
+                if ( m_offline && m_offline->on_underflow() )
+                    _go_offline();
                 break;
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_RESUMED:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_RESUMED for idx: " << idx << std::endl;
+                m_qoe.on_resumed();
+                m_clock.resume();
+                _set_idle( false );
                 output_event = player_event::render_track_resumed;
                 break;
 
@@ -538,6 +1746,11 @@ private:
 
             case DZ_PLAYER_EVENT_RENDER_TRACK_REMOVED:
                 std::cout << "(App:" << &m_ctx << ") ==== PLAYER_EVENT ==== RENDER_TRACK_REMOVED for idx: " << idx << std::endl;
+                m_qoe.on_track_removed();
+                _skip_drop();
+                m_clock.reset();
+                m_render_progress_ms = 0;
+                _set_idle( true );
                 output_event = player_event::render_track_removed;
                 break;
 
@@ -556,38 +1769,100 @@ private:
                                                 dz_error_t status,
                                                 dz_object_handle result)
     {
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
         reinterpret_cast<deezer_wrapper_impl*>( delegate )->_connect_on_deactivate( operation_userdata, status, result );
     }
     void _connect_on_deactivate(    void* operation_userdata,
                                     dz_error_t status,
                                     dz_object_handle result)
     {
-        m_activation_count--;
-        std::cout << "CONNECT deactivated - c = " << m_activation_count << " with status = " << status << std::endl;
+        std::cout << "CONNECT deactivated - c = " << _deactivated() << " with status = " << status << std::endl;
     }
     static void _static_player_on_deactivate(   void* delegate,
                                                 void* operation_userdata,
                                                 dz_error_t status,
                                                 dz_object_handle result )
     {
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
         reinterpret_cast<deezer_wrapper_impl*>( delegate )->_player_on_deactivate( operation_userdata, status, result );
     }
     void _player_on_deactivate( void* operation_userdata,
                                 dz_error_t status,
                                 dz_object_handle result )
     {
-        m_activation_count--;
-        std::cout << "PLAYER deactivated - c = " << m_activation_count << " with status = " << status << std::endl;
+        std::cout << "PLAYER deactivated - c = " << _deactivated() << " with status = " << status << std::endl;
+    }
+    static void _static_offline_sync_callback(  void* delegate,
+                                                void* operation_userdata,
+                                                dz_error_t status,
+                                                dz_object_handle result )
+    {
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_offline_sync_callback( operation_userdata, status );
+        else
+            delete static_cast<std::string*>( operation_userdata );
+    }
+    void _offline_sync_callback( void* operation_userdata, dz_error_t status )
+    {
+        if ( operation_userdata )
+        {
+            std::unique_ptr<std::string> content( static_cast<std::string*>( operation_userdata ) );
+            if ( m_schedule )
+                m_schedule->on_preload_done( *content, status == DZ_ERROR_NO_ERROR );
+            return;
+        }
+
+        std::cout << "OFFLINE sync done with status = " << status << std::endl;
+        if ( m_offline )
+            m_offline->on_sync_done( status == DZ_ERROR_NO_ERROR );
+    }
+    static void _static_audioads_callback(  void* delegate,
+                                            void* operation_userdata,
+                                            dz_error_t status,
+                                            dz_object_handle result )
+    {
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass && status != DZ_ERROR_NO_ERROR )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_on_ad_failure();
+    }
+    static void _static_resume_after_ads_callback(  void* delegate,
+                                                    void* operation_userdata,
+                                                    dz_error_t status,
+                                                    dz_object_handle result )
+    {
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_resume_after_ads_callback( status );
+    }
+    void _resume_after_ads_callback( dz_error_t status )
+    {
+        if ( status == DZ_ERROR_NO_ERROR || m_ad_state != ad_resuming )
+            return;
+        // rights not granted after the ad : restart the current track as a plain play
+        std::cerr << "ADS => resume after ads refused with status = " << status << ", restarting the track" << std::endl;
+        dz_player_play( m_dzplayer, nullptr, nullptr,
+                        DZ_PLAYER_PLAY_CMD_START_TRACKLIST,
+                        DZ_INDEX_IN_QUEUELIST_CURRENT );
     }
     static void _static_index_progress_callback(    dz_player_handle handle,
                                                     dz_useconds_t progress,
                                                     void* delegate )
     {
-        reinterpret_cast<deezer_wrapper_impl*>( delegate )->_index_progress_callback( progress );
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_index_progress_callback( progress );
     }
     void _index_progress_callback( dz_useconds_t progress )
     {
         //std::cout << "INDEX_PROGRESS " << progress << std::endl;
+        m_index_progress_ms = static_cast<int>( progress / 1000 );
+        if ( m_offline )
+            m_offline->on_index_progress( m_index_progress_ms, m_render_progress_ms, m_duration_ms );
         if ( m_observer )
             m_observer->on_index_progress( static_cast<int>( progress / 1000 ) );
     }
@@ -595,11 +1870,17 @@ private:
                                                     dz_useconds_t progress,
                                                     void* delegate )
     {
-        reinterpret_cast<deezer_wrapper_impl*>( delegate )->_render_progress_callback( progress );
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_render_progress_callback( progress );
     }
     void _render_progress_callback( dz_useconds_t progress )
     {
         //std::cout << "RENDER_PROGRESS " << progress << std::endl;
+        m_render_progress_ms = static_cast<int>( progress / 1000 );
+        m_qoe.on_render_progress( m_render_progress_ms );
+        m_clock.on_progress( m_render_progress_ms );
         if ( m_observer )
             m_observer->on_render_progress( static_cast<int>( progress / 1000 ) );
     }
@@ -607,7 +1888,10 @@ private:
                                             dz_track_metadata_handle metadata,
                                             void* delegate )
     {
-        reinterpret_cast<deezer_wrapper_impl*>( delegate )->_metadata_callback( metadata );
+        reinterpret_cast<deezer_wrapper_impl*>( delegate )->m_wakeups++;
+        callback_pass pass( delegate );
+        if ( pass )
+            reinterpret_cast<deezer_wrapper_impl*>( delegate )->_metadata_callback( metadata );
     }
     void _metadata_callback( dz_track_metadata_handle metadata )
     {
@@ -619,9 +1903,12 @@ private:
             break;
         case DZ_TRACK_METADATA_FORMAT_HEADER:
             std::cout << "FORMAT HEADER METADATA" << std::endl;
+            if ( auto* header = dz_track_metadata_get_format_header( metadata ) )
+                m_qoe.on_format( header );
             break;
         case DZ_TRACK_METADATA_DURATION_MS:
             std::cout << "DURATION MS METADATA" << std::endl;
+            m_duration_ms = dz_track_metadata_get_duration( metadata );
             if ( m_observer )
                 m_observer->on_track_duration( dz_track_metadata_get_duration( metadata ) );
             break;
@@ -631,21 +1918,132 @@ private:
 
     int m_track_played_count = 0;
     int m_activation_count = 0;
+    std::mutex m_activation_mutex;
+    std::condition_variable m_deactivation;
+    std::mutex m_gate_mutex;
+    std::condition_variable m_gate_drained;
+    bool m_gate_open = false;
+    int m_gate_inflight = 0;
     bool m_shuffle_mode = false;
 
+    // progress snapshot, written from SDK callbacks and read from any thread
+    std::atomic<int> m_render_progress_ms{ 0 };
+    std::atomic<int> m_index_progress_ms{ 0 };
+    std::atomic<int> m_duration_ms{ 0 };
+
+    std::atomic<bool> m_idle{ true };
+
+    // counts every entry from the SDK threads into the wrapper (and the loudness meters stopped since)
+    std::atomic<unsigned long> m_wakeups{ 0 };
+    std::mutex m_wakeups_mutex;
+    std::chrono::steady_clock::time_point m_wakeups_sample_time = std::chrono::steady_clock::now();
+    unsigned long m_wakeups_sample_count = 0;
+
+    // the content is set and loaded from the GUI, the SDK (offline fallback), schedule and room sync threads
+    std::mutex m_content_mutex;
     std::string m_content_url;
+    std::string m_online_content_url;
 
     dz_connect_handle m_dzconnect = nullptr;
     dz_player_handle m_dzplayer = nullptr;
     dz_queuelist_repeat_mode_t m_repeat_mode = DZ_QUEUELIST_REPEAT_MODE_OFF;
 
+    bool m_loudness_enabled = false;
+    std::unique_ptr<loudness_normalizer> m_loudness;
+
+    std::unique_ptr<offline_scheduler> m_offline;
+
+    bool m_skip_prediction_enabled = false;
+    std::unique_ptr<skip_predictor> m_skip;
+    long long m_predicted_skip_id = 0;
+    int m_consecutive_pre_skips = 0;
+    bool m_pre_skip = false;
+    // judged at the next selection : a predicted skip that played anyway, and the last pre-skipped track
+    long long m_played_prediction_id = 0;
+    long long m_pre_skipped_id = 0;
+    bool m_pre_skip_landing = false;
+    bool m_after_pre_skip = false;
+    // set by user commands and content loads : the selection that follows is not an automatic advance
+    std::atomic<bool> m_user_selection{ false };
+
+    bool m_schedule_enabled = false;
+    std::unique_ptr<content_schedule> m_schedule;
+    unsigned int m_schedule_preload_version = 0;
+
+    bool m_equalizer_enabled = false;
+    std::unique_ptr<output_equalizer> m_equalizer;
+    unsigned int m_presync_version = 0;
+
+    std::unique_ptr<connection_supervisor> m_supervisor;
+    // guards the per profile helpers and the token sink : held by their users for the duration of each
+    // (non-blocking) call, the helpers being swapped under it on profile switch and destroyed outside of it
+    std::mutex m_profile_mutex;
+    std::unique_ptr<api_client> m_api;
+    bool m_token_sink = false;      ///< tokens applied to the live handles while connected
+    std::atomic<bool> m_token_relogin{ false };
+    // after m_api : stopped first, as its token callback updates the api client
+    std::unique_ptr<profile_manager> m_profiles;
+
+    enum { switch_none, switch_login, switch_audio };
+    std::atomic<int> m_switch_state{ switch_none };
+    std::chrono::steady_clock::time_point m_switch_start;
+    std::mutex m_switch_mutex;
+    deezer_wrapper::switch_infos m_switch_infos = { 0, 0, 0 };
+
+    enum { ad_none, ad_requested, ad_playing, ad_resuming };
+    std::atomic<int> m_ad_state{ ad_none };
+    std::chrono::steady_clock::time_point m_ad_start;
+    std::chrono::steady_clock::time_point m_ad_end;
+    std::mutex m_ad_mutex;
+    deezer_wrapper::ad_infos m_ad_infos = { false, 0, 0, 0, 0, 0 };
+    std::unique_ptr<library_index> m_library;
+    bool m_thread_policy_enabled = false;
+    std::unique_ptr<thread_policy> m_thread_policy;
+    std::atomic<int> m_current_idx{ DZ_INDEX_IN_QUEUELIST_INVALID };
+    std::atomic<int> m_resume_idx{ DZ_INDEX_IN_QUEUELIST_INVALID };
+    std::atomic<int> m_resume_position_ms{ 0 };
+    std::atomic<bool> m_resume_pending{ false };
+    std::atomic<int> m_online_resume_idx{ DZ_INDEX_IN_QUEUELIST_INVALID };
+    std::atomic<int> m_online_resume_position_ms{ 0 };
+    std::atomic<bool> m_online_resume_pending{ false };
+
+    std::string m_session_content;
+    int m_session_idx = 0;
+    int m_session_position_ms = 0;
+
+    bool m_ram_cache_enabled = false;
+    std::unique_ptr<ram_cache> m_ram_cache;
+    std::string m_profile_path;
+    std::atomic<int> m_underflow_count{ 0 };
+
+    // kept across reconnections
+    qoe_tracker m_qoe{ qoe_window_size };
+
+    // render position extrapolated between progress callbacks
+    playback_clock m_clock;
+
     deezer_wrapper::observer* m_observer = nullptr;
+
+    // the track infos are written by the player event thread alone, which reads them without the lock
+    std::mutex m_queue_mutex;
+    int m_queue_generation = 0;
     deezer_wrapper::track_infos m_current_track_infos = {};
+    deezer_wrapper::track_infos m_next_track_infos = {};
 
     dz_connect_configuration m_config;
     wrapper_context m_ctx;
 };
 
+// out of class definitions for the constants passed by reference
+constexpr int deezer_wrapper::deezer_wrapper_impl::default_output_volume;
+constexpr size_t deezer_wrapper::deezer_wrapper_impl::presync_window_size;
+constexpr unsigned int deezer_wrapper::deezer_wrapper_impl::presync_budget_kbps;
+constexpr const char* deezer_wrapper::deezer_wrapper_impl::ram_cache_path;
+constexpr unsigned long deezer_wrapper::deezer_wrapper_impl::ram_profile_quota_kB;
+constexpr std::chrono::seconds deezer_wrapper::deezer_wrapper_impl::ram_cache_flush_period;
+constexpr const char* deezer_wrapper::deezer_wrapper_impl::api_base_url;
+constexpr size_t deezer_wrapper::deezer_wrapper_impl::api_pool_size;
+
 deezer_wrapper::deezer_wrapper( const std::string& app_id,
                                 const std::string& product_id,
                                 const std::string& product_build_id,
@@ -660,7 +2058,7 @@ deezer_wrapper::~deezer_wrapper()
 
 std::string deezer_wrapper::user_id()
 {
-    return deezzy::USER_ID;
+    return m_pimpl->user_id();
 }
 
 void deezer_wrapper::register_observer( deezer_wrapper::observer* observer )
@@ -678,6 +2076,11 @@ void deezer_wrapper::load_content()
     m_pimpl->load_content();
 }
 
+void deezer_wrapper::load_content( const std::string& content )
+{
+    m_pimpl->load_content( content );
+}
+
 std::string deezer_wrapper::get_content()
 {
     return m_pimpl->get_content();
@@ -693,9 +2096,9 @@ void deezer_wrapper::connect()
     m_pimpl->connect();
 }
 
-void deezer_wrapper::disconnect()
+deezer_wrapper::shutdown_infos deezer_wrapper::disconnect( int deadline_ms )
 {
-    m_pimpl->disconnect();
+    return m_pimpl->disconnect( deadline_ms );
 }
 
 void deezer_wrapper::playback_start()
@@ -703,6 +2106,11 @@ void deezer_wrapper::playback_start()
     m_pimpl->playback_start();
 }
 
+void deezer_wrapper::playback_start_at( int index )
+{
+    m_pimpl->playback_start_at( index );
+}
+
 void deezer_wrapper::playback_stop()
 {
     m_pimpl->playback_stop();
@@ -748,6 +2156,16 @@ void deezer_wrapper::playback_like()
     m_pimpl->playback_like();
 }
 
+void deezer_wrapper::playback_like_album()
+{
+    m_pimpl->playback_like_album();
+}
+
+void deezer_wrapper::playlist_add_current( long long playlist_id )
+{
+    m_pimpl->playlist_add_current( playlist_id );
+}
+
 void deezer_wrapper::playback_dislike()
 {
     m_pimpl->playback_dislike();
@@ -758,7 +2176,177 @@ void deezer_wrapper::play_audioads()
     m_pimpl->play_audioads();
 }
 
-const deezer_wrapper::track_infos& deezer_wrapper::current_track_infos()
+bool deezer_wrapper::ad_break()
+{
+    return m_pimpl->ad_break();
+}
+
+deezer_wrapper::ad_infos deezer_wrapper::current_ad_infos()
+{
+    return m_pimpl->current_ad_infos();
+}
+
+deezer_wrapper::track_infos deezer_wrapper::current_track_infos()
 {
     return m_pimpl->current_track_infos();
 }
+
+deezer_wrapper::queue_infos deezer_wrapper::current_queue_infos()
+{
+    return m_pimpl->current_queue_infos();
+}
+
+deezer_wrapper::progress_infos deezer_wrapper::current_progress_infos()
+{
+    return m_pimpl->current_progress_infos();
+}
+
+void deezer_wrapper::enable_loudness_normalization( bool enable )
+{
+    m_pimpl->enable_loudness_normalization( enable );
+}
+
+deezer_wrapper::loudness_infos deezer_wrapper::current_loudness_infos()
+{
+    return m_pimpl->current_loudness_infos();
+}
+
+bool deezer_wrapper::idle()
+{
+    return m_pimpl->idle();
+}
+
+deezer_wrapper::offline_infos deezer_wrapper::current_offline_infos()
+{
+    return m_pimpl->current_offline_infos();
+}
+
+void deezer_wrapper::enable_ram_cache( bool enable )
+{
+    m_pimpl->enable_ram_cache( enable );
+}
+
+deezer_wrapper::storage_infos deezer_wrapper::current_storage_infos()
+{
+    return m_pimpl->current_storage_infos();
+}
+
+deezer_wrapper::connection_infos deezer_wrapper::current_connection_infos()
+{
+    return m_pimpl->current_connection_infos();
+}
+
+void deezer_wrapper::api_get( const std::string& path, int ttl_s, api_callback callback )
+{
+    m_pimpl->api_get( path, ttl_s, callback );
+}
+
+void deezer_wrapper::enable_skip_prediction( bool enable )
+{
+    m_pimpl->enable_skip_prediction( enable );
+}
+
+deezer_wrapper::skip_infos deezer_wrapper::current_skip_infos()
+{
+    return m_pimpl->current_skip_infos();
+}
+
+void deezer_wrapper::enable_equalizer( bool enable )
+{
+    m_pimpl->enable_equalizer( enable );
+}
+
+std::vector<std::string> deezer_wrapper::eq_presets()
+{
+    return m_pimpl->eq_presets();
+}
+
+bool deezer_wrapper::set_eq_preset( const std::string& zone )
+{
+    return m_pimpl->set_eq_preset( zone );
+}
+
+deezer_wrapper::eq_infos deezer_wrapper::current_eq_infos()
+{
+    return m_pimpl->current_eq_infos();
+}
+
+void deezer_wrapper::enable_schedule( bool enable )
+{
+    m_pimpl->enable_schedule( enable );
+}
+
+void deezer_wrapper::enable_thread_policy( bool enable )
+{
+    m_pimpl->enable_thread_policy( enable );
+}
+
+std::string deezer_wrapper::scheduled_content()
+{
+    return m_pimpl->scheduled_content();
+}
+
+deezer_wrapper::schedule_infos deezer_wrapper::current_schedule_infos()
+{
+    return m_pimpl->current_schedule_infos();
+}
+
+std::vector<deezer_wrapper::profile_infos> deezer_wrapper::profiles()
+{
+    return m_pimpl->profiles();
+}
+
+bool deezer_wrapper::switch_profile( const std::string& name )
+{
+    return m_pimpl->switch_profile( name );
+}
+
+deezer_wrapper::switch_infos deezer_wrapper::current_switch_infos()
+{
+    return m_pimpl->current_switch_infos();
+}
+
+deezer_wrapper::token_infos deezer_wrapper::current_token_infos()
+{
+    return m_pimpl->current_token_infos();
+}
+
+deezer_wrapper::api_infos deezer_wrapper::current_api_infos()
+{
+    return m_pimpl->current_api_infos();
+}
+
+std::vector<deezer_wrapper::thread_infos> deezer_wrapper::current_thread_infos()
+{
+    return m_pimpl->current_thread_infos();
+}
+
+int deezer_wrapper::playback_position_ms()
+{
+    return m_pimpl->playback_position_ms();
+}
+
+bool deezer_wrapper::playback_clock_running()
+{
+    return m_pimpl->playback_clock_running();
+}
+
+deezer_wrapper::qoe_infos deezer_wrapper::current_qoe_infos()
+{
+    return m_pimpl->current_qoe_infos();
+}
+
+std::vector<deezer_wrapper::qoe_record> deezer_wrapper::recent_qoe_records()
+{
+    return m_pimpl->recent_qoe_records();
+}
+
+library_index& deezer_wrapper::library()
+{
+    return m_pimpl->library();
+}
+
+float deezer_wrapper::wakeups_per_second()
+{
+    return m_pimpl->wakeups_per_second();
+}
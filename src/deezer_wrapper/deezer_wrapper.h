@@ -24,9 +24,14 @@ THE SOFTWARE.
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 struct dz_connect_configuration;
+class library_index;
 
 class deezer_wrapper_exception : public std::runtime_error
 {
@@ -42,14 +47,192 @@ public:
 
     struct track_infos
     {
-        int id;
+        long long id;
         std::string title;
         std::string artist;
+        long long artist_id;
         int duration;
         std::string album_title;
+        long long album_id;
         std::string cover_art;
     };
 
+    struct progress_infos
+    {
+        int render_ms;
+        int index_ms;
+        int duration_ms;
+    };
+
+    struct loudness_infos
+    {
+        float short_term_lufs;
+        float track_lufs;
+        int volume;
+        float cpu_load;
+    };
+
+    struct offline_infos
+    {
+        int synced_tracks;
+        int pending_tracks;
+        float buffered_ahead_minutes;
+        bool offline;
+    };
+
+    struct storage_infos
+    {
+        unsigned long ram_kB;
+        unsigned long flushed_kB;
+        int flush_count;
+        unsigned long written_kB;
+        int underflow_count;
+    };
+
+    struct connection_infos
+    {
+        bool connected;
+        int outage_count;
+        int retry_count;
+        int last_recover_ms;
+        int max_recover_ms;
+    };
+
+    struct api_infos
+    {
+        int pending_actions;
+        int sent_actions;
+        int requests;
+        int cache_hits;
+        int revalidations;
+        int cache_kB;           ///< response cache size, bounded in low memory builds
+    };
+
+    struct token_infos
+    {
+        int expires_in_s;       ///< -1 when the token does not expire
+        int refreshes;
+        int failures;
+        int coalesced;          ///< refresh requests that joined one in flight
+    };
+
+    struct skip_infos
+    {
+        int model_entries;      ///< artists and albums with skip statistics
+        int skipped;            ///< tracks skipped within the skip window, or disliked
+        int listened;
+        int predicted;          ///< announced radio tracks predicted as skips
+        int pre_skipped;        ///< predicted skips skipped before they buffered
+        int mispredicted;       ///< predicted skips listened through, or played back after a pre-skip
+    };
+
+    struct eq_infos
+    {
+        std::string preset;
+        int bands;
+        int switches;
+        float cpu_load;         ///< processing time over audio time
+        int max_block_us;       ///< worst 10ms block processing time
+        int latency_ms;         ///< added by the equalizer stage
+        std::string kernel;     ///< neon, sse2 or scalar
+    };
+
+    struct schedule_infos
+    {
+        std::string next_content;   ///< empty when nothing is scheduled
+        int next_in_s;
+        std::string preload;        ///< waiting, pending, ready, failed or unavailable
+        int transitions;
+        int last_offset_ms;         ///< audio start of the last transition minus its slot time
+        int start_lead_ms;          ///< scheduled loads are issued this early
+    };
+
+    struct profile_infos
+    {
+        std::string name;
+        std::string user_id;
+        bool active;
+        bool ready;             ///< pre-authenticated : token checked in the background
+    };
+
+    struct switch_infos
+    {
+        int switches;
+        int login_ms;           ///< last switch request to the new user logged in
+        int audio_ms;           ///< last switch request to its first rendered audio
+    };
+
+    struct ad_infos
+    {
+        bool in_break;          ///< an ad is requested, playing, or the music is resuming after it
+        int breaks;
+        int failures;           ///< ads that could not be played, the music resumed without them
+        int last_gap_ms;        ///< last ad end to the first rendered music after it
+        int max_gap_ms;
+        int ads_ms;             ///< total time spent rendering ads
+    };
+
+    struct shutdown_infos
+    {
+        int total_ms;
+        int stop_ms;            ///< session stored, playback and helpers stopped
+        int deactivation_ms;    ///< waiting for the SDK deactivation callbacks
+        int flush_ms;           ///< RAM tier written back to persistent storage
+        bool timed_out;         ///< deactivation not confirmed before the deadline
+    };
+
+    struct thread_infos
+    {
+        int tid;
+        std::string name;
+        std::string placement;  ///< applied policy rule, empty when no rule matched
+        long cpu_ms;
+        float cpu_load;
+        long involuntary_switches;
+    };
+
+    struct queue_infos
+    {
+        int generation;         ///< incremented on each load_content
+        int index;              ///< selected queuelist index, negative until a track is selected
+        track_infos next;       ///< next track announced by the SDK, id 0 when unknown
+        int repeat_mode;        ///< 0 : off, 1 : one, 2 : all
+        bool shuffle;
+    };
+
+    using api_callback = std::function<void( bool ok, const std::string& body )>;
+
+    struct qoe_infos
+    {
+        int tracks;                 ///< records in the rolling window
+        int first_data_p50_ms;      ///< track selection to first streamed data
+        int first_data_p99_ms;
+        int first_audio_p50_ms;     ///< track selection to first rendered audio
+        int first_audio_p99_ms;
+        int seek_p50_ms;            ///< seek request to data ready
+        int seek_p99_ms;
+        int stall_p50_ms;           ///< stalled time per track
+        int stall_p99_ms;
+        float stalled_tracks;       ///< ratio of tracks with at least one underflow
+        float stall_ratio;          ///< stalled time over played time
+        int skips;
+        int failures;
+    };
+
+    struct qoe_record
+    {
+        int track_id;
+        int first_data_ms;          ///< -1 when no data came
+        int first_audio_ms;         ///< -1 when the track never started
+        int played_ms;
+        int stall_count;
+        int stall_ms;
+        int seek_count;
+        int seek_max_ms;
+        std::string end_reason;     ///< completed, next, previous, jump, stopped, failed or interrupted
+        std::string format;         ///< stream format header
+    };
+
     /*struct track_metadata
     {
         int duration;
@@ -139,14 +322,19 @@ public:
 
     void set_content( const std::string& content );
     void load_content();
+    // sets and loads the content in one step, for callers other than the GUI (schedule, room sync)
+    void load_content( const std::string& content );
     std::string get_content();
 
     bool active();
 
     void connect();
-    void disconnect();
+    // stores the session and stops playback, ignores SDK callbacks from then on, stops the helpers and background
+    // threads and flushes caches, waiting at most deadline_ms in all for the callbacks in flight and the SDK deactivation
+    shutdown_infos disconnect( int deadline_ms = 3000 );
 
     void playback_start();
+    void playback_start_at( int index );
     void playback_stop();
     void playback_pause();
     void playback_resume();
@@ -159,11 +347,79 @@ public:
     void playback_previous();
 
     void playback_like();
+    void playback_like_album();
     void playback_dislike();
 
+    void playlist_add_current( long long playlist_id );
+
+    // renders an ad now, the music resumes by itself when it ends
     void play_audioads();
+    bool ad_break();
+    ad_infos current_ad_infos();
+
+    track_infos current_track_infos();
+    queue_infos current_queue_infos();
+    progress_infos current_progress_infos();
+
+    // render position extrapolated from the last progress callback, frozen while paused, stalled or seeking
+    int playback_position_ms();
+    bool playback_clock_running();
+
+    void enable_loudness_normalization( bool enable );
+    loudness_infos current_loudness_infos();
+
+    offline_infos current_offline_infos();
+
+    // to be called before connect : SDK cache and profile go to tmpfs, the profile being flushed in batches
+    void enable_ram_cache( bool enable );
+    storage_infos current_storage_infos();
+
+    connection_infos current_connection_infos();
+
+    // to be called before connect : radio tracks predicted as skips from past listening are skipped before they buffer
+    void enable_skip_prediction( bool enable );
+    skip_infos current_skip_infos();
+
+    // to be called before connect : the output is equalized with the zone presets of USER_CACHE_PATH/eq.conf, when present
+    void enable_equalizer( bool enable );
+    std::vector<std::string> eq_presets();
+    // crossfades to the zone preset, which is restored on next start
+    bool set_eq_preset( const std::string& zone );
+    eq_infos current_eq_infos();
+
+    // to be called before connect : the dayparts of USER_CACHE_PATH/schedule.conf are loaded on time, when present
+    void enable_schedule( bool enable );
+    // content of the daypart in progress (empty without schedule), to be loaded first
+    std::string scheduled_content();
+    schedule_infos current_schedule_infos();
+
+    // the compile time "default" profile, plus the ones of USER_CACHE_PATH/profiles.conf
+    std::vector<profile_infos> profiles();
+    // hands the live player over to another profile, which resumes its last session (or plays its flow)
+    bool switch_profile( const std::string& name );
+    switch_infos current_switch_infos();
+
+    // access token lifecycle (refreshed in the background when USER_REFRESH_TOKEN is set)
+    token_infos current_token_infos();
+
+    // Web API read (e.g. "user/me/albums"), answered on a client thread, from cache while younger than ttl_s
+    void api_get( const std::string& path, int ttl_s, api_callback callback );
+    api_infos current_api_infos();
+
+    // to be called before connect : threads are placed by the rules of USER_CACHE_PATH/thread_policy.conf, or the defaults
+    void enable_thread_policy( bool enable );
+    // process threads as placed by the thread policy (empty without it)
+    std::vector<thread_infos> current_thread_infos();
+
+    // quality of experience over the last tracks, and the per track records behind it (oldest first)
+    qoe_infos current_qoe_infos();
+    std::vector<qoe_record> recent_qoe_records();
+
+    // local copy of the user library, synced on each login
+    library_index& library();
 
-    const track_infos& current_track_infos();
+    bool idle();
+    float wakeups_per_second();
 
 private:
 
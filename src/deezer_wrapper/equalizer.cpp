@@ -0,0 +1,643 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "equalizer.h"
+#include "thread_policy.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DEEZZY_EQ_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DEEZZY_EQ_SSE
+#endif
+
+#include <pulse/context.h>
+#include <pulse/error.h>
+#include <pulse/introspect.h>
+#include <pulse/mainloop.h>
+#include <pulse/simple.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+namespace {
+
+constexpr unsigned int sample_rate = 48000;
+constexpr const char* flat_preset = "flat";
+constexpr const char* active_file = "/eq.active";
+
+// synchronous introspection and module calls on a private mainloop, only used at setup and teardown
+class pulse_session
+{
+public:
+    pulse_session()
+    {
+        m_loop = pa_mainloop_new();
+        m_context = pa_context_new( pa_mainloop_get_api( m_loop ), "deezzy" );
+        if ( pa_context_connect( m_context, nullptr, PA_CONTEXT_NOFLAGS, nullptr ) < 0 )
+            return;
+
+        for ( ;; )
+        {
+            auto state = pa_context_get_state( m_context );
+            if ( state == PA_CONTEXT_READY )
+            {
+                m_ready = true;
+                break;
+            }
+            if ( !PA_CONTEXT_IS_GOOD( state ) || pa_mainloop_iterate( m_loop, 1, nullptr ) < 0 )
+                break;
+        }
+    }
+    ~pulse_session()
+    {
+        pa_context_disconnect( m_context );
+        pa_context_unref( m_context );
+        pa_mainloop_free( m_loop );
+    }
+
+    bool ready() const { return m_ready; }
+    pa_context* context() { return m_context; }
+    std::string error() { return pa_strerror( pa_context_errno( m_context ) ); }
+
+    // runs the mainloop until the operation completes
+    bool wait( pa_operation* operation )
+    {
+        if ( !operation )
+            return false;
+
+        while ( pa_operation_get_state( operation ) == PA_OPERATION_RUNNING )
+            if ( pa_mainloop_iterate( m_loop, 1, nullptr ) < 0 )
+                break;
+
+        auto done = pa_operation_get_state( operation ) == PA_OPERATION_DONE;
+        pa_operation_unref( operation );
+        return done;
+    }
+
+private:
+    pa_mainloop* m_loop;
+    pa_context* m_context;
+    bool m_ready = false;
+};
+
+bool parse_shape( const std::string& type, eq_band::shape& shape )
+{
+    static const std::pair<const char*, eq_band::shape> shapes[] = {
+        { "peak", eq_band::shape::peak },
+        { "low_shelf", eq_band::shape::low_shelf },
+        { "high_shelf", eq_band::shape::high_shelf },
+        { "low_pass", eq_band::shape::low_pass },
+        { "high_pass", eq_band::shape::high_pass }
+    };
+
+    for ( const auto& candidate : shapes )
+        if ( type == candidate.first )
+        {
+            shape = candidate.second;
+            return true;
+        }
+    return false;
+}
+
+} // namespace
+
+constexpr size_t biquad_cascade::max_bands;
+constexpr const char* output_equalizer::sink_name;
+constexpr size_t output_equalizer::block_frames;
+constexpr size_t output_equalizer::fade_frames;
+constexpr uint32_t output_equalizer::invalid_module;
+
+biquad_cascade::biquad_cascade( const eq_preset& preset, unsigned int sample_rate )
+{
+    for ( const auto& band : preset.bands )
+        if ( m_stage_count < max_bands )
+            m_stages[m_stage_count++] = _design( band, sample_rate );
+
+    if ( m_stage_count == 0 )
+        m_stages[m_stage_count++] = { 1.f, 0.f, 0.f, 0.f, 0.f };
+
+    // the pre-gain is folded into the first stage
+    auto gain = std::pow( 10.f, preset.preamp_db / 20.f );
+    m_stages[0].b0 *= gain;
+    m_stages[0].b1 *= gain;
+    m_stages[0].b2 *= gain;
+}
+
+void biquad_cascade::reset()
+{
+    std::fill( &m_state[0][0][0], &m_state[0][0][0] + max_bands * 4, 0.f );
+}
+
+const char* biquad_cascade::kernel()
+{
+#if defined(DEEZZY_EQ_NEON)
+    return "neon";
+#elif defined(DEEZZY_EQ_SSE)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+biquad_cascade::biquad biquad_cascade::_design( const eq_band& band, unsigned int sample_rate )
+{
+    const double pi = 3.14159265358979323846;
+
+    const double A = std::pow( 10.0, band.gain_db / 40.0 );
+    const double w0 = 2.0 * pi * band.frequency_hz / sample_rate;
+    const double cos_w0 = std::cos( w0 );
+    const double alpha = std::sin( w0 ) / ( 2.0 * band.q );
+    const double shelf = 2.0 * std::sqrt( A ) * alpha;
+
+    double b0, b1, b2, a0, a1, a2;
+    switch ( band.type )
+    {
+    case eq_band::shape::peak:
+        b0 = 1.0 + alpha * A;
+        b1 = -2.0 * cos_w0;
+        b2 = 1.0 - alpha * A;
+        a0 = 1.0 + alpha / A;
+        a1 = -2.0 * cos_w0;
+        a2 = 1.0 - alpha / A;
+        break;
+    case eq_band::shape::low_shelf:
+        b0 = A * ( ( A + 1.0 ) - ( A - 1.0 ) * cos_w0 + shelf );
+        b1 = 2.0 * A * ( ( A - 1.0 ) - ( A + 1.0 ) * cos_w0 );
+        b2 = A * ( ( A + 1.0 ) - ( A - 1.0 ) * cos_w0 - shelf );
+        a0 = ( A + 1.0 ) + ( A - 1.0 ) * cos_w0 + shelf;
+        a1 = -2.0 * ( ( A - 1.0 ) + ( A + 1.0 ) * cos_w0 );
+        a2 = ( A + 1.0 ) + ( A - 1.0 ) * cos_w0 - shelf;
+        break;
+    case eq_band::shape::high_shelf:
+        b0 = A * ( ( A + 1.0 ) + ( A - 1.0 ) * cos_w0 + shelf );
+        b1 = -2.0 * A * ( ( A - 1.0 ) + ( A + 1.0 ) * cos_w0 );
+        b2 = A * ( ( A + 1.0 ) + ( A - 1.0 ) * cos_w0 - shelf );
+        a0 = ( A + 1.0 ) - ( A - 1.0 ) * cos_w0 + shelf;
+        a1 = 2.0 * ( ( A - 1.0 ) - ( A + 1.0 ) * cos_w0 );
+        a2 = ( A + 1.0 ) - ( A - 1.0 ) * cos_w0 - shelf;
+        break;
+    case eq_band::shape::low_pass:
+        b0 = ( 1.0 - cos_w0 ) / 2.0;
+        b1 = 1.0 - cos_w0;
+        b2 = ( 1.0 - cos_w0 ) / 2.0;
+        a0 = 1.0 + alpha;
+        a1 = -2.0 * cos_w0;
+        a2 = 1.0 - alpha;
+        break;
+    case eq_band::shape::high_pass:
+    default:
+        b0 = ( 1.0 + cos_w0 ) / 2.0;
+        b1 = -( 1.0 + cos_w0 );
+        b2 = ( 1.0 + cos_w0 ) / 2.0;
+        a0 = 1.0 + alpha;
+        a1 = -2.0 * cos_w0;
+        a2 = 1.0 - alpha;
+        break;
+    }
+
+    return { static_cast<float>( b0 / a0 ), static_cast<float>( b1 / a0 ), static_cast<float>( b2 / a0 ),
+             static_cast<float>( a1 / a0 ), static_cast<float>( a2 / a0 ) };
+}
+
+void biquad_cascade::process_scalar( const float* input, float* output, size_t frame_count )
+{
+    for ( size_t s = 0; s < m_stage_count; s++ )
+    {
+        const auto& q = m_stages[s];
+        const auto* in = s == 0 ? input : output;
+
+        for ( size_t c = 0; c < 2; c++ )
+        {
+            auto s1 = m_state[s][0][c];
+            auto s2 = m_state[s][1][c];
+
+            for ( size_t i = 0; i < frame_count; i++ )
+            {
+                auto x = in[2 * i + c];
+
+                auto y = s1 + q.b0 * x;
+                s1 = s2 + q.b1 * x - q.a1 * y;
+                s2 = q.b2 * x - q.a2 * y;
+
+                output[2 * i + c] = y;
+            }
+
+            m_state[s][0][c] = s1;
+            m_state[s][1][c] = s2;
+        }
+    }
+}
+
+#if defined(DEEZZY_EQ_NEON)
+
+void biquad_cascade::process( const float* input, float* output, size_t frame_count )
+{
+    for ( size_t s = 0; s < m_stage_count; s++ )
+    {
+        const auto& q = m_stages[s];
+        const auto* in = s == 0 ? input : output;
+
+        // lane 0 : left channel, lane 1 : right channel
+        auto s1 = vld1_f32( m_state[s][0] );
+        auto s2 = vld1_f32( m_state[s][1] );
+
+        const auto b0 = vdup_n_f32( q.b0 ), b1 = vdup_n_f32( q.b1 ), b2 = vdup_n_f32( q.b2 );
+        const auto a1 = vdup_n_f32( q.a1 ), a2 = vdup_n_f32( q.a2 );
+
+        for ( size_t i = 0; i < frame_count; i++ )
+        {
+            auto x = vld1_f32( in + 2 * i );
+
+            auto y = vmla_f32( s1, b0, x );
+            s1 = vmls_f32( vmla_f32( s2, b1, x ), a1, y );
+            s2 = vmls_f32( vmul_f32( b2, x ), a2, y );
+
+            vst1_f32( output + 2 * i, y );
+        }
+
+        vst1_f32( m_state[s][0], s1 );
+        vst1_f32( m_state[s][1], s2 );
+    }
+}
+
+#elif defined(DEEZZY_EQ_SSE)
+
+void biquad_cascade::process( const float* input, float* output, size_t frame_count )
+{
+    // lanes 0 & 1 : left & right channels, upper lanes unused
+    auto load2 = []( const float* p ) { return _mm_castsi128_ps( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( p ) ) ); };
+    auto store2 = []( float* p, __m128 v ) { _mm_storel_epi64( reinterpret_cast<__m128i*>( p ), _mm_castps_si128( v ) ); };
+
+    for ( size_t s = 0; s < m_stage_count; s++ )
+    {
+        const auto& q = m_stages[s];
+        const auto* in = s == 0 ? input : output;
+
+        auto s1 = load2( m_state[s][0] );
+        auto s2 = load2( m_state[s][1] );
+
+        const auto b0 = _mm_set1_ps( q.b0 ), b1 = _mm_set1_ps( q.b1 ), b2 = _mm_set1_ps( q.b2 );
+        const auto a1 = _mm_set1_ps( q.a1 ), a2 = _mm_set1_ps( q.a2 );
+
+        for ( size_t i = 0; i < frame_count; i++ )
+        {
+            auto x = load2( in + 2 * i );
+
+            auto y = _mm_add_ps( s1, _mm_mul_ps( b0, x ) );
+            s1 = _mm_sub_ps( _mm_add_ps( s2, _mm_mul_ps( b1, x ) ), _mm_mul_ps( a1, y ) );
+            s2 = _mm_sub_ps( _mm_mul_ps( b2, x ), _mm_mul_ps( a2, y ) );
+
+            store2( output + 2 * i, y );
+        }
+
+        store2( m_state[s][0], s1 );
+        store2( m_state[s][1], s2 );
+    }
+}
+
+#else
+
+void biquad_cascade::process( const float* input, float* output, size_t frame_count )
+{
+    process_scalar( input, output, frame_count );
+}
+
+#endif
+
+std::vector<eq_preset> output_equalizer::load_presets( const std::string& presets_file )
+{
+    std::vector<eq_preset> presets{ { flat_preset, 0.f, {} } };
+
+    std::ifstream file( presets_file );
+    std::string line;
+    while ( std::getline( file, line ) )
+    {
+        std::istringstream fields( line );
+        std::string zone, type, frequency;
+        auto gain_db = 0.f;
+        if ( line.empty() || line[0] == '#' || !( fields >> zone >> type >> frequency >> gain_db ) )
+            continue;
+        auto q = 0.7071f;
+        fields >> q;
+
+        if ( zone == flat_preset )
+        {
+            std::cerr << "ignoring equalizer bands of the " << flat_preset << " preset" << std::endl;
+            continue;
+        }
+
+        auto preset = std::find_if( presets.begin(), presets.end(), [&zone]( const eq_preset& p ) { return p.zone == zone; } );
+        if ( preset == presets.end() )
+            preset = presets.insert( presets.end(), { zone, 0.f, {} } );
+
+        if ( type == "preamp" )
+        {
+            preset->preamp_db = gain_db;
+            continue;
+        }
+
+        eq_band band{ eq_band::shape::peak, static_cast<float>( std::atof( frequency.c_str() ) ), gain_db, q };
+        if ( !parse_shape( type, band.type ) || band.frequency_hz < 10.f || band.frequency_hz >= sample_rate / 2.f || band.q <= 0.f )
+        {
+            std::cerr << "ignoring equalizer band : " << line << std::endl;
+            continue;
+        }
+        if ( preset->bands.size() == biquad_cascade::max_bands )
+        {
+            std::cerr << "ignoring equalizer band beyond " << biquad_cascade::max_bands << " in zone " << zone << std::endl;
+            continue;
+        }
+        preset->bands.push_back( band );
+    }
+
+    return presets;
+}
+
+output_equalizer::output_equalizer( const std::string& cache_path, std::vector<eq_preset> presets )
+    : m_active_file( cache_path + active_file ), m_presets( std::move( presets ) )
+{
+    if ( m_presets.size() > 1 )
+        m_preset = 1;
+
+    std::ifstream active( m_active_file );
+    std::string zone;
+    if ( std::getline( active, zone ) )
+    {
+        for ( size_t i = 0; i < m_presets.size(); i++ )
+            if ( m_presets[i].zone == zone )
+                m_preset = i;
+    }
+
+    if ( m_presets.empty() || !_load_sink() )
+        return;
+
+    m_pending = new biquad_cascade( m_presets[m_preset], sample_rate );
+
+    std::cout << "EQUALIZER => " << m_presets[m_preset].zone << " (" << biquad_cascade::kernel() << ") to " << m_output_sink << std::endl;
+
+    m_thread = std::thread( &output_equalizer::_run, this );
+}
+
+output_equalizer::~output_equalizer()
+{
+    m_running = false;
+    if ( m_thread.joinable() )
+        m_thread.join();
+
+    // a player stream still attached falls back to the default sink
+    _unload_sink();
+
+    delete m_pending.exchange( nullptr );
+    delete m_retired.exchange( nullptr );
+}
+
+std::vector<std::string> output_equalizer::presets() const
+{
+    std::vector<std::string> zones;
+    for ( const auto& preset : m_presets )
+        zones.push_back( preset.zone );
+    return zones;
+}
+
+bool output_equalizer::set_preset( const std::string& zone )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto preset = std::find_if( m_presets.begin(), m_presets.end(), [&zone]( const eq_preset& p ) { return p.zone == zone; } );
+    if ( preset == m_presets.end() )
+        return false;
+
+    auto index = static_cast<size_t>( preset - m_presets.begin() );
+    if ( index == m_preset )
+        return true;
+
+    m_preset = index;
+    m_switches++;
+
+    // coefficients are designed here, the audio thread only swaps cascades
+    delete m_retired.exchange( nullptr );
+    delete m_pending.exchange( new biquad_cascade( *preset, sample_rate ) );
+
+    std::ofstream( m_active_file ) << zone << std::endl;
+
+    std::cout << "EQUALIZER => " << zone << std::endl;
+    return true;
+}
+
+output_equalizer::infos output_equalizer::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return { m_presets.empty() ? std::string() : m_presets[m_preset].zone,
+             m_presets.empty() ? 0 : static_cast<int>( m_presets[m_preset].bands.size() ),
+             m_switches,
+             m_cpu_load.load(),
+             m_max_block_us.load(),
+             m_latency_ms.load(),
+             biquad_cascade::kernel() };
+}
+
+bool output_equalizer::_load_sink()
+{
+    pulse_session pulse;
+    if ( !pulse.ready() )
+    {
+        std::cerr << "cannot reach pulseaudio for the equalizer : " << pulse.error() << std::endl;
+        return false;
+    }
+
+    // the actual output, looked up before the null sink exists
+    pulse.wait( pa_context_get_server_info( pulse.context(), []( pa_context*, const pa_server_info* info, void* user ) {
+        if ( info && info->default_sink_name )
+            *static_cast<std::string*>( user ) = info->default_sink_name;
+    }, &m_output_sink ) );
+
+    // left over by a run that did not exit cleanly
+    uint32_t stale = invalid_module;
+    pulse.wait( pa_context_get_sink_info_by_name( pulse.context(), sink_name, []( pa_context*, const pa_sink_info* info, int eol, void* user ) {
+        if ( eol == 0 && info )
+            *static_cast<uint32_t*>( user ) = info->owner_module;
+    }, &stale ) );
+    if ( stale != invalid_module )
+        pulse.wait( pa_context_unload_module( pulse.context(), stale, nullptr, nullptr ) );
+
+    if ( m_output_sink.empty() || m_output_sink == sink_name )
+    {
+        std::cerr << "no output sink to equalize to" << std::endl;
+        return false;
+    }
+
+    auto arguments = std::string( "sink_name=" ) + sink_name + " format=float32le rate=" + std::to_string( sample_rate )
+                   + " channels=2 sink_properties=device.description=deezzy_equalizer";
+    pulse.wait( pa_context_load_module( pulse.context(), "module-null-sink", arguments.c_str(), []( pa_context*, uint32_t index, void* user ) {
+        *static_cast<uint32_t*>( user ) = index;
+    }, &m_module ) );
+
+    if ( m_module == invalid_module )
+    {
+        std::cerr << "cannot load the equalizer sink : " << pulse.error() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void output_equalizer::_unload_sink()
+{
+    if ( m_module == invalid_module )
+        return;
+
+    pulse_session pulse;
+    if ( !pulse.ready() || !pulse.wait( pa_context_unload_module( pulse.context(), m_module, nullptr, nullptr ) ) )
+        std::cerr << "cannot unload the equalizer sink : " << pulse.error() << std::endl;
+    m_module = invalid_module;
+}
+
+void output_equalizer::_run()
+{
+    thread_policy::name_current_thread( "dz-eq" );
+
+#if defined(DEEZZY_EQ_SSE)
+    // filter tails decaying into denormals would stall the SSE units (NEON flushes them to zero)
+    _mm_setcsr( _mm_getcsr() | 0x8040 );
+#endif
+
+    const pa_sample_spec spec = { PA_SAMPLE_FLOAT32NE, sample_rate, 2 };
+    const auto block_bytes = static_cast<uint32_t>( block_frames * 2 * sizeof( float ) );
+
+    // one fragment per block on capture, and a few blocks queued on playback to ride scheduling jitter
+    pa_buffer_attr capture_attr;
+    capture_attr.maxlength = static_cast<uint32_t>( -1 );
+    capture_attr.fragsize = block_bytes;
+    capture_attr.tlength = capture_attr.prebuf = capture_attr.minreq = static_cast<uint32_t>( -1 );
+
+    pa_buffer_attr playback_attr;
+    playback_attr.maxlength = static_cast<uint32_t>( -1 );
+    playback_attr.tlength = 3 * block_bytes;
+    playback_attr.prebuf = 2 * block_bytes;
+    playback_attr.minreq = block_bytes;
+    playback_attr.fragsize = static_cast<uint32_t>( -1 );
+
+    int error = 0;
+    auto monitor = std::string( sink_name ) + ".monitor";
+    auto* capture = pa_simple_new( nullptr, "deezzy", PA_STREAM_RECORD, monitor.c_str(),
+                                   "equalizer capture", &spec, nullptr, &capture_attr, &error );
+    auto* playback = capture ? pa_simple_new( nullptr, "deezzy", PA_STREAM_PLAYBACK, m_output_sink.c_str(),
+                                              "equalizer", &spec, nullptr, &playback_attr, &error ) : nullptr;
+    if ( !playback )
+    {
+        std::cerr << "cannot open the equalizer streams : " << pa_strerror( error ) << std::endl;
+        if ( capture )
+            pa_simple_free( capture );
+        return;
+    }
+
+    std::unique_ptr<biquad_cascade> cascade;
+    std::unique_ptr<biquad_cascade> fading;
+    size_t fade_position = 0;
+
+    std::vector<float> block( block_frames * 2 );
+    std::vector<float> previous( block_frames * 2, 0.f );
+    std::vector<float> faded( block_frames * 2 );
+
+    double busy = 0.;
+    double processed = 0.;
+    int max_block_us = 0;
+
+    while ( m_running )
+    {
+        if ( pa_simple_read( capture, block.data(), block.size() * sizeof( float ), &error ) < 0 )
+        {
+            std::cerr << "equalizer read failed : " << pa_strerror( error ) << std::endl;
+            break;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        // one switch at a time : a preset posted during a fade waits for its end
+        if ( !fading )
+        {
+            if ( auto* next = m_pending.exchange( nullptr ) )
+            {
+                next->process( previous.data(), faded.data(), block_frames );
+                fading = std::move( cascade );
+                cascade.reset( next );
+                fade_position = 0;
+            }
+        }
+
+        std::copy( block.begin(), block.end(), previous.begin() );
+
+        if ( fading )
+            fading->process( block.data(), faded.data(), block_frames );
+        if ( cascade )
+            cascade->process( block.data(), block.data(), block_frames );
+
+        if ( fading )
+        {
+            for ( size_t i = 0; i < block_frames; i++ )
+            {
+                auto t = std::min( 1.f, static_cast<float>( fade_position + i ) / fade_frames );
+                block[2 * i] = faded[2 * i] + t * ( block[2 * i] - faded[2 * i] );
+                block[2 * i + 1] = faded[2 * i + 1] + t * ( block[2 * i + 1] - faded[2 * i + 1] );
+            }
+
+            fade_position += block_frames;
+            if ( fade_position >= fade_frames )
+                delete m_retired.exchange( fading.release() );  // only frees here when switches pile up
+        }
+
+        auto elapsed = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+        busy += elapsed;
+        processed += static_cast<double>( block_frames ) / sample_rate;
+        max_block_us = std::max( max_block_us, static_cast<int>( elapsed * 1e6 ) );
+
+        // figures are refreshed every 10s of audio
+        if ( processed >= 10. )
+        {
+            m_cpu_load = static_cast<float>( busy / processed );
+            m_max_block_us = max_block_us;
+            m_latency_ms = static_cast<int>( ( pa_simple_get_latency( capture, nullptr ) + pa_simple_get_latency( playback, nullptr ) ) / 1000 );
+            busy = processed = 0.;
+            max_block_us = 0;
+        }
+
+        if ( pa_simple_write( playback, block.data(), block.size() * sizeof( float ), &error ) < 0 )
+        {
+            std::cerr << "equalizer write failed : " << pa_strerror( error ) << std::endl;
+            break;
+        }
+    }
+
+    pa_simple_free( playback );
+    pa_simple_free( capture );
+}
@@ -0,0 +1,182 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * One equalizer band, designed with the audio EQ cookbook formulas (gain is ignored by the pass filters).
+ */
+struct eq_band
+{
+    enum class shape
+    {
+        peak,
+        low_shelf,
+        high_shelf,
+        low_pass,
+        high_pass
+    };
+
+    shape type;
+    float frequency_hz;
+    float gain_db;
+    float q;
+};
+
+/*
+ * Room correction of one zone of the venue : a pre-gain, to keep headroom for boosts, and its bands.
+ */
+struct eq_preset
+{
+    std::string zone;
+    float preamp_db;
+    std::vector<eq_band> bands;
+};
+
+/*
+ * Cascade of biquads applied to interleaved stereo frames, both channels being filtered in parallel
+ * SIMD lanes (NEON on ARM, SSE2 on x86, scalar otherwise). Blocks go through one stage after the
+ * other, so that each stage keeps its coefficients and states in registers.
+ */
+class biquad_cascade
+{
+public:
+    static constexpr size_t max_bands = 12;
+
+    biquad_cascade( const eq_preset& preset, unsigned int sample_rate );
+
+    void reset();
+
+    // output may be the input
+    void process( const float* input, float* output, size_t frame_count );
+    // reference kernel, to benchmark and check the SIMD ones against
+    void process_scalar( const float* input, float* output, size_t frame_count );
+
+    // "neon", "sse2" or "scalar"
+    static const char* kernel();
+
+private:
+    struct biquad
+    {
+        float b0, b1, b2, a1, a2;
+    };
+
+    static biquad _design( const eq_band& band, unsigned int sample_rate );
+
+private:
+    biquad m_stages[max_bands];
+    size_t m_stage_count = 0;
+
+    // transposed direct form II states, per stage and per channel
+    float m_state[max_bands][2][2] = {};
+};
+
+/*
+ * Equalizes the player output : the player plays into a null sink created by the application, whose
+ * monitor is captured, filtered with the preset of the current zone and played to the actual output
+ * sink, in a real-time thread. Presets are switched without glitch by crossfading the old and the
+ * new cascade outputs, the new cascade being warmed up on the previous block first.
+ *
+ * Presets file format, one band per line, bands of a zone being cascaded in order :
+ *
+ *      # zone      type        frequency_hz    gain_db     q
+ *      terrace     preamp      -               -3
+ *      terrace     high_pass   40              0           0.7
+ *      terrace     peak        125             -6          1.4
+ *      terrace     high_shelf  6000            3           0.7
+ *
+ * with types among preamp, peak, low_shelf, high_shelf, low_pass and high_pass. A "flat" preset
+ * (no band) is always available.
+ */
+class output_equalizer
+{
+public:
+    // the player is routed here through PULSE_SINK
+    static constexpr const char* sink_name = "deezzy_eq";
+    static constexpr size_t block_frames = 480;     /*10ms*/
+    static constexpr size_t fade_frames = 2400;     /*50ms*/
+
+    struct infos
+    {
+        std::string preset;
+        int bands;
+        int switches;
+        float cpu_load;         ///< processing time over audio time
+        int max_block_us;       ///< worst block processing time, over a 10ms budget
+        int latency_ms;         ///< capture and playback buffering added by the stage
+        const char* kernel;
+    };
+
+    // the flat preset comes first, followed by the zones of the file (none when it is missing)
+    static std::vector<eq_preset> load_presets( const std::string& presets_file );
+
+    // the zone of the previous run is restored, the first zone of the file being the default
+    output_equalizer( const std::string& cache_path, std::vector<eq_preset> presets );
+    ~output_equalizer();
+
+    // false when the pipeline could not be set up : the player should then keep its default sink
+    bool active() const { return m_module != invalid_module; }
+
+    std::vector<std::string> presets() const;
+    bool set_preset( const std::string& zone );
+
+    infos current_infos();
+
+private:
+    static constexpr uint32_t invalid_module = static_cast<uint32_t>( -1 );
+
+    bool _load_sink();
+    void _unload_sink();
+    void _run();
+
+private:
+    const std::string m_active_file;
+    const std::vector<eq_preset> m_presets;
+
+    std::string m_output_sink;
+    uint32_t m_module = invalid_module;
+
+    std::mutex m_mutex;
+    size_t m_preset = 0;
+    int m_switches = 0;
+
+    // handed to the audio thread, and back to be freed outside of it
+    std::atomic<biquad_cascade*> m_pending{ nullptr };
+    std::atomic<biquad_cascade*> m_retired{ nullptr };
+
+    std::atomic<bool> m_running{ true };
+    std::atomic<float> m_cpu_load{ 0.f };
+    std::atomic<int> m_max_block_us{ 0 };
+    std::atomic<int> m_latency_ms{ 0 };
+
+    std::thread m_thread;
+};
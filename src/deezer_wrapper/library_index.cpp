@@ -0,0 +1,567 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "library_index.h"
+#include "memory_profile.h"
+#include "thread_policy.h"
+
+#include "third_party/json.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+// 02 : 64 bits ids, older stores are rebuilt by the next sync
+constexpr char store_magic[8] = "DZLIB02";
+#ifdef DEEZZY_LOW_MEMORY
+constexpr int page_size = 100;
+#else
+constexpr int page_size = 1000;
+#endif
+
+struct endpoint
+{
+    const char* path;
+    library_index::kind type;
+};
+
+// synced in this order, which is also the results order (a few artists/albums before many tracks)
+const endpoint endpoints[] = {
+    { "user/me/artists", library_index::kind::artist },
+    { "user/me/albums", library_index::kind::album },
+    { "user/me/playlists", library_index::kind::playlist },
+    { "user/me/tracks", library_index::kind::track },
+};
+
+// ASCII is lower cased and punctuation becomes a word separator, UTF-8 sequences are kept as is
+std::string normalize( const std::string& text )
+{
+    std::string normalized;
+    normalized.reserve( text.size() );
+    for ( unsigned char c : text )
+    {
+        if ( c >= 0x80 )
+            normalized += static_cast<char>( c );
+        else
+            normalized += std::isalnum( c ) ? static_cast<char>( std::tolower( c ) ) : ' ';
+    }
+    return normalized;
+}
+
+std::vector<std::string> split_words( const std::string& normalized )
+{
+    std::vector<std::string> words;
+    size_t begin = 0;
+    while ( ( begin = normalized.find_first_not_of( ' ', begin ) ) != std::string::npos )
+    {
+        auto end = std::min( normalized.find( ' ', begin ), normalized.size() );
+        words.push_back( normalized.substr( begin, end - begin ) );
+        begin = end;
+    }
+    return words;
+}
+
+// trigrams use the 24 low bits, word prefixes of 1 and 2 characters are tagged in the high byte
+inline uint32_t trigram_key( const char* p )
+{
+    return ( static_cast<uint8_t>( p[0] ) << 16 ) | ( static_cast<uint8_t>( p[1] ) << 8 ) | static_cast<uint8_t>( p[2] );
+}
+
+inline uint32_t prefix_key( const std::string& word, size_t length )
+{
+    return length == 1 ? 0x01000000u | static_cast<uint8_t>( word[0] )
+                       : 0x02000000u | ( static_cast<uint8_t>( word[0] ) << 8 ) | static_cast<uint8_t>( word[1] );
+}
+
+// first position in [begin, end) not lower than value, probing exponentially from begin
+const uint32_t* gallop( const uint32_t* begin, const uint32_t* end, uint32_t value )
+{
+    size_t step = 1;
+    auto low = begin;
+    while ( low + step < end && low[step] < value )
+    {
+        low += step;
+        step *= 2;
+    }
+    return std::lower_bound( low, std::min( low + step + 1, end ), value );
+}
+
+template<typename T>
+void write_column( std::ofstream& out, const std::vector<T>& column )
+{
+    out.write( reinterpret_cast<const char*>( column.data() ), column.size() * sizeof( T ) );
+}
+
+template<typename T>
+bool read_column( std::ifstream& in, std::vector<T>& column, size_t count )
+{
+    column.resize( count );
+    return static_cast<bool>( in.read( reinterpret_cast<char*>( column.data() ), count * sizeof( T ) ) );
+}
+
+} // namespace
+
+class library_index::snapshot
+{
+public:
+    // columns
+    std::vector<uint8_t> kinds;
+    std::vector<int64_t> ids;
+    std::vector<uint32_t> title_offsets{ 0 };
+    std::string titles;
+    std::vector<uint32_t> subtitle_offsets{ 0 };
+    std::string subtitles;
+
+    // normalized text of each row, to confirm trigram candidates
+    std::vector<uint32_t> text_offsets{ 0 };
+    std::string texts;
+
+    // postings : rows[offsets[i]..offsets[i+1]) contain keys[i]
+    std::vector<uint32_t> keys;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> rows;
+
+    size_t size() const { return ids.size(); }
+
+    void append( const item& i )
+    {
+        kinds.push_back( static_cast<uint8_t>( i.type ) );
+        ids.push_back( i.id );
+        titles += i.title;
+        title_offsets.push_back( static_cast<uint32_t>( titles.size() ) );
+        subtitles += i.subtitle;
+        subtitle_offsets.push_back( static_cast<uint32_t>( subtitles.size() ) );
+    }
+
+    item at( uint32_t row ) const
+    {
+        return { static_cast<kind>( kinds[row] ), ids[row],
+                 titles.substr( title_offsets[row], title_offsets[row + 1] - title_offsets[row] ),
+                 subtitles.substr( subtitle_offsets[row], subtitle_offsets[row + 1] - subtitle_offsets[row] ) };
+    }
+
+    bool text_contains( uint32_t row, const std::string& word ) const
+    {
+        auto begin = texts.begin() + text_offsets[row];
+        auto end = texts.begin() + text_offsets[row + 1];
+        return std::search( begin, end, word.begin(), word.end() ) != end;
+    }
+
+    std::pair<const uint32_t*, const uint32_t*> postings( uint32_t key ) const
+    {
+        auto itr = std::lower_bound( keys.begin(), keys.end(), key );
+        if ( itr == keys.end() || *itr != key )
+            return { nullptr, nullptr };
+        auto k = itr - keys.begin();
+        return { rows.data() + offsets[k], rows.data() + offsets[k + 1] };
+    }
+
+    void index()
+    {
+        std::vector<uint64_t> pairs;
+        auto add = [&pairs]( uint32_t key, uint32_t row ) {
+            pairs.push_back( ( static_cast<uint64_t>( key ) << 32 ) | row );
+        };
+
+        for ( uint32_t row = 0; row < size(); row++ )
+        {
+            auto text = normalize( titles.substr( title_offsets[row], title_offsets[row + 1] - title_offsets[row] ) ) + " " +
+                        normalize( subtitles.substr( subtitle_offsets[row], subtitle_offsets[row + 1] - subtitle_offsets[row] ) );
+            texts += text;
+            text_offsets.push_back( static_cast<uint32_t>( texts.size() ) );
+
+            for ( const auto& word : split_words( text ) )
+            {
+                add( prefix_key( word, 1 ), row );
+                if ( word.size() >= 2 )
+                    add( prefix_key( word, 2 ), row );
+                for ( size_t i = 0; i + 3 <= word.size(); i++ )
+                    add( trigram_key( word.data() + i ), row );
+            }
+        }
+
+        std::sort( pairs.begin(), pairs.end() );
+        pairs.erase( std::unique( pairs.begin(), pairs.end() ), pairs.end() );
+
+        rows.reserve( pairs.size() );
+        for ( auto pair : pairs )
+        {
+            auto key = static_cast<uint32_t>( pair >> 32 );
+            if ( keys.empty() || keys.back() != key )
+            {
+                keys.push_back( key );
+                offsets.push_back( static_cast<uint32_t>( rows.size() ) );
+            }
+            rows.push_back( static_cast<uint32_t>( pair ) );
+        }
+        offsets.push_back( static_cast<uint32_t>( rows.size() ) );
+    }
+
+    bool save( const std::string& file ) const
+    {
+        auto tmp = file + ".tmp";
+        {
+            std::ofstream out( tmp, std::ios::binary | std::ios::trunc );
+            uint32_t header[3] = { static_cast<uint32_t>( size() ), static_cast<uint32_t>( titles.size() ), static_cast<uint32_t>( subtitles.size() ) };
+            out.write( store_magic, sizeof( store_magic ) );
+            out.write( reinterpret_cast<const char*>( header ), sizeof( header ) );
+            write_column( out, kinds );
+            write_column( out, ids );
+            write_column( out, title_offsets );
+            out.write( titles.data(), titles.size() );
+            write_column( out, subtitle_offsets );
+            out.write( subtitles.data(), subtitles.size() );
+            if ( !out )
+                return false;
+        }
+        return std::rename( tmp.c_str(), file.c_str() ) == 0;
+    }
+
+    bool load( const std::string& file )
+    {
+        std::ifstream in( file, std::ios::binary );
+
+        char magic[sizeof( store_magic )];
+        uint32_t header[3];
+        if ( !in.read( magic, sizeof( magic ) ) || std::memcmp( magic, store_magic, sizeof( magic ) ) != 0 ||
+             !in.read( reinterpret_cast<char*>( header ), sizeof( header ) ) )
+            return false;
+
+        titles.resize( header[1] );
+        subtitles.resize( header[2] );
+        return read_column( in, kinds, header[0] ) && read_column( in, ids, header[0] ) &&
+               read_column( in, title_offsets, header[0] + 1 ) && in.read( &titles[0], titles.size() ) &&
+               read_column( in, subtitle_offsets, header[0] + 1 ) && in.read( &subtitles[0], subtitles.size() );
+    }
+};
+
+struct library_index::sync_state
+{
+    std::string store_file;
+    unsigned int generation;
+    size_t endpoint = 0;
+    int index = 0;
+    std::vector<item> items;
+};
+
+std::string library_index::item::content_url() const
+{
+    switch( type )
+    {
+        case kind::artist:
+            return "dzradio:///artist-" + std::to_string( id );
+        case kind::album:
+            return "dzmedia:///album/" + std::to_string( id );
+        case kind::playlist:
+            return "dzmedia:///playlist/" + std::to_string( id );
+        case kind::track:
+        default:
+            return "dzmedia:///track/" + std::to_string( id );
+    }
+}
+
+library_index::item library_index::results::at( size_t i ) const
+{
+    return m_snapshot->at( m_rows[i] );
+}
+
+library_index::library_index( const std::string& store_file, page_fetcher fetcher )
+    : m_store_file( store_file ), m_fetcher( fetcher ), m_snapshot( std::make_shared<snapshot>() )
+{
+    if ( m_store_file.empty() )
+        return;
+
+    _load( false );
+}
+
+library_index::~library_index()
+{
+    if ( m_loader.joinable() )
+        m_loader.join();
+}
+
+void library_index::build( std::vector<item> items )
+{
+    std::string store_file;
+    unsigned int generation;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        store_file = m_store_file;
+        generation = m_generation;
+    }
+    _build( std::move( items ), store_file, generation );
+}
+
+void library_index::sync()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( m_syncing || !m_fetcher )
+            return;
+        m_syncing = true;
+    }
+
+    auto state = std::make_shared<sync_state>();
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        state->store_file = m_store_file;
+        state->generation = m_generation;
+    }
+
+    std::cout << "LIBRARY sync started" << std::endl;
+    _fetch_page( state );
+}
+
+void library_index::open( const std::string& store_file )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_store_file = store_file;
+        m_generation++;
+        m_syncing = false;
+    }
+
+    if ( m_loader.joinable() )
+        m_loader.join();
+    _load( true );
+}
+
+void library_index::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_generation++;
+        m_syncing = false;
+    }
+
+    if ( m_loader.joinable() )
+        m_loader.join();
+}
+
+library_index::results library_index::search( const std::string& query, size_t max_results ) const
+{
+    auto start = std::chrono::steady_clock::now();
+
+    results found;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        found.m_snapshot = m_snapshot;
+    }
+    const auto& s = *found.m_snapshot;
+
+    // short words match word prefixes, longer ones match anywhere through their trigrams
+    auto words = split_words( normalize( query ) );
+    if ( words.empty() )
+        return found;
+
+    std::vector<std::pair<const uint32_t*, const uint32_t*>> lists;
+    for ( const auto& word : words )
+    {
+        if ( word.size() < 3 )
+            lists.push_back( s.postings( prefix_key( word, word.size() ) ) );
+        else
+            for ( size_t i = 0; i + 3 <= word.size(); i++ )
+                lists.push_back( s.postings( trigram_key( word.data() + i ) ) );
+    }
+
+    // walks the shortest list, galloping through the others, and stops as soon as enough rows matched
+    std::sort( lists.begin(), lists.end(), []( const std::pair<const uint32_t*, const uint32_t*>& l,
+                                               const std::pair<const uint32_t*, const uint32_t*>& r ) {
+        return l.second - l.first < r.second - r.first;
+    } );
+
+    for ( auto candidate = lists[0].first; candidate != lists[0].second && found.m_rows.size() < max_results; ++candidate )
+    {
+        auto row = *candidate;
+        auto in_all = std::all_of( lists.begin() + 1, lists.end(), [row]( std::pair<const uint32_t*, const uint32_t*>& list ) {
+            list.first = gallop( list.first, list.second, row );
+            return list.first != list.second && *list.first == row;
+        } );
+        if ( !in_all )
+            continue;
+
+        auto confirmed = std::all_of( words.begin(), words.end(), [&s, row]( const std::string& word ) {
+            return word.size() <= 3 || s.text_contains( row, word );
+        } );
+        if ( confirmed )
+            found.m_rows.push_back( row );
+    }
+
+    found.m_micros = static_cast<int>( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count() );
+    return found;
+}
+
+size_t library_index::size() const
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_snapshot->size();
+}
+
+void library_index::set_update_callback( std::function<void()> callback )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_update_callback = callback;
+}
+
+void library_index::_build( std::vector<item> items, const std::string& store_file, unsigned int generation )
+{
+    memory_profile::scope tagged( memory_profile::tag::library );
+
+    auto built = std::make_shared<snapshot>();
+    for ( const auto& i : items )
+        built->append( i );
+    built->index();
+
+    if ( !store_file.empty() && !built->save( store_file ) )
+        std::cerr << "cannot store library in " << store_file << std::endl;
+
+    _publish( built, generation );
+}
+
+void library_index::_load( bool publish_empty )
+{
+    std::string store_file;
+    unsigned int generation;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        store_file = m_store_file;
+        generation = m_generation;
+    }
+
+    m_loader = std::thread( [this, store_file, generation, publish_empty]() {
+        thread_policy::name_current_thread( "dz-library" );
+
+        auto loaded = std::make_shared<snapshot>();
+        if ( !loaded->load( store_file ) )
+        {
+            // an empty library rather than the previous user's
+            if ( publish_empty )
+                _publish( std::make_shared<snapshot>(), generation );
+            return;
+        }
+
+        loaded->index();
+        std::cout << "LIBRARY loaded " << loaded->size() << " items" << std::endl;
+        _publish( loaded, generation );
+    } );
+}
+
+void library_index::_fetch_page( std::shared_ptr<sync_state> state )
+{
+    {
+        // the store was switched meanwhile
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( state->generation != m_generation )
+            return;
+    }
+
+    if ( state->endpoint == sizeof( endpoints ) / sizeof( endpoints[0] ) )
+    {
+        std::cout << "LIBRARY synced " << state->items.size() << " items" << std::endl;
+        _build( std::move( state->items ), state->store_file, state->generation );
+
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( state->generation == m_generation )
+            m_syncing = false;
+        return;
+    }
+
+    const auto& current = endpoints[state->endpoint];
+    auto path = std::string( current.path ) + "?limit=" + std::to_string( page_size ) + "&index=" + std::to_string( state->index );
+
+    m_fetcher( path, [this, state, current]( bool ok, const std::string& body ) {
+        size_t count = 0;
+        int total = 0;
+        try
+        {
+            if ( !ok )
+                throw std::runtime_error( "request failed" );
+
+            using json = nlohmann::json;
+            memory_profile::scope tagged( memory_profile::tag::library );
+
+            // pages carry many unused fields (pictures, links, md5...) : only the indexed ones are kept
+            auto page = json::parse( body, []( int, json::parse_event_t event, json& parsed ) {
+                if ( event != json::parse_event_t::key )
+                    return true;
+                const auto& key = parsed.get_ref<const std::string&>();
+                return key == "data" || key == "total" || key == "id" || key == "title" || key == "name"
+                    || key == "artist" || key == "creator";
+            } );
+            total = page.value( "total", 0 );
+            for ( const auto& data : page.at( "data" ) )
+            {
+                item i{ current.type, data.at( "id" ).get<int64_t>(), "", "" };
+                if ( current.type == kind::artist )
+                    i.title = data.value( "name", "" );
+                else
+                    i.title = data.value( "title", "" );
+
+                if ( current.type == kind::playlist && data.count( "creator" ) )
+                    i.subtitle = data["creator"].value( "name", "" );
+                else if ( data.count( "artist" ) )
+                    i.subtitle = data["artist"].value( "name", "" );
+
+                state->items.push_back( std::move( i ) );
+                count++;
+            }
+        }
+        catch( std::exception& e )
+        {
+            std::cerr << "library sync aborted on " << current.path << " : " << e.what() << std::endl;
+            std::lock_guard<std::mutex> lock( m_mutex );
+            if ( state->generation == m_generation )
+                m_syncing = false;
+            return;
+        }
+
+        state->index += static_cast<int>( count );
+        if ( count == 0 || state->index >= total )
+        {
+            state->endpoint++;
+            state->index = 0;
+        }
+        _fetch_page( state );
+    } );
+}
+
+void library_index::_publish( std::shared_ptr<const snapshot> published, unsigned int generation )
+{
+    std::function<void()> callback;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( generation != m_generation )
+            return;
+        m_snapshot = published;
+        callback = m_update_callback;
+    }
+    if ( callback )
+        callback();
+}
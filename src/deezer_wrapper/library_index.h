@@ -0,0 +1,126 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Local copy of the user library (favourite artists, albums, playlists and tracks) kept in a compact
+ * columnar store on disk, with an in-memory trigram (and short word prefix) index answering
+ * type-ahead queries. The library is loaded and re-indexed off the calling thread, and searches run
+ * against immutable snapshots so that they never wait on a sync.
+ */
+class library_index
+{
+public:
+    enum class kind : uint8_t
+    {
+        artist,
+        album,
+        playlist,
+        track
+    };
+
+    struct item
+    {
+        kind type;
+        int64_t id;
+        std::string title;
+        std::string subtitle;
+
+        std::string content_url() const;
+    };
+
+    class snapshot;
+
+    // search results, rows being materialized one at a time on demand
+    class results
+    {
+    public:
+        size_t size() const { return m_rows.size(); }
+        item at( size_t i ) const;
+        int micros() const { return m_micros; }
+
+    private:
+        friend class library_index;
+        std::shared_ptr<const snapshot> m_snapshot;
+        std::vector<uint32_t> m_rows;
+        int m_micros = 0;
+    };
+
+    using page_callback = std::function<void( bool ok, const std::string& body )>;
+    using page_fetcher = std::function<void( const std::string& path, page_callback callback )>;
+
+    // an empty store file keeps the library in memory only (e.g. benchmarks)
+    library_index( const std::string& store_file, page_fetcher fetcher );
+    ~library_index();
+
+    // indexes the given items, persists them and publishes the new snapshot
+    void build( std::vector<item> items );
+
+    // pulls the whole library from the Web API, then persists and re-indexes it
+    void sync();
+
+    // switches to another store (e.g. another user), loaded off the calling thread : searches answer
+    // from the current snapshot until then, and a sync in flight is dropped
+    void open( const std::string& store_file );
+
+    // drops the sync in flight and waits for the store loader : searches still answer from the current
+    // snapshot, and the next sync() starts over
+    void stop();
+
+    results search( const std::string& query, size_t max_results ) const;
+    size_t size() const;
+
+    // called (from a background thread) each time a new snapshot is published
+    void set_update_callback( std::function<void()> callback );
+
+private:
+    struct sync_state;
+
+    void _build( std::vector<item> items, const std::string& store_file, unsigned int generation );
+    void _load( bool publish_empty );
+    void _fetch_page( std::shared_ptr<sync_state> state );
+    void _publish( std::shared_ptr<const snapshot> snapshot, unsigned int generation );
+
+private:
+    std::string m_store_file;
+    page_fetcher m_fetcher;
+
+    mutable std::mutex m_mutex;
+    std::shared_ptr<const snapshot> m_snapshot;
+    std::function<void()> m_update_callback;
+    bool m_syncing = false;
+    unsigned int m_generation = 0;      ///< store switches
+
+    std::thread m_loader;
+};
@@ -0,0 +1,437 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "loudness.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DEEZZY_LOUDNESS_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DEEZZY_LOUDNESS_SSE
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+constexpr float absolute_gate_lufs = -70.f;
+constexpr float reference_lufs = -14.f;     // full volume track loudness played at base volume
+constexpr size_t short_term_blocks = 30;    // 3s of 100ms blocks
+constexpr int min_track_blocks = 30;        // do not trust (nor cache) less than 3s of audio
+constexpr size_t max_cached_tracks = 20000; // about 300kB of cache file, the most recent measures kept
+
+inline float to_lufs( double mean_square )
+{
+    return mean_square > 0. ? -0.691f + 10.f * static_cast<float>( std::log10( mean_square ) ) : -std::numeric_limits<float>::infinity();
+}
+
+} // namespace
+
+k_weighting_filter::k_weighting_filter( unsigned int sample_rate )
+{
+    // BS.1770 filters, re-derived for the given sample rate
+    const double pi = 3.14159265358979323846;
+
+    {
+        const double f0 = 1681.974450955533;
+        const double G  = 3.999843853973347;
+        const double Q  = 0.7071752369554196;
+
+        const double K  = std::tan( pi * f0 / sample_rate );
+        const double Vh = std::pow( 10.0, G / 20.0 );
+        const double Vb = std::pow( Vh, 0.4996667741545416 );
+        const double a0 = 1.0 + K / Q + K * K;
+
+        m_shelf.b0 = static_cast<float>( ( Vh + Vb * K / Q + K * K ) / a0 );
+        m_shelf.b1 = static_cast<float>( 2.0 * ( K * K - Vh ) / a0 );
+        m_shelf.b2 = static_cast<float>( ( Vh - Vb * K / Q + K * K ) / a0 );
+        m_shelf.a1 = static_cast<float>( 2.0 * ( K * K - 1.0 ) / a0 );
+        m_shelf.a2 = static_cast<float>( ( 1.0 - K / Q + K * K ) / a0 );
+    }
+    {
+        const double f0 = 38.13547087602444;
+        const double Q  = 0.5003270373238773;
+
+        const double K  = std::tan( pi * f0 / sample_rate );
+        const double a0 = 1.0 + K / Q + K * K;
+
+        m_highpass.b0 = 1.f;
+        m_highpass.b1 = -2.f;
+        m_highpass.b2 = 1.f;
+        m_highpass.a1 = static_cast<float>( 2.0 * ( K * K - 1.0 ) / a0 );
+        m_highpass.a2 = static_cast<float>( ( 1.0 - K / Q + K * K ) / a0 );
+    }
+}
+
+void k_weighting_filter::reset()
+{
+    std::fill( &m_state[0][0][0], &m_state[0][0][0] + 8, 0.f );
+}
+
+#if defined(DEEZZY_LOUDNESS_NEON)
+
+double k_weighting_filter::process( const float* frames, size_t frame_count )
+{
+    // lane 0 : left channel, lane 1 : right channel
+    auto s1 = vld1_f32( m_state[0][0] );
+    auto s2 = vld1_f32( m_state[0][1] );
+    auto t1 = vld1_f32( m_state[1][0] );
+    auto t2 = vld1_f32( m_state[1][1] );
+
+    const auto sb0 = vdup_n_f32( m_shelf.b0 ), sb1 = vdup_n_f32( m_shelf.b1 ), sb2 = vdup_n_f32( m_shelf.b2 );
+    const auto sa1 = vdup_n_f32( m_shelf.a1 ), sa2 = vdup_n_f32( m_shelf.a2 );
+    const auto hb0 = vdup_n_f32( m_highpass.b0 ), hb1 = vdup_n_f32( m_highpass.b1 ), hb2 = vdup_n_f32( m_highpass.b2 );
+    const auto ha1 = vdup_n_f32( m_highpass.a1 ), ha2 = vdup_n_f32( m_highpass.a2 );
+
+    auto acc = vdup_n_f32( 0.f );
+
+    for ( size_t i = 0; i < frame_count; i++ )
+    {
+        auto x = vld1_f32( frames + 2 * i );
+
+        auto y = vmla_f32( s1, sb0, x );
+        s1 = vmls_f32( vmla_f32( s2, sb1, x ), sa1, y );
+        s2 = vmls_f32( vmul_f32( sb2, x ), sa2, y );
+
+        auto z = vmla_f32( t1, hb0, y );
+        t1 = vmls_f32( vmla_f32( t2, hb1, y ), ha1, z );
+        t2 = vmls_f32( vmul_f32( hb2, y ), ha2, z );
+
+        acc = vmla_f32( acc, z, z );
+    }
+
+    vst1_f32( m_state[0][0], s1 );
+    vst1_f32( m_state[0][1], s2 );
+    vst1_f32( m_state[1][0], t1 );
+    vst1_f32( m_state[1][1], t2 );
+
+    return static_cast<double>( vget_lane_f32( acc, 0 ) ) + vget_lane_f32( acc, 1 );
+}
+
+#elif defined(DEEZZY_LOUDNESS_SSE)
+
+double k_weighting_filter::process( const float* frames, size_t frame_count )
+{
+    // lanes 0 & 1 : left & right channels, upper lanes unused
+    auto load2 = []( const float* p ) { return _mm_castsi128_ps( _mm_loadl_epi64( reinterpret_cast<const __m128i*>( p ) ) ); };
+    auto store2 = []( float* p, __m128 v ) { _mm_storel_epi64( reinterpret_cast<__m128i*>( p ), _mm_castps_si128( v ) ); };
+
+    auto s1 = load2( m_state[0][0] );
+    auto s2 = load2( m_state[0][1] );
+    auto t1 = load2( m_state[1][0] );
+    auto t2 = load2( m_state[1][1] );
+
+    const auto sb0 = _mm_set1_ps( m_shelf.b0 ), sb1 = _mm_set1_ps( m_shelf.b1 ), sb2 = _mm_set1_ps( m_shelf.b2 );
+    const auto sa1 = _mm_set1_ps( m_shelf.a1 ), sa2 = _mm_set1_ps( m_shelf.a2 );
+    const auto hb0 = _mm_set1_ps( m_highpass.b0 ), hb1 = _mm_set1_ps( m_highpass.b1 ), hb2 = _mm_set1_ps( m_highpass.b2 );
+    const auto ha1 = _mm_set1_ps( m_highpass.a1 ), ha2 = _mm_set1_ps( m_highpass.a2 );
+
+    auto acc = _mm_setzero_ps();
+
+    for ( size_t i = 0; i < frame_count; i++ )
+    {
+        auto x = load2( frames + 2 * i );
+
+        auto y = _mm_add_ps( s1, _mm_mul_ps( sb0, x ) );
+        s1 = _mm_sub_ps( _mm_add_ps( s2, _mm_mul_ps( sb1, x ) ), _mm_mul_ps( sa1, y ) );
+        s2 = _mm_sub_ps( _mm_mul_ps( sb2, x ), _mm_mul_ps( sa2, y ) );
+
+        auto z = _mm_add_ps( t1, _mm_mul_ps( hb0, y ) );
+        t1 = _mm_sub_ps( _mm_add_ps( t2, _mm_mul_ps( hb1, y ) ), _mm_mul_ps( ha1, z ) );
+        t2 = _mm_sub_ps( _mm_mul_ps( hb2, y ), _mm_mul_ps( ha2, z ) );
+
+        acc = _mm_add_ps( acc, _mm_mul_ps( z, z ) );
+    }
+
+    store2( m_state[0][0], s1 );
+    store2( m_state[0][1], s2 );
+    store2( m_state[1][0], t1 );
+    store2( m_state[1][1], t2 );
+
+    float sums[4];
+    _mm_storeu_ps( sums, acc );
+    return static_cast<double>( sums[0] ) + sums[1];
+}
+
+#else
+
+double k_weighting_filter::process( const float* frames, size_t frame_count )
+{
+    double acc = 0.;
+
+    for ( size_t c = 0; c < 2; c++ )
+    {
+        auto& s = m_state[0];
+        auto& t = m_state[1];
+
+        for ( size_t i = 0; i < frame_count; i++ )
+        {
+            auto x = frames[2 * i + c];
+
+            auto y = s[0][c] + m_shelf.b0 * x;
+            s[0][c] = s[1][c] + m_shelf.b1 * x - m_shelf.a1 * y;
+            s[1][c] = m_shelf.b2 * x - m_shelf.a2 * y;
+
+            auto z = t[0][c] + m_highpass.b0 * y;
+            t[0][c] = t[1][c] + m_highpass.b1 * y - m_highpass.a1 * z;
+            t[1][c] = m_highpass.b2 * y - m_highpass.a2 * z;
+
+            acc += z * z;
+        }
+    }
+
+    return acc;
+}
+
+#endif
+
+loudness_meter::loudness_meter( const std::string& source, block_callback callback )
+    : m_filter( audio_monitor::sample_rate ), m_callback( callback ),
+      m_monitor( "loudness meter", source, block_frames, [this]( const float* frames, size_t frame_count ) {
+          m_callback( m_filter.process( frames, frame_count ) / frame_count );
+      } )
+{
+}
+
+float loudness_meter::cpu_load() const
+{
+    return m_monitor.cpu_load();
+}
+
+loudness_normalizer::loudness_normalizer( const std::string& cache_path, int base_volume, volume_setter setter )
+    : m_cache_file( cache_path + "/loudness.cache" ), m_base_volume( base_volume ), m_setter( setter ),
+      m_volume( base_volume ), m_target_volume( base_volume )
+{
+    _load_cache();
+}
+
+loudness_normalizer::~loudness_normalizer()
+{
+    set_active( false );
+}
+
+void loudness_normalizer::set_active( bool active )
+{
+    std::lock_guard<std::mutex> lock( m_meter_mutex );
+    if ( active == static_cast<bool>( m_meter ) )
+        return;
+
+    if ( active )
+    {
+        m_meter = std::make_unique<loudness_meter>( audio_monitor::own_output, [this]( double mean_square ) {
+            _on_block( mean_square );
+        } );
+    }
+    else
+    {
+        m_meter.reset();
+    }
+}
+
+unsigned long loudness_normalizer::blocks() const
+{
+    return m_blocks;
+}
+
+void loudness_normalizer::on_track_started( long long track_id )
+{
+    int volume = -1;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+
+        if ( m_track_id && m_track_blocks >= min_track_blocks )
+        {
+            auto track_lufs = to_lufs( m_track_energy / m_track_blocks );
+            m_cache[m_track_id] = track_lufs;
+            _store_cache( m_track_id, track_lufs );
+        }
+
+        m_track_id = track_id;
+        m_track_energy = 0.;
+        m_track_blocks = 0;
+
+        auto itr = m_cache.find( track_id );
+        if ( itr != m_cache.end() )
+        {
+            // known track : jump straight to its volume
+            m_target_volume = m_volume = _volume_for( itr->second );
+            volume = m_volume;
+        }
+    }
+
+    if ( volume >= 0 )
+    {
+        std::cout << "LOUDNESS cached for track " << track_id << " => volume " << volume << std::endl;
+        m_setter( volume );
+    }
+}
+
+loudness_normalizer::infos loudness_normalizer::current_infos()
+{
+    float cpu_load = 0.f;
+    {
+        std::lock_guard<std::mutex> lock( m_meter_mutex );
+        if ( m_meter )
+            cpu_load = m_meter->cpu_load();
+    }
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    double short_term = 0.;
+    for ( auto energy : m_short_term_blocks )
+        short_term += energy;
+    if ( !m_short_term_blocks.empty() )
+        short_term /= m_short_term_blocks.size();
+
+    return { to_lufs( short_term ),
+             m_track_blocks ? to_lufs( m_track_energy / m_track_blocks ) : -std::numeric_limits<float>::infinity(),
+             m_volume,
+             cpu_load };
+}
+
+void loudness_normalizer::_on_block( double mean_square )
+{
+    m_blocks++;
+
+    int volume = -1;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+
+        m_short_term_blocks.push_back( mean_square );
+        if ( m_short_term_blocks.size() > short_term_blocks )
+            m_short_term_blocks.pop_front();
+
+        // the monitor is post volume : bring the block back to full volume before integrating it
+        auto gain = m_volume / 100.;
+        if ( gain > 0. && to_lufs( mean_square ) > absolute_gate_lufs )
+        {
+            m_track_energy += mean_square / ( gain * gain );
+            m_track_blocks++;
+        }
+
+        if ( m_track_blocks >= min_track_blocks )
+            m_target_volume = _volume_for( to_lufs( m_track_energy / m_track_blocks ) );
+
+        // smooth ramp : at most one volume step per block
+        if ( m_volume != m_target_volume )
+        {
+            m_volume += m_target_volume > m_volume ? 1 : -1;
+            volume = m_volume;
+        }
+    }
+
+    if ( volume >= 0 )
+        m_setter( volume );
+}
+
+int loudness_normalizer::_volume_for( float track_lufs ) const
+{
+    auto volume = m_base_volume * std::pow( 10.f, ( reference_lufs - track_lufs ) / 20.f );
+    return std::min( std::max( static_cast<int>( std::lround( volume ) ), 1 ), 100 );
+}
+
+void loudness_normalizer::_load_cache()
+{
+    std::ifstream file( m_cache_file );
+
+    long long track_id;
+    float track_lufs;
+    while ( file >> track_id >> track_lufs )
+    {
+        m_cache[track_id] = track_lufs;
+        m_cache_lines++;
+    }
+
+    std::cout << "LOUDNESS cache => " << m_cache.size() << " tracks" << std::endl;
+
+    if ( _cache_needs_compaction() )
+        _compact_cache();
+}
+
+void loudness_normalizer::_store_cache( long long track_id, float track_lufs )
+{
+    // appended, later entries override earlier ones when loading
+    {
+        std::ofstream file( m_cache_file, std::ios::app );
+        file << track_id << " " << track_lufs << "\n";
+    }
+    m_cache_lines++;
+
+    if ( _cache_needs_compaction() )
+        _compact_cache();
+}
+
+bool loudness_normalizer::_cache_needs_compaction() const
+{
+    // once half of the file is overridden entries, or when it holds too many tracks
+    return m_cache_lines > 2 * m_cache.size() + 64 || m_cache.size() > max_cached_tracks;
+}
+
+void loudness_normalizer::_compact_cache()
+{
+    std::vector<std::pair<long long, float>> entries;
+    {
+        std::ifstream file( m_cache_file );
+        long long track_id;
+        float track_lufs;
+        while ( file >> track_id >> track_lufs )
+            entries.emplace_back( track_id, track_lufs );
+    }
+
+    // the latest entry of each track wins, and the most recently measured tracks are kept
+    std::unordered_set<long long> kept;
+    std::vector<std::pair<long long, float>> compacted;
+    for ( auto itr = entries.rbegin(); itr != entries.rend() && compacted.size() < max_cached_tracks; ++itr )
+    {
+        if ( kept.insert( itr->first ).second )
+            compacted.push_back( *itr );
+    }
+
+    for ( auto itr = m_cache.begin(); itr != m_cache.end(); )
+        itr = kept.count( itr->first ) ? std::next( itr ) : m_cache.erase( itr );
+
+    auto tmp_file = m_cache_file + ".tmp";
+    {
+        std::ofstream file( tmp_file, std::ios::trunc );
+        for ( auto itr = compacted.rbegin(); itr != compacted.rend(); ++itr )
+            file << itr->first << " " << itr->second << "\n";
+        if ( !file )
+        {
+            std::cerr << "cannot compact loudness cache " << m_cache_file << std::endl;
+            return;
+        }
+    }
+    std::rename( tmp_file.c_str(), m_cache_file.c_str() );
+
+    std::cout << "LOUDNESS cache compacted => " << entries.size() << " entries to " << compacted.size() << std::endl;
+    m_cache_lines = compacted.size();
+}
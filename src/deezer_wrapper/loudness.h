@@ -0,0 +1,151 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "audio_monitor.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/*
+ * ITU-R BS.1770 K-weighting (pre-filter shelf + RLB high-pass) applied to interleaved stereo frames,
+ * both channels being filtered in parallel SIMD lanes (NEON on ARM, SSE2 on x86, scalar otherwise).
+ */
+class k_weighting_filter
+{
+public:
+    k_weighting_filter( unsigned int sample_rate );
+
+    void reset();
+
+    // filters interleaved stereo frames and returns the sum of squares over both channels
+    double process( const float* frames, size_t frame_count );
+
+private:
+    struct biquad
+    {
+        float b0, b1, b2, a1, a2;
+    };
+
+    biquad m_shelf;
+    biquad m_highpass;
+
+    // transposed direct form II states, per stage and per channel
+    float m_state[2][2][2] = {};
+};
+
+/*
+ * Reports the K-weighted mean square energy of each 100ms block of the monitored output.
+ */
+class loudness_meter
+{
+public:
+    static constexpr size_t block_frames = audio_monitor::sample_rate / 10; /*100ms*/
+
+    using block_callback = std::function<void( double mean_square )>;
+
+    loudness_meter( const std::string& source, block_callback callback );
+
+    float cpu_load() const;
+
+private:
+    k_weighting_filter m_filter;
+    block_callback m_callback;
+
+    // last member : the capture thread must stop before the filter goes away
+    audio_monitor m_monitor;
+};
+
+/*
+ * Drives the player output volume from measured loudness : each track is brought to the reference
+ * loudness with a smooth volume ramp, and measurements are cached by track id (and persisted in the
+ * user cache) so that a track that already played starts at the right volume. The output is only
+ * captured while active, i.e. while audio is rendered.
+ */
+class loudness_normalizer
+{
+public:
+    using volume_setter = std::function<void( int volume )>;
+
+    struct infos
+    {
+        float short_term_lufs;  ///< last 3s loudness, as measured on the output
+        float track_lufs;       ///< current track loudness, normalized to full volume
+        int volume;             ///< current output volume
+        float cpu_load;         ///< meter processing time over audio time
+    };
+
+    loudness_normalizer( const std::string& cache_path, int base_volume, volume_setter setter );
+    ~loudness_normalizer();
+
+    // called once the track is rendered (0 for audio not to measure, e.g. ads) : a track selected ahead
+    // of time (natural next) would otherwise get the tail of the previous one at its volume
+    void on_track_started( long long track_id );
+
+    // starts or stops the output capture (stopping joins the capture thread)
+    void set_active( bool active );
+
+    // measured blocks since creation, each one being a capture thread wakeup
+    unsigned long blocks() const;
+
+    infos current_infos();
+
+private:
+    void _on_block( double mean_square );
+    int _volume_for( float track_lufs ) const;
+    void _load_cache();
+    void _store_cache( long long track_id, float track_lufs );
+    bool _cache_needs_compaction() const;
+    void _compact_cache();
+
+private:
+    const std::string m_cache_file;
+    const int m_base_volume;
+    volume_setter m_setter;
+
+    std::mutex m_mutex;
+
+    std::unordered_map<long long, float> m_cache;
+    size_t m_cache_lines = 0;   ///< entries in the cache file, overridden ones included
+
+    std::deque<double> m_short_term_blocks;
+    double m_track_energy = 0.;
+    int m_track_blocks = 0;
+    long long m_track_id = 0;
+
+    int m_volume;
+    int m_target_volume;
+
+    std::atomic<unsigned long> m_blocks{ 0 };
+
+    // not m_mutex : the capture thread takes it for each block, and is joined when the meter goes away
+    std::mutex m_meter_mutex;
+    std::unique_ptr<loudness_meter> m_meter;
+};
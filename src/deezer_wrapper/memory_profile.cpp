@@ -0,0 +1,277 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "memory_profile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+
+const char* tag_names[] = { "other", "qml", "json", "library", "api", "cover" };
+
+// first match wins : paths are matched on substrings
+const struct { const char* pattern; const char* subsystem; } subsystems[] = {
+    { "[heap]", "heap" },
+    { "[stack", "stacks" },
+    { "libQt5", "qt" },
+    { "/qml/", "qt" },
+    { "libdeezer", "sdk" },
+    { "libpulse", "pulse" },
+    { "libcurl", "network" },
+    { "libssl", "network" },
+    { "libcrypto", "network" },
+    { "/dev/dri", "gpu" },
+    { "/dev/vchiq", "gpu" },
+    { "/dev/fb", "gpu" },
+    { "libGL", "gpu" },
+    { "libEGL", "gpu" },
+    { "libbrcm", "gpu" },
+    { "_dri.so", "gpu" },
+    { ".ttf", "fonts" },
+    { ".otf", "fonts" },
+    { "/fonts/", "fonts" },
+    { ".so", "other libraries" },
+};
+
+std::string subsystem_of( const std::string& path, const std::string& executable )
+{
+    if ( path.empty() )
+        return "anonymous";
+    // the executable also holds the compiled in resources (QML, icons, embedded font)
+    if ( path == executable )
+        return "deezzy";
+    for ( const auto& s : subsystems )
+    {
+        if ( path.find( s.pattern ) != std::string::npos )
+            return s.subsystem;
+    }
+    return "files";
+}
+
+long status_kB( const char* field )
+{
+    std::ifstream status( "/proc/self/status" );
+    std::string line;
+    auto length = std::char_traits<char>::length( field );
+    while ( std::getline( status, line ) )
+    {
+        if ( line.compare( 0, length, field ) == 0 )
+            return std::atol( line.c_str() + length );
+    }
+    return 0;
+}
+
+} // namespace
+
+#ifdef DEEZZY_MEMORY_ACCOUNTING
+
+namespace {
+
+struct heap_counters
+{
+    std::atomic<long> current{ 0 };
+    std::atomic<long> peak{ 0 };
+    std::atomic<long> allocations{ 0 };
+};
+
+heap_counters counters[static_cast<size_t>( memory_profile::tag::count )];
+
+thread_local memory_profile::tag current_tag = memory_profile::tag::other;
+
+// size and tag are kept in front of each block, keeping the default new alignment
+struct alignas( max_align_t ) block_header
+{
+    size_t size;
+    memory_profile::tag tag;
+};
+
+void* tracked_alloc( size_t size, bool nothrow )
+{
+    auto* header = static_cast<block_header*>( std::malloc( sizeof( block_header ) + size ) );
+    if ( !header )
+    {
+        if ( nothrow )
+            return nullptr;
+        throw std::bad_alloc();
+    }
+
+    header->size = size;
+    header->tag = current_tag;
+
+    auto& c = counters[static_cast<size_t>( header->tag )];
+    auto current = c.current.fetch_add( static_cast<long>( size ), std::memory_order_relaxed ) + static_cast<long>( size );
+    auto peak = c.peak.load( std::memory_order_relaxed );
+    while ( current > peak && !c.peak.compare_exchange_weak( peak, current, std::memory_order_relaxed ) ) {}
+    c.allocations.fetch_add( 1, std::memory_order_relaxed );
+
+    return header + 1;
+}
+
+void tracked_free( void* block )
+{
+    if ( !block )
+        return;
+
+    auto* header = static_cast<block_header*>( block ) - 1;
+    counters[static_cast<size_t>( header->tag )].current.fetch_sub( static_cast<long>( header->size ), std::memory_order_relaxed );
+    std::free( header );
+}
+
+} // namespace
+
+void* operator new( size_t size ) { return tracked_alloc( size, false ); }
+void* operator new[]( size_t size ) { return tracked_alloc( size, false ); }
+void* operator new( size_t size, const std::nothrow_t& ) noexcept { return tracked_alloc( size, true ); }
+void* operator new[]( size_t size, const std::nothrow_t& ) noexcept { return tracked_alloc( size, true ); }
+void operator delete( void* block ) noexcept { tracked_free( block ); }
+void operator delete[]( void* block ) noexcept { tracked_free( block ); }
+void operator delete( void* block, size_t ) noexcept { tracked_free( block ); }
+void operator delete[]( void* block, size_t ) noexcept { tracked_free( block ); }
+void operator delete( void* block, const std::nothrow_t& ) noexcept { tracked_free( block ); }
+void operator delete[]( void* block, const std::nothrow_t& ) noexcept { tracked_free( block ); }
+
+memory_profile::scope::scope( tag t ) : m_previous( current_tag )
+{
+    current_tag = t;
+}
+
+memory_profile::scope::~scope()
+{
+    current_tag = m_previous;
+}
+
+#endif
+
+memory_profile::report memory_profile::sample()
+{
+    report r{ status_kB( "VmRSS:" ), status_kB( "VmHWM:" ), {}, {} };
+
+    char executable[4096] = {};
+    auto length = readlink( "/proc/self/exe", executable, sizeof( executable ) - 1 );
+    auto executable_path = std::string( executable, length > 0 ? static_cast<size_t>( length ) : 0 );
+
+    // mapping header lines ("start-end perms offset dev inode [path]") are followed by "Key: value kB" lines
+    std::map<std::string, mapping_usage> usage;
+    mapping_usage* current = nullptr;
+
+    std::ifstream smaps( "/proc/self/smaps" );
+    std::string line;
+    while ( std::getline( smaps, line ) )
+    {
+        auto colon = line.find( ':' );
+        auto space = line.find( ' ' );
+        if ( colon == std::string::npos || ( space != std::string::npos && space < colon ) )
+        {
+            std::istringstream fields( line );
+            std::string range, perms, offset, device, inode, path;
+            fields >> range >> perms >> offset >> device >> inode;
+            std::getline( fields >> std::ws, path );
+
+            auto subsystem = subsystem_of( path, executable_path );
+            current = &usage.emplace( subsystem, mapping_usage{ subsystem, 0, 0 } ).first->second;
+        }
+        else if ( current && line.compare( 0, 4, "Rss:" ) == 0 )
+            current->rss_kB += std::atol( line.c_str() + 4 );
+        else if ( current && line.compare( 0, 4, "Pss:" ) == 0 )
+            current->pss_kB += std::atol( line.c_str() + 4 );
+    }
+
+    for ( const auto& u : usage )
+        r.mappings.push_back( u.second );
+    std::sort( r.mappings.begin(), r.mappings.end(), []( const mapping_usage& a, const mapping_usage& b ) {
+        return a.rss_kB > b.rss_kB;
+    } );
+
+#ifdef DEEZZY_MEMORY_ACCOUNTING
+    for ( size_t t = 0; t < static_cast<size_t>( tag::count ); t++ )
+        r.heap.push_back( { tag_names[t], counters[t].current / 1024, counters[t].peak / 1024, counters[t].allocations } );
+#endif
+
+    return r;
+}
+
+long memory_profile::peak_rss_kB()
+{
+    return status_kB( "VmHWM:" );
+}
+
+bool memory_profile::check_peak_rss( long budget_kB )
+{
+    auto peak_kB = peak_rss_kB();
+    std::cout << "MEMORY => peak RSS " << peak_kB << "kB" << ( budget_kB > 0 ? " (budget " + std::to_string( budget_kB ) + "kB)" : "" ) << std::endl;
+    if ( budget_kB > 0 && peak_kB > budget_kB )
+    {
+        std::cerr << "peak RSS over budget by " << peak_kB - budget_kB << "kB" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+long memory_profile::cpu_time_ms()
+{
+    rusage usage{};
+    getrusage( RUSAGE_SELF, &usage );
+    return ( usage.ru_utime.tv_sec + usage.ru_stime.tv_sec ) * 1000L + ( usage.ru_utime.tv_usec + usage.ru_stime.tv_usec ) / 1000L;
+}
+
+long memory_profile::process_age_ms()
+{
+    std::ifstream stat( "/proc/self/stat" );
+    std::string line;
+    std::getline( stat, line );
+
+    // fields after the command name, which may contain spaces : the start time is the 22nd field
+    auto close_paren = line.rfind( ')' );
+    if ( close_paren == std::string::npos )
+        return -1;
+    std::istringstream fields( line.substr( close_paren + 2 ) );
+    std::string field;
+    for ( auto i = 3; i < 22 && fields >> field; i++ ) {}
+    unsigned long long start_ticks = 0;
+    if ( !( fields >> start_ticks ) )
+        return -1;
+
+    timespec now{};
+    clock_gettime( CLOCK_BOOTTIME, &now );
+    auto now_ms = static_cast<long long>( now.tv_sec ) * 1000 + now.tv_nsec / 1000000;
+    return static_cast<long>( now_ms - static_cast<long long>( start_ticks * 1000 / sysconf( _SC_CLK_TCK ) ) );
+}
+
+const char* memory_profile::tag_name( tag t )
+{
+    return tag_names[static_cast<size_t>( t )];
+}
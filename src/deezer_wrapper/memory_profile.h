@@ -0,0 +1,101 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Memory footprint accounting : resident memory is broken down per subsystem by classifying the
+ * mappings of /proc/self/smaps (Qt, SDK, GPU, fonts, heap...), and in DEEZZY_MEMORY_ACCOUNTING
+ * builds the global operator new/delete are replaced to attribute C++ heap usage to the tag of the
+ * scope allocating it. Allocations made through malloc (C libraries, Qt image data, the JS engine)
+ * are not seen by the hooks, and only show up in the mapping breakdown.
+ */
+class memory_profile
+{
+public:
+    enum class tag : uint8_t
+    {
+        other,
+        qml,
+        json,
+        library,
+        api,
+        cover,
+        count
+    };
+
+    struct mapping_usage
+    {
+        std::string subsystem;
+        long rss_kB;
+        long pss_kB;            ///< resident share, shared pages being divided among their users
+    };
+
+    struct heap_usage
+    {
+        std::string tag;
+        long current_kB;
+        long peak_kB;
+        long allocations;       ///< since startup
+    };
+
+    struct report
+    {
+        long rss_kB;
+        long peak_rss_kB;
+        std::vector<mapping_usage> mappings;    ///< largest first
+        std::vector<heap_usage> heap;           ///< empty unless the allocator hooks are compiled in
+    };
+
+    // attributes the heap allocations of the calling thread to a tag while alive
+    class scope
+    {
+    public:
+#ifdef DEEZZY_MEMORY_ACCOUNTING
+        explicit scope( tag t );
+        ~scope();
+    private:
+        tag m_previous;
+#else
+        explicit scope( tag ) {}
+#endif
+    };
+
+    static report sample();
+    static long peak_rss_kB();
+
+    // prints the peak resident size, and returns false (with an error) when it went over budget_kB (0 : no budget)
+    static bool check_peak_rss( long budget_kB );
+
+    // process CPU time (user + system) and time since the process started, to compare front-ends
+    static long cpu_time_ms();
+    static long process_age_ms();
+
+    static const char* tag_name( tag t );
+};
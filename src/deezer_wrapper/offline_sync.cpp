@@ -0,0 +1,267 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "offline_sync.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace {
+
+constexpr double stream_bytes_per_second = 320000. / 8.;   // worst case (HQ) stream bitrate
+constexpr int buffered_margin_ms = 1000;                    // stream considered fully buffered below this margin
+constexpr size_t underflow_storm_count = 3;
+constexpr auto underflow_storm_period = std::chrono::seconds( 30 );
+constexpr auto offline_hold_off = std::chrono::minutes( 2 );
+
+} // namespace
+
+offline_scheduler::offline_scheduler( size_t window_size, unsigned int budget_kbps, sync_request request )
+    : m_window_size( window_size ), m_budget_bytes_per_second( budget_kbps * 1000. / 8. ), m_request( request )
+{
+}
+
+void offline_scheduler::on_track_selected( long long track_id, int duration_s, long long next_track_id, int next_duration_s )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_current_track_id = track_id;
+    m_buffered_ms = 0;
+
+    if ( track_id )
+        _push( track_id, duration_s );
+    if ( next_track_id )
+        _push( next_track_id, next_duration_s );
+}
+
+void offline_scheduler::on_upcoming_tracks( long long track_id, const std::vector<track>& upcoming )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    // the selection moved on while the tracks were fetched
+    if ( !track_id || track_id != m_current_track_id )
+        return;
+
+    // the playing track keeps its slot : the rest of the window goes to upcoming tracks, in queue order
+    auto count = std::min( upcoming.size(), m_window_size - 1 );
+    for ( size_t i = 0; i < count; i++ )
+        if ( upcoming[i].id )
+            _push( upcoming[i].id, upcoming[i].duration_s );
+}
+
+void offline_scheduler::on_index_progress( int index_ms, int render_ms, int duration_ms )
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+
+    m_buffered_ms = std::max( 0, index_ms - render_ms );
+
+    auto now = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double>( now - m_refill_time ).count();
+    m_refill_time = now;
+
+    // the bucket holds at most one full track worth of budget
+    auto largest = std::max_element( m_window.begin(), m_window.end(), []( const entry& l, const entry& r ) {
+        return l.duration_s < r.duration_s;
+    } );
+    auto capacity = largest != m_window.end() ? largest->duration_s * stream_bytes_per_second : 0.;
+    m_tokens = std::min( m_tokens + elapsed * m_budget_bytes_per_second, capacity );
+
+    if ( m_offline || m_inflight_track_id )
+        return;
+
+    // never compete with the playing stream
+    if ( duration_ms > 0 && index_ms < duration_ms - buffered_margin_ms )
+        return;
+
+    // upcoming tracks first, then the recently played ones
+    auto current = std::find_if( m_window.begin(), m_window.end(), [this]( const entry& e ) {
+        return e.track_id == m_current_track_id;
+    } );
+    auto candidate = std::find_if( current, m_window.end(), []( const entry& e ) { return !e.synced; } );
+    if ( candidate == m_window.end() )
+        candidate = std::find_if( m_window.begin(), m_window.end(), []( const entry& e ) { return !e.synced; } );
+
+    std::string tracklist;
+    if ( candidate != m_window.end() )
+    {
+        auto cost = candidate->duration_s * stream_bytes_per_second;
+        if ( m_tokens < cost )
+            return;
+        m_tokens -= cost;
+        m_inflight_track_id = candidate->track_id;
+        tracklist = _tracklist_json( candidate->track_id );
+    }
+    else if ( m_dirty )
+    {
+        // evicted tracks only : nothing to download
+        m_inflight_track_id = -1;
+        tracklist = _tracklist_json( 0 );
+    }
+    else
+        return;
+
+    m_dirty = false;
+    lock.unlock();
+
+    m_request( tracklist );
+}
+
+void offline_scheduler::on_sync_done( bool success )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    for ( auto& e : m_window )
+        if ( e.track_id == m_inflight_track_id )
+            e.synced = success;
+
+    if ( !success )
+        m_dirty = true;
+    m_inflight_track_id = 0;
+}
+
+bool offline_scheduler::on_underflow()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto now = std::chrono::steady_clock::now();
+    m_underflows.push_back( now );
+    while ( !m_underflows.empty() && now - m_underflows.front() > underflow_storm_period )
+        m_underflows.pop_front();
+
+    return !m_offline && m_underflows.size() >= underflow_storm_count && _synced_ahead();
+}
+
+bool offline_scheduler::on_network_error()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return !m_offline && _synced_ahead();
+}
+
+int offline_scheduler::first_synced_ahead()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto current = _current();
+    if ( current == m_window.end() )
+        return -1;
+
+    // the synced tracklist follows the window order
+    auto position = static_cast<int>( std::count_if( m_window.cbegin(), current + 1, []( const entry& e ) { return e.synced; } ) );
+    for ( auto itr = current + 1; itr != m_window.cend(); ++itr )
+        if ( itr->synced )
+            return position;
+    return -1;
+}
+
+bool offline_scheduler::may_go_online()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return m_offline && std::chrono::steady_clock::now() - m_offline_time > offline_hold_off;
+}
+
+void offline_scheduler::set_offline( bool offline )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_offline = offline;
+    m_offline_time = std::chrono::steady_clock::now();
+    m_underflows.clear();
+}
+
+offline_scheduler::infos offline_scheduler::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    infos result{ 0, 0, 0.f, m_offline };
+
+    for ( const auto& e : m_window )
+    {
+        if ( e.synced )
+            result.synced_tracks++;
+        else
+            result.pending_tracks++;
+    }
+
+    // recently played tracks are synced too, but only what follows the playing one is ahead
+    int ahead_s = 0;
+    auto current = _current();
+    if ( current != m_window.end() )
+        for ( auto itr = current + 1; itr != m_window.cend(); ++itr )
+            if ( itr->synced )
+                ahead_s += itr->duration_s;
+    result.buffered_ahead_minutes = ( ahead_s + m_buffered_ms / 1000.f ) / 60.f;
+
+    return result;
+}
+
+void offline_scheduler::_push( long long track_id, int duration_s )
+{
+    auto itr = std::find_if( m_window.begin(), m_window.end(), [track_id]( const entry& e ) {
+        return e.track_id == track_id;
+    } );
+    if ( itr != m_window.end() )
+        return;
+
+    m_window.push_back( { track_id, duration_s, false } );
+
+    while ( m_window.size() > m_window_size && m_window.front().track_id != m_current_track_id )
+    {
+        m_dirty |= m_window.front().synced;
+        m_window.pop_front();
+    }
+}
+
+std::deque<offline_scheduler::entry>::const_iterator offline_scheduler::_current() const
+{
+    return std::find_if( m_window.cbegin(), m_window.cend(), [this]( const entry& e ) {
+        return e.track_id == m_current_track_id;
+    } );
+}
+
+bool offline_scheduler::_synced_ahead() const
+{
+    auto current = _current();
+    return current != m_window.cend() && std::any_of( current + 1, m_window.cend(), []( const entry& e ) { return e.synced; } );
+}
+
+std::string offline_scheduler::_tracklist_json( long long extra_track_id ) const
+{
+    std::ostringstream json;
+    json << "{\"data\":[";
+
+    auto first = true;
+    for ( const auto& e : m_window )
+    {
+        if ( !e.synced && e.track_id != extra_track_id )
+            continue;
+        json << ( first ? "" : "," ) << "{\"id\":\"" << e.track_id << "\"}";
+        first = false;
+    }
+
+    json << "]}";
+    return json.str();
+}
@@ -0,0 +1,113 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * Keeps a rolling window of tracks (recently played + upcoming) synchronized in the SDK offline store,
+ * one track at a time and only while the playing stream is fully buffered, within a bandwidth budget.
+ * Also decides when playback should fall back to (and come back from) offline mode.
+ */
+class offline_scheduler
+{
+public:
+    using sync_request = std::function<void( const std::string& tracklist_json )>;
+
+    struct infos
+    {
+        int synced_tracks;              ///< tracks of the window available offline
+        int pending_tracks;             ///< tracks of the window still to be synced
+        float buffered_ahead_minutes;   ///< playable minutes if the link drops now
+        bool offline;                   ///< playback currently fell back to offline mode
+    };
+
+    struct track
+    {
+        long long id;
+        int duration_s;
+    };
+
+    offline_scheduler( size_t window_size, unsigned int budget_kbps, sync_request request );
+
+    void on_track_selected( long long track_id, int duration_s, long long next_track_id, int next_duration_s );
+    // tracks queued after track_id, beyond the next one announced with the selection
+    void on_upcoming_tracks( long long track_id, const std::vector<track>& upcoming );
+    void on_index_progress( int index_ms, int render_ms, int duration_ms );
+    void on_sync_done( bool success );
+
+    // return true when playback should switch to offline mode, i.e. only with synced tracks after the playing one
+    bool on_underflow();
+    bool on_network_error();
+
+    // position in the synced tracklist of the first synced track after the playing one, -1 when there is none
+    int first_synced_ahead();
+
+    // returns true when the offline hold-off elapsed and the link can be tried again
+    bool may_go_online();
+    void set_offline( bool offline );
+
+    infos current_infos();
+
+private:
+    struct entry
+    {
+        long long track_id;
+        int duration_s;
+        bool synced;
+    };
+
+    void _push( long long track_id, int duration_s );
+    std::deque<entry>::const_iterator _current() const;
+    bool _synced_ahead() const;
+    std::string _tracklist_json( long long extra_track_id ) const;
+
+private:
+    const size_t m_window_size;
+    const double m_budget_bytes_per_second;
+    sync_request m_request;
+
+    std::mutex m_mutex;
+
+    std::deque<entry> m_window;
+    long long m_current_track_id = 0;
+    long long m_inflight_track_id = 0;
+    bool m_dirty = false;
+
+    double m_tokens = 0.;
+    std::chrono::steady_clock::time_point m_refill_time = std::chrono::steady_clock::now();
+
+    int m_buffered_ms = 0;
+
+    std::deque<std::chrono::steady_clock::time_point> m_underflows;
+    bool m_offline = false;
+    std::chrono::steady_clock::time_point m_offline_time;
+};
@@ -0,0 +1,140 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "playback_clock.h"
+
+#include <algorithm>
+#include <cmath>
+
+void playback_clock::on_progress( int position_ms )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto now = clock::now();
+    auto error = m_playing && !m_held ? _estimate( now ) - position_ms : 0.;
+
+    // samples only come while audio renders
+    m_held = false;
+    m_anchor_time = now;
+    m_anchor_ms = position_ms;
+
+    if ( std::abs( error ) > snap_ms )
+    {
+        m_correction_ms = 0.;
+        m_last_ms = position_ms;
+    }
+    else
+        m_correction_ms = error;
+}
+
+void playback_clock::start( int position_ms )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_playing = true;
+    m_held = false;
+    m_anchor_time = clock::now();
+    m_anchor_ms = m_last_ms = position_ms;
+    m_correction_ms = 0.;
+}
+
+void playback_clock::reset()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_playing = false;
+    m_held = false;
+    m_anchor_ms = m_last_ms = m_correction_ms = 0.;
+}
+
+void playback_clock::pause()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    _freeze( clock::now() );
+    m_playing = false;
+}
+
+void playback_clock::resume()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    _freeze( clock::now() );
+    m_playing = true;
+    m_held = false;
+}
+
+void playback_clock::stall()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    _freeze( clock::now() );
+    m_held = true;
+}
+
+void playback_clock::seek( int position_ms )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_held = true;
+    m_anchor_time = clock::now();
+    m_anchor_ms = m_last_ms = position_ms;
+    m_correction_ms = 0.;
+}
+
+int playback_clock::position_ms()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( m_playing && !m_held )
+        m_last_ms = std::max( m_last_ms, _estimate( clock::now() ) );
+    return static_cast<int>( m_last_ms );
+}
+
+bool playback_clock::running()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return m_playing && !m_held;
+}
+
+double playback_clock::_estimate( clock::time_point now ) const
+{
+    if ( !m_playing || m_held )
+        return m_anchor_ms;
+
+    auto elapsed = std::chrono::duration<double, std::milli>( now - m_anchor_time ).count();
+    auto decay = std::max( 0., 1. - elapsed / slew_ms );
+    return m_anchor_ms + elapsed + m_correction_ms * decay;
+}
+
+// re-anchors on the current estimate, so that the clock restarts from where it stopped
+void playback_clock::_freeze( clock::time_point now )
+{
+    m_anchor_ms = std::max( m_last_ms, _estimate( now ) );
+    m_last_ms = m_anchor_ms;
+    m_anchor_time = now;
+    m_correction_ms = 0.;
+}
@@ -0,0 +1,71 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+/*
+ * Playback position between render progress samples : each sample anchors the clock, which then
+ * follows the monotonic clock while audio renders. Pauses, underflows and seeks freeze it until
+ * rendering resumes, and small disagreements with a new sample are slewed out rather than jumped.
+ */
+class playback_clock
+{
+public:
+    // errors below this are slewed out over slew_ms, larger ones (seek, drift after a stall) snap
+    static constexpr int slew_ms = 1000;
+    static constexpr int snap_ms = 750;
+
+    void on_progress( int position_ms );
+
+    void start( int position_ms );  ///< track starts rendering
+    void reset();                   ///< new track selected, or playback stopped
+    void pause();
+    void resume();                  ///< after a pause or an underflow
+    void stall();
+    void seek( int position_ms );
+
+    int position_ms();
+    bool running();
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    double _estimate( clock::time_point now ) const;
+    void _freeze( clock::time_point now );
+
+private:
+    std::mutex m_mutex;
+
+    bool m_playing = false;     ///< started and not paused
+    bool m_held = false;        ///< waiting for data (underflow, seek)
+
+    clock::time_point m_anchor_time;
+    double m_anchor_ms = 0.;
+    double m_correction_ms = 0.;    ///< estimate minus sample at the anchor, decaying to zero
+    double m_last_ms = 0.;          ///< last reported position, which never goes back while running
+};
@@ -0,0 +1,343 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "profile_manager.h"
+#include "thread_policy.h"
+
+#include "third_party/json.hpp"
+
+#include <curl/curl.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <sys/stat.h>
+
+namespace {
+
+constexpr const char* default_profile = "default";
+constexpr const char* profiles_file = "/profiles.conf";
+constexpr const char* active_file = "/profile.active";
+constexpr const char* validation_url = "https://api.deezer.com/user/me?access_token=";
+
+size_t on_body( char* data, size_t size, size_t count, void* user )
+{
+    static_cast<std::string*>( user )->append( data, size * count );
+    return size * count;
+}
+
+// called at least once per second during a transfer : a non zero result aborts it
+int abort_transfer( void* aborting, curl_off_t, curl_off_t, curl_off_t, curl_off_t )
+{
+    return static_cast<const std::atomic<bool>*>( aborting )->load() ? 1 : 0;
+}
+
+} // namespace
+
+constexpr std::chrono::minutes profile_manager::revalidate_period;
+constexpr std::chrono::minutes profile_manager::unreachable_retry_period;
+
+profile_manager::profile_manager( const std::string& cache_path,
+                                  const std::string& default_user_id,
+                                  const token_manager::token& default_token,
+                                  const oauth_settings& oauth,
+                                  token_manager::token_callback on_active_token,
+                                  validator validate,
+                                  token_manager::http_post post ) : m_cache_path( cache_path ),
+                                                                    m_oauth( oauth ),
+                                                                    m_on_active_token( std::move( on_active_token ) ),
+                                                                    m_validate( std::move( validate ) ),
+                                                                    m_post( std::move( post ) )
+{
+    // the compile time user keeps its files at the root of the cache path
+    _add( default_profile, default_user_id, m_cache_path, default_token );
+    _load_profiles();
+
+    std::ifstream active( m_cache_path + active_file );
+    std::string name;
+    if ( std::getline( active, name ) )
+    {
+        for ( size_t i = 0; i < m_profiles.size(); i++ )
+            if ( m_profiles[i].infos.name == name )
+                m_active = i;
+    }
+    std::cout << "PROFILE => " << m_profiles[m_active].infos.name << " (" << m_profiles.size() << " profiles)" << std::endl;
+
+    m_thread = std::thread( &profile_manager::_run, this );
+}
+
+profile_manager::~profile_manager()
+{
+    stop();
+}
+
+void profile_manager::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_aborting = true;
+    m_wakeup.notify_one();
+    if ( m_thread.joinable() )
+        m_thread.join();
+
+    // the validation thread may refresh inactive tokens : stopped first
+    for ( auto& e : m_profiles )
+        e.tokens->stop();
+}
+
+void profile_manager::start()
+{
+    if ( m_thread.joinable() )
+        return;
+
+    for ( auto& e : m_profiles )
+        e.tokens->start();
+
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = true;
+    }
+    m_aborting = false;
+    m_thread = std::thread( &profile_manager::_run, this );
+}
+
+profile_manager::profile profile_manager::active()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_profiles[m_active].infos;
+}
+
+std::vector<profile_manager::status> profile_manager::statuses()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    std::vector<status> result;
+    for ( size_t i = 0; i < m_profiles.size(); i++ )
+    {
+        const auto& e = m_profiles[i];
+        result.push_back( { e.infos, i == m_active, e.ready, e.tokens->current_infos().expires_in_s } );
+    }
+    return result;
+}
+
+bool profile_manager::activate( const std::string& name )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+
+        size_t i = 0;
+        while ( i < m_profiles.size() && m_profiles[i].infos.name != name )
+            i++;
+        if ( i == m_profiles.size() )
+            return false;
+
+        // the profile left was logged in until now
+        auto& previous = m_profiles[m_active];
+        previous.ready = true;
+        previous.next_check = std::chrono::steady_clock::now() + revalidate_period;
+        m_active = i;
+
+        std::ofstream( m_cache_path + active_file ) << name << std::endl;
+    }
+    m_wakeup.notify_one();
+    return true;
+}
+
+bool profile_manager::ready( const std::string& name )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    for ( const auto& e : m_profiles )
+        if ( e.infos.name == name )
+            return e.ready;
+    return false;
+}
+
+std::string profile_manager::access_token()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_profiles[m_active].tokens->access_token();
+}
+
+void profile_manager::refresh_async()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_profiles[m_active].tokens->refresh_async();
+}
+
+token_manager::infos profile_manager::token_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_profiles[m_active].tokens->current_infos();
+}
+
+profile_manager::validation profile_manager::api_validate( const std::string& access_token, std::string& user_id,
+                                                           const std::atomic<bool>& aborting )
+{
+    auto* curl = curl_easy_init();
+    if ( !curl )
+        return validation::unreachable;
+
+    std::string body;
+    auto url = validation_url + access_token;
+    curl_easy_setopt( curl, CURLOPT_URL, url.c_str() );
+    curl_easy_setopt( curl, CURLOPT_WRITEFUNCTION, on_body );
+    curl_easy_setopt( curl, CURLOPT_WRITEDATA, &body );
+    curl_easy_setopt( curl, CURLOPT_NOPROGRESS, 0L );
+    curl_easy_setopt( curl, CURLOPT_XFERINFOFUNCTION, abort_transfer );
+    curl_easy_setopt( curl, CURLOPT_XFERINFODATA, const_cast<std::atomic<bool>*>( &aborting ) );
+    curl_easy_setopt( curl, CURLOPT_NOSIGNAL, 1L );
+    curl_easy_setopt( curl, CURLOPT_CONNECTTIMEOUT, 5L );
+    curl_easy_setopt( curl, CURLOPT_TIMEOUT, 10L );
+    curl_easy_setopt( curl, CURLOPT_USERAGENT, "deezzy" );
+
+    auto code = curl_easy_perform( curl );
+    curl_easy_cleanup( curl );
+    if ( code != CURLE_OK )
+        return validation::unreachable;
+
+    // the Web API answers 200 in both cases, with an OAuthException error for bad tokens
+    try
+    {
+        auto response = nlohmann::json::parse( body );
+        if ( response.count( "id" ) )
+        {
+            user_id = std::to_string( response["id"].get<long long>() );
+            return validation::valid;
+        }
+        if ( response.count( "error" ) && response["error"].value( "type", "" ) == "OAuthException" )
+            return validation::rejected;
+    }
+    catch( const std::exception& e )
+    {
+        std::cerr << "bad user response : " << e.what() << std::endl;
+    }
+    return validation::unreachable;
+}
+
+void profile_manager::_add( const std::string& name, const std::string& user_id, const std::string& cache_path,
+                            const token_manager::token& seed )
+{
+    auto index = m_profiles.size();
+
+    entry e;
+    e.infos = { name, user_id, cache_path };
+    e.tokens = std::make_unique<token_manager>( cache_path + "/oauth.token", m_oauth.token_url, m_oauth.client_id, m_oauth.client_secret,
+                                                seed, [this, index]( const std::string& access_token ) {
+        bool active;
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            active = index == m_active;
+        }
+        if ( active && m_on_active_token )
+            m_on_active_token( access_token );
+    }, m_post );
+    m_profiles.push_back( std::move( e ) );
+}
+
+void profile_manager::_load_profiles()
+{
+    std::ifstream file( m_cache_path + profiles_file );
+    std::string line;
+    while ( std::getline( file, line ) )
+    {
+        std::istringstream fields( line );
+        std::string name, user_id;
+        token_manager::token seed{ "", "", 0, 0 };
+        if ( line.empty() || line[0] == '#' || !( fields >> name >> user_id >> seed.access_token ) )
+            continue;
+        fields >> seed.refresh_token;
+
+        if ( name == default_profile || name.find( '/' ) != std::string::npos || name[0] == '.' )
+        {
+            std::cerr << "ignoring profile " << name << std::endl;
+            continue;
+        }
+
+        auto path = m_cache_path + "/profiles";
+        mkdir( path.c_str(), 0700 );
+        path += "/" + name;
+        mkdir( path.c_str(), 0700 );
+
+        _add( name, user_id, path, seed );
+    }
+}
+
+void profile_manager::_run()
+{
+    thread_policy::name_current_thread( "dz-profiles" );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        // the inactive profile due for a check first
+        auto now = std::chrono::steady_clock::now();
+        size_t due = m_profiles.size();
+        for ( size_t i = 0; i < m_profiles.size(); i++ )
+            if ( i != m_active && ( due == m_profiles.size() || m_profiles[i].next_check < m_profiles[due].next_check ) )
+                due = i;
+
+        if ( due == m_profiles.size() )
+        {
+            m_wakeup.wait( lock );
+            continue;
+        }
+        if ( m_profiles[due].next_check > now )
+        {
+            m_wakeup.wait_until( lock, m_profiles[due].next_check );
+            continue;
+        }
+
+        auto* tokens = m_profiles[due].tokens.get();
+        auto name = m_profiles[due].infos.name;
+        lock.unlock();
+
+        // a rejected token is refreshed once, then checked again
+        std::string user_id;
+        auto result = m_validate( tokens->access_token(), user_id, m_aborting );
+        if ( result == validation::rejected && tokens->refresh() )
+            result = m_validate( tokens->access_token(), user_id, m_aborting );
+
+        lock.lock();
+        auto& e = m_profiles[due];
+        e.next_check = std::chrono::steady_clock::now() + ( result == validation::unreachable ? unreachable_retry_period : revalidate_period );
+        if ( result == validation::unreachable )
+            continue;
+
+        if ( result == validation::valid )
+        {
+            if ( !e.ready )
+                std::cout << "PROFILE => " << name << " pre-authenticated as user " << user_id << std::endl;
+            e.infos.user_id = user_id;
+        }
+        else
+        {
+            std::cerr << "profile " << name << " : access token rejected" << std::endl;
+        }
+        e.ready = result == validation::valid;
+    }
+}
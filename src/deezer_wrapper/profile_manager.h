@@ -0,0 +1,139 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "token_manager.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Deezer accounts sharing the device : the compile time user ("default" profile, in the user cache
+ * path) plus the ones listed in USER_CACHE_PATH/profiles.conf, each with its own cache subdirectory and
+ * token lifecycle. Inactive profiles are pre-authenticated in the background (token refreshed when
+ * needed and checked against the Web API), so that switching to one never waits on a failed login.
+ */
+class profile_manager
+{
+public:
+    struct profile
+    {
+        std::string name;
+        std::string user_id;
+        std::string cache_path;     ///< per profile state (session, library, api queue, tokens...)
+    };
+
+    struct status
+    {
+        profile infos;
+        bool active;
+        bool ready;                 ///< token checked against the Web API (the active one logged in)
+        int token_expires_in_s;     ///< -1 when the token does not expire
+    };
+
+    enum class validation { valid, rejected, unreachable };
+
+    // checks an access token, setting the user id it belongs to (unreachable once aborting is set)
+    using validator = std::function<validation( const std::string& access_token, std::string& user_id,
+                                                const std::atomic<bool>& aborting )>;
+
+    struct oauth_settings
+    {
+        std::string token_url;
+        std::string client_id;
+        std::string client_secret;
+    };
+
+    // inactive profiles are checked this often, and retried sooner when the API could not be reached
+    static constexpr std::chrono::minutes revalidate_period{ 30 };
+    static constexpr std::chrono::minutes unreachable_retry_period{ 1 };
+
+    // profiles.conf : "name user_id access_token [refresh_token]" lines, # for comments
+    profile_manager( const std::string& cache_path,
+                     const std::string& default_user_id,
+                     const token_manager::token& default_token,
+                     const oauth_settings& oauth,
+                     token_manager::token_callback on_active_token,
+                     validator validate = api_validate,
+                     token_manager::http_post post = token_manager::curl_post );
+    ~profile_manager();
+
+    profile active();
+    std::vector<status> statuses();
+
+    // makes the profile active (remembered across restarts), false when it is unknown
+    bool activate( const std::string& name );
+    bool ready( const std::string& name );
+
+    // active profile token
+    std::string access_token();
+    void refresh_async();
+    token_manager::infos token_infos();
+
+    // aborts the checks and refreshes in flight and joins the background threads (the validation one and
+    // each profile's token one) : profiles and tokens stay readable, and nothing runs until restarted
+    void stop();
+    void start();
+
+    static validation api_validate( const std::string& access_token, std::string& user_id, const std::atomic<bool>& aborting );
+
+private:
+    struct entry
+    {
+        profile infos;
+        std::unique_ptr<token_manager> tokens;
+        bool ready = false;
+        std::chrono::steady_clock::time_point next_check;
+    };
+
+    void _add( const std::string& name, const std::string& user_id, const std::string& cache_path,
+               const token_manager::token& seed );
+    void _load_profiles();
+    void _run();
+
+private:
+    const std::string m_cache_path;
+    const oauth_settings m_oauth;
+    token_manager::token_callback m_on_active_token;
+    validator m_validate;
+    token_manager::http_post m_post;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_running = true;
+    std::atomic<bool> m_aborting{ false };
+
+    std::vector<entry> m_profiles;
+    size_t m_active = 0;
+
+    std::thread m_thread;
+};
@@ -0,0 +1,295 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "qoe_tracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+const char* reason_names[] = { "completed", "next", "previous", "jump", "stopped", "failed", "interrupted" };
+
+int elapsed_ms( std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to )
+{
+    return static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( to - from ).count() );
+}
+
+qoe_tracker::percentiles percentiles_of( std::vector<int>& values )
+{
+    if ( values.empty() )
+        return { 0, 0 };
+
+    // nearest rank
+    auto rank = [&values]( size_t percent ) {
+        auto n = ( percent * values.size() + 99 ) / 100;
+        auto itr = values.begin() + static_cast<long>( std::max<size_t>( n, 1 ) - 1 );
+        std::nth_element( values.begin(), itr, values.end() );
+        return *itr;
+    };
+    auto p50 = rank( 50 );
+    auto p99 = rank( 99 );
+    return { p50, p99 };
+}
+
+} // namespace
+
+qoe_tracker::qoe_tracker( size_t capacity ) : m_ring( std::max<size_t>( capacity, 1 ) )
+{
+}
+
+void qoe_tracker::on_track_selected( long long track_id )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    // selected again before starting to render
+    if ( m_next.active )
+        _close( m_next, m_has_pending_reason ? m_pending_reason : end_reason::interrupted );
+
+    m_next = open_record{};
+    m_next.active = true;
+    m_next.data = record{ track_id, -1, -1, 0, 0, 0, 0, 0, 0, end_reason::completed, {} };
+    m_next.selected = clock::now();
+}
+
+void qoe_tracker::on_format( const std::string& format )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    // the header comes with the first data of a stream, before it renders
+    auto& open = m_next.active ? m_next : m_current;
+    if ( !open.active )
+        return;
+
+    auto length = std::min( format.size(), sizeof( open.data.format ) - 1 );
+    std::memcpy( open.data.format, format.data(), length );
+    open.data.format[length] = '\0';
+}
+
+void qoe_tracker::on_data_ready()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( m_next.active && m_next.data.first_data_ms < 0 )
+        m_next.data.first_data_ms = elapsed_ms( m_next.selected, clock::now() );
+}
+
+void qoe_tracker::on_render_start()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_next.active )
+        return;
+
+    if ( m_current.active )
+        _close( m_current, m_has_pending_reason ? m_pending_reason : end_reason::interrupted );
+
+    m_current = m_next;
+    m_next.active = false;
+    m_current.data.first_audio_ms = elapsed_ms( m_current.selected, clock::now() );
+    m_position_ms = 0;
+}
+
+void qoe_tracker::on_start_failure()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( m_next.active )
+        _close( m_next, end_reason::failed );
+}
+
+void qoe_tracker::on_underflow()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_current.active || m_current.stalled )
+        return;
+
+    m_current.stalled = true;
+    m_current.stall_start = clock::now();
+    m_current.data.stall_count++;
+}
+
+void qoe_tracker::on_resumed()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    // also sent when resuming from a pause, which is not a stall
+    if ( m_current.active )
+        _end_stall( m_current, clock::now() );
+}
+
+void qoe_tracker::on_seek()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_current.active )
+        return;
+
+    m_current.seeking = true;
+    m_current.seek_start = clock::now();
+}
+
+void qoe_tracker::on_seek_ready()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_current.active || !m_current.seeking )
+        return;
+
+    auto latency_ms = elapsed_ms( m_current.seek_start, clock::now() );
+    m_current.seeking = false;
+    m_current.data.seek_count++;
+    m_current.data.seek_total_ms += latency_ms;
+    m_current.data.seek_max_ms = std::max( m_current.data.seek_max_ms, latency_ms );
+}
+
+void qoe_tracker::on_track_end()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( !m_current.active )
+        return;
+
+    _close( m_current, m_has_pending_reason ? m_pending_reason : end_reason::completed );
+
+    // a natural next is selected ahead of the end : the listener only waits from now on
+    if ( m_next.active )
+    {
+        auto now = clock::now();
+        auto waited_ms = elapsed_ms( m_next.selected, now );
+        if ( m_next.data.first_data_ms >= 0 )
+            m_next.data.first_data_ms = std::max( 0, m_next.data.first_data_ms - waited_ms );
+        m_next.selected = now;
+    }
+}
+
+void qoe_tracker::on_track_removed()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    if ( m_current.active )
+        _close( m_current, m_has_pending_reason ? m_pending_reason : end_reason::interrupted );
+}
+
+void qoe_tracker::on_user_action( end_reason reason )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    m_has_pending_reason = true;
+    m_pending_reason = reason;
+}
+
+std::vector<qoe_tracker::record> qoe_tracker::records()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    std::vector<record> ordered;
+    ordered.reserve( m_count );
+    for ( size_t i = 0; i < m_count; i++ )
+        ordered.push_back( m_ring[( m_head + m_ring.size() - m_count + i ) % m_ring.size()] );
+    return ordered;
+}
+
+qoe_tracker::aggregates qoe_tracker::current_aggregates()
+{
+    std::vector<int> first_data;
+    std::vector<int> first_audio;
+    std::vector<int> seeks;
+    std::vector<int> stalls;
+
+    aggregates result{};
+    long stalled_ms = 0;
+    long played_ms = 0;
+    int stalled_tracks = 0;
+
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+
+        result.tracks = static_cast<int>( m_count );
+        for ( size_t i = 0; i < m_count; i++ )
+        {
+            const auto& r = m_ring[( m_head + m_ring.size() - m_count + i ) % m_ring.size()];
+            if ( r.first_data_ms >= 0 )
+                first_data.push_back( r.first_data_ms );
+            if ( r.first_audio_ms >= 0 )
+                first_audio.push_back( r.first_audio_ms );
+            if ( r.seek_count > 0 )
+                seeks.push_back( r.seek_total_ms / r.seek_count );
+            stalls.push_back( r.stall_ms );
+
+            stalled_ms += r.stall_ms;
+            played_ms += r.played_ms;
+            stalled_tracks += r.stall_count > 0 ? 1 : 0;
+            result.skips += r.reason == end_reason::next || r.reason == end_reason::previous ? 1 : 0;
+            result.failures += r.reason == end_reason::failed ? 1 : 0;
+        }
+    }
+
+    result.first_data_ms = percentiles_of( first_data );
+    result.first_audio_ms = percentiles_of( first_audio );
+    result.seek_ms = percentiles_of( seeks );
+    result.stall_ms = percentiles_of( stalls );
+    result.stalled_tracks = result.tracks ? static_cast<float>( stalled_tracks ) / result.tracks : 0.f;
+    result.stall_ratio = played_ms + stalled_ms > 0 ? static_cast<float>( stalled_ms ) / ( played_ms + stalled_ms ) : 0.f;
+    return result;
+}
+
+const char* qoe_tracker::reason_name( end_reason reason )
+{
+    return reason_names[static_cast<size_t>( reason )];
+}
+
+void qoe_tracker::_close( open_record& open, end_reason reason )
+{
+    auto now = clock::now();
+    _end_stall( open, now );
+
+    if ( &open == &m_current )
+    {
+        open.data.played_ms = m_position_ms;
+        // the user action applied to the track being played
+        m_has_pending_reason = false;
+    }
+    open.data.reason = reason;
+    open.active = false;
+
+    std::cout << "QOE track " << open.data.track_id << " => " << reason_name( reason ) << " - first audio : " << open.data.first_audio_ms
+              << "ms - stalls : " << open.data.stall_count << " (" << open.data.stall_ms << "ms) - seeks : " << open.data.seek_count << std::endl;
+
+    m_ring[m_head] = open.data;
+    m_head = ( m_head + 1 ) % m_ring.size();
+    m_count = std::min( m_count + 1, m_ring.size() );
+}
+
+void qoe_tracker::_end_stall( open_record& open, clock::time_point now )
+{
+    if ( !open.stalled )
+        return;
+
+    open.stalled = false;
+    open.data.stall_ms += elapsed_ms( open.stall_start, now );
+}
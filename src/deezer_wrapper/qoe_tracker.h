@@ -0,0 +1,142 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * Quality of experience as heard by the listener : one compact record per track is built from the
+ * player events (time to first audio, stalls, seek latencies, why the track ended, stream format) and
+ * kept in a ring buffer, over which p50/p99 aggregates are computed on demand.
+ */
+class qoe_tracker
+{
+public:
+    enum class end_reason : uint8_t
+    {
+        completed,      ///< stream ended
+        next,           ///< user skipped forward
+        previous,       ///< user went back
+        jump,           ///< other content or queue index loaded
+        stopped,        ///< playback stopped
+        failed,         ///< track could not start
+        interrupted     ///< replaced or removed by the SDK (rights, radio...)
+    };
+
+    struct record
+    {
+        long long track_id;
+        int first_data_ms;      ///< selection to first streamed data, -1 if none came
+        int first_audio_ms;     ///< selection to first rendered audio, -1 if it never started
+        int played_ms;          ///< render position when the track ended
+        int stall_count;
+        int stall_ms;
+        int seek_count;
+        int seek_max_ms;        ///< seek request to data ready
+        int seek_total_ms;
+        end_reason reason;
+        char format[23];        ///< stream format header, truncated
+    };
+
+    struct percentiles
+    {
+        int p50;
+        int p99;
+    };
+
+    struct aggregates
+    {
+        int tracks;                 ///< records in the window
+        percentiles first_data_ms;
+        percentiles first_audio_ms;
+        percentiles seek_ms;
+        percentiles stall_ms;       ///< per track stalled time
+        float stalled_tracks;       ///< ratio of tracks with at least one stall
+        float stall_ratio;          ///< stalled time over played time
+        int skips;                  ///< next/previous before the end of the stream
+        int failures;
+    };
+
+    explicit qoe_tracker( size_t capacity );
+
+    void on_track_selected( long long track_id );
+    void on_format( const std::string& format );
+    void on_data_ready();
+    void on_render_start();
+    void on_start_failure();
+    void on_underflow();
+    void on_resumed();
+    void on_seek();
+    void on_seek_ready();
+    void on_track_end();
+    void on_track_removed();
+    void on_render_progress( int position_ms ) { m_position_ms = position_ms; }
+
+    // user intent, giving the reason of the next track change
+    void on_user_action( end_reason reason );
+
+    std::vector<record> records();      ///< oldest first
+    aggregates current_aggregates();
+
+    static const char* reason_name( end_reason reason );
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct open_record
+    {
+        bool active = false;
+        record data;
+        clock::time_point selected;
+        clock::time_point stall_start;
+        clock::time_point seek_start;
+        bool stalled = false;
+        bool seeking = false;
+    };
+
+    void _close( open_record& open, end_reason reason );
+    void _end_stall( open_record& open, clock::time_point now );
+
+private:
+    std::mutex m_mutex;
+
+    // selected and not yet rendered (next track being buffered), and currently rendered
+    open_record m_next;
+    open_record m_current;
+
+    bool m_has_pending_reason = false;
+    end_reason m_pending_reason = end_reason::completed;
+
+    std::atomic<int> m_position_ms{ 0 };
+
+    std::vector<record> m_ring;
+    size_t m_head = 0;  ///< next slot to write
+    size_t m_count = 0;
+};
@@ -0,0 +1,292 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ram_cache.h"
+#include "thread_policy.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr size_t copy_chunk = 1 << 20; // 1MB sequential writes
+
+void make_dirs( const std::string& path )
+{
+    for ( auto pos = path.find( '/', 1 ); ; pos = path.find( '/', pos + 1 ) )
+    {
+        ::mkdir( path.substr( 0, pos ).c_str(), 0755 );
+        if ( pos == std::string::npos )
+            break;
+    }
+}
+
+// calls visitor( relative_path, stat ) for each regular file below root
+void walk( const std::string& root, const std::string& relative, const std::function<void( const std::string&, const struct stat& )>& visitor )
+{
+    auto* dir = ::opendir( ( root + relative ).c_str() );
+    if ( !dir )
+        return;
+
+    while ( auto* entry = ::readdir( dir ) )
+    {
+        std::string name = entry->d_name;
+        if ( name == "." || name == ".." )
+            continue;
+
+        auto path = relative + "/" + name;
+        struct stat st;
+        if ( ::lstat( ( root + path ).c_str(), &st ) != 0 )
+            continue;
+
+        if ( S_ISDIR( st.st_mode ) )
+            walk( root, path, visitor );
+        else if ( S_ISREG( st.st_mode ) )
+            visitor( path, st );
+    }
+
+    ::closedir( dir );
+}
+
+// copies through a temporary file and a rename, so that an interrupted copy never leaves a torn file
+bool copy_file( const std::string& from, const std::string& to )
+{
+    auto in = ::open( from.c_str(), O_RDONLY );
+    if ( in < 0 )
+        return false;
+
+    make_dirs( to.substr( 0, to.rfind( '/' ) ) );
+
+    auto tmp = to + ".tmp";
+    auto out = ::open( tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+    if ( out < 0 )
+    {
+        ::close( in );
+        return false;
+    }
+
+    std::vector<char> chunk( copy_chunk );
+    auto ok = true;
+    ssize_t count;
+    while ( ok && ( count = ::read( in, chunk.data(), chunk.size() ) ) > 0 )
+        ok = ::write( out, chunk.data(), count ) == count;
+    ok = ok && count == 0;
+
+    ::close( in );
+    ::close( out );
+
+    return ok ? ::rename( tmp.c_str(), to.c_str() ) == 0 : ( ::unlink( tmp.c_str() ), false );
+}
+
+long long mtime_ns( const struct stat& st )
+{
+    return static_cast<long long>( st.st_mtim.tv_sec ) * 1000000000LL + st.st_mtim.tv_nsec;
+}
+
+} // namespace
+
+ram_cache::ram_cache( const std::string& persistent_path, const std::string& ram_path, std::chrono::seconds flush_period,
+                      unsigned long profile_quota_kB )
+    : m_persistent_path( persistent_path + "/profile" ), m_ram_path( ram_path ), m_flush_period( flush_period ),
+      m_profile_quota_kB( profile_quota_kB )
+{
+    make_dirs( cache_path() );
+    make_dirs( m_persistent_path );
+
+    m_profile_in_ram = _profile_fits();
+    if ( m_profile_in_ram )
+    {
+        make_dirs( profile_path() );
+        _restore();
+    }
+
+    m_thread = std::thread( &ram_cache::_run, this );
+}
+
+ram_cache::~ram_cache()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_wakeup.notify_one();
+
+    if ( m_thread.joinable() )
+        m_thread.join();
+}
+
+std::string ram_cache::cache_path() const
+{
+    return m_ram_path + "/cache";
+}
+
+std::string ram_cache::profile_path() const
+{
+    return m_profile_in_ram ? m_ram_path + "/profile" : m_persistent_path;
+}
+
+ram_cache::infos ram_cache::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    return { m_ram_kB, m_flushed_kB, m_flush_count, process_written_kB() };
+}
+
+unsigned long ram_cache::process_written_kB()
+{
+    std::ifstream io( "/proc/self/io" );
+    std::string key;
+    unsigned long long value;
+    while ( io >> key >> value )
+        if ( key == "write_bytes:" )
+            return static_cast<unsigned long>( value / 1024 );
+    return 0;
+}
+
+void ram_cache::_run()
+{
+    thread_policy::name_current_thread( "dz-ram-cache" );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+
+    while ( m_running )
+    {
+        m_wakeup.wait_for( lock, m_flush_period, [this]() { return !m_running; } );
+
+        lock.unlock();
+        _flush();
+        lock.lock();
+    }
+}
+
+// the offline store grows with the synchronized tracks : a profile that does not fit is left on persistent storage
+bool ram_cache::_profile_fits()
+{
+    unsigned long long profile_bytes = 0;
+    walk( m_persistent_path, "", [&]( const std::string&, const struct stat& st ) {
+        profile_bytes += st.st_size;
+    } );
+
+    struct statvfs fs;
+    auto available_bytes = ::statvfs( m_ram_path.c_str(), &fs ) == 0 ? static_cast<unsigned long long>( fs.f_bavail ) * fs.f_frsize : 0ULL;
+    auto quota_bytes = std::min<unsigned long long>( m_profile_quota_kB * 1024ULL, available_bytes );
+
+    if ( profile_bytes <= quota_bytes )
+        return true;
+
+    std::cout << "RAM CACHE profile of " << profile_bytes / 1024 << "kB over the " << quota_bytes / 1024
+              << "kB quota => kept in " << m_persistent_path << std::endl;
+    return false;
+}
+
+void ram_cache::_restore()
+{
+    auto ram_profile = profile_path();
+
+    // only restored files are tracked : the persistent copy of any other one is never removed by a flush
+    walk( m_persistent_path, "", [&]( const std::string& path, const struct stat& ) {
+        struct stat st;
+        auto restored = ::stat( ( ram_profile + path ).c_str(), &st ) == 0 ||
+                        ( copy_file( m_persistent_path + path, ram_profile + path ) && ::stat( ( ram_profile + path ).c_str(), &st ) == 0 );
+        if ( restored )
+            m_flushed[path] = { static_cast<long long>( st.st_size ), mtime_ns( st ) };
+        else
+            std::cerr << "RAM CACHE cannot restore " << path << std::endl;
+    } );
+
+    std::cout << "RAM CACHE restored " << m_flushed.size() << " profile files => " << ram_profile << std::endl;
+}
+
+void ram_cache::_flush()
+{
+    unsigned long ram_bytes = 0;
+    unsigned long flushed_bytes = 0;
+
+    walk( cache_path(), "", [&]( const std::string&, const struct stat& st ) {
+        ram_bytes += st.st_size;
+    } );
+
+    // durable files that changed since the last batch, and files that disappeared from the RAM tier
+    auto ram_profile = profile_path();
+    std::map<std::string, file_state> current;
+    unsigned long profile_bytes = 0;
+    if ( m_profile_in_ram )
+        walk( ram_profile, "", [&]( const std::string& path, const struct stat& st ) {
+            profile_bytes += st.st_size;
+            current[path] = { static_cast<long long>( st.st_size ), mtime_ns( st ) };
+        } );
+    ram_bytes += profile_bytes;
+
+    // the profile cannot move while the SDK uses it : it is left on persistent storage from the next start
+    if ( profile_bytes / 1024 > m_profile_quota_kB && !m_over_quota )
+    {
+        m_over_quota = true;
+        std::cout << "RAM CACHE profile of " << profile_bytes / 1024 << "kB over the " << m_profile_quota_kB
+                  << "kB quota => kept in " << m_persistent_path << " from the next start" << std::endl;
+    }
+
+    for ( auto& file : current )
+    {
+        auto itr = m_flushed.find( file.first );
+        if ( itr != m_flushed.end() && itr->second.size == file.second.size && itr->second.mtime_ns == file.second.mtime_ns )
+            continue;
+        if ( copy_file( ram_profile + file.first, m_persistent_path + file.first ) )
+            flushed_bytes += file.second.size;
+        else
+            file.second = { -1, -1 }; // retried next batch
+    }
+    for ( const auto& file : m_flushed )
+        if ( current.find( file.first ) == current.end() )
+            ::unlink( ( m_persistent_path + file.first ).c_str() );
+
+    m_flushed.swap( current );
+
+    // one sync for the whole batch
+    if ( flushed_bytes )
+    {
+        auto fd = ::open( m_persistent_path.c_str(), O_RDONLY );
+        if ( fd >= 0 )
+        {
+            ::syncfs( fd );
+            ::close( fd );
+        }
+        std::cout << "RAM CACHE flushed " << flushed_bytes / 1024 << "kB => " << m_persistent_path << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_ram_kB = ram_bytes / 1024;
+    m_flushed_kB += flushed_bytes / 1024;
+    if ( flushed_bytes )
+        m_flush_count++;
+}
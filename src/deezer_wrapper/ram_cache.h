@@ -0,0 +1,95 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+ * Two tier storage for the SDK : streaming cache and user profile both live in a RAM backed directory
+ * (tmpfs), the streaming cache being volatile while the profile (credentials, offline store) is
+ * restored from persistent storage at startup and written back to it in periodic sequential batches.
+ * A profile larger than its quota, or than the room left in the RAM tier, stays on persistent storage.
+ */
+class ram_cache
+{
+public:
+    struct infos
+    {
+        unsigned long ram_kB;           ///< current RAM tier footprint
+        unsigned long flushed_kB;       ///< profile data written back to persistent storage
+        int flush_count;                ///< flush batches that had something to write
+        unsigned long written_kB;       ///< bytes this process caused to be written to storage
+    };
+
+    ram_cache( const std::string& persistent_path, const std::string& ram_path, std::chrono::seconds flush_period,
+               unsigned long profile_quota_kB );
+    ~ram_cache();
+
+    std::string cache_path() const;     // volatile tier, for dz_connect_cache_path_set
+    std::string profile_path() const;   // durable tier, for the user profile path
+
+    infos current_infos();
+
+    static unsigned long process_written_kB();
+
+private:
+    struct file_state
+    {
+        long long size;
+        long long mtime_ns;
+    };
+
+    void _run();
+    bool _profile_fits();
+    void _restore();
+    void _flush();
+
+private:
+    const std::string m_persistent_path;
+    const std::string m_ram_path;
+    const std::chrono::seconds m_flush_period;
+    const unsigned long m_profile_quota_kB;
+    bool m_profile_in_ram = false;
+    bool m_over_quota = false;      // flush thread only
+
+    // last flushed state of each durable file, by path relative to the profile tier
+    std::map<std::string, file_state> m_flushed;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_running = true;
+
+    unsigned long m_ram_kB = 0;
+    unsigned long m_flushed_kB = 0;
+    int m_flush_count = 0;
+
+    std::thread m_thread;
+};
@@ -0,0 +1,637 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "remote_server.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int listener_tag = -1;
+constexpr int max_iovecs = 16;
+
+// RFC 3174, only used for the WebSocket handshake
+std::array<uint8_t, 20> sha1( const std::string& message )
+{
+    uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+    auto data = message;
+    auto bit_length = static_cast<uint64_t>( message.size() ) * 8;
+    data.push_back( static_cast<char>( 0x80 ) );
+    while ( data.size() % 64 != 56 )
+        data.push_back( 0 );
+    for ( auto i = 7; i >= 0; i-- )
+        data.push_back( static_cast<char>( bit_length >> ( i * 8 ) ) );
+
+    auto rotate = []( uint32_t value, int bits ) { return ( value << bits ) | ( value >> ( 32 - bits ) ); };
+
+    for ( size_t chunk = 0; chunk < data.size(); chunk += 64 )
+    {
+        uint32_t w[80];
+        for ( auto i = 0; i < 16; i++ )
+        {
+            const auto* p = reinterpret_cast<const uint8_t*>( &data[chunk + 4 * i] );
+            w[i] = ( uint32_t( p[0] ) << 24 ) | ( uint32_t( p[1] ) << 16 ) | ( uint32_t( p[2] ) << 8 ) | p[3];
+        }
+        for ( auto i = 16; i < 80; i++ )
+            w[i] = rotate( w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1 );
+
+        auto a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for ( auto i = 0; i < 80; i++ )
+        {
+            uint32_t f, k;
+            if ( i < 20 )      { f = ( b & c ) | ( ~b & d );             k = 0x5A827999; }
+            else if ( i < 40 ) { f = b ^ c ^ d;                          k = 0x6ED9EBA1; }
+            else if ( i < 60 ) { f = ( b & c ) | ( b & d ) | ( c & d );  k = 0x8F1BBCDC; }
+            else               { f = b ^ c ^ d;                          k = 0xCA62C1D6; }
+            auto t = rotate( a, 5 ) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotate( b, 30 );
+            b = a;
+            a = t;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+    }
+
+    std::array<uint8_t, 20> digest;
+    for ( auto i = 0; i < 20; i++ )
+        digest[i] = static_cast<uint8_t>( h[i / 4] >> ( 24 - 8 * ( i % 4 ) ) );
+    return digest;
+}
+
+std::string base64( const uint8_t* data, size_t size )
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string encoded;
+    for ( size_t i = 0; i < size; i += 3 )
+    {
+        uint32_t group = uint32_t( data[i] ) << 16;
+        if ( i + 1 < size ) group |= uint32_t( data[i + 1] ) << 8;
+        if ( i + 2 < size ) group |= data[i + 2];
+        encoded.push_back( alphabet[( group >> 18 ) & 63] );
+        encoded.push_back( alphabet[( group >> 12 ) & 63] );
+        encoded.push_back( i + 1 < size ? alphabet[( group >> 6 ) & 63] : '=' );
+        encoded.push_back( i + 2 < size ? alphabet[group & 63] : '=' );
+    }
+    return encoded;
+}
+
+std::string lowercase( std::string text )
+{
+    std::transform( text.begin(), text.end(), text.begin(), []( unsigned char c ) { return std::tolower( c ); } );
+    return text;
+}
+
+std::string trim( const std::string& text )
+{
+    auto first = text.find_first_not_of( " \t" );
+    auto last = text.find_last_not_of( " \t\r" );
+    return first == std::string::npos ? std::string() : text.substr( first, last - first + 1 );
+}
+
+// value of a query parameter, "" when missing
+std::string query_parameter( const std::string& query, const std::string& name )
+{
+    std::istringstream parameters( query );
+    std::string parameter;
+    while ( std::getline( parameters, parameter, '&' ) )
+    {
+        if ( parameter.compare( 0, name.size() + 1, name + "=" ) == 0 )
+            return parameter.substr( name.size() + 1 );
+    }
+    return std::string();
+}
+
+// compares in a time that does not depend on where the strings differ
+bool same_secret( const std::string& a, const std::string& b )
+{
+    unsigned char difference = a.size() == b.size() ? 0 : 1;
+    for ( size_t i = 0; i < a.size(); i++ )
+        difference |= static_cast<unsigned char>( a[i] ^ b[i % std::max<size_t>( b.size(), 1 )] );
+    return difference == 0 && !b.empty();
+}
+
+} // namespace
+
+remote_server::remote_server( const std::string& address, int port, const std::string& token, command_handler handler )
+    : m_handler( std::move( handler ) ),
+      m_token( token )
+{
+    m_snapshot_frame = _frame( 0x1, m_snapshot );
+
+    m_listener = socket( AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+    int enable = 1;
+    setsockopt( m_listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof( enable ) );
+
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_port = htons( static_cast<uint16_t>( port ) );
+
+    if ( inet_pton( AF_INET, address.c_str(), &local.sin_addr ) != 1 )
+    {
+        std::cerr << "remote control cannot listen on " << address << " : not an IPv4 address" << std::endl;
+        if ( m_listener >= 0 )
+            close( m_listener );
+        m_listener = -1;
+        return;
+    }
+
+    if ( m_listener < 0
+         || bind( m_listener, reinterpret_cast<sockaddr*>( &local ), sizeof( local ) ) < 0
+         || listen( m_listener, SOMAXCONN ) < 0 )
+    {
+        std::cerr << "remote control cannot listen on " << address << ":" << port << " : " << strerror( errno ) << std::endl;
+        if ( m_listener >= 0 )
+            close( m_listener );
+        m_listener = -1;
+        return;
+    }
+
+    m_epoll = epoll_create1( EPOLL_CLOEXEC );
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = listener_tag;
+    epoll_ctl( m_epoll, EPOLL_CTL_ADD, m_listener, &event );
+
+    if ( m_token.empty() && ntohl( local.sin_addr.s_addr ) >> 24 != 127 )
+        std::cerr << "remote control listens on " << address << " without a token, anyone on the network can drive the player" << std::endl;
+
+    std::cout << "REMOTE => listening on " << address << ":" << port << ( m_token.empty() ? "" : " (token required)" ) << std::endl;
+}
+
+remote_server::~remote_server()
+{
+    for ( auto& c : m_clients )
+        close( c.first );
+    if ( m_epoll >= 0 )
+        close( m_epoll );
+    if ( m_listener >= 0 )
+        close( m_listener );
+}
+
+void remote_server::process()
+{
+    if ( m_epoll < 0 )
+        return;
+
+    epoll_event events[64];
+    auto count = epoll_wait( m_epoll, events, 64, 0 );
+    for ( auto i = 0; i < count; i++ )
+    {
+        if ( events[i].data.fd == listener_tag )
+        {
+            _accept();
+            continue;
+        }
+
+        auto it = m_clients.find( events[i].data.fd );
+        if ( it == m_clients.end() || it->second.closed )
+            continue;
+        auto& c = it->second;
+
+        if ( events[i].events & ( EPOLLERR | EPOLLHUP ) )
+            _close( c );
+        else if ( events[i].events & EPOLLIN )
+            _read( c );
+        if ( !c.closed && ( events[i].events & EPOLLOUT ) )
+            _flush( c );
+    }
+
+    // deferred, so that a descriptor is not reused by an accept while events still refer to it
+    for ( auto fd : m_closed )
+    {
+        m_clients.erase( fd );
+        close( fd );
+    }
+    m_closed.clear();
+}
+
+void remote_server::publish( const std::string& delta, const std::string& snapshot )
+{
+    m_snapshot = snapshot;
+    m_snapshot_frame.reset();   // framed on the next handshake only
+
+    if ( m_epoll < 0 )
+        return;
+
+    auto frame = _frame( 0x1, delta );
+    m_frames++;
+
+    for ( auto& entry : m_clients )
+    {
+        auto& c = entry.second;
+        if ( !c.websocket || c.closing || c.closed )
+            continue;
+
+        if ( c.output.size() >= max_pending_frames )
+        {
+            m_dropped_clients++;
+            _close( c );
+            continue;
+        }
+        _send( c, frame );
+    }
+}
+
+remote_server::infos remote_server::current_infos() const
+{
+    infos result{ 0, 0, m_frames, m_bytes_sent, m_dropped_clients };
+    for ( const auto& entry : m_clients )
+    {
+        if ( entry.second.closed )
+            continue;
+        if ( entry.second.websocket )
+            result.websocket_clients++;
+        else
+            result.http_clients++;
+    }
+    return result;
+}
+
+void remote_server::_accept()
+{
+    int fd;
+    while ( ( fd = accept4( m_listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC ) ) >= 0 )
+    {
+        // updates are small and latency matters more than packet count
+        int enable = 1;
+        setsockopt( fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof( enable ) );
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if ( epoll_ctl( m_epoll, EPOLL_CTL_ADD, fd, &event ) < 0 )
+        {
+            close( fd );
+            continue;
+        }
+
+        client c;
+        c.fd = fd;
+        m_clients[fd] = std::move( c );
+    }
+}
+
+void remote_server::_read( client& c )
+{
+    char data[4096];
+    ssize_t size;
+    while ( ( size = recv( c.fd, data, sizeof( data ), 0 ) ) > 0 )
+    {
+        c.input.append( data, static_cast<size_t>( size ) );
+        if ( c.input.size() > max_request_bytes + 16 )
+        {
+            _close( c );
+            return;
+        }
+    }
+    if ( size < 0 && errno != EAGAIN && errno != EWOULDBLOCK )
+    {
+        _close( c );
+        return;
+    }
+
+    // a closing client has nothing more to say
+    while ( !c.closed && !c.closing && ( c.websocket ? _handle_frames( c ) : _handle_request( c ) ) ) {}
+
+    // peer shutdown : pending output is still written
+    if ( size == 0 )
+        _close_after_output( c );
+}
+
+bool remote_server::_handle_request( client& c )
+{
+    auto header_end = c.input.find( "\r\n\r\n" );
+    if ( header_end == std::string::npos )
+    {
+        if ( c.input.size() > max_request_bytes )
+            _close( c );
+        return false;
+    }
+
+    std::istringstream header( c.input.substr( 0, header_end ) );
+    std::string method, target, line;
+    header >> method >> target;
+    std::getline( header, line );
+
+    size_t content_length = 0;
+    std::string upgrade, key, authorization, host, origin;
+    while ( std::getline( header, line ) )
+    {
+        auto colon = line.find( ':' );
+        if ( colon == std::string::npos )
+            continue;
+        auto name = lowercase( trim( line.substr( 0, colon ) ) );
+        auto value = trim( line.substr( colon + 1 ) );
+        if ( name == "content-length" )
+            content_length = std::min<size_t>( std::strtoul( value.c_str(), nullptr, 10 ), max_request_bytes + 1 );
+        else if ( name == "upgrade" )
+            upgrade = lowercase( value );
+        else if ( name == "sec-websocket-key" )
+            key = value;
+        else if ( name == "authorization" )
+            authorization = value;
+        else if ( name == "host" )
+            host = lowercase( value );
+        else if ( name == "origin" )
+            origin = lowercase( value );
+    }
+
+    if ( content_length > max_request_bytes )
+    {
+        _send( c, _response( 413, "text/plain", "request too large\n" ) );
+        _close_after_output( c );
+        return false;
+    }
+    if ( c.input.size() < header_end + 4 + content_length )
+        return false;
+
+    auto body = c.input.substr( header_end + 4, content_length );
+    c.input.erase( 0, header_end + 4 + content_length );
+
+    // browsers can't set headers on WebSocket connections, hence the token query parameter
+    auto query_start = target.find( '?' );
+    auto query = query_start == std::string::npos ? std::string() : target.substr( query_start + 1 );
+    target = target.substr( 0, query_start );
+
+    // pages from other sites can still post simple requests to a loopback or LAN address : only same origin browser requests are served
+    auto scheme_end = origin.find( "://" );
+    if ( !origin.empty() && ( scheme_end == std::string::npos || origin.substr( scheme_end + 3 ) != host ) )
+    {
+        _send( c, _response( 403, "text/plain", "cross origin requests are not allowed\n" ) );
+        _close_after_output( c );
+        return false;
+    }
+
+    const std::string bearer = "Bearer ";
+    if ( !m_token.empty()
+         && !( authorization.compare( 0, bearer.size(), bearer ) == 0 && same_secret( authorization.substr( bearer.size() ), m_token ) )
+         && !same_secret( query_parameter( query, "token" ), m_token ) )
+    {
+        _send( c, _response( 401, "text/plain", "missing or wrong token\n" ) );
+        _close_after_output( c );
+        return false;
+    }
+
+    const std::string command_prefix = "/command/";
+    if ( method == "GET" && target == "/events" && upgrade == "websocket" && !key.empty() )
+    {
+        auto digest = sha1( key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11" );
+        _send( c, std::make_shared<const std::string>( "HTTP/1.1 101 Switching Protocols\r\n"
+                                                       "Upgrade: websocket\r\n"
+                                                       "Connection: Upgrade\r\n"
+                                                       "Sec-WebSocket-Accept: " + base64( digest.data(), digest.size() ) + "\r\n\r\n" ) );
+        if ( !m_snapshot_frame )
+            m_snapshot_frame = _frame( 0x1, m_snapshot );
+        _send( c, m_snapshot_frame );
+        c.websocket = true;
+        return !c.closed;
+    }
+    else if ( method == "GET" && target == "/state" )
+    {
+        _send( c, _response( 200, "application/json", m_snapshot ) );
+    }
+    else if ( method == "POST" && target.compare( 0, command_prefix.size(), command_prefix ) == 0 )
+    {
+        auto accepted = m_handler && m_handler( target.substr( command_prefix.size() ), trim( body ) );
+        _send( c, accepted ? _response( 202, "text/plain", "accepted\n" ) : _response( 404, "text/plain", "unknown command\n" ) );
+    }
+    else
+    {
+        _send( c, _response( 404, "text/plain", "GET /state, GET /events (websocket), POST /command/<name>\n" ) );
+    }
+
+    // one request per connection
+    _close_after_output( c );
+    return false;
+}
+
+bool remote_server::_handle_frames( client& c )
+{
+    if ( c.input.size() < 2 )
+        return false;
+
+    const auto* data = reinterpret_cast<const uint8_t*>( c.input.data() );
+    auto final_fragment = ( data[0] & 0x80 ) != 0;
+    auto opcode = data[0] & 0x0f;
+    auto masked = ( data[1] & 0x80 ) != 0;
+    uint64_t length = data[1] & 0x7f;
+    size_t header = 2;
+
+    if ( length == 126 )
+    {
+        if ( c.input.size() < 4 )
+            return false;
+        length = ( uint64_t( data[2] ) << 8 ) | data[3];
+        header = 4;
+    }
+    else if ( length == 127 )
+    {
+        if ( c.input.size() < 10 )
+            return false;
+        length = 0;
+        for ( auto i = 2; i < 10; i++ )
+            length = ( length << 8 ) | data[i];
+        header = 10;
+    }
+
+    // commands are short single frames, always masked by browsers
+    if ( !masked || !final_fragment || length > max_request_bytes )
+    {
+        _close( c );
+        return false;
+    }
+    if ( c.input.size() < header + 4 + length )
+        return false;
+
+    const auto* mask = data + header;
+    std::string payload( length, '\0' );
+    for ( size_t i = 0; i < length; i++ )
+        payload[i] = static_cast<char>( data[header + 4 + i] ^ mask[i % 4] );
+    c.input.erase( 0, header + 4 + length );
+
+    switch ( opcode )
+    {
+        case 0x1: // text
+        {
+            auto space = payload.find( ' ' );
+            auto command = payload.substr( 0, space );
+            auto argument = space == std::string::npos ? std::string() : trim( payload.substr( space + 1 ) );
+            if ( m_handler )
+                m_handler( command, argument );
+            break;
+        }
+        case 0x8: // close
+            _send( c, _frame( 0x8, payload.substr( 0, 2 ) ) );
+            _close_after_output( c );
+            return false;
+        case 0x9: // ping
+            _send( c, _frame( 0xA, payload ) );
+            break;
+        default:
+            break;
+    }
+    return !c.closed;
+}
+
+void remote_server::_send( client& c, const buffer& data )
+{
+    c.output.push_back( data );
+    if ( !c.wants_write )
+        _flush( c );
+}
+
+void remote_server::_flush( client& c )
+{
+    while ( !c.output.empty() )
+    {
+        iovec vectors[max_iovecs];
+        auto count = 0;
+        for ( auto it = c.output.begin(); it != c.output.end() && count < max_iovecs; ++it, ++count )
+        {
+            auto skip = count == 0 ? c.offset : 0;
+            vectors[count].iov_base = const_cast<char*>( ( *it )->data() + skip );
+            vectors[count].iov_len = ( *it )->size() - skip;
+        }
+
+        msghdr message{};
+        message.msg_iov = vectors;
+        message.msg_iovlen = static_cast<size_t>( count );
+        auto written = sendmsg( c.fd, &message, MSG_NOSIGNAL );
+        if ( written < 0 )
+        {
+            if ( errno == EAGAIN || errno == EWOULDBLOCK )
+            {
+                _watch_write( c, true );
+                return;
+            }
+            _close( c );
+            return;
+        }
+
+        m_bytes_sent += written;
+        auto remaining = static_cast<size_t>( written );
+        while ( remaining > 0 )
+        {
+            auto left = c.output.front()->size() - c.offset;
+            if ( remaining < left )
+            {
+                c.offset += remaining;
+                break;
+            }
+            remaining -= left;
+            c.output.pop_front();
+            c.offset = 0;
+        }
+    }
+
+    _watch_write( c, false );
+    if ( c.closing )
+        _close( c );
+}
+
+void remote_server::_watch_write( client& c, bool enable )
+{
+    if ( c.wants_write == enable )
+        return;
+    c.wants_write = enable;
+
+    epoll_event event{};
+    event.events = enable ? EPOLLIN | EPOLLOUT : EPOLLIN;
+    event.data.fd = c.fd;
+    epoll_ctl( m_epoll, EPOLL_CTL_MOD, c.fd, &event );
+}
+
+void remote_server::_close_after_output( client& c )
+{
+    c.closing = true;
+    if ( c.output.empty() )
+        _close( c );
+}
+
+void remote_server::_close( client& c )
+{
+    if ( c.closed )
+        return;
+    c.closed = true;
+    c.output.clear();
+    epoll_ctl( m_epoll, EPOLL_CTL_DEL, c.fd, nullptr );
+    m_closed.push_back( c.fd );
+}
+
+remote_server::buffer remote_server::_frame( uint8_t opcode, const std::string& payload )
+{
+    std::string frame;
+    frame.reserve( payload.size() + 10 );
+    frame.push_back( static_cast<char>( 0x80 | opcode ) );
+    if ( payload.size() < 126 )
+    {
+        frame.push_back( static_cast<char>( payload.size() ) );
+    }
+    else if ( payload.size() < 65536 )
+    {
+        frame.push_back( 126 );
+        frame.push_back( static_cast<char>( payload.size() >> 8 ) );
+        frame.push_back( static_cast<char>( payload.size() ) );
+    }
+    else
+    {
+        frame.push_back( 127 );
+        for ( auto i = 7; i >= 0; i-- )
+            frame.push_back( static_cast<char>( static_cast<uint64_t>( payload.size() ) >> ( 8 * i ) ) );
+    }
+    frame += payload;
+    return std::make_shared<const std::string>( std::move( frame ) );
+}
+
+remote_server::buffer remote_server::_response( int status, const std::string& content_type, const std::string& body )
+{
+    const char* reason = status == 200 ? "OK"
+                       : status == 202 ? "Accepted"
+                       : status == 401 ? "Unauthorized"
+                       : status == 403 ? "Forbidden"
+                       : status == 413 ? "Payload Too Large"
+                       : "Not Found";
+    std::ostringstream response;
+    response << "HTTP/1.1 " << status << " " << reason << "\r\n"
+             << "Content-Type: " << content_type << "\r\n"
+             << "Content-Length: " << body.size() << "\r\n"
+             << "Connection: close\r\n\r\n"
+             << body;
+    return std::make_shared<const std::string>( response.str() );
+}
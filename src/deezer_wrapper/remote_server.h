@@ -0,0 +1,123 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Embedded HTTP + WebSocket remote control server, driven by the host event loop : fd() becomes
+ * readable when any connection needs attention, and process() then handles it without blocking.
+ * Commands are posted to /command/<name> (or sent as "<name> <argument>" WebSocket text messages),
+ * state updates are pushed to every /events WebSocket client. Each update is framed once, and the
+ * frame is shared by all the client output queues rather than copied per client.
+ * When a token is given, requests must carry it as "Authorization: Bearer <token>" or as a token query
+ * parameter (WebSocket clients of browsers), and browser requests from other origins are always refused.
+ */
+class remote_server
+{
+public:
+    using command_handler = std::function<bool( const std::string& command, const std::string& argument )>;
+
+    struct infos
+    {
+        int http_clients;
+        int websocket_clients;
+        long frames;            ///< updates published
+        long bytes_sent;
+        int dropped_clients;    ///< websocket clients closed for not keeping up
+    };
+
+    // a client lagging this many updates behind is disconnected, it gets a fresh snapshot on reconnection
+    static constexpr size_t max_pending_frames = 64;
+    static constexpr size_t max_request_bytes = 8192;
+
+    // address is the IPv4 address to listen on ("127.0.0.1" for this device only), an empty token accepts any client
+    remote_server( const std::string& address, int port, const std::string& token, command_handler handler );
+    ~remote_server();
+
+    remote_server( const remote_server& ) = delete;
+    remote_server& operator=( const remote_server& ) = delete;
+
+    // to be watched for reading by the host event loop, -1 when the server could not listen
+    int fd() const { return m_epoll; }
+    void process();
+
+    // pushes a delta to the connected clients, the snapshot being sent first to new clients and served on /state
+    void publish( const std::string& delta, const std::string& snapshot );
+
+    infos current_infos() const;
+
+private:
+    using buffer = std::shared_ptr<const std::string>;
+
+    struct client
+    {
+        int fd;
+        std::string input;          ///< bytes received and not yet parsed
+        bool websocket = false;
+        bool closing = false;       ///< closed once the output is written
+        bool closed = false;
+        bool wants_write = false;   ///< watched for writing, the socket buffer being full
+        std::deque<buffer> output;
+        size_t offset = 0;          ///< bytes of the first output buffer already written
+    };
+
+    void _accept();
+    void _read( client& c );
+    bool _handle_request( client& c );
+    bool _handle_frames( client& c );
+    void _send( client& c, const buffer& data );
+    void _flush( client& c );
+    void _watch_write( client& c, bool enable );
+    void _close_after_output( client& c );
+    void _close( client& c );
+
+    static buffer _frame( uint8_t opcode, const std::string& payload );
+    static buffer _response( int status, const std::string& content_type, const std::string& body );
+
+private:
+    command_handler m_handler;
+    std::string m_token;
+
+    int m_listener = -1;
+    int m_epoll = -1;
+
+    std::unordered_map<int, client> m_clients;
+    std::vector<int> m_closed;
+
+    std::string m_snapshot = "{}";
+    buffer m_snapshot_frame;
+
+    long m_frames = 0;
+    long m_bytes_sent = 0;
+    int m_dropped_clients = 0;
+};
@@ -0,0 +1,487 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "room_sync.h"
+#include "deezer_wrapper.h"
+#include "thread_policy.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int64_t tick_us = 250000;
+constexpr int64_t state_period_us = 1000000;        // leader state is resent at least this often
+constexpr int64_t sync_period_us = 1000000;         // follower clock exchanges, faster until the filter is full
+constexpr int64_t follower_timeout_us = 5000000;
+constexpr int64_t load_settle_us = 5000000;
+constexpr int64_t jump_settle_us = 3000000;
+constexpr int64_t seek_settle_us = 2000000;
+constexpr int64_t play_settle_us = 1000000;
+constexpr int64_t play_hold_us = 500000;            // leader pauses shorter than this (seeks, stalls) are not followed
+constexpr size_t clock_samples = 8;
+constexpr int max_seek_lead_ms = 3000;
+
+std::string address_key( const sockaddr_in& address )
+{
+    char host[INET_ADDRSTRLEN];
+    inet_ntop( AF_INET, &address.sin_addr, host, sizeof( host ) );
+    return std::string( host ) + ":" + std::to_string( ntohs( address.sin_port ) );
+}
+
+std::string track_content( int track_id )
+{
+    return "dzmedia:///track/" + std::to_string( track_id );
+}
+
+} // namespace
+
+room_sync::player room_sync::bind( deezer_wrapper& wrapper )
+{
+    player p;
+    p.state = [&wrapper]() {
+        return player_state{ wrapper.get_content(),
+                             wrapper.current_queue_infos().index,
+                             wrapper.current_track_infos().id,
+                             wrapper.playback_position_ms(),
+                             wrapper.playback_clock_running() };
+    };
+    p.load = [&wrapper]( const std::string& content ) { wrapper.load_content( content ); };
+    p.jump = [&wrapper]( int index ) { wrapper.playback_start_at( index ); };
+    p.seek = [&wrapper]( int position_ms ) { wrapper.playback_seek( position_ms ); };
+    p.pause = [&wrapper]() { wrapper.playback_pause(); };
+    p.resume = [&wrapper]() { wrapper.playback_resume(); };
+    return p;
+}
+
+room_sync::room_sync( role r, const std::string& host, int port, player p, int simulated_delay_ms ) :
+    m_role( r ),
+    m_player( std::move( p ) ),
+    m_simulated_delay_ms( simulated_delay_ms )
+{
+    m_socket = socket( AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl( INADDR_ANY );
+    local.sin_port = htons( m_role == role::leader ? static_cast<uint16_t>( port ) : 0 );
+
+    if ( m_socket < 0 || ::bind( m_socket, reinterpret_cast<sockaddr*>( &local ), sizeof( local ) ) < 0 )
+    {
+        std::cerr << "room sync cannot bind its socket : " << strerror( errno ) << std::endl;
+        return;
+    }
+
+    if ( m_role == role::follower )
+    {
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        addrinfo* result = nullptr;
+        if ( getaddrinfo( host.c_str(), std::to_string( port ).c_str(), &hints, &result ) != 0 || !result )
+        {
+            std::cerr << "room sync cannot resolve leader " << host << std::endl;
+            return;
+        }
+        std::memcpy( &m_leader_address, result->ai_addr, sizeof( m_leader_address ) );
+        freeaddrinfo( result );
+    }
+
+    if ( pipe2( m_wake_pipe, O_NONBLOCK | O_CLOEXEC ) < 0 )
+        return;
+
+    m_thread = std::thread( &room_sync::_run, this );
+
+    std::cout << "SYNC => " << ( m_role == role::leader ? "leading on port " + std::to_string( port ) : "following " + host + ":" + std::to_string( port ) ) << std::endl;
+}
+
+room_sync::~room_sync()
+{
+    m_running = false;
+    if ( m_thread.joinable() )
+    {
+        char byte = 0;
+        auto written = write( m_wake_pipe[1], &byte, 1 );
+        (void)written;
+        m_thread.join();
+    }
+
+    for ( auto fd : { m_socket, m_wake_pipe[0], m_wake_pipe[1] } )
+    {
+        if ( fd >= 0 )
+            close( fd );
+    }
+}
+
+room_sync::infos room_sync::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    infos result{ m_role == role::leader, false, 0, 0, 0, 0, 0, 0 };
+    if ( m_role == role::leader )
+    {
+        auto now = _now_us();
+        for ( const auto& follower : m_followers )
+        {
+            const auto& entry = follower.second.second;
+            if ( now - entry.last_seen_us > follower_timeout_us )
+                continue;
+            result.followers++;
+            if ( entry.synced && std::abs( entry.skew_ms ) > std::abs( result.skew_ms ) )
+                result.skew_ms = entry.skew_ms;
+        }
+    }
+    else
+    {
+        result.synced = m_have_leader && !m_samples.empty();
+        result.offset_us = static_cast<long>( m_clock.offset_us );
+        result.round_trip_ms = static_cast<int>( m_clock.round_trip_us / 1000 );
+        result.skew_ms = m_skew_ms;
+        result.corrections = m_corrections;
+        result.seek_lead_ms = m_seek_lead_ms;
+    }
+    return result;
+}
+
+int64_t room_sync::_now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>( clock::now().time_since_epoch() ).count();
+}
+
+void room_sync::_run()
+{
+    thread_policy::name_current_thread( "dz-room-sync" );
+
+    auto next_tick = _now_us();
+    while ( m_running )
+    {
+        auto now = _now_us();
+        auto wake = next_tick;
+        if ( !m_delayed.empty() )
+            wake = std::min( wake, m_delayed.front().due_us );
+
+        pollfd fds[2] = { { m_socket, POLLIN, 0 }, { m_wake_pipe[0], POLLIN, 0 } };
+        poll( fds, 2, static_cast<int>( std::max<int64_t>( 0, wake - now + 999 ) / 1000 ) );
+
+        now = _now_us();
+        if ( fds[0].revents & POLLIN )
+            _receive( now );
+        _flush_delayed( now );
+
+        if ( now >= next_tick )
+        {
+            if ( m_role == role::leader )
+                _lead( now );
+            else
+                _follow( now );
+            next_tick = now + tick_us;
+        }
+    }
+}
+
+void room_sync::_receive( int64_t now )
+{
+    char data[1500];
+    sockaddr_in from{};
+    socklen_t from_size = sizeof( from );
+    ssize_t size;
+    while ( ( size = recvfrom( m_socket, data, sizeof( data ), 0, reinterpret_cast<sockaddr*>( &from ), &from_size ) ) > 0 )
+    {
+        _on_datagram( std::string( data, static_cast<size_t>( size ) ), from, now );
+        from_size = sizeof( from );
+    }
+}
+
+void room_sync::_on_datagram( const std::string& data, const sockaddr_in& from, int64_t now )
+{
+    // leader messages drive the player : anything not coming from the leader address and port is ignored
+    if ( m_role == role::follower && ( from.sin_addr.s_addr != m_leader_address.sin_addr.s_addr || from.sin_port != m_leader_address.sin_port ) )
+        return;
+
+    std::istringstream message( data );
+    std::string type;
+    message >> type;
+
+    if ( m_role == role::leader && type == "SYNC" )
+    {
+        // SYNC <follower send time> <skew ms> <synced>
+        int64_t t1 = 0;
+        follower_entry entry{ now, 0, false };
+        message >> t1 >> entry.skew_ms >> entry.synced;
+
+        bool known;
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            auto key = address_key( from );
+            known = m_followers.count( key ) != 0;
+            m_followers[key] = { from, entry };
+        }
+
+        _send( from, "TIME " + std::to_string( t1 ) + " " + std::to_string( now ) + " " + std::to_string( _now_us() ), now );
+        if ( !known )
+            m_broadcast_us = 0;    // new follower : state on the next tick
+    }
+    else if ( m_role == role::follower && type == "TIME" )
+    {
+        // TIME <follower send time> <leader receive time> <leader send time>
+        int64_t t1, t2, t3;
+        if ( !( message >> t1 >> t2 >> t3 ) )
+            return;
+        clock_sample sample{ ( ( t2 - t1 ) + ( t3 - now ) ) / 2, ( now - t1 ) - ( t3 - t2 ) };
+
+        m_samples.push_back( sample );
+        if ( m_samples.size() > clock_samples )
+            m_samples.pop_front();
+
+        // queueing delays only lengthen a round trip : the shortest exchange is the most accurate
+        auto best = *std::min_element( m_samples.begin(), m_samples.end(), []( const clock_sample& a, const clock_sample& b ) {
+            return a.round_trip_us < b.round_trip_us;
+        } );
+
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_clock = best;
+    }
+    else if ( m_role == role::follower && type == "STATE" )
+    {
+        // STATE <sequence> <leader time> <track id> <queue index> <position ms> <playing> <content>
+        int sequence;
+        leader_state state{};
+        message >> sequence >> state.time_us >> state.player.track_id >> state.player.queue_index
+                >> state.player.position_ms >> state.player.playing;
+        if ( !message || ( sequence <= m_leader_sequence && m_leader_sequence - sequence < 1000 ) )
+            return;     // reordered
+        message >> std::ws;
+        std::getline( message, state.player.content );
+
+        if ( !m_have_leader || state.player.playing != m_leader.player.playing )
+            m_leader_playing_since_us = now;
+        m_leader_sequence = sequence;
+        m_leader = state;
+
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_have_leader = true;
+    }
+}
+
+void room_sync::_send( const sockaddr_in& to, const std::string& data, int64_t now )
+{
+    if ( m_simulated_delay_ms > 0 )
+    {
+        static std::minstd_rand random( 1 );
+        auto delay_us = m_simulated_delay_ms * ( 500 + static_cast<int64_t>( random() % 1000 ) );
+        datagram d{ now + delay_us, to, data };
+        m_delayed.insert( std::upper_bound( m_delayed.begin(), m_delayed.end(), d, []( const datagram& a, const datagram& b ) {
+            return a.due_us < b.due_us;
+        } ), d );
+        return;
+    }
+    sendto( m_socket, data.data(), data.size(), 0, reinterpret_cast<const sockaddr*>( &to ), sizeof( to ) );
+}
+
+void room_sync::_flush_delayed( int64_t now )
+{
+    while ( !m_delayed.empty() && m_delayed.front().due_us <= now )
+    {
+        const auto& d = m_delayed.front();
+        sendto( m_socket, d.data.data(), d.data.size(), 0, reinterpret_cast<const sockaddr*>( &d.to ), sizeof( d.to ) );
+        m_delayed.pop_front();
+    }
+}
+
+void room_sync::_lead( int64_t now )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        for ( auto it = m_followers.begin(); it != m_followers.end(); )
+        {
+            if ( now - it->second.second.last_seen_us > follower_timeout_us )
+                it = m_followers.erase( it );
+            else
+                ++it;
+        }
+        if ( m_followers.empty() )
+            return;
+    }
+
+    auto state = m_player.state();
+
+    // sent on any discontinuity, otherwise periodically so that followers can join and datagrams can be lost
+    const auto& last = m_broadcast_state;
+    auto predicted = last.position_ms + ( last.playing ? static_cast<int>( ( now - m_broadcast_us ) / 1000 ) : 0 );
+    auto changed = state.content != last.content || state.queue_index != last.queue_index || state.track_id != last.track_id
+                   || state.playing != last.playing || std::abs( state.position_ms - predicted ) > tolerance_ms;
+
+    if ( changed || now - m_broadcast_us >= state_period_us )
+        _broadcast( state, now );
+}
+
+void room_sync::_broadcast( const player_state& state, int64_t now )
+{
+    std::ostringstream message;
+    message << "STATE " << ++m_sequence << " " << now << " " << state.track_id << " " << state.queue_index << " "
+            << state.position_ms << " " << state.playing << " " << state.content;
+
+    std::vector<sockaddr_in> followers;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        for ( const auto& follower : m_followers )
+            followers.push_back( follower.second.first );
+    }
+    for ( const auto& to : followers )
+        _send( to, message.str(), now );
+
+    m_broadcast_state = state;
+    m_broadcast_us = now;
+}
+
+void room_sync::_follow( int64_t now )
+{
+    int skew_ms;
+    bool synced;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        skew_ms = m_skew_ms;
+        synced = m_have_leader && !m_samples.empty();
+    }
+
+    if ( now >= m_next_sync_us )
+    {
+        _send( m_leader_address, "SYNC " + std::to_string( now ) + " " + std::to_string( skew_ms ) + " " + std::to_string( synced ), now );
+        m_next_sync_us = now + ( m_samples.size() < clock_samples ? tick_us : sync_period_us );
+    }
+
+    if ( !synced || now < m_busy_until_us )
+        return;
+
+    auto state = m_player.state();
+    const auto& leader = m_leader.player;
+
+    if ( leader.content != m_leader_content )
+    {
+        m_leader_content = leader.content;
+        m_track_mode = false;
+    }
+    if ( leader.content.empty() || leader.track_id == 0 )
+        return;
+
+    auto count_action = [this]( int64_t settle_us, int64_t now_us ) {
+        m_busy_until_us = now_us + settle_us;
+        m_out_of_tolerance = 0;
+        m_correcting = false;
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_corrections++;
+    };
+
+    // same queue as the leader, or the leader track alone when the content is personal (flows)
+    auto wanted_content = m_track_mode ? track_content( leader.track_id ) : leader.content;
+    if ( state.content != wanted_content )
+    {
+        std::cout << "SYNC => loading " << wanted_content << std::endl;
+        m_player.load( wanted_content );
+        count_action( load_settle_us, now );
+        return;
+    }
+    if ( state.queue_index < 0 )
+        return;
+    if ( !m_track_mode && state.queue_index != leader.queue_index )
+    {
+        std::cout << "SYNC => jumping to queue index " << leader.queue_index << std::endl;
+        m_player.jump( leader.queue_index );
+        count_action( jump_settle_us, now );
+        return;
+    }
+    if ( state.track_id != leader.track_id )
+    {
+        if ( !m_track_mode && state.track_id != 0 )
+        {
+            std::cout << "SYNC => queue differs from the leader, following track by track" << std::endl;
+            m_track_mode = true;
+        }
+        return;
+    }
+
+    if ( state.playing != leader.playing && now - m_leader_playing_since_us >= play_hold_us )
+    {
+        if ( leader.playing )
+            m_player.resume();
+        else
+            m_player.pause();
+        count_action( play_settle_us, now );
+        return;
+    }
+    if ( !leader.playing || !state.playing )
+        return;
+
+    int64_t leader_now;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        leader_now = now + m_clock.offset_us;
+    }
+    auto expected = leader.position_ms + static_cast<int>( ( leader_now - m_leader.time_us ) / 1000 );
+    auto skew = state.position_ms - expected;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_skew_ms = skew;
+    }
+
+    if ( std::abs( skew ) <= tolerance_ms )
+    {
+        m_out_of_tolerance = 0;
+        m_correcting = false;
+        return;
+    }
+
+    // first measure after a correction : what is left is the seek latency not yet compensated
+    if ( m_correcting )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_seek_lead_ms = std::min( std::max( m_seek_lead_ms - skew / 2, 0 ), max_seek_lead_ms );
+        m_correcting = false;
+    }
+
+    // two measures in a row, so that a late progress sample does not trigger a seek
+    if ( ++m_out_of_tolerance < 2 )
+        return;
+
+    int lead_ms;
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        lead_ms = m_seek_lead_ms;
+    }
+    std::cout << "SYNC => skew " << skew << "ms, seeking to " << expected + lead_ms << "ms" << std::endl;
+    m_player.seek( expected + lead_ms );
+    count_action( seek_settle_us, now );
+    m_correcting = true;
+}
@@ -0,0 +1,181 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <netinet/in.h>
+
+class deezer_wrapper;
+
+/*
+ * Multi-room playback over a small UDP protocol : the leader sends its content, queue index, track
+ * and position to its followers, which estimate the leader clock NTP-style (offset of the exchange
+ * with the smallest round trip among the last ones) and keep their own player on the same track and
+ * position. The SDK has no playback rate control, so drift beyond the tolerance is corrected by seeks,
+ * the seek latency being learnt from the residual skew after each correction.
+ */
+class room_sync
+{
+public:
+    enum class role
+    {
+        leader,
+        follower
+    };
+
+    struct player_state
+    {
+        std::string content;
+        int queue_index;    ///< negative while loading
+        int track_id;       ///< 0 when no track is selected
+        int position_ms;
+        bool playing;       ///< rendering, neither paused, stalled nor seeking
+    };
+
+    // how a node drives its player, see bind()
+    struct player
+    {
+        std::function<player_state()> state;
+        std::function<void( const std::string& content )> load;
+        std::function<void( int index )> jump;
+        std::function<void( int position_ms )> seek;
+        std::function<void()> pause;
+        std::function<void()> resume;
+    };
+
+    // the host is expected to start playback when the queue list is loaded, as the applications do
+    static player bind( deezer_wrapper& wrapper );
+
+    struct infos
+    {
+        bool leader;
+        bool synced;            ///< follower : leader clock estimated and leader state received
+        int followers;          ///< leader : followers heard from recently
+        long offset_us;         ///< follower : leader clock minus local clock
+        int round_trip_ms;      ///< follower : of the exchange the offset comes from
+        int skew_ms;            ///< follower : own position minus the leader's, leader : largest reported
+        int corrections;        ///< follower : reloads, jumps and seeks issued
+        int seek_lead_ms;       ///< follower : learnt seek latency compensation
+    };
+
+    static constexpr int tolerance_ms = 40;
+
+    // the leader listens on port, a follower talks to the leader at host:port
+    // (simulated_delay_ms delays each outgoing datagram by 50 to 150% of it, to test on loopback)
+    room_sync( role r, const std::string& host, int port, player p, int simulated_delay_ms = 0 );
+    ~room_sync();
+
+    infos current_infos();
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct leader_state
+    {
+        player_state player;
+        int64_t time_us;        ///< leader clock when the state was sampled
+    };
+
+    struct follower_entry
+    {
+        int64_t last_seen_us;
+        int skew_ms;
+        bool synced;
+    };
+
+    struct clock_sample
+    {
+        int64_t offset_us;
+        int64_t round_trip_us;
+    };
+
+    struct datagram
+    {
+        int64_t due_us;
+        sockaddr_in to;
+        std::string data;
+    };
+
+    static int64_t _now_us();
+
+    void _run();
+    void _receive( int64_t now );
+    void _on_datagram( const std::string& data, const sockaddr_in& from, int64_t now );
+    void _send( const sockaddr_in& to, const std::string& data, int64_t now );
+    void _flush_delayed( int64_t now );
+
+    void _lead( int64_t now );
+    void _broadcast( const player_state& state, int64_t now );
+    void _follow( int64_t now );
+
+private:
+    const role m_role;
+    player m_player;
+    const int m_simulated_delay_ms;
+
+    int m_socket = -1;
+    int m_wake_pipe[2] = { -1, -1 };
+    sockaddr_in m_leader_address{};
+
+    std::mutex m_mutex;
+    std::atomic<bool> m_running{ true };
+    std::deque<datagram> m_delayed;
+
+    // leader
+    std::map<std::string, std::pair<sockaddr_in, follower_entry>> m_followers;
+    player_state m_broadcast_state{ "", -1, 0, 0, false };
+    int64_t m_broadcast_us = 0;
+    int m_sequence = 0;
+
+    // follower
+    std::deque<clock_sample> m_samples;
+    clock_sample m_clock{ 0, 0 };
+    bool m_have_leader = false;
+    leader_state m_leader{};
+    int m_leader_sequence = -1;
+    int64_t m_leader_playing_since_us = 0;
+    std::string m_leader_content;
+    bool m_track_mode = false;      ///< following track by track, the leader content being a personal flow
+    int64_t m_busy_until_us = 0;    ///< waiting for the last action to settle
+    int64_t m_next_sync_us = 0;
+    int m_out_of_tolerance = 0;
+    bool m_correcting = false;
+    int m_skew_ms = 0;
+    int m_corrections = 0;
+    int m_seek_lead_ms = 0;
+
+    std::thread m_thread;
+};
@@ -0,0 +1,256 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "skip_predictor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+enum { artist_kind, album_kind };
+
+constexpr char store_magic[4] = { 'd', 'z', 's', 'k' };
+constexpr uint32_t store_version = 1;
+
+// a few neutral listens for each new artist or album : the first skip is not enough to predict
+constexpr float prior_skip_ratio = 0.2f;
+constexpr float prior_weight = 2.f;
+constexpr float min_evidence = 3.f;
+
+// decayed below this, an entry is forgotten when stored
+constexpr float min_weight = 0.05f;
+constexpr int store_period = 16;
+
+constexpr float dislike_weight = 2.f;
+
+} // namespace
+
+skip_predictor::skip_predictor( const std::string& store_file ) : m_store_file( store_file )
+{
+    _load();
+}
+
+skip_predictor::~skip_predictor()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( m_unsaved )
+        _store();
+}
+
+void skip_predictor::on_track_selected( long long artist_id, long long album_id )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    _label( 0.f, 1.f );
+    m_labeling = true;
+    m_artist_id = artist_id;
+    m_album_id = album_id;
+}
+
+void skip_predictor::on_next( int played_ms )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    if ( played_ms < skip_window_ms )
+        _label( 1.f, 0.f );
+    else
+        _label( 0.f, 1.f );
+}
+
+void skip_predictor::on_dislike()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    _label( dislike_weight, 0.f );
+}
+
+void skip_predictor::on_drop()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_labeling = false;
+}
+
+float skip_predictor::skip_probability( long long artist_id, long long album_id )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return _probability( artist_id, album_id );
+}
+
+bool skip_predictor::predict_skip( long long artist_id, long long album_id )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto artist = _decayed( _key( artist_kind, artist_id ) );
+    auto album = _decayed( _key( album_kind, album_id ) );
+    if ( artist.skips + artist.listens + album.skips + album.listens < min_evidence )
+        return false;
+    if ( _probability( artist_id, album_id ) < skip_threshold )
+        return false;
+
+    m_predicted++;
+    return true;
+}
+
+void skip_predictor::on_pre_skipped()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_labeling = false;
+    m_pre_skipped++;
+}
+
+void skip_predictor::on_mispredicted()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    m_mispredicted++;
+}
+
+skip_predictor::infos skip_predictor::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return { static_cast<int>( m_entries.size() ), m_skipped, m_listened, m_predicted, m_pre_skipped, m_mispredicted };
+}
+
+// ids are folded into the low 32 bits, which keeps the stored table format
+uint64_t skip_predictor::_key( int kind, long long id )
+{
+    return ( static_cast<uint64_t>( kind ) << 32 ) | static_cast<uint32_t>( id );
+}
+
+float skip_predictor::_probability( long long artist_id, long long album_id )
+{
+    auto artist = _decayed( _key( artist_kind, artist_id ) );
+    auto album = _decayed( _key( album_kind, album_id ) );
+
+    auto skips = artist.skips + album.skips;
+    auto total = skips + artist.listens + album.listens;
+    return ( skips + prior_weight * prior_skip_ratio ) / ( total + prior_weight );
+}
+
+skip_predictor::entry skip_predictor::_decayed( uint64_t key )
+{
+    auto it = m_entries.find( key );
+    if ( it == m_entries.end() )
+        return { 0.f, 0.f, m_tick };
+
+    auto decay = std::exp2( -static_cast<float>( m_tick - it->second.tick ) / half_life_tracks );
+    return { it->second.skips * decay, it->second.listens * decay, m_tick };
+}
+
+void skip_predictor::_label( float skip_weight, float listen_weight )
+{
+    if ( !m_labeling )
+        return;
+    m_labeling = false;
+
+    m_tick++;
+    if ( m_artist_id > 0 )
+        _update( _key( artist_kind, m_artist_id ), skip_weight, listen_weight );
+    if ( m_album_id > 0 )
+        _update( _key( album_kind, m_album_id ), skip_weight, listen_weight );
+
+    if ( skip_weight > 0.f )
+        m_skipped++;
+    else
+        m_listened++;
+
+    if ( ++m_unsaved >= store_period )
+        _store();
+}
+
+void skip_predictor::_update( uint64_t key, float skip_weight, float listen_weight )
+{
+    auto current = _decayed( key );
+    m_entries[key] = { current.skips + skip_weight, current.listens + listen_weight, m_tick };
+}
+
+void skip_predictor::_load()
+{
+    // magic, version, tick and count, then 16 bytes per entry
+    std::ifstream store( m_store_file, std::ios::binary );
+    char magic[4];
+    uint32_t version = 0, count = 0;
+    if ( !store.read( magic, sizeof( magic ) ) || !std::equal( magic, magic + 4, store_magic )
+         || !store.read( reinterpret_cast<char*>( &version ), sizeof( version ) ) || version != store_version
+         || !store.read( reinterpret_cast<char*>( &m_tick ), sizeof( m_tick ) )
+         || !store.read( reinterpret_cast<char*>( &count ), sizeof( count ) ) )
+    {
+        m_tick = 0;
+        return;
+    }
+
+    m_entries.reserve( count );
+    for ( uint32_t i = 0; i < count; i++ )
+    {
+        uint64_t key;
+        float counts[2];
+        if ( !store.read( reinterpret_cast<char*>( &key ), sizeof( key ) )
+             || !store.read( reinterpret_cast<char*>( counts ), sizeof( counts ) ) )
+            break;
+        m_entries[key] = { counts[0], counts[1], m_tick };
+    }
+}
+
+void skip_predictor::_store()
+{
+    m_unsaved = 0;
+
+    // decayed up to now, so that one tick is stored for all entries
+    for ( auto it = m_entries.begin(); it != m_entries.end(); )
+    {
+        auto current = _decayed( it->first );
+        if ( current.skips + current.listens < min_weight )
+        {
+            it = m_entries.erase( it );
+        }
+        else
+        {
+            it->second = current;
+            ++it;
+        }
+    }
+
+    auto temporary = m_store_file + ".tmp";
+    {
+        std::ofstream store( temporary, std::ios::binary | std::ios::trunc );
+        uint32_t count = static_cast<uint32_t>( m_entries.size() );
+        store.write( store_magic, sizeof( store_magic ) );
+        store.write( reinterpret_cast<const char*>( &store_version ), sizeof( store_version ) );
+        store.write( reinterpret_cast<const char*>( &m_tick ), sizeof( m_tick ) );
+        store.write( reinterpret_cast<const char*>( &count ), sizeof( count ) );
+        for ( const auto& e : m_entries )
+        {
+            float counts[2] = { e.second.skips, e.second.listens };
+            store.write( reinterpret_cast<const char*>( &e.first ), sizeof( e.first ) );
+            store.write( reinterpret_cast<const char*>( counts ), sizeof( counts ) );
+        }
+        if ( !store )
+        {
+            std::cerr << "cannot store skip model to " << temporary << std::endl;
+            return;
+        }
+    }
+    std::rename( temporary.c_str(), m_store_file.c_str() );
+}
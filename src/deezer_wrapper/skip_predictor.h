@@ -0,0 +1,110 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/*
+ * Learns which radio tracks get skipped from the player's own events : skip and listen counts are
+ * kept per artist and per album, exponentially decayed over the labeled tracks (lazily, each update
+ * being O(1)), and persisted as a compact binary table in the user cache. A track whose artist and
+ * album were mostly skipped lately is predicted to be skipped again.
+ */
+class skip_predictor
+{
+public:
+    struct infos
+    {
+        int entries;            ///< artists and albums in the model
+        int skipped;            ///< labeled tracks
+        int listened;
+        int predicted;          ///< announced tracks predicted as skips
+        int pre_skipped;        ///< tracks skipped before they played
+        int mispredicted;       ///< predicted skips listened through, or played back after a pre-skip
+    };
+
+    // a user skip within this window is a skip, a later one counts as a listen
+    static constexpr int skip_window_ms = 30000;
+    // counts are halved every this many labeled tracks
+    static constexpr int half_life_tracks = 1000;
+    static constexpr float skip_threshold = 0.7f;
+
+    skip_predictor( const std::string& store_file );
+    ~skip_predictor();
+
+    // starts labeling the selected track : the previous one, if still unlabeled, was listened through
+    void on_track_selected( long long artist_id, long long album_id );
+    void on_next( int played_ms );
+    void on_dislike();
+    // jumps, stops and pre-emptive skips tell nothing about the listener
+    void on_drop();
+
+    float skip_probability( long long artist_id, long long album_id );
+    // counts the prediction when positive
+    bool predict_skip( long long artist_id, long long album_id );
+    void on_pre_skipped();
+    void on_mispredicted();
+
+    infos current_infos();
+
+private:
+    struct entry
+    {
+        float skips;
+        float listens;
+        uint32_t tick;      ///< label count at which the counts were last decayed
+    };
+
+    static uint64_t _key( int kind, long long id );
+
+    float _probability( long long artist_id, long long album_id );
+    entry _decayed( uint64_t key );
+    void _label( float skip_weight, float listen_weight );
+    void _update( uint64_t key, float skip_weight, float listen_weight );
+    void _load();
+    void _store();
+
+private:
+    const std::string m_store_file;
+
+    std::mutex m_mutex;
+    std::unordered_map<uint64_t, entry> m_entries;
+    uint32_t m_tick = 0;
+    int m_unsaved = 0;
+
+    bool m_labeling = false;
+    long long m_artist_id = 0;
+    long long m_album_id = 0;
+
+    int m_skipped = 0;
+    int m_listened = 0;
+    int m_predicted = 0;
+    int m_pre_skipped = 0;
+    int m_mispredicted = 0;
+};
@@ -0,0 +1,267 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "spectrum_analyzer.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DEEZZY_SPECTRUM_NEON
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#define DEEZZY_SPECTRUM_SSE
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+
+constexpr float min_frequency = 40.f;
+constexpr float max_frequency = 16000.f;
+constexpr float floor_db = -60.f;
+
+#if defined(DEEZZY_SPECTRUM_NEON)
+
+using vec4 = float32x4_t;
+inline vec4 v_load( const float* p ) { return vld1q_f32( p ); }
+inline void v_store( float* p, vec4 v ) { vst1q_f32( p, v ); }
+inline vec4 v_add( vec4 a, vec4 b ) { return vaddq_f32( a, b ); }
+inline vec4 v_sub( vec4 a, vec4 b ) { return vsubq_f32( a, b ); }
+inline vec4 v_mul( vec4 a, vec4 b ) { return vmulq_f32( a, b ); }
+
+#elif defined(DEEZZY_SPECTRUM_SSE)
+
+using vec4 = __m128;
+inline vec4 v_load( const float* p ) { return _mm_loadu_ps( p ); }
+inline void v_store( float* p, vec4 v ) { _mm_storeu_ps( p, v ); }
+inline vec4 v_add( vec4 a, vec4 b ) { return _mm_add_ps( a, b ); }
+inline vec4 v_sub( vec4 a, vec4 b ) { return _mm_sub_ps( a, b ); }
+inline vec4 v_mul( vec4 a, vec4 b ) { return _mm_mul_ps( a, b ); }
+
+#else
+
+struct vec4 { float v[4]; };
+inline vec4 v_load( const float* p ) { return { { p[0], p[1], p[2], p[3] } }; }
+inline void v_store( float* p, vec4 v ) { std::copy( v.v, v.v + 4, p ); }
+inline vec4 v_add( vec4 a, vec4 b ) { return { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; }
+inline vec4 v_sub( vec4 a, vec4 b ) { return { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } }; }
+inline vec4 v_mul( vec4 a, vec4 b ) { return { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; }
+
+#endif
+
+} // namespace
+
+real_fft::real_fft( size_t size )
+    : m_size( size ), m_half( size / 2 ),
+      m_bit_reverse( m_half ), m_twiddle_re( m_half ), m_twiddle_im( m_half ),
+      m_post_re( m_half ), m_post_im( m_half ), m_re( m_half ), m_im( m_half )
+{
+    unsigned int bits = 0;
+    while ( ( 1u << bits ) < m_half )
+        bits++;
+
+    for ( unsigned int i = 0; i < m_half; i++ )
+    {
+        unsigned int r = 0;
+        for ( unsigned int b = 0; b < bits; b++ )
+            r |= ( ( i >> b ) & 1u ) << ( bits - 1 - b );
+        m_bit_reverse[i] = r;
+    }
+
+    // stage of length 'len' uses len/2 twiddles stored at offset len/2 - 1
+    for ( size_t len = 2; len <= m_half; len *= 2 )
+    {
+        for ( size_t j = 0; j < len / 2; j++ )
+        {
+            m_twiddle_re[len / 2 - 1 + j] = static_cast<float>( std::cos( -2. * pi * j / len ) );
+            m_twiddle_im[len / 2 - 1 + j] = static_cast<float>( std::sin( -2. * pi * j / len ) );
+        }
+    }
+
+    for ( size_t k = 0; k < m_half; k++ )
+    {
+        m_post_re[k] = static_cast<float>( std::cos( -2. * pi * k / m_size ) );
+        m_post_im[k] = static_cast<float>( std::sin( -2. * pi * k / m_size ) );
+    }
+}
+
+void real_fft::power_spectrum( const float* input, float* power )
+{
+    // even samples as real part, odd samples as imaginary part, in bit reversed order
+    for ( size_t k = 0; k < m_half; k++ )
+    {
+        m_re[m_bit_reverse[k]] = input[2 * k];
+        m_im[m_bit_reverse[k]] = input[2 * k + 1];
+    }
+
+    auto* re = m_re.data();
+    auto* im = m_im.data();
+
+    for ( size_t len = 2; len <= m_half; len *= 2 )
+    {
+        const auto half = len / 2;
+        const auto* wr = m_twiddle_re.data() + half - 1;
+        const auto* wi = m_twiddle_im.data() + half - 1;
+
+        for ( size_t start = 0; start < m_half; start += len )
+        {
+            auto* ar = re + start;
+            auto* ai = im + start;
+            auto* br = ar + half;
+            auto* bi = ai + half;
+
+            if ( half < 4 )
+            {
+                for ( size_t j = 0; j < half; j++ )
+                {
+                    auto tr = br[j] * wr[j] - bi[j] * wi[j];
+                    auto ti = br[j] * wi[j] + bi[j] * wr[j];
+                    br[j] = ar[j] - tr;
+                    bi[j] = ai[j] - ti;
+                    ar[j] += tr;
+                    ai[j] += ti;
+                }
+                continue;
+            }
+
+            for ( size_t j = 0; j < half; j += 4 )
+            {
+                auto vwr = v_load( wr + j ), vwi = v_load( wi + j );
+                auto var = v_load( ar + j ), vai = v_load( ai + j );
+                auto vbr = v_load( br + j ), vbi = v_load( bi + j );
+
+                auto tr = v_sub( v_mul( vbr, vwr ), v_mul( vbi, vwi ) );
+                auto ti = v_add( v_mul( vbr, vwi ), v_mul( vbi, vwr ) );
+
+                v_store( br + j, v_sub( var, tr ) );
+                v_store( bi + j, v_sub( vai, ti ) );
+                v_store( ar + j, v_add( var, tr ) );
+                v_store( ai + j, v_add( vai, ti ) );
+            }
+        }
+    }
+
+    // unpack the half size complex transform into the real input spectrum
+    power[0] = ( re[0] + im[0] ) * ( re[0] + im[0] );
+    for ( size_t k = 1; k < m_half; k++ )
+    {
+        auto ar = re[k] + re[m_half - k];
+        auto ai = im[k] - im[m_half - k];
+        auto br = re[k] - re[m_half - k];
+        auto bi = im[k] + im[m_half - k];
+
+        // 2.X[k] = A + W^k.(-i.B)
+        auto xr = ar + m_post_re[k] * bi + m_post_im[k] * br;
+        auto xi = ai + m_post_im[k] * bi - m_post_re[k] * br;
+
+        power[k] = 0.25f * ( xr * xr + xi * xi );
+    }
+}
+
+constexpr size_t spectrum_analyzer::fft_size;
+
+spectrum_analyzer::spectrum_analyzer()
+    : m_fft( fft_size ), m_window( fft_size ), m_mono( fft_size ), m_power( fft_size / 2 )
+{
+    for ( size_t i = 0; i < fft_size; i++ )
+        m_window[i] = static_cast<float>( 0.5 - 0.5 * std::cos( 2. * pi * i / ( fft_size - 1 ) ) );
+
+    // log spaced bands, at least one bin wide
+    const auto bin_hz = static_cast<float>( audio_monitor::sample_rate ) / fft_size;
+    size_t previous = 0;
+    for ( size_t b = 0; b <= band_count; b++ )
+    {
+        auto frequency = min_frequency * std::pow( max_frequency / min_frequency, static_cast<float>( b ) / band_count );
+        auto bin = std::max( static_cast<size_t>( frequency / bin_hz ), b ? previous + 1 : size_t( 1 ) );
+        m_band_edges[b] = previous = std::min( bin, fft_size / 2 );
+    }
+
+    for ( auto& slot : m_ring )
+        for ( auto& level : slot )
+            level.store( 0.f, std::memory_order_relaxed );
+
+    m_monitor = std::make_unique<audio_monitor>( "spectrum analyzer", audio_monitor::default_source, fft_size,
+                                                 [this]( const float* frames, size_t frame_count ) {
+        _on_block( frames, frame_count );
+    } );
+}
+
+bool spectrum_analyzer::latest( bands& output )
+{
+    for ( ;; )
+    {
+        auto published = m_published.load( std::memory_order_acquire );
+        if ( published == m_consumed )
+            return false;
+
+        const auto& slot = m_ring[published % ring_size];
+        for ( size_t b = 0; b < band_count; b++ )
+            output[b] = slot[b].load( std::memory_order_relaxed );
+
+        // orders the copy before the re-check : the producer may have lapped us while copying, in which case the copy is retried
+        std::atomic_thread_fence( std::memory_order_acquire );
+        if ( m_published.load( std::memory_order_relaxed ) - published < ring_size - 1 )
+        {
+            m_consumed = published;
+            return true;
+        }
+    }
+}
+
+float spectrum_analyzer::cpu_load() const
+{
+    return m_monitor->cpu_load();
+}
+
+void spectrum_analyzer::_on_block( const float* frames, size_t frame_count )
+{
+    for ( size_t i = 0; i < fft_size; i++ )
+        m_mono[i] = 0.5f * ( frames[2 * i] + frames[2 * i + 1] ) * m_window[i];
+
+    m_fft.power_spectrum( m_mono.data(), m_power.data() );
+
+    // a full scale sine peaks at (N/4)^2 with a Hann window
+    const auto reference = ( fft_size / 4.f ) * ( fft_size / 4.f );
+
+    auto next = m_published.load( std::memory_order_relaxed ) + 1;
+    auto& slot = m_ring[next % ring_size];
+
+    // pairs with the reader fence : a reader seeing any of the levels below also sees the previous publication
+    std::atomic_thread_fence( std::memory_order_release );
+
+    for ( size_t b = 0; b < band_count; b++ )
+    {
+        float band_power = 0.f;
+        for ( auto k = m_band_edges[b]; k < m_band_edges[b + 1]; k++ )
+            band_power = std::max( band_power, m_power[k] );
+
+        auto db = band_power > 0.f ? 10.f * std::log10( band_power / reference ) : floor_db;
+        slot[b].store( std::min( std::max( ( db - floor_db ) / -floor_db, 0.f ), 1.f ), std::memory_order_relaxed );
+    }
+
+    m_published.store( next, std::memory_order_release );
+}
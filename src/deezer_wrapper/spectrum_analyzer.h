@@ -0,0 +1,100 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include "audio_monitor.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/*
+ * Radix-2 real FFT working on split (SoA) real/imaginary buffers, so that butterflies run four
+ * at a time in SIMD registers (NEON on ARM, SSE on x86, scalar otherwise).
+ */
+class real_fft
+{
+public:
+    explicit real_fft( size_t size );
+
+    // computes the squared magnitudes of bins [0, size/2) of the real input
+    void power_spectrum( const float* input, float* power );
+
+    size_t size() const { return m_size; }
+
+private:
+    const size_t m_size;
+    const size_t m_half;
+
+    std::vector<unsigned int> m_bit_reverse;
+    std::vector<float> m_twiddle_re;    // per stage twiddles, laid out contiguously stage after stage
+    std::vector<float> m_twiddle_im;
+    std::vector<float> m_post_re;       // real spectrum unpacking twiddles
+    std::vector<float> m_post_im;
+    std::vector<float> m_re;
+    std::vector<float> m_im;
+};
+
+/*
+ * Captures the output monitor and publishes log spaced band levels (0..1) through a lock-free
+ * single producer / single consumer ring, for a renderer running at display rate.
+ */
+class spectrum_analyzer
+{
+public:
+    static constexpr size_t band_count = 32;
+    static constexpr size_t fft_size = 1024;
+
+    using bands = std::array<float, band_count>;
+
+    spectrum_analyzer();
+
+    // copies the latest published bands, returns false if nothing new since the previous call
+    bool latest( bands& output );
+
+    float cpu_load() const;
+
+private:
+    void _on_block( const float* frames, size_t frame_count );
+
+private:
+    static constexpr unsigned int ring_size = 4;
+
+    real_fft m_fft;
+    std::vector<float> m_window;
+    std::vector<float> m_mono;
+    std::vector<float> m_power;
+    std::array<size_t, band_count + 1> m_band_edges;
+
+    // a seqlock : slots may be overwritten while read, hence relaxed atomics rather than plain floats
+    std::array<std::array<std::atomic<float>, band_count>, ring_size> m_ring;
+    std::atomic<unsigned int> m_published{ 0 };
+    unsigned int m_consumed = 0;
+
+    // last member : the capture thread must stop before the buffers above go away
+    std::unique_ptr<audio_monitor> m_monitor;
+};
@@ -0,0 +1,423 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "thread_policy.h"
+
+#include <dirent.h>
+#include <fnmatch.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+namespace {
+
+// new SDK threads are mostly created at connection and player start : they get placed within a scan period
+constexpr auto scan_period = std::chrono::seconds( 2 );
+
+// GUI and helpers on the first core, SDK threads (decoding, output) on the others. Only the equalizer feeding the
+// output runs SCHED_FIFO : a busy real-time thread starves the system, so unknown threads keep their scheduling
+const char* default_rules =
+    "[*]\n"
+    "@main          0       inherit\n"
+    "@dispatcher    0       inherit\n"
+    "QSG*           0       inherit\n"
+    "dz-eq          1-3     fifo:20\n"
+    "dz-*           0-1     nice:10\n"
+    "threaded-ml    0-1     nice:10\n"
+    "Q*             0       nice:5\n"
+    "Thread*        0       nice:10\n"
+    "*              1-3     inherit\n";
+
+long steady_ms()
+{
+    return static_cast<long>( std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count() );
+}
+
+std::string read_first_line( const std::string& path )
+{
+    std::ifstream file( path );
+    std::string line;
+    std::getline( file, line );
+    return line;
+}
+
+// "0-1,3" : cpus beyond the ones configured on this device are dropped
+bool parse_cpus( const std::string& text, std::vector<int>& cpus )
+{
+    cpus.clear();
+    if ( text == "-" )
+        return true;
+
+    static const auto cpu_count = static_cast<int>( sysconf( _SC_NPROCESSORS_CONF ) );
+
+    std::istringstream ranges( text );
+    std::string range;
+    while ( std::getline( ranges, range, ',' ) )
+    {
+        int first, last;
+        auto dash = range.find( '-' );
+        try
+        {
+            first = std::stoi( range.substr( 0, dash ) );
+            last = dash == std::string::npos ? first : std::stoi( range.substr( dash + 1 ) );
+        }
+        catch( std::exception& )
+        {
+            return false;
+        }
+        for ( auto cpu = first; cpu <= last && cpu < cpu_count; cpu++ )
+            cpus.push_back( cpu );
+    }
+    // none of the cpus exists here : leave affinity untouched rather than failing
+    return true;
+}
+
+bool parse_scheduling( const std::string& text, thread_policy::rule& rule )
+{
+    using scheduling = thread_policy::rule::scheduling;
+
+    rule.level = 0;
+    if ( text == "inherit" )
+    {
+        rule.policy = scheduling::inherit;
+        return true;
+    }
+
+    auto colon = text.find( ':' );
+    if ( colon == std::string::npos )
+        return false;
+
+    auto kind = text.substr( 0, colon );
+    if ( kind == "nice" )
+        rule.policy = scheduling::other;
+    else if ( kind == "fifo" )
+        rule.policy = scheduling::fifo;
+    else
+        return false;
+
+    try
+    {
+        rule.level = std::stoi( text.substr( colon + 1 ) );
+    }
+    catch( std::exception& )
+    {
+        return false;
+    }
+    return true;
+}
+
+// rules of the first section matching the device model, none when no section matches
+std::vector<thread_policy::rule> parse_rules( std::istream& input, const std::string& model, bool& matched )
+{
+    std::vector<thread_policy::rule> rules;
+    matched = false;
+
+    bool in_section = false;
+    std::string line;
+    while ( std::getline( input, line ) )
+    {
+        auto hash = line.find( '#' );
+        if ( hash != std::string::npos )
+            line.resize( hash );
+
+        std::istringstream fields( line );
+        std::string pattern, cpus, scheduling;
+        if ( !( fields >> pattern ) )
+            continue;
+
+        if ( pattern.front() == '[' && pattern.back() == ']' )
+        {
+            // the device model may contain spaces : take the whole bracketed line
+            auto section = line.substr( line.find( '[' ) + 1 );
+            section.resize( section.rfind( ']' ) );
+
+            if ( matched )
+                break;
+            in_section = fnmatch( section.c_str(), model.c_str(), 0 ) == 0;
+            matched = in_section;
+            continue;
+        }
+        if ( !in_section )
+            continue;
+
+        thread_policy::rule rule;
+        rule.pattern = pattern;
+        if ( !( fields >> cpus >> scheduling ) || !parse_cpus( cpus, rule.cpus ) || !parse_scheduling( scheduling, rule ) )
+        {
+            std::cerr << "ignoring invalid thread policy rule : " << line << std::endl;
+            continue;
+        }
+        rules.push_back( rule );
+    }
+    return rules;
+}
+
+} // namespace
+
+thread_policy::thread_policy( const std::string& config_file )
+    : m_rules( _load_rules( config_file ) ), m_main_tid( static_cast<int>( getpid() ) )
+{
+    m_thread = std::thread( &thread_policy::_run, this );
+}
+
+thread_policy::~thread_policy()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_wakeup.notify_one();
+
+    if ( m_thread.joinable() )
+        m_thread.join();
+}
+
+void thread_policy::set_dispatcher_thread( int tid )
+{
+    if ( m_dispatcher_tid.exchange( tid ) == tid )
+        return;
+
+    // possibly placed already under a generic rule : place it again right away
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        auto thread = m_threads.find( tid );
+        if ( thread != m_threads.end() )
+            thread->second.placed = false;
+    }
+    m_wakeup.notify_one();
+}
+
+std::vector<thread_policy::thread_infos> thread_policy::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    std::vector<thread_infos> infos;
+    infos.reserve( m_threads.size() );
+    for ( const auto& thread : m_threads )
+        infos.push_back( thread.second.infos );
+    return infos;
+}
+
+int thread_policy::current_thread_id()
+{
+    return static_cast<int>( syscall( SYS_gettid ) );
+}
+
+void thread_policy::name_current_thread( const std::string& name )
+{
+    pthread_setname_np( pthread_self(), name.substr( 0, 15 ).c_str() );
+}
+
+void thread_policy::_run()
+{
+    name_current_thread( "dz-threads" );
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        lock.unlock();
+        _scan();
+        lock.lock();
+
+        m_wakeup.wait_for( lock, scan_period );
+    }
+}
+
+void thread_policy::_scan()
+{
+    static const auto clock_ticks = sysconf( _SC_CLK_TCK );
+
+    // task names and counters, read without the lock
+    struct sample
+    {
+        std::string name;
+        long cpu_ms;
+        long involuntary_switches;
+    };
+    std::map<int, sample> samples;
+
+    if ( auto* tasks = opendir( "/proc/self/task" ) )
+    {
+        while ( auto* entry = readdir( tasks ) )
+        {
+            if ( entry->d_name[0] == '.' )
+                continue;
+
+            auto tid = std::atoi( entry->d_name );
+            auto task = std::string( "/proc/self/task/" ) + entry->d_name;
+
+            // the name may contain spaces and parentheses : counters start after the last ')'
+            auto stat = read_first_line( task + "/stat" );
+            auto open = stat.find( '(' );
+            auto close = stat.rfind( ')' );
+            if ( open == std::string::npos || close == std::string::npos )
+                continue;
+
+            std::istringstream fields( stat.substr( close + 2 ) );
+            std::string field;
+            long utime = 0, stime = 0;
+            for ( auto i = 3; i <= 15 && fields >> field; i++ )
+            {
+                if ( i == 14 )
+                    utime = std::atol( field.c_str() );
+                else if ( i == 15 )
+                    stime = std::atol( field.c_str() );
+            }
+
+            long involuntary_switches = 0;
+            std::ifstream status( task + "/status" );
+            std::string line;
+            while ( std::getline( status, line ) )
+            {
+                if ( line.compare( 0, 27, "nonvoluntary_ctxt_switches:" ) == 0 )
+                    involuntary_switches = std::atol( line.c_str() + 27 );
+            }
+
+            samples[tid] = { stat.substr( open + 1, close - open - 1 ), ( utime + stime ) * 1000 / clock_ticks, involuntary_switches };
+        }
+        closedir( tasks );
+    }
+
+    auto now_ms = steady_ms();
+
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto elapsed_ms = m_last_scan_ms ? now_ms - m_last_scan_ms : 0;
+    m_last_scan_ms = now_ms;
+
+    // forget the threads that exited
+    for ( auto thread = m_threads.begin(); thread != m_threads.end(); )
+        thread = samples.count( thread->first ) ? std::next( thread ) : m_threads.erase( thread );
+
+    for ( const auto& entry : samples )
+    {
+        auto tid = entry.first;
+        const auto& sample = entry.second;
+
+        auto inserted = m_threads.emplace( tid, tracked_thread{ { tid, sample.name, "", sample.cpu_ms, 0.f, 0 }, false } );
+        auto& thread = inserted.first->second;
+
+        thread.infos.cpu_load = elapsed_ms > 0 && !inserted.second ?
+            static_cast<float>( sample.cpu_ms - thread.infos.cpu_ms ) / elapsed_ms : 0.f;
+        thread.infos.cpu_ms = sample.cpu_ms;
+        thread.infos.involuntary_switches = sample.involuntary_switches;
+
+        // threads usually get their name right after creation : a renamed thread is placed again
+        if ( thread.infos.name != sample.name )
+        {
+            thread.infos.name = sample.name;
+            thread.placed = false;
+        }
+        if ( !thread.placed )
+        {
+            thread.infos.placement = _place( tid, sample.name, !thread.infos.placement.empty() );
+            thread.placed = true;
+        }
+    }
+}
+
+std::string thread_policy::_place( int tid, const std::string& name, bool placed_before )
+{
+    for ( const auto& rule : m_rules )
+    {
+        if ( rule.pattern == "@main" ? tid != m_main_tid :
+             rule.pattern == "@dispatcher" ? tid != m_dispatcher_tid :
+             fnmatch( rule.pattern.c_str(), name.c_str(), 0 ) != 0 )
+            continue;
+
+        std::ostringstream placement;
+        placement << rule.pattern;
+
+        if ( !rule.cpus.empty() )
+        {
+            cpu_set_t set;
+            CPU_ZERO( &set );
+            for ( auto cpu : rule.cpus )
+                CPU_SET( cpu, &set );
+
+            placement << " cpus:";
+            for ( size_t i = 0; i < rule.cpus.size(); i++ )
+                placement << ( i ? "," : "" ) << rule.cpus[i];
+            if ( sched_setaffinity( tid, sizeof( set ), &set ) != 0 )
+                placement << "(" << std::strerror( errno ) << ")";
+        }
+
+        // back to the default class before a rule that leaves scheduling untouched
+        if ( rule.policy == rule::scheduling::inherit && placed_before )
+        {
+            sched_param param;
+            param.sched_priority = 0;
+            sched_setscheduler( tid, SCHED_OTHER, &param );
+            setpriority( PRIO_PROCESS, static_cast<id_t>( tid ), 0 );
+        }
+        else if ( rule.policy != rule::scheduling::inherit )
+        {
+            auto fifo = rule.policy == rule::scheduling::fifo;
+
+            sched_param param;
+            param.sched_priority = fifo ? rule.level : 0;
+
+            placement << ( fifo ? " fifo:" : " nice:" ) << rule.level;
+
+            // raising priorities requires CAP_SYS_NICE or matching RLIMIT_RTPRIO / RLIMIT_NICE
+            if ( sched_setscheduler( tid, fifo ? SCHED_FIFO : SCHED_OTHER, &param ) != 0 ||
+                 ( !fifo && setpriority( PRIO_PROCESS, static_cast<id_t>( tid ), rule.level ) != 0 ) )
+                placement << "(" << std::strerror( errno ) << ")";
+        }
+
+        std::cout << "THREAD placement => " << tid << " " << name << " : " << placement.str() << std::endl;
+        return placement.str();
+    }
+    return std::string();
+}
+
+std::vector<thread_policy::rule> thread_policy::_load_rules( const std::string& config_file )
+{
+    auto model = read_first_line( "/proc/device-tree/model" );
+    model = model.c_str(); // device tree strings are NUL terminated
+
+    bool matched = false;
+    std::ifstream file( config_file );
+    auto rules = parse_rules( file, model, matched );
+    if ( matched )
+    {
+        std::cout << "THREAD policy => " << config_file << " for " << ( model.empty() ? "unknown device" : model ) << std::endl;
+        return rules;
+    }
+
+    std::istringstream defaults( default_rules );
+    return parse_rules( defaults, model, matched );
+}
@@ -0,0 +1,124 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Places the process threads on CPUs and scheduling classes according to per device rules. Threads
+ * created by the SDK (and by Qt or pulseaudio) are discovered by periodically scanning the process
+ * tasks, and each new thread gets the first rule matching its name ; per thread CPU time and
+ * involuntary context switches are sampled on each scan.
+ *
+ * Config file format, the first section matching /proc/device-tree/model being used :
+ *
+ *      [Raspberry Pi 2*]
+ *      # thread        cpus    scheduling
+ *      @main           0       nice:-5
+ *      @dispatcher     0       inherit
+ *      dz-eq           1-3     fifo:20
+ *      dz-*            0-1     nice:10
+ *      *               1-3     inherit
+ *
+ * @main is the GUI thread and @dispatcher the SDK thread calling back into the wrapper, other patterns
+ * being globs on thread names. Cpus are a list ("0-1,3") or "-" to leave affinity untouched, and
+ * scheduling is one of "inherit", "nice:<value>" or "fifo:<priority>". fifo is meant for named audio
+ * threads only : a busy real-time thread matched by a catch-all pattern can starve the whole system.
+ */
+class thread_policy
+{
+public:
+    struct rule
+    {
+        enum class scheduling
+        {
+            inherit,
+            other,
+            fifo
+        };
+
+        std::string pattern;
+        std::vector<int> cpus;
+        scheduling policy;
+        int level;                  ///< nice value (other) or real-time priority (fifo)
+    };
+
+    struct thread_infos
+    {
+        int tid;
+        std::string name;
+        std::string placement;      ///< applied rule, empty when no rule matched
+        long cpu_ms;                ///< user and system time since thread start
+        float cpu_load;             ///< share of one core since the previous scan
+        long involuntary_switches;
+    };
+
+    // built-in rules are used when the file is missing or has no section for the device
+    thread_policy( const std::string& config_file );
+    ~thread_policy();
+
+    // the dispatcher thread is only known once the SDK calls back into the wrapper
+    void set_dispatcher_thread( int tid );
+
+    std::vector<thread_infos> current_infos();
+
+    static int current_thread_id();
+    // names the calling thread so that rules can match it (truncated to 15 characters)
+    static void name_current_thread( const std::string& name );
+
+private:
+    struct tracked_thread
+    {
+        thread_infos infos;
+        bool placed;
+    };
+
+    void _run();
+    void _scan();
+    std::string _place( int tid, const std::string& name, bool placed_before );
+
+    static std::vector<rule> _load_rules( const std::string& config_file );
+
+private:
+    const std::vector<rule> m_rules;
+    const int m_main_tid;
+    std::atomic<int> m_dispatcher_tid{ 0 };
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_running = true;
+
+    std::map<int, tracked_thread> m_threads;
+    long m_last_scan_ms = 0;
+
+    std::thread m_thread;
+};
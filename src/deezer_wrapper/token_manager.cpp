@@ -0,0 +1,411 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "token_manager.h"
+#include "thread_policy.h"
+
+#include "third_party/json.hpp"
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr auto min_backoff = std::chrono::seconds( 5 );
+constexpr auto max_backoff = std::chrono::seconds( 300 );
+constexpr int64_t never = std::numeric_limits<int64_t>::max();
+
+std::string url_encode( const std::string& value )
+{
+    static const char digits[] = "0123456789ABCDEF";
+    std::string encoded;
+    for ( unsigned char c : value )
+    {
+        if ( std::isalnum( c ) || c == '-' || c == '_' || c == '.' || c == '~' )
+        {
+            encoded.push_back( static_cast<char>( c ) );
+        }
+        else
+        {
+            encoded.push_back( '%' );
+            encoded.push_back( digits[c >> 4] );
+            encoded.push_back( digits[c & 15] );
+        }
+    }
+    return encoded;
+}
+
+size_t on_body( char* data, size_t size, size_t count, void* user )
+{
+    static_cast<std::string*>( user )->append( data, size * count );
+    return size * count;
+}
+
+// called at least once per second during a transfer : a non zero result aborts it
+int abort_transfer( void* aborting, curl_off_t, curl_off_t, curl_off_t, curl_off_t )
+{
+    return static_cast<const std::atomic<bool>*>( aborting )->load() ? 1 : 0;
+}
+
+} // namespace
+
+token_manager::token_manager( const std::string& store_file,
+                              const std::string& token_url,
+                              const std::string& client_id,
+                              const std::string& client_secret,
+                              const token& seed,
+                              token_callback on_token,
+                              http_post post ) : m_store_file( store_file ),
+                                                 m_token_url( token_url ),
+                                                 m_client_id( client_id ),
+                                                 m_client_secret( client_secret ),
+                                                 m_on_token( std::move( on_token ) ),
+                                                 m_post( std::move( post ) ),
+                                                 m_backoff( min_backoff )
+{
+    _load( seed );
+    m_thread = std::thread( &token_manager::_run, this );
+}
+
+token_manager::~token_manager()
+{
+    stop();
+}
+
+void token_manager::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = false;
+    }
+    m_aborting = true;
+    m_wakeup.notify_one();
+    if ( m_thread.joinable() )
+        m_thread.join();
+}
+
+void token_manager::start()
+{
+    if ( m_thread.joinable() )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_running = true;
+    }
+    m_aborting = false;
+    m_thread = std::thread( &token_manager::_run, this );
+}
+
+std::string token_manager::access_token()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+    return m_token.access_token;
+}
+
+bool token_manager::refresh()
+{
+    std::unique_lock<std::mutex> lock( m_mutex );
+
+    if ( m_refreshing )
+    {
+        m_coalesced++;
+        auto generation = m_generation;
+        m_refreshed.wait( lock, [this, generation]() { return m_generation != generation; } );
+        return m_last_result;
+    }
+    if ( m_token.refresh_token.empty() || m_token_url.empty() || m_aborting )
+        return false;
+
+    m_refreshing = true;
+    auto fields = "grant_type=refresh_token&refresh_token=" + url_encode( m_token.refresh_token )
+                + "&client_id=" + url_encode( m_client_id ) + "&client_secret=" + url_encode( m_client_secret );
+    lock.unlock();
+
+    long status = 0;
+    std::string body;
+    token fresh{};
+    auto ok = m_post( m_token_url, fields, status, body, m_aborting ) && status == 200 && _parse_response( body, fresh );
+
+    lock.lock();
+    if ( ok )
+    {
+        // the server may keep the refresh token, or rotate it
+        if ( fresh.refresh_token.empty() )
+            fresh.refresh_token = m_token.refresh_token;
+        m_token = fresh;
+        m_refreshes++;
+        _store();
+    }
+    else
+    {
+        m_failures++;
+    }
+    auto access = m_token.access_token;
+    auto expires_at = m_token.expires_at;
+    lock.unlock();
+
+    // swapped into the live handles before waiters resume
+    if ( ok )
+    {
+        std::cout << "TOKEN => refreshed, " << ( expires_at ? "expires in " + std::to_string( expires_at - _now() ) + "s" : "does not expire" ) << std::endl;
+        if ( m_on_token )
+            m_on_token( access );
+    }
+    else
+    {
+        std::cerr << "token refresh failed (HTTP " << status << ")" << std::endl;
+    }
+
+    lock.lock();
+    m_refreshing = false;
+    m_last_result = ok;
+    m_generation++;
+    m_refreshed.notify_all();
+    return ok;
+}
+
+void token_manager::refresh_async()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( m_token.refresh_token.empty() || m_token_url.empty() )
+            return;
+        m_refresh_requested = true;
+    }
+    m_wakeup.notify_one();
+}
+
+token_manager::infos token_manager::current_infos()
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto expires_in = m_token.expires_at ? static_cast<int>( std::max<int64_t>( m_token.expires_at - _now(), 0 ) ) : -1;
+    return { expires_in, m_refreshes, m_failures, m_coalesced, m_refreshing };
+}
+
+bool token_manager::curl_post( const std::string& url, const std::string& fields, long& status, std::string& body,
+                               const std::atomic<bool>& aborting )
+{
+    auto* curl = curl_easy_init();
+    if ( !curl )
+        return false;
+
+    curl_easy_setopt( curl, CURLOPT_URL, url.c_str() );
+    curl_easy_setopt( curl, CURLOPT_POST, 1L );
+    curl_easy_setopt( curl, CURLOPT_POSTFIELDS, fields.c_str() );
+    curl_easy_setopt( curl, CURLOPT_WRITEFUNCTION, on_body );
+    curl_easy_setopt( curl, CURLOPT_WRITEDATA, &body );
+    curl_easy_setopt( curl, CURLOPT_NOPROGRESS, 0L );
+    curl_easy_setopt( curl, CURLOPT_XFERINFOFUNCTION, abort_transfer );
+    curl_easy_setopt( curl, CURLOPT_XFERINFODATA, const_cast<std::atomic<bool>*>( &aborting ) );
+    curl_easy_setopt( curl, CURLOPT_NOSIGNAL, 1L );
+    curl_easy_setopt( curl, CURLOPT_CONNECTTIMEOUT, 5L );
+    curl_easy_setopt( curl, CURLOPT_TIMEOUT, 10L );
+    curl_easy_setopt( curl, CURLOPT_USERAGENT, "deezzy" );
+
+    auto code = curl_easy_perform( curl );
+    curl_easy_getinfo( curl, CURLINFO_RESPONSE_CODE, &status );
+    curl_easy_cleanup( curl );
+
+    if ( code != CURLE_OK )
+    {
+        std::cerr << "token request failed : " << curl_easy_strerror( code ) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int64_t token_manager::_now()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>( std::chrono::system_clock::now().time_since_epoch() ).count();
+}
+
+bool token_manager::_parse_response( const std::string& body, token& result )
+{
+    // RFC 6749 json (expires_in), or the Deezer form encoded answer (expires, 0 for offline_access tokens)
+    int64_t expires = 0;
+    if ( !body.empty() && body[0] == '{' )
+    {
+        try
+        {
+            auto response = nlohmann::json::parse( body );
+            result.access_token = response.value( "access_token", "" );
+            result.refresh_token = response.value( "refresh_token", "" );
+            expires = response.value( "expires_in", response.value( "expires", int64_t( 0 ) ) );
+        }
+        catch( const std::exception& e )
+        {
+            std::cerr << "bad token response : " << e.what() << std::endl;
+            return false;
+        }
+    }
+    else
+    {
+        std::istringstream fields( body );
+        std::string field;
+        while ( std::getline( fields, field, '&' ) )
+        {
+            auto equal = field.find( '=' );
+            auto name = field.substr( 0, equal );
+            auto value = equal == std::string::npos ? std::string() : field.substr( equal + 1 );
+            if ( name == "access_token" )
+                result.access_token = value;
+            else if ( name == "refresh_token" )
+                result.refresh_token = value;
+            else if ( name == "expires" || name == "expires_in" )
+                expires = std::atoll( value.c_str() );
+        }
+    }
+
+    result.obtained_at = _now();
+    result.expires_at = expires > 0 ? result.obtained_at + expires : 0;
+    return !result.access_token.empty();
+}
+
+int64_t token_manager::_refresh_time() const
+{
+    if ( m_token.refresh_token.empty() || m_token_url.empty() )
+        return never;
+
+    // compile time token : its expiry is unknown until a first refresh
+    if ( m_token.obtained_at == 0 )
+        return m_token.expires_at ? m_token.expires_at - max_refresh_margin_s : 0;
+    if ( m_token.expires_at == 0 )
+        return never;
+
+    auto lifetime = m_token.expires_at - m_token.obtained_at;
+    return m_token.expires_at - std::min( lifetime / 5, max_refresh_margin_s );
+}
+
+void token_manager::_run()
+{
+    thread_policy::name_current_thread( "dz-token" );
+
+    int64_t retry_at = 0;
+
+    std::unique_lock<std::mutex> lock( m_mutex );
+    while ( m_running )
+    {
+        auto due = std::max( _refresh_time(), retry_at );
+        if ( due == never )
+        {
+            m_wakeup.wait( lock, [this]() { return !m_running || m_refresh_requested; } );
+        }
+        else
+        {
+            auto deadline = std::chrono::system_clock::time_point( std::chrono::seconds( due ) );
+            m_wakeup.wait_until( lock, deadline, [this]() { return !m_running || m_refresh_requested; } );
+        }
+        if ( !m_running )
+            break;
+        if ( !m_refresh_requested && _now() < due )
+            continue;
+
+        m_refresh_requested = false;
+        lock.unlock();
+        auto ok = refresh();
+        lock.lock();
+
+        if ( ok )
+        {
+            retry_at = 0;
+            m_backoff = min_backoff;
+        }
+        else
+        {
+            retry_at = _now() + m_backoff.count();
+            m_backoff = std::min( m_backoff * 2, std::chrono::seconds( max_backoff ) );
+        }
+    }
+}
+
+void token_manager::_load( const token& seed )
+{
+    m_seed = seed.access_token;
+    m_token = seed;
+
+    // seed, access token, refresh token, then obtained and expiry times
+    std::ifstream store( m_store_file );
+    std::string stored_seed;
+    token stored{};
+    if ( std::getline( store, stored_seed ) && std::getline( store, stored.access_token )
+         && std::getline( store, stored.refresh_token ) && store >> stored.obtained_at >> stored.expires_at )
+    {
+        // a new token compiled in replaces the refreshed ones
+        if ( stored_seed == m_seed && !stored.access_token.empty() )
+            m_token = stored;
+    }
+}
+
+void token_manager::_store()
+{
+    std::ostringstream content;
+    content << m_seed << "\n" << m_token.access_token << "\n" << m_token.refresh_token << "\n"
+            << m_token.obtained_at << " " << m_token.expires_at << "\n";
+    auto data = content.str();
+
+    // created owner-only before the token is written : a leftover from an interrupted store is not reused
+    auto temporary = m_store_file + ".tmp";
+    ::unlink( temporary.c_str() );
+    auto fd = ::open( temporary.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_CLOEXEC, S_IRUSR | S_IWUSR );
+    if ( fd < 0 )
+    {
+        std::cerr << "cannot store the token in " << temporary << " : " << strerror( errno ) << std::endl;
+        return;
+    }
+
+    size_t written = 0;
+    while ( written < data.size() )
+    {
+        auto count = ::write( fd, data.data() + written, data.size() - written );
+        if ( count < 0 && errno == EINTR )
+            continue;
+        if ( count <= 0 )
+            break;
+        written += static_cast<size_t>( count );
+    }
+    auto closed = ::close( fd ) == 0;
+
+    if ( written != data.size() || !closed || std::rename( temporary.c_str(), m_store_file.c_str() ) != 0 )
+    {
+        std::cerr << "cannot store the token in " << m_store_file << " : " << strerror( errno ) << std::endl;
+        ::unlink( temporary.c_str() );
+    }
+}
@@ -0,0 +1,137 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+ * OAuth access token lifecycle : the token and its expiry are kept in the user cache, and refreshed
+ * (refresh_token grant) from a background thread well before they expire, so that logins never wait
+ * on an expired token. Refreshes are serialized : a caller arriving while one is in flight waits for
+ * its result instead of sending another request, which could invalidate a rotated refresh token.
+ */
+class token_manager
+{
+public:
+    struct token
+    {
+        std::string access_token;
+        std::string refresh_token;
+        int64_t obtained_at;    ///< unix time
+        int64_t expires_at;     ///< unix time, 0 for tokens that do not expire
+    };
+
+    // called with each new access token, from the thread that refreshed it
+    using token_callback = std::function<void( const std::string& access_token )>;
+
+    // posts url encoded fields, returns false on transport errors (or once aborting is set)
+    using http_post = std::function<bool( const std::string& url, const std::string& fields, long& status, std::string& body,
+                                          const std::atomic<bool>& aborting )>;
+
+    struct infos
+    {
+        int expires_in_s;       ///< -1 for tokens that do not expire
+        int refreshes;
+        int failures;
+        int coalesced;          ///< refresh requests that joined one in flight
+        bool refreshing;
+    };
+
+    // tokens are refreshed this long before expiry, or after 80% of shorter lifetimes
+    static constexpr int64_t max_refresh_margin_s = 600;
+
+    // the seed (compile time token) is only used while the store holds nothing newer for it
+    token_manager( const std::string& store_file,
+                   const std::string& token_url,
+                   const std::string& client_id,
+                   const std::string& client_secret,
+                   const token& seed,
+                   token_callback on_token,
+                   http_post post = curl_post );
+    ~token_manager();
+
+    std::string access_token();
+
+    // refreshes now, or waits for the refresh in flight, and tells whether it succeeded
+    bool refresh();
+
+    // schedules an immediate refresh on the background thread, e.g. from SDK callbacks (no-op without refresh token)
+    void refresh_async();
+
+    // aborts the refresh in flight and joins the background thread, refreshes failing until restarted
+    void stop();
+    void start();
+
+    infos current_infos();
+
+    static bool curl_post( const std::string& url, const std::string& fields, long& status, std::string& body,
+                           const std::atomic<bool>& aborting );
+
+private:
+    static int64_t _now();
+    static bool _parse_response( const std::string& body, token& result );
+
+    int64_t _refresh_time() const;
+    void _run();
+    void _load( const token& seed );
+    void _store();
+
+private:
+    const std::string m_store_file;
+    const std::string m_token_url;
+    const std::string m_client_id;
+    const std::string m_client_secret;
+    token_callback m_on_token;
+    http_post m_post;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::condition_variable m_refreshed;
+    bool m_running = true;
+    std::atomic<bool> m_aborting{ false };
+
+    token m_token;
+    std::string m_seed;             ///< compile time token the store derives from
+
+    bool m_refreshing = false;
+    bool m_refresh_requested = false;
+    bool m_last_result = false;
+    int m_generation = 0;           ///< completed refreshes, successful or not
+    std::chrono::seconds m_backoff;
+
+    int m_refreshes = 0;
+    int m_failures = 0;
+    int m_coalesced = 0;
+
+    std::thread m_thread;
+};
@@ -23,6 +23,18 @@ THE SOFTWARE.
 */
 
 #include "DeezzyApp.h"
+#include "RemoteControl.h"
+#include "SeekBar.h"
+#include "SpectrumView.h"
+
+#include "deezer_wrapper/memory_profile.h"
+
+#include <QQmlContext>
+#include <QQuickWindow>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
 
 //#define DEEZZY_HALT_ON_EXIT
 
@@ -39,29 +51,93 @@ char* get_option( char ** begin, char ** end, const std::string& option )
 int main( int argc, char *argv[] )
 {
     auto* playlist = get_option( argv, argv+argc, "-p" );
+    // [address:]port, this device only when no address is given
+    auto* remote_port = get_option( argv, argv+argc, "-remote" );
+    auto* remote_token = get_option( argv, argv+argc, "-remote-token" );
+    auto* leader_port = get_option( argv, argv+argc, "-leader" );
+    auto* leader_address = get_option( argv, argv+argc, "-follow" );
+    // exit status 1 when the peak resident size goes over it, for regression runs
+    auto* rss_budget = get_option( argv, argv+argc, "-rss-budget" );
+
+#ifdef DEEZZY_LOW_MEMORY
+    // the scene graph texture and glyph atlases otherwise grow up to the maximum texture size
+    qputenv( "QSG_ATLAS_WIDTH", "512" );
+    qputenv( "QSG_ATLAS_HEIGHT", "512" );
+#endif
 
     QGuiApplication app( argc, argv );
 
 	qRegisterMetaType<TrackInfos*>("TrackInfos*");
+	qRegisterMetaType<LibraryModel*>("LibraryModel*");
+	qRegisterMetaType<QueueModel*>("QueueModel*");
 	qmlRegisterType<DeezzyApp>("Native.DeezzyApp", 1, 0, "DeezzyApp");
+	qmlRegisterType<SeekBar>("Native.SeekBar", 1, 0, "SeekBar");
+	qmlRegisterType<SpectrumView>("Native.SpectrumView", 1, 0, "SpectrumView");
 
     QQmlApplicationEngine engine;
+#ifdef DEEZZY_LOW_MEMORY
+    engine.rootContext()->setContextProperty( "lowMemory", true );
+#else
+    engine.rootContext()->setContextProperty( "lowMemory", false );
+#endif
+    {
+        memory_profile::scope tagged( memory_profile::tag::qml );
 #ifndef __arm__
-    engine.load(QUrl(QStringLiteral("qrc:/Deezzy.qml")));
+        engine.load(QUrl(QStringLiteral("qrc:/Deezzy.qml")));
 #else
-    engine.load(QUrl(QStringLiteral("qrc:/Deezzy_480_320.qml")));
+        engine.load(QUrl(QStringLiteral("qrc:/Deezzy_480_320.qml")));
 #endif
+    }
+
+    auto* rootObject = engine.rootObjects().first();
+    auto* deezzyObject = rootObject->findChild<DeezzyApp*>("deezzy");
 
     if ( playlist )
     {
-        auto* rootObject = engine.rootObjects().first();
-        auto* deezzyObject = rootObject->findChild<DeezzyApp*>("deezzy");
         deezzyObject->setPlaylist( playlist );
     }
 
+    if ( leader_port )
+    {
+        deezzyObject->startRoomSync( "", std::atoi( leader_port ) );
+    }
+    else if ( leader_address )
+    {
+        // host:port
+        auto address = QString( leader_address ).split( ':' );
+        deezzyObject->startRoomSync( address.value( 0 ), address.value( 1 ).toInt() );
+    }
+
+    if ( remote_port )
+    {
+        auto address = QString( remote_port ).split( ':' );
+        if ( address.size() > 1 )
+            new RemoteControl( deezzyObject, address.value( 0 ), address.value( 1 ).toInt(), remote_token );
+        else
+            new RemoteControl( deezzyObject, "127.0.0.1", address.value( 0 ).toInt(), remote_token );
+    }
+
+    // startup cost, to compare with the framebuffer front-end
+    if ( auto* window = qobject_cast<QQuickWindow*>( rootObject ) )
+    {
+        auto connection = std::make_shared<QMetaObject::Connection>();
+        *connection = QObject::connect( window, &QQuickWindow::frameSwapped, [connection]() {
+            std::cout << "STARTUP => first frame after " << memory_profile::process_age_ms() << "ms" << std::endl;
+            QObject::disconnect( *connection );
+        } );
+    }
+
+    // orderly teardown before exec() returns : the engine (and its onDestruction handlers) would go too late for a halt
+    QObject::connect( &app, &QGuiApplication::aboutToQuit, [deezzyObject]() { deezzyObject->disconnect(); } );
+
     app.exec();
 
+    std::cout << "CPU => " << memory_profile::cpu_time_ms() << "ms over " << memory_profile::process_age_ms() << "ms" << std::endl;
+    auto within_budget = memory_profile::check_peak_rss( rss_budget ? std::atol( rss_budget ) : 0 );
+
 #if defined(__arm__) && defined(DEEZZY_HALT_ON_EXIT)
     system( "sudo halt");
 #endif
+
+    return within_budget ? 0 : 1;
 }
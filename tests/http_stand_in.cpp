@@ -0,0 +1,202 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "http_stand_in.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int poll_period_ms = 100;     // how often blocked threads look at the running flag
+
+const char* reason( int status )
+{
+    switch ( status )
+    {
+        case 200: return "OK";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 401: return "Unauthorized";
+        case 404: return "Not Found";
+        case 503: return "Service Unavailable";
+        default: return "Error";
+    }
+}
+
+} // namespace
+
+http_stand_in::http_stand_in( handler on_request ) : m_on_request( std::move( on_request ) )
+{
+    m_listener = socket( AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    address.sin_port = 0;
+    socklen_t length = sizeof( address );
+
+    if ( m_listener < 0
+         || bind( m_listener, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0
+         || listen( m_listener, SOMAXCONN ) < 0
+         || getsockname( m_listener, reinterpret_cast<sockaddr*>( &address ), &length ) < 0 )
+    {
+        std::cerr << "stand-in server cannot listen : " << strerror( errno ) << std::endl;
+        if ( m_listener >= 0 )
+            close( m_listener );
+        m_listener = -1;
+        return;
+    }
+
+    m_port = ntohs( address.sin_port );
+    m_acceptor = std::thread( &http_stand_in::_accept_loop, this );
+}
+
+http_stand_in::~http_stand_in()
+{
+    m_running = false;
+    if ( m_acceptor.joinable() )
+        m_acceptor.join();
+
+    // no more connections once the acceptor is gone
+    for ( auto& t : m_threads )
+        t.join();
+
+    if ( m_listener >= 0 )
+        close( m_listener );
+}
+
+std::string http_stand_in::url() const
+{
+    return m_listener < 0 ? std::string() : "http://127.0.0.1:" + std::to_string( m_port );
+}
+
+void http_stand_in::_accept_loop()
+{
+    while ( m_running )
+    {
+        pollfd listener{ m_listener, POLLIN, 0 };
+        if ( poll( &listener, 1, poll_period_ms ) <= 0 )
+            continue;
+
+        auto fd = accept4( m_listener, nullptr, nullptr, SOCK_CLOEXEC );
+        if ( fd < 0 )
+            continue;
+
+        m_connections++;
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_threads.emplace_back( &http_stand_in::_serve, this, fd );
+    }
+}
+
+void http_stand_in::_serve( int fd )
+{
+    std::string input;
+    char data[4096];
+
+    while ( m_running )
+    {
+        auto header_end = input.find( "\r\n\r\n" );
+        if ( header_end == std::string::npos )
+        {
+            pollfd connection{ fd, POLLIN, 0 };
+            if ( poll( &connection, 1, poll_period_ms ) <= 0 )
+                continue;
+            auto size = recv( fd, data, sizeof( data ), 0 );
+            if ( size <= 0 )
+                break;
+            input.append( data, static_cast<size_t>( size ) );
+            continue;
+        }
+
+        request r;
+        std::istringstream header( input.substr( 0, header_end ) );
+        std::string target, line;
+        header >> r.method >> target;
+        std::getline( header, line );
+        while ( std::getline( header, line ) )
+        {
+            auto colon = line.find( ':' );
+            if ( colon == std::string::npos )
+                continue;
+            auto name = line.substr( 0, colon );
+            std::transform( name.begin(), name.end(), name.begin(), []( unsigned char c ) { return std::tolower( c ); } );
+            auto first = line.find_first_not_of( ' ', colon + 1 );
+            auto value = first == std::string::npos ? std::string() : line.substr( first );
+            if ( !value.empty() && value.back() == '\r' )
+                value.pop_back();
+            r.headers[name] = value;
+        }
+
+        auto query = target.find( '?' );
+        r.path = target.substr( 0, query );
+        r.query = query == std::string::npos ? std::string() : target.substr( query + 1 );
+
+        auto length = r.headers.count( "content-length" ) ? std::strtoul( r.headers["content-length"].c_str(), nullptr, 10 ) : 0;
+        auto complete = true;
+        while ( m_running && input.size() < header_end + 4 + length )
+        {
+            pollfd connection{ fd, POLLIN, 0 };
+            if ( poll( &connection, 1, poll_period_ms ) <= 0 )
+                continue;
+            auto size = recv( fd, data, sizeof( data ), 0 );
+            if ( size <= 0 )
+            {
+                complete = false;
+                break;
+            }
+            input.append( data, static_cast<size_t>( size ) );
+        }
+        if ( !complete || !m_running )
+            break;
+
+        r.body = input.substr( header_end + 4, length );
+        input.erase( 0, header_end + 4 + length );
+
+        m_requests++;
+        auto answer = m_on_request( r );
+
+        std::ostringstream out;
+        out << "HTTP/1.1 " << answer.status << " " << reason( answer.status ) << "\r\n";
+        for ( const auto& h : answer.headers )
+            out << h.first << ": " << h.second << "\r\n";
+        out << "Content-Length: " << answer.body.size() << "\r\n\r\n" << answer.body;
+
+        auto response = out.str();
+        if ( send( fd, response.data(), response.size(), MSG_NOSIGNAL ) != static_cast<ssize_t>( response.size() ) )
+            break;
+    }
+
+    close( fd );
+}
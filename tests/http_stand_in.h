@@ -0,0 +1,91 @@
+/*
+The MIT License
+
+Copyright (c) 2017-2017 Albert Murienne
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Minimal HTTP/1.1 server on an ephemeral loopback port, standing in for the Web API and OAuth
+ * endpoints in test_player's checks. Connections are kept alive and served on a thread each, so
+ * the handler must be thread safe. Only Content-Length bodies are supported.
+ */
+class http_stand_in
+{
+public:
+    struct request
+    {
+        std::string method;
+        std::string path;
+        std::string query;
+        std::map<std::string, std::string> headers;     ///< lower case names
+        std::string body;
+    };
+
+    struct response
+    {
+        int status;
+        std::string body;
+        std::map<std::string, std::string> headers;
+    };
+
+    using handler = std::function<response( const request& )>;
+
+    explicit http_stand_in( handler on_request );
+    ~http_stand_in();
+
+    http_stand_in( const http_stand_in& ) = delete;
+    http_stand_in& operator=( const http_stand_in& ) = delete;
+
+    // http://127.0.0.1:<port>, empty when the server could not listen
+    std::string url() const;
+
+    int requests() const { return m_requests; }
+    int connections() const { return m_connections; }
+
+private:
+    void _accept_loop();
+    void _serve( int fd );
+
+private:
+    handler m_on_request;
+
+    int m_listener = -1;
+    int m_port = 0;
+    std::atomic<bool> m_running{ true };
+
+    std::atomic<int> m_requests{ 0 };
+    std::atomic<int> m_connections{ 0 };
+
+    std::mutex m_mutex;
+    std::vector<std::thread> m_threads;
+    std::thread m_acceptor;
+};
@@ -23,11 +23,46 @@ THE SOFTWARE.
 */
 
 #include "deezer_wrapper/deezer_wrapper.h"
+#include "deezer_wrapper/api_client.h"
+#include "deezer_wrapper/equalizer.h"
+#include "deezer_wrapper/library_index.h"
+#include "deezer_wrapper/loudness.h"
+#include "deezer_wrapper/memory_profile.h"
+#include "deezer_wrapper/remote_server.h"
+#include "deezer_wrapper/room_sync.h"
+#include "deezer_wrapper/spectrum_analyzer.h"
+#include "deezer_wrapper/token_manager.h"
+
+#include "http_stand_in.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
 
 #define TEST_PLAYER_APPLICATION_ID      "247082"	// SET YOUR APPLICATION ID
 #define TEST_PLAYER_APPLICATION_NAME    "Deezzy"    // SET YOUR APPLICATION NAME
@@ -45,11 +80,793 @@ char* get_option( char ** begin, char ** end, const std::string& option )
     return nullptr;
 }
 
-bool leave()
+bool has_option( char ** begin, char ** end, const std::string& option )
+{
+    return std::find( begin, end, option ) != end;
+}
+
+// blocks on the keyboard until a command is typed, no polling involved
+char command()
 {
     char c;
-    std::cin >> std::noskipws >> c;
-    return c == 'q';
+    if ( !( std::cin >> c ) )
+        return 'q';
+    return c;
+}
+
+// 50k synthetic tracks indexed from scratch, then typical type-ahead queries timed against them
+void library_benchmark()
+{
+    static const char* syllables[] = { "ka", "lo", "mi", "ne", "ro", "sa", "tu", "ve", "zi", "qua", "der", "mon", "lux", "bel", "tor", "ish" };
+    static const char* queries[] = { "k", "ka", "kal", "kalo", "kalom", "mon lux", "der be", "quad", "zz", "ve ro sa" };
+
+    std::mt19937 generator( 1 );
+    auto word = [&generator]() {
+        std::string word;
+        for ( auto i = 2 + generator() % 3; i > 0; i-- )
+            word += syllables[generator() % 16];
+        return word;
+    };
+
+    std::vector<library_index::item> items;
+    for ( auto id = 0; id < 50000; id++ )
+        items.push_back( { library_index::kind::track, id, word() + " " + word() + " " + word(), word() + " " + word() } );
+
+    library_index library( "", nullptr );
+
+    auto start = std::chrono::steady_clock::now();
+    library.build( std::move( items ) );
+    std::cout << "library benchmark : indexed " << library.size() << " tracks in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - start ).count() << "ms" << std::endl;
+
+    for ( auto* query : queries )
+    {
+        auto total_us = 0;
+        auto max_us = 0;
+        size_t count = 0;
+        for ( auto run = 0; run < 100; run++ )
+        {
+            auto results = library.search( query, 500 );
+            total_us += results.micros();
+            max_us = std::max( max_us, results.micros() );
+            count = results.size();
+        }
+        std::cout << "  '" << query << "' : " << count << " results - avg " << total_us / 100.f << "us - max " << max_us << "us" << std::endl;
+    }
+}
+
+// a couple of tones over noise, in the player's stereo float format
+std::vector<float> synthetic_pcm( size_t rate, size_t frames )
+{
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution<float> noise( -0.1f, 0.1f );
+    std::vector<float> pcm( 2 * frames );
+    for ( size_t i = 0; i < frames; i++ )
+    {
+        auto t = static_cast<float>( i ) / rate;
+        auto tones = 0.3f * std::sin( 2.f * 3.14159265f * 110.f * t ) + 0.2f * std::sin( 2.f * 3.14159265f * 3520.f * t );
+        pcm[2 * i] = tones + noise( generator );
+        pcm[2 * i + 1] = 0.8f * tones + noise( generator );
+    }
+    return pcm;
+}
+
+// scalar and SIMD biquad kernels timed on 60s of synthetic PCM through a 10 band correction, in 10ms blocks
+void equalizer_benchmark()
+{
+    static const float frequencies[] = { 31.f, 63.f, 125.f, 250.f, 500.f, 1000.f, 2000.f, 4000.f, 8000.f, 16000.f };
+
+    eq_preset preset{ "benchmark", -6.f, {} };
+    for ( auto i = 0; i < 10; i++ )
+        preset.bands.push_back( { eq_band::shape::peak, frequencies[i], i % 2 ? 4.f : -4.f, 1.4f } );
+
+    const size_t rate = 48000;
+    const size_t frames = 60 * rate;
+    auto pcm = synthetic_pcm( rate, frames );
+
+    auto run = [&]( bool simd, std::vector<float>& output ) {
+        biquad_cascade cascade( preset, rate );
+        output.resize( pcm.size() );
+
+        const auto block = output_equalizer::block_frames;
+        long max_block_us = 0;
+        auto start = std::chrono::steady_clock::now();
+        for ( size_t offset = 0; offset + block <= frames; offset += block )
+        {
+            auto block_start = std::chrono::steady_clock::now();
+            if ( simd )
+                cascade.process( pcm.data() + 2 * offset, output.data() + 2 * offset, block );
+            else
+                cascade.process_scalar( pcm.data() + 2 * offset, output.data() + 2 * offset, block );
+            max_block_us = std::max<long>( max_block_us, std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - block_start ).count() );
+        }
+        auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+        std::cout << "  " << ( simd ? biquad_cascade::kernel() : "scalar" ) << " : " << 1e9 * seconds / frames << "ns per frame - cpu load "
+                  << 100. * seconds / 60. << "% - worst block " << max_block_us << "us (10ms budget)" << std::endl;
+    };
+
+    std::cout << "equalizer benchmark : " << preset.bands.size() << " bands, 60s of stereo 48kHz" << std::endl;
+
+    std::vector<float> scalar, simd;
+    run( false, scalar );
+    run( true, simd );
+
+    auto max_difference = 0.f;
+    for ( size_t i = 0; i < pcm.size(); i++ )
+        max_difference = std::max( max_difference, std::abs( scalar[i] - simd[i] ) );
+    std::cout << "  max difference between kernels : " << max_difference << std::endl;
+}
+
+// K-weighting filter timed on 60s of synthetic PCM, in the meter's 100ms blocks
+void loudness_benchmark()
+{
+    const size_t rate = audio_monitor::sample_rate;
+    const size_t frames = 60 * rate;
+    auto pcm = synthetic_pcm( rate, frames );
+
+    k_weighting_filter filter( rate );
+
+    const auto block = loudness_meter::block_frames;
+    double energy = 0.;
+    long max_block_us = 0;
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t offset = 0; offset + block <= frames; offset += block )
+    {
+        auto block_start = std::chrono::steady_clock::now();
+        energy += filter.process( pcm.data() + 2 * offset, block );
+        max_block_us = std::max<long>( max_block_us, std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - block_start ).count() );
+    }
+    auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << "loudness benchmark : K-weighting, 60s of stereo 48kHz" << std::endl;
+    std::cout << "  " << 1e9 * seconds / frames << "ns per frame - cpu load " << 100. * seconds / 60. << "% - worst block "
+              << max_block_us << "us (100ms budget) - measured " << -0.691 + 10. * std::log10( energy / frames ) << " LUFS" << std::endl;
+}
+
+// real FFT timed on 60s of synthetic PCM in the analyzer's 1024 frames blocks, and checked against a plain DFT
+void fft_benchmark()
+{
+    const size_t rate = audio_monitor::sample_rate;
+    const size_t frames = 60 * rate;
+    const auto size = spectrum_analyzer::fft_size;
+    auto pcm = synthetic_pcm( rate, frames );
+
+    real_fft fft( size );
+    std::vector<float> mono( size ), power( size / 2 );
+
+    long max_block_us = 0;
+    size_t blocks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t offset = 0; offset + size <= frames; offset += size, blocks++ )
+    {
+        auto block_start = std::chrono::steady_clock::now();
+        for ( size_t i = 0; i < size; i++ )
+            mono[i] = 0.5f * ( pcm[2 * ( offset + i )] + pcm[2 * ( offset + i ) + 1] );
+        fft.power_spectrum( mono.data(), power.data() );
+        max_block_us = std::max<long>( max_block_us, std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - block_start ).count() );
+    }
+    auto seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+    std::cout << "fft benchmark : " << size << " points, 60s of stereo 48kHz" << std::endl;
+    std::cout << "  " << 1e6 * seconds / blocks << "us per block - cpu load " << 100. * seconds / 60. << "% - worst block "
+              << max_block_us << "us (" << 1e3 * size / rate << "ms budget)" << std::endl;
+
+    // last block against the textbook transform, relative to the spectrum peak
+    double peak = 0., max_difference = 0.;
+    std::vector<double> reference( size / 2 );
+    for ( size_t k = 0; k < size / 2; k++ )
+    {
+        double re = 0., im = 0.;
+        for ( size_t n = 0; n < size; n++ )
+        {
+            re += mono[n] * std::cos( 2. * 3.14159265358979 * k * n / size );
+            im -= mono[n] * std::sin( 2. * 3.14159265358979 * k * n / size );
+        }
+        reference[k] = re * re + im * im;
+        peak = std::max( peak, reference[k] );
+    }
+    for ( size_t k = 0; k < size / 2; k++ )
+        max_difference = std::max( max_difference, std::abs( power[k] - reference[k] ) / peak );
+    std::cout << "  max difference with a plain DFT : " << max_difference << " of the peak" << std::endl;
+}
+
+// polls the condition until it holds or the timeout expires
+bool eventually( const std::function<bool()>& condition, int timeout_ms )
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout_ms );
+    while ( !condition() )
+    {
+        if ( std::chrono::steady_clock::now() > deadline )
+            return false;
+        std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    }
+    return true;
+}
+
+bool expect( bool ok, const std::string& what )
+{
+    std::cout << "  " << ( ok ? "ok" : "FAILED" ) << " : " << what << std::endl;
+    return ok;
+}
+
+// api client against a local stand-in of the Web API : dedup, playlist batching, 304 revalidation and queue persistence
+bool api_check()
+{
+    std::mutex mutex;
+    std::vector<std::string> posts;
+    auto writes_fail = false;
+
+    http_stand_in api( [&]( const http_stand_in::request& r ) -> http_stand_in::response {
+        std::lock_guard<std::mutex> lock( mutex );
+        if ( r.method == "POST" )
+        {
+            if ( writes_fail )
+                return { 503, "", {} };
+            if ( r.query.find( "access_token=expired" ) != std::string::npos )
+                return { 200, "{\"error\":{\"type\":\"OAuthException\",\"code\":300}}", {} };
+            posts.push_back( r.path + " " + r.body );
+            return { 200, "true", {} };
+        }
+        if ( r.path == "/album/302127" )
+        {
+            if ( r.headers.count( "if-none-match" ) && r.headers.at( "if-none-match" ) == "\"v1\"" )
+                return { 304, "", { { "ETag", "\"v1\"" } } };
+            return { 200, "{\"id\":302127,\"title\":\"Discovery\"}", { { "ETag", "\"v1\"" } } };
+        }
+        return { 404, "{\"error\":{\"code\":800}}", {} };
+    } );
+    if ( api.url().empty() )
+        return false;
+
+    const std::string queue_file = "/tmp/test_player_api.queue";
+    std::remove( queue_file.c_str() );
+
+    auto passed = true;
+    auto connections = 0, requests = 0;
+    auto get = []( api_client& client, const std::string& path, std::chrono::seconds ttl ) {
+        std::promise<std::pair<bool, std::string>> answer;
+        client.get( path, ttl, [&answer]( bool ok, const std::string& body ) { answer.set_value( { ok, body } ); } );
+        return answer.get_future().get();
+    };
+
+    std::cout << "api check : stand-in at " << api.url() << std::endl;
+    {
+        api_client client( api.url(), "token", queue_file, 2 );
+
+        long max_enqueue_us = 0;
+        auto enqueue = [&]( api_client::action_type type, int id, int target ) {
+            auto start = std::chrono::steady_clock::now();
+            client.enqueue( type, id, target );
+            max_enqueue_us = std::max<long>( max_enqueue_us, std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count() );
+        };
+        enqueue( api_client::action_type::like_track, 3135556, 0 );
+        enqueue( api_client::action_type::like_track, 3135556, 0 );
+        enqueue( api_client::action_type::like_album, 302127, 0 );
+        enqueue( api_client::action_type::add_to_playlist, 908622995, 11 );
+        enqueue( api_client::action_type::add_to_playlist, 908622996, 11 );
+        std::cout << "  slowest enqueue : " << max_enqueue_us << "us" << std::endl;
+
+        passed &= expect( eventually( [&]() { return client.current_infos().pending_actions == 0; }, 5000 ), "actions flushed" );
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            std::sort( posts.begin(), posts.end() );
+            passed &= expect( posts == std::vector<std::string>{ "/playlist/11/tracks songs=908622995,908622996",
+                                                                 "/user/me/albums album_id=302127",
+                                                                 "/user/me/tracks track_id=3135556" },
+                              "duplicate like dropped, playlist additions batched" );
+        }
+        std::ifstream queue( queue_file );
+        passed &= expect( queue && queue.peek() == std::ifstream::traits_type::eof(), "queue file rewritten empty" );
+
+        auto first = get( client, "album/302127", std::chrono::seconds( 0 ) );
+        auto second = get( client, "album/302127", std::chrono::seconds( 0 ) );
+        auto third = get( client, "album/302127", std::chrono::seconds( 60 ) );
+        auto fourth = get( client, "album/302127", std::chrono::seconds( 60 ) );
+        auto infos = client.current_infos();
+        connections = api.connections();
+        requests = api.requests();
+        passed &= expect( first.first && second == first && third == first && fourth == first, "album served the same from the cache" );
+        passed &= expect( infos.revalidations == 2 && infos.cache_hits == 1, "expired entries revalidated with a 304, fresh one served without request" );
+
+        std::lock_guard<std::mutex> lock( mutex );
+        writes_fail = true;
+    }
+    {
+        // 503s keep the action queued, destroying the client aborts the retries
+        api_client client( api.url(), "token", queue_file, 2 );
+        client.enqueue( api_client::action_type::like_track, 1109731, 0 );
+        std::this_thread::sleep_for( std::chrono::seconds( 3 ) );
+        passed &= expect( client.current_infos().pending_actions == 1, "action kept while the API fails" );
+    }
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        writes_fail = false;
+        posts.clear();
+    }
+    {
+        api_client client( api.url(), "token", queue_file, 2 );
+        passed &= expect( eventually( [&]() { return client.current_infos().pending_actions == 0; }, 5000 ), "queued action sent after a restart" );
+        std::lock_guard<std::mutex> lock( mutex );
+        passed &= expect( posts == std::vector<std::string>{ "/user/me/tracks track_id=1109731" }, "restored action sent once" );
+        posts.clear();
+    }
+    {
+        // a refused token keeps the action until the refreshed one is set
+        std::atomic<int> refreshes{ 0 };
+        api_client client( api.url(), "expired", queue_file, 2, [&refreshes]() { refreshes++; } );
+        client.enqueue( api_client::action_type::like_album, 302127, 0 );
+        passed &= expect( eventually( [&]() { return refreshes == 1; }, 5000 ), "refresh asked for a refused token" );
+        passed &= expect( client.current_infos().pending_actions == 1, "action kept while the token is refused" );
+        client.set_access_token( "fresh" );
+        passed &= expect( eventually( [&]() { return client.current_infos().pending_actions == 0; }, 2000 ), "action sent with the refreshed token" );
+        std::lock_guard<std::mutex> lock( mutex );
+        passed &= expect( posts == std::vector<std::string>{ "/user/me/albums album_id=302127" } && refreshes == 1, "action sent once, one refresh asked" );
+    }
+
+    passed &= expect( connections <= 3, "connections kept alive (" + std::to_string( connections ) + " for " + std::to_string( requests ) + " requests)" );
+
+    std::remove( queue_file.c_str() );
+    std::cout << "api check : " << ( passed ? "passed" : "FAILED" ) << std::endl;
+    return passed;
+}
+
+// remote server driven by a poll loop as by the GUI, against a local load generator of WebSocket clients
+bool remote_load_check( int clients )
+{
+    const int port = 18765;
+    const int updates = 20;
+
+    // both ends of each connection live in this process
+    rlimit files;
+    getrlimit( RLIMIT_NOFILE, &files );
+    files.rlim_cur = std::max<rlim_t>( files.rlim_cur, std::min<rlim_t>( files.rlim_max, 2 * clients + 64 ) );
+    setrlimit( RLIMIT_NOFILE, &files );
+
+    remote_server server( "127.0.0.1", port, "", []( const std::string&, const std::string& ) { return true; } );
+    if ( server.fd() < 0 )
+        return false;
+
+    auto serve = [&server]( std::chrono::milliseconds duration ) {
+        auto end = std::chrono::steady_clock::now() + duration;
+        for ( auto now = std::chrono::steady_clock::now(); now < end; now = std::chrono::steady_clock::now() )
+        {
+            pollfd events{ server.fd(), POLLIN, 0 };
+            if ( poll( &events, 1, static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( end - now ).count() ) + 1 ) > 0 )
+                server.process();
+        }
+    };
+    auto cpu_ms = []() {
+        timespec t;
+        clock_gettime( CLOCK_THREAD_CPUTIME_ID, &t );
+        return t.tv_sec * 1000. + t.tv_nsec / 1e6;
+    };
+
+    std::atomic<bool> generating{ true };
+    std::atomic<int> connected{ 0 };
+    std::vector<int> frames( clients, 0 );
+
+    std::thread generator( [&]() {
+        struct connection
+        {
+            int fd;
+            bool upgraded;
+            std::string input;
+        };
+        std::vector<connection> connections;
+
+        auto poller = epoll_create1( EPOLL_CLOEXEC );
+        const std::string handshake = "GET /events HTTP/1.1\r\nHost: 127.0.0.1:" + std::to_string( port ) + "\r\n"
+                                      "Upgrade: websocket\r\nConnection: Upgrade\r\n"
+                                      "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+        for ( auto i = 0; i < clients; i++ )
+        {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+            address.sin_port = htons( port );
+
+            auto fd = socket( AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+            if ( fd < 0 || connect( fd, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) < 0
+                 || send( fd, handshake.data(), handshake.size(), MSG_NOSIGNAL ) != static_cast<ssize_t>( handshake.size() ) )
+            {
+                std::cerr << "load generator cannot connect client " << i << " : " << strerror( errno ) << std::endl;
+                if ( fd >= 0 )
+                    close( fd );
+                break;
+            }
+            connections.push_back( { fd, false, {} } );
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u32 = static_cast<uint32_t>( i );
+            epoll_ctl( poller, EPOLL_CTL_ADD, fd, &event );
+        }
+
+        epoll_event events[64];
+        while ( generating )
+        {
+            auto count = epoll_wait( poller, events, 64, 50 );
+            for ( auto e = 0; e < count; e++ )
+            {
+                auto i = events[e].data.u32;
+                auto& c = connections[i];
+                char data[4096];
+                auto size = recv( c.fd, data, sizeof( data ), MSG_DONTWAIT );
+                if ( size <= 0 )
+                {
+                    epoll_ctl( poller, EPOLL_CTL_DEL, c.fd, nullptr );
+                    continue;
+                }
+                c.input.append( data, static_cast<size_t>( size ) );
+
+                if ( !c.upgraded )
+                {
+                    auto header_end = c.input.find( "\r\n\r\n" );
+                    if ( header_end == std::string::npos )
+                        continue;
+                    c.upgraded = c.input.compare( 0, 12, "HTTP/1.1 101" ) == 0;
+                    c.input.erase( 0, header_end + 4 );
+                }
+
+                // server frames are not masked
+                while ( c.upgraded && c.input.size() >= 2 )
+                {
+                    size_t length = c.input[1] & 0x7f;
+                    size_t header = 2;
+                    if ( length == 126 )
+                    {
+                        if ( c.input.size() < 4 )
+                            break;
+                        length = ( size_t( uint8_t( c.input[2] ) ) << 8 ) | uint8_t( c.input[3] );
+                        header = 4;
+                    }
+                    if ( c.input.size() < header + length )
+                        break;
+                    c.input.erase( 0, header + length );
+                    if ( frames[i]++ == 0 )
+                        connected++;
+                }
+            }
+        }
+
+        for ( auto& c : connections )
+            close( c.fd );
+        close( poller );
+    } );
+
+    std::cout << "remote load : " << clients << " WebSocket clients on port " << port << std::endl;
+
+    auto passed = true;
+    auto start = std::chrono::steady_clock::now();
+    auto cpu_start = cpu_ms();
+    while ( connected < clients && std::chrono::steady_clock::now() - start < std::chrono::seconds( 10 ) )
+        serve( std::chrono::milliseconds( 50 ) );
+    std::cout << "  handshakes : " << connected << " in " << std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - start ).count()
+              << "ms - cpu " << cpu_ms() - cpu_start << "ms" << std::endl;
+    passed &= expect( connected == clients, "every client connected and got the snapshot" );
+
+    cpu_start = cpu_ms();
+    for ( auto i = 1; i <= updates; i++ )
+    {
+        auto position = std::to_string( i * 1000 );
+        server.publish( "{\"position\":" + position + "}", "{\"state\":\"playing\",\"position\":" + position + "}" );
+        serve( std::chrono::milliseconds( 250 ) );
+    }
+    auto infos = server.current_infos();
+    std::cout << "  updates : " << updates << " - " << infos.bytes_sent / 1024 << "kB sent - cpu " << cpu_ms() - cpu_start << "ms" << std::endl;
+
+    cpu_start = cpu_ms();
+    serve( std::chrono::seconds( 2 ) );
+    auto idle_cpu_ms = cpu_ms() - cpu_start;
+    std::cout << "  idle : cpu " << idle_cpu_ms << "ms over 2s" << std::endl;
+
+    generating = false;
+    generator.join();
+
+    passed &= expect( std::all_of( frames.begin(), frames.end(), [updates]( int count ) { return count == updates + 1; } ), "every client received every update" );
+    passed &= expect( infos.websocket_clients == clients && infos.dropped_clients == 0, "no client dropped" );
+    passed &= expect( idle_cpu_ms < 20., "idle connections cost no CPU" );
+
+    std::cout << "remote load : " << ( passed ? "passed" : "FAILED" ) << std::endl;
+    return passed;
+}
+
+// player stand-in for room_sync : positions follow the local clock at the given rate, and actions take time to land as on the SDK
+class simulated_player
+{
+public:
+    simulated_player( int user, double rate, int seek_latency_ms ) : m_user( user ), m_rate( rate ), m_seek_latency_ms( seek_latency_ms ) {}
+
+    room_sync::player bind()
+    {
+        return { [this]() { return state(); },
+                 [this]( const std::string& content ) { load( content ); },
+                 [this]( int index ) { _act( action::jump, index, jump_latency_ms ); },
+                 [this]( int position_ms ) { _act( action::seek, position_ms, m_seek_latency_ms ); },
+                 [this]() { pause(); },
+                 [this]() { resume(); } };
+    }
+
+    room_sync::player_state state()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        _settle();
+        return { m_content, m_index, m_index < 0 ? 0 : _track_id( m_index ), static_cast<int>( _position_ms() ), m_playing };
+    }
+
+    void load( const std::string& content )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_content = content;
+        m_index = -1;
+        _freeze( 0 );
+        _schedule( action::load, 0, load_latency_ms );
+    }
+    void seek( int position_ms ) { _act( action::seek, position_ms, m_seek_latency_ms ); }
+    void jump( int index ) { _act( action::jump, index, jump_latency_ms ); }
+
+    void pause()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        _settle();
+        _freeze( _position_ms() );
+    }
+    void resume()
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        _settle();
+        if ( m_index >= 0 && m_pending == action::none )
+            _start( _position_ms() );
+    }
+
+private:
+    enum class action { none, load, jump, seek };
+
+    static constexpr int load_latency_ms = 600;
+    static constexpr int jump_latency_ms = 300;
+
+    using clock = std::chrono::steady_clock;
+
+    void _act( action a, int target, int latency_ms )
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        _settle();
+        if ( m_index < 0 )
+            return;
+        _freeze( a == action::seek ? target : 0 );
+        _schedule( a, target, latency_ms );
+    }
+
+    void _schedule( action a, int target, int latency_ms )
+    {
+        m_pending = a;
+        m_target = target;
+        m_due = clock::now() + std::chrono::milliseconds( latency_ms );
+    }
+
+    // the host starts playback once the queue is loaded
+    void _settle()
+    {
+        if ( m_pending == action::none || clock::now() < m_due )
+            return;
+        if ( m_pending == action::load )
+            m_index = 0;
+        else if ( m_pending == action::jump )
+            m_index = m_target;
+        m_pending = action::none;
+        _start( _position_ms() );
+        m_anchor = m_due;
+    }
+
+    void _freeze( double position_ms )
+    {
+        m_playing = false;
+        m_position_ms = position_ms;
+    }
+    void _start( double position_ms )
+    {
+        m_playing = true;
+        m_position_ms = position_ms;
+        m_anchor = clock::now();
+    }
+
+    double _position_ms() const
+    {
+        return m_playing ? m_position_ms + m_rate * std::chrono::duration<double, std::milli>( clock::now() - m_anchor ).count() : m_position_ms;
+    }
+
+    // flows differ per user, other contents give the same queue to everyone
+    int _track_id( int index ) const
+    {
+        const std::string track = "dzmedia:///track/";
+        if ( m_content.compare( 0, track.size(), track ) == 0 )
+            return std::atoi( m_content.c_str() + track.size() );
+        if ( m_content.compare( 0, 11, "dzradio:///" ) == 0 )
+            return 900000 + 1000 * m_user + index;
+        return static_cast<int>( std::hash<std::string>()( m_content ) % 100000 ) * 100 + index + 1;
+    }
+
+private:
+    const int m_user;
+    const double m_rate;
+    const int m_seek_latency_ms;
+
+    std::mutex m_mutex;
+    std::string m_content;
+    int m_index = -1;
+    bool m_playing = false;
+    double m_position_ms = 0.;
+    clock::time_point m_anchor;
+
+    action m_pending = action::none;
+    int m_target = 0;
+    clock::time_point m_due;
+};
+
+// a leader and a follower with simulated players in this process, talking over loopback with simulated network delay
+bool sync_check( int delay_ms )
+{
+    const int port = 18766;
+    const int seek_latency_ms = 150;
+
+    // the follower plays 0.1% fast, as a drifting sound card would
+    simulated_player leader_player( 1, 1., seek_latency_ms );
+    simulated_player follower_player( 2, 1.001, seek_latency_ms );
+    leader_player.load( "dzmedia:///playlist/1234" );
+
+    room_sync leader( room_sync::role::leader, "", port, leader_player.bind(), delay_ms );
+    room_sync follower( room_sync::role::follower, "127.0.0.1", port, follower_player.bind(), delay_ms );
+
+    // true skew, both players sharing this process clock
+    auto skew_ms = [&]() {
+        auto l = leader_player.state();
+        auto f = follower_player.state();
+        return l.track_id == f.track_id && l.playing && f.playing ? f.position_ms - l.position_ms : std::numeric_limits<int>::max();
+    };
+
+    std::cout << "sync check : simulated players, " << seek_latency_ms << "ms seeks, " << delay_ms << "ms network delay" << std::endl;
+
+    auto passed = true;
+    auto converge = [&]( const std::string& what, int timeout_s ) {
+        auto start = std::chrono::steady_clock::now();
+        auto ok = eventually( [&]() { return std::abs( skew_ms() ) <= room_sync::tolerance_ms; }, timeout_s * 1000 );
+        passed &= expect( ok, what + " followed in " + std::to_string( std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - start ).count() ) + "ms" );
+    };
+
+    converge( "leader content", 20 );
+
+    // then held without the leader doing anything
+    auto max_skew_ms = 0;
+    for ( auto i = 0; i < 100; i++ )
+    {
+        max_skew_ms = std::max( max_skew_ms, std::abs( skew_ms() ) );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+    }
+    passed &= expect( max_skew_ms <= 2 * room_sync::tolerance_ms, "skew held within " + std::to_string( max_skew_ms ) + "ms over 10s" );
+
+    leader_player.seek( 120000 );
+    converge( "leader seek", 10 );
+
+    leader_player.jump( 3 );
+    converge( "leader jump", 10 );
+
+    leader_player.load( "dzradio:///user-1" );
+    converge( "leader flow, track by track,", 20 );
+
+    // lets the follower measure again after its last correction
+    std::this_thread::sleep_for( std::chrono::seconds( 2 ) );
+    auto infos = follower.current_infos();
+    std::cout << "  follower : clock offset " << infos.offset_us << "us (round trip " << infos.round_trip_ms << "ms) - reported skew "
+              << infos.skew_ms << "ms - corrections " << infos.corrections << " - seek lead " << infos.seek_lead_ms << "ms" << std::endl;
+    passed &= expect( std::abs( infos.offset_us ) < 10000, "clock offset estimated within 10ms" );
+    passed &= expect( leader.current_infos().followers == 1, "follower known to the leader" );
+
+    std::cout << "sync check : " << ( passed ? "passed" : "FAILED" ) << std::endl;
+    return passed;
+}
+
+// token manager against a local OAuth stand-in issuing 5s tokens and rotating refresh tokens, which it only accepts once
+bool token_check()
+{
+    std::mutex mutex;
+    auto issued = 0;
+    auto rejected = 0;
+    std::string refresh_token = "refresh-0";
+    auto down = false;
+    std::atomic<int> response_delay_ms{ 0 };
+
+    http_stand_in oauth( [&]( const http_stand_in::request& r ) -> http_stand_in::response {
+        std::this_thread::sleep_for( std::chrono::milliseconds( response_delay_ms ) );
+
+        std::map<std::string, std::string> fields;
+        std::istringstream body( r.body );
+        std::string field;
+        while ( std::getline( body, field, '&' ) )
+            fields[field.substr( 0, field.find( '=' ) )] = field.find( '=' ) == std::string::npos ? "" : field.substr( field.find( '=' ) + 1 );
+
+        std::lock_guard<std::mutex> lock( mutex );
+        if ( down )
+            return { 503, "", {} };
+        if ( r.method != "POST" || r.path != "/oauth/token" || fields["grant_type"] != "refresh_token" || fields["refresh_token"] != refresh_token )
+        {
+            rejected++;
+            return { 400, "{\"error\":\"invalid_grant\"}", {} };
+        }
+        issued++;
+        refresh_token = "refresh-" + std::to_string( issued );
+        return { 200, "{\"access_token\":\"access-" + std::to_string( issued ) + "\",\"token_type\":\"bearer\",\"expires_in\":5,\"refresh_token\":\"" + refresh_token + "\"}",
+                 { { "Content-Type", "application/json" } } };
+    } );
+    if ( oauth.url().empty() )
+        return false;
+
+    const std::string store_file = "/tmp/test_player_oauth.token";
+    std::remove( store_file.c_str() );
+
+    const token_manager::token seed{ "access-0", "refresh-0", 0, 0 };
+    std::string swapped;
+    auto on_token = [&]( const std::string& access_token ) {
+        std::lock_guard<std::mutex> lock( mutex );
+        swapped = access_token;
+    };
+    auto requests = [&oauth]() { return oauth.requests(); };
+
+    std::cout << "token check : stand-in at " << oauth.url() << std::endl;
+
+    auto passed = true;
+    {
+        // the seed expiry is unknown, so it is refreshed at once, then after 80% of each 5s lifetime
+        token_manager tokens( store_file, oauth.url() + "/oauth/token", "id", "secret", seed, on_token );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 9500 ) );
+        auto infos = tokens.current_infos();
+        passed &= expect( infos.refreshes >= 3 && infos.failures == 0, std::to_string( infos.refreshes ) + " background refreshes in 9.5s, none refused" );
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            passed &= expect( swapped == tokens.access_token() && swapped == "access-" + std::to_string( issued ), "each new token handed over" );
+        }
+
+        response_delay_ms = 300;
+        auto before = requests();
+        std::vector<std::future<bool>> results;
+        for ( auto i = 0; i < 10; i++ )
+            results.push_back( std::async( std::launch::async, [&tokens]() { return tokens.refresh(); } ) );
+        auto all_ok = std::all_of( results.begin(), results.end(), []( std::future<bool>& result ) { return result.get(); } );
+        response_delay_ms = 0;
+        passed &= expect( all_ok && requests() - before == 1, "10 concurrent refreshes sent " + std::to_string( requests() - before ) + " request" );
+    }
+    {
+        auto before = requests();
+        token_manager tokens( store_file, oauth.url() + "/oauth/token", "id", "secret", seed, on_token );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            passed &= expect( tokens.access_token() == "access-" + std::to_string( issued ) && requests() == before, "stored token reused after a restart" );
+            down = true;
+        }
+
+        // the refresh due before expiry fails, then is retried with backoff
+        auto failures = [&tokens]() { return tokens.current_infos().failures; };
+        passed &= expect( eventually( [&]() { return failures() == 1; }, 6000 ), "refresh failing while the endpoint is down" );
+        auto failed = std::chrono::steady_clock::now();
+        auto retried = eventually( [&]() { return failures() == 2; }, 8000 );
+        auto backoff_ms = std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - failed ).count();
+        passed &= expect( retried && backoff_ms >= 4000, "retried after " + std::to_string( backoff_ms ) + "ms" );
+
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            down = false;
+        }
+        tokens.refresh_async();
+        passed &= expect( eventually( [&]() { return tokens.current_infos().expires_in_s > 0; }, 3000 ), "token refreshed once the endpoint is back" );
+    }
+
+    std::lock_guard<std::mutex> lock( mutex );
+    passed &= expect( rejected == 0, "no refresh token sent twice" );
+
+    std::remove( store_file.c_str() );
+    std::cout << "token check : " << ( passed ? "passed" : "FAILED" ) << std::endl;
+    return passed;
 }
 
 class auto_reset_event
@@ -177,7 +994,8 @@ class my_observer : public deezer_wrapper::observer
         }
         void on_render_progress( int progress_ms ) final override
         {
-            std::cout << "render progress : " << progress_ms << std::endl;
+            // the clock keeps its own estimate, slewed towards the samples
+            std::cout << "render progress : " << progress_ms << " - clock : " << dz_wrapper.playback_position_ms() << std::endl;
         }
         void on_track_duration( int duration_ms ) final override
         {
@@ -186,24 +1004,256 @@ class my_observer : public deezer_wrapper::observer
 
 int main( int argc, char *argv[] )
 {
+    // kernels only, no login nor audio output involved
+    if ( std::find( argv, argv+argc, std::string( "-eq-bench" ) ) != argv+argc )
+    {
+        equalizer_benchmark();
+        return 0;
+    }
+    if ( std::find( argv, argv+argc, std::string( "-loudness-bench" ) ) != argv+argc )
+    {
+        loudness_benchmark();
+        return 0;
+    }
+    if ( std::find( argv, argv+argc, std::string( "-fft-bench" ) ) != argv+argc )
+    {
+        fft_benchmark();
+        return 0;
+    }
+    // against local stand-ins, exit status 1 on failure
+    if ( has_option( argv, argv+argc, "-api-check" ) )
+        return api_check() ? 0 : 1;
+    if ( has_option( argv, argv+argc, "-remote-load" ) )
+    {
+        auto* clients = get_option( argv, argv+argc, "-remote-load" );
+        return remote_load_check( clients && std::atoi( clients ) > 0 ? std::atoi( clients ) : 500 ) ? 0 : 1;
+    }
+    if ( has_option( argv, argv+argc, "-sync-check" ) )
+    {
+        auto* sync_delay = get_option( argv, argv+argc, "-sync-delay" );
+        return sync_check( sync_delay ? std::atoi( sync_delay ) : 30 ) ? 0 : 1;
+    }
+    if ( has_option( argv, argv+argc, "-token-check" ) )
+        return token_check() ? 0 : 1;
+
     auto* playlist = get_option( argv, argv+argc, "-p" );
+    auto* leader_port = get_option( argv, argv+argc, "-leader" );
+    auto* leader_address = get_option( argv, argv+argc, "-follow" );
+    // outgoing sync datagrams delayed by 50 to 150% of this, to run several nodes on loopback
+    auto* sync_delay = get_option( argv, argv+argc, "-sync-delay" );
+    // exit status 1 when the peak resident size goes over it, for regression runs
+    auto* rss_budget = get_option( argv, argv+argc, "-rss-budget" );
 
     my_observer player_observer;
 
     dz_wrapper.register_observer( &player_observer );
+    // optional features are opt-in, as in the players
+    dz_wrapper.enable_loudness_normalization( has_option( argv, argv+argc, "-loudness" ) );
+    dz_wrapper.enable_ram_cache( has_option( argv, argv+argc, "-ram-cache" ) );
+    dz_wrapper.enable_skip_prediction( has_option( argv, argv+argc, "-skip-prediction" ) );
+    dz_wrapper.enable_equalizer( has_option( argv, argv+argc, "-eq" ) );
+    dz_wrapper.enable_schedule( has_option( argv, argv+argc, "-schedule" ) );
+    dz_wrapper.enable_thread_policy( has_option( argv, argv+argc, "-thread-policy" ) );
     dz_wrapper.connect();
 
     ars_login_ok.wait_one(); // wait for log in success
 
-    dz_wrapper.set_content( playlist ? std::string( playlist ) : ( "dzradio:///user-" + dz_wrapper.user_id() ) );
-    dz_wrapper.load_content();
+    std::unique_ptr<room_sync> sync;
+    auto delay_ms = sync_delay ? std::atoi( sync_delay ) : 0;
+    if ( leader_address )
+    {
+        // host:port, the content comes from the leader
+        std::string address( leader_address );
+        auto colon = address.find( ':' );
+        sync.reset( new room_sync( room_sync::role::follower, address.substr( 0, colon ),
+                                   colon == std::string::npos ? 0 : std::atoi( address.c_str() + colon + 1 ),
+                                   room_sync::bind( dz_wrapper ), delay_ms ) );
+    }
+    else
+    {
+        auto scheduled = dz_wrapper.scheduled_content();
+        dz_wrapper.set_content( playlist ? std::string( playlist ) : !scheduled.empty() ? scheduled : ( "dzradio:///user-" + dz_wrapper.user_id() ) );
+        dz_wrapper.load_content();
+
+        if ( leader_port )
+            sync.reset( new room_sync( room_sync::role::leader, "", std::atoi( leader_port ), room_sync::bind( dz_wrapper ), delay_ms ) );
+    }
+
+    std::cout << "commands : 'w' wakeups per second, 'l' loudness, 'o' offline sync, 's' storage, 'r' reconnections, 'x' access token, 'g' profiles, 'h' switch profile, 'k' like, 'p' skip prediction, 'z' equalizer, 'n' equalizer zone, 'd' daypart schedule, 'c' ad breaks, 'a' api, 'f' find in library, 'b' library benchmark, 'u' up next, 't' threads, 'm' memory, 'e' quality of experience, 'y' room sync, 'q' quit" << std::endl;
 
-    while ( dz_wrapper.active() )
+    for ( auto c = command(); c != 'q'; c = command() )
     {
-        if ( leave() )
-            break;
+        if ( c == 'w' )
+            std::cout << "wakeups per second : " << dz_wrapper.wakeups_per_second()
+                      << " (" << std::string( dz_wrapper.idle() ? "idle" : "active" ) << ")" << std::endl;
+        else if ( c == 'l' )
+        {
+            auto infos = dz_wrapper.current_loudness_infos();
+            std::cout << "loudness short term : " << infos.short_term_lufs << " LUFS - track : " << infos.track_lufs
+                      << " LUFS - volume : " << infos.volume << " - meter cpu load : " << 100.f * infos.cpu_load << "%" << std::endl;
+        }
+        else if ( c == 'o' )
+        {
+            auto infos = dz_wrapper.current_offline_infos();
+            std::cout << "offline synced tracks : " << infos.synced_tracks << " - pending : " << infos.pending_tracks
+                      << " - buffered ahead : " << infos.buffered_ahead_minutes << " min"
+                      << " (" << std::string( infos.offline ? "offline" : "online" ) << ")" << std::endl;
+        }
+        else if ( c == 's' )
+        {
+            auto infos = dz_wrapper.current_storage_infos();
+            std::cout << "storage ram tier : " << infos.ram_kB << "kB - flushed : " << infos.flushed_kB << "kB in " << infos.flush_count
+                      << " batches - process writes : " << infos.written_kB << "kB - underflows : " << infos.underflow_count << std::endl;
+        }
+        else if ( c == 'r' )
+        {
+            auto infos = dz_wrapper.current_connection_infos();
+            std::cout << "connection " << std::string( infos.connected ? "up" : "down" ) << " - outages : " << infos.outage_count
+                      << " - retries : " << infos.retry_count << " - last recover : " << infos.last_recover_ms
+                      << "ms - max recover : " << infos.max_recover_ms << "ms" << std::endl;
+        }
+        else if ( c == 'x' )
+        {
+            auto infos = dz_wrapper.current_token_infos();
+            std::cout << "access token " << ( infos.expires_in_s < 0 ? std::string( "does not expire" ) : "expires in " + std::to_string( infos.expires_in_s ) + "s" )
+                      << " - refreshes : " << infos.refreshes << " - failures : " << infos.failures
+                      << " - coalesced : " << infos.coalesced << std::endl;
+        }
+        else if ( c == 'g' )
+        {
+            for ( const auto& profile : dz_wrapper.profiles() )
+                std::cout << "  " << ( profile.active ? "* " : "  " ) << profile.name << " (user " << profile.user_id << ")"
+                          << ( profile.ready || profile.active ? "" : " - not pre-authenticated" ) << std::endl;
+            auto infos = dz_wrapper.current_switch_infos();
+            std::cout << "switches : " << infos.switches << " - last one logged in after " << infos.login_ms
+                      << "ms, audio after " << infos.audio_ms << "ms" << std::endl;
+        }
+        else if ( c == 'h' )
+        {
+            std::string name;
+            std::cin >> name;
+            if ( !dz_wrapper.switch_profile( name ) )
+                std::cout << "cannot switch to profile " << name << std::endl;
+        }
+        else if ( c == 'z' )
+        {
+            auto infos = dz_wrapper.current_eq_infos();
+            std::cout << "equalizer zone : " << infos.preset << " (" << infos.bands << " bands, " << infos.kernel << ") - switches : " << infos.switches
+                      << " - cpu load : " << 100.f * infos.cpu_load << "% - worst block : " << infos.max_block_us << "us - latency : " << infos.latency_ms << "ms" << std::endl;
+            for ( const auto& zone : dz_wrapper.eq_presets() )
+                std::cout << "  " << zone << std::endl;
+        }
+        else if ( c == 'n' )
+        {
+            std::string zone;
+            std::cin >> zone;
+            if ( !dz_wrapper.set_eq_preset( zone ) )
+                std::cout << "cannot switch to equalizer zone " << zone << std::endl;
+        }
+        else if ( c == 'd' )
+        {
+            auto infos = dz_wrapper.current_schedule_infos();
+            if ( infos.next_content.empty() )
+                std::cout << "no daypart scheduled" << std::endl;
+            else
+                std::cout << "next daypart : " << infos.next_content << " in " << infos.next_in_s << "s - preload : " << infos.preload
+                          << " - transitions : " << infos.transitions << " - last audio start : " << infos.last_offset_ms
+                          << "ms from slot - load lead : " << infos.start_lead_ms << "ms" << std::endl;
+        }
+        else if ( c == 'c' )
+        {
+            auto infos = dz_wrapper.current_ad_infos();
+            std::cout << "ad breaks : " << infos.breaks << ( infos.in_break ? " (in break)" : "" ) << " - failures : " << infos.failures
+                      << " - ads played : " << infos.ads_ms / 1000 << "s - ad to music gap : " << infos.last_gap_ms
+                      << "ms (max " << infos.max_gap_ms << "ms)" << std::endl;
+        }
+        else if ( c == 'k' )
+            dz_wrapper.playback_like();
+        else if ( c == 'p' )
+        {
+            auto infos = dz_wrapper.current_skip_infos();
+            std::cout << "skip model : " << infos.model_entries << " artists and albums - skipped : " << infos.skipped
+                      << " - listened : " << infos.listened << " - predicted : " << infos.predicted
+                      << " - skipped before buffering : " << infos.pre_skipped << " - mispredicted : " << infos.mispredicted << std::endl;
+        }
+        else if ( c == 'a' )
+        {
+            auto infos = dz_wrapper.current_api_infos();
+            std::cout << "api pending actions : " << infos.pending_actions << " - sent : " << infos.sent_actions
+                      << " - requests : " << infos.requests << " - cache hits : " << infos.cache_hits
+                      << " - revalidations : " << infos.revalidations << " - cache : " << infos.cache_kB << "kB" << std::endl;
+        }
+        else if ( c == 'f' )
+        {
+            std::string query;
+            std::getline( std::cin >> std::ws, query );
+            auto results = dz_wrapper.library().search( query, 10 );
+            std::cout << results.size() << " results in " << results.micros() << "us (library : " << dz_wrapper.library().size() << " items)" << std::endl;
+            for ( size_t i = 0; i < results.size(); i++ )
+            {
+                auto item = results.at( i );
+                std::cout << "  " << item.title << " - " << item.subtitle << " : " << item.content_url() << std::endl;
+            }
+        }
+        else if ( c == 'b' )
+            library_benchmark();
+        else if ( c == 't' )
+        {
+            for ( const auto& thread : dz_wrapper.current_thread_infos() )
+                std::cout << "thread " << thread.tid << " " << thread.name << " [" << thread.placement << "] - cpu : " << thread.cpu_ms
+                          << "ms (" << 100.f * thread.cpu_load << "%) - involuntary switches : " << thread.involuntary_switches << std::endl;
+        }
+        else if ( c == 'm' )
+        {
+            auto report = memory_profile::sample();
+            std::cout << "memory RSS : " << report.rss_kB << "kB - peak : " << report.peak_rss_kB << "kB" << std::endl;
+            for ( const auto& mapping : report.mappings )
+                std::cout << "  " << mapping.subsystem << " : " << mapping.rss_kB << "kB (pss " << mapping.pss_kB << "kB)" << std::endl;
+            for ( const auto& heap : report.heap )
+                std::cout << "  heap " << heap.tag << " : " << heap.current_kB << "kB - peak : " << heap.peak_kB
+                          << "kB - allocations : " << heap.allocations << std::endl;
+        }
+        else if ( c == 'e' )
+        {
+            for ( const auto& record : dz_wrapper.recent_qoe_records() )
+                std::cout << "  track " << record.track_id << " " << record.format << " => " << record.end_reason << " after " << record.played_ms
+                          << "ms - first data : " << record.first_data_ms << "ms - first audio : " << record.first_audio_ms
+                          << "ms - stalls : " << record.stall_count << " (" << record.stall_ms << "ms) - seeks : " << record.seek_count
+                          << " (max " << record.seek_max_ms << "ms)" << std::endl;
+            auto infos = dz_wrapper.current_qoe_infos();
+            std::cout << "qoe over " << infos.tracks << " tracks - first data p50/p99 : " << infos.first_data_p50_ms << "/" << infos.first_data_p99_ms
+                      << "ms - first audio p50/p99 : " << infos.first_audio_p50_ms << "/" << infos.first_audio_p99_ms
+                      << "ms - seek p50/p99 : " << infos.seek_p50_ms << "/" << infos.seek_p99_ms
+                      << "ms - stall p50/p99 : " << infos.stall_p50_ms << "/" << infos.stall_p99_ms
+                      << "ms - stalled tracks : " << 100.f * infos.stalled_tracks << "% - stall ratio : " << 100.f * infos.stall_ratio
+                      << "% - skips : " << infos.skips << " - failures : " << infos.failures << std::endl;
+        }
+        else if ( c == 'y' )
+        {
+            if ( !sync )
+                std::cout << "room sync disabled (-leader <port> or -follow <host:port>)" << std::endl;
+            else
+            {
+                auto infos = sync->current_infos();
+                if ( infos.leader )
+                    std::cout << "room sync leader - followers : " << infos.followers << " - largest skew : " << infos.skew_ms << "ms" << std::endl;
+                else
+                    std::cout << "room sync follower " << std::string( infos.synced ? "synced" : "waiting for the leader" )
+                              << " - clock offset : " << infos.offset_us << "us (round trip " << infos.round_trip_ms
+                              << "ms) - skew : " << infos.skew_ms << "ms - corrections : " << infos.corrections
+                              << " - seek lead : " << infos.seek_lead_ms << "ms" << std::endl;
+            }
+        }
+        else if ( c == 'u' )
+        {
+            auto infos = dz_wrapper.current_queue_infos();
+            std::cout << "queue index : " << infos.index << " - next : " << infos.next.artist << " - " << infos.next.title
+                      << " - repeat : " << infos.repeat_mode << " - shuffle : " << std::string( infos.shuffle ? "on" : "off" ) << std::endl;
+        }
     }
 
-    dz_wrapper.playback_stop();
-    dz_wrapper.disconnect();
+    sync.reset();
+    auto infos = dz_wrapper.disconnect();
+    std::cout << "teardown : " << infos.total_ms << "ms" << std::string( infos.timed_out ? " (deactivation timed out)" : "" ) << std::endl;
+    return memory_profile::check_peak_rss( rss_budget ? std::atol( rss_budget ) : 0 ) ? 0 : 1;
 }